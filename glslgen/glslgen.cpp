@@ -22,6 +22,8 @@
 #include <cstdlib>
 #include <fstream>
 #include <filesystem>
+#include <map>
+#include <stdexcept>
 #include <tinyformat.h>
 #include <magic_enum/magic_enum.hpp>
 
@@ -68,25 +70,137 @@ const auto light_probe_struct = "struct LightProbe\n"
                                 "{\n"
                                 "    int enabled;\n"
                                 "    samplerCube environment;\n"
-                                "    samplerCube diffuse;\n"
                                 "    samplerCube specular;\n"
                                 "};\n";
 
+struct MemberSpec
+{
+    std::string  type;
+    std::string  id;
+    unsigned int size = 0; // 0 == scalar
+};
+
+struct StructSpec
+{
+    std::string             name;
+    std::vector<MemberSpec> members;
+};
+// structs usable in uniform blocks and storage buffers
+const auto structs = std::vector<StructSpec>{
+    {"LightData", {
+        {"vec4", "position"},  // xyz position, w range
+        {"vec4", "direction"}, // xyz direction, w type
+        {"vec4", "color"},
+        {"vec4", "angles"}
+    }}
+};
+
+struct BlockSpec
+{
+    pkzo::UniformBinding    binding;
+    std::string             name;
+    std::string             instance;
+    std::vector<MemberSpec> members;
+};
+const auto blocks = std::vector<BlockSpec>{
+    {pkzo::UniformBinding::FRAME, "FrameBlock", "blk_Frame", {
+        {"mat4",      "projection_matrix"},
+        {"mat4",      "view_matrix"},
+        {"mat4",      "inverse_view_projection_matrix"},
+        {"LightData", "lights", pkzo::MAX_LIGHTS},
+        {"ivec3",     "cluster_grid"},
+        {"vec2",      "cluster_tile_size"},
+        {"vec2",      "cluster_depth"},
+        {"vec4",      "light_probe_irradiance", pkzo::MAX_LIGHT_PROBES * pkzo::IRRADIANCE_COEFFICIENTS}, // rgb coefficients per probe
+        {"mat4",      "shadow_matrices", pkzo::MAX_SHADOW_VIEWS},
+        {"vec4",      "shadow_tiles", pkzo::MAX_SHADOW_VIEWS}, // texel offset, size and normal offset in the atlas
+        {"vec4",      "shadow_cascade_splits"}
+    }},
+    {pkzo::UniformBinding::MATERIAL, "MaterialBlock", "blk_Material", {
+        {"vec4",  "base_color_factor"},
+        {"vec3",  "emissive_factor"},
+        {"float", "metallic_factor"},
+        {"float", "roughness_factor"}
+    }},
+    {pkzo::UniformBinding::OBJECT, "ObjectBlock", "blk_Object", {
+        {"mat4", "model_matrix"},
+        {"int",  "instanced"}
+    }}
+};
+
+struct StorageSpec
+{
+    pkzo::StorageBinding binding;
+    std::string          block;
+    std::string          type;
+    std::string          id;
+};
+const auto storages = std::vector<StorageSpec>{
+    {pkzo::StorageBinding::CLUSTER_LIGHTS,        "ClusterLights",       "LightData", "ssb_ClusterLights"},
+    {pkzo::StorageBinding::CLUSTER_RANGES,        "ClusterRanges",       "uvec2",     "ssb_ClusterRanges"},
+    {pkzo::StorageBinding::CLUSTER_LIGHT_INDEXES, "ClusterLightIndexes", "uint",      "ssb_ClusterLightIndexes"}
+};
+
+// storage of an attribute in the interleaved packed vertex format
+struct PackedSpec
+{
+    std::string  id;
+    std::string  cpp_type;
+    unsigned int size       = 0;
+    unsigned int components = 0; // 0 == not packed
+    std::string  gl_type;
+    bool         normalized = false;
+};
 
 struct AttribSpec
 {
     pkzo::AttributeLocation location;
     std::string             type;
     std::string             id;
+    PackedSpec              packed;
 };
 const auto attributes = std::vector<AttribSpec>{
-        {pkzo::AttributeLocation::VERTEX,   "vec3", "atr_Vertex"},
-        {pkzo::AttributeLocation::NORMAL,   "vec3", "atr_Normal"},
-        {pkzo::AttributeLocation::TANGENT,  "vec3", "atr_Tangent"},
-        {pkzo::AttributeLocation::TEXCOORD, "vec2", "atr_TexCoord"},
-        {pkzo::AttributeLocation::COLOR,    "vec4", "atr_Color"}
+        {pkzo::AttributeLocation::VERTEX,   "vec3", "atr_Vertex",   {"vertex",   "uint64_t", 8, 3, "GL_UNSIGNED_SHORT", true}}, // relative to the mesh bounds
+        {pkzo::AttributeLocation::NORMAL,   "vec3", "atr_Normal",   {"normal",   "uint32_t", 4, 2, "GL_SHORT",          true}}, // octahedral
+        {pkzo::AttributeLocation::TANGENT,  "vec3", "atr_Tangent",  {"tangent",  "uint32_t", 4, 2, "GL_SHORT",          true}}, // octahedral
+        {pkzo::AttributeLocation::TEXCOORD, "vec2", "atr_TexCoord", {"texcoord", "uint32_t", 4, 2, "GL_HALF_FLOAT",     false}},
+        {pkzo::AttributeLocation::COLOR,    "vec4", "atr_Color",    {"color",    "uint32_t", 4, 4, "GL_UNSIGNED_BYTE",  true}},
+        {pkzo::AttributeLocation::INSTANCE_MODEL_MATRIX, "mat4", "atr_InstanceModelMatrix"}
     };
 
+// Per mesh values to decode the packed vertex format, declared with the
+// attributes since only vertex shaders read it.
+const auto mesh_block = BlockSpec{pkzo::UniformBinding::MESH, "MeshBlock", "blk_Mesh", {
+    {"vec4", "position_scale"},
+    {"vec4", "position_offset"},
+    {"int",  "packed"}
+}};
+
+const auto mesh_functions = "vec3 decode_octahedral(vec2 e)\n"
+                            "{\n"
+                            "    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+                            "    if (n.z < 0.0)\n"
+                            "    {\n"
+                            "        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);\n"
+                            "    }\n"
+                            "    return normalize(n);\n"
+                            "}\n"
+                            "\n"
+                            "vec3 get_vertex()\n"
+                            "{\n"
+                            "    return atr_Vertex * blk_Mesh.position_scale.xyz + blk_Mesh.position_offset.xyz;\n"
+                            "}\n"
+                            "\n"
+                            "vec3 get_normal()\n"
+                            "{\n"
+                            "    return blk_Mesh.packed != 0 ? decode_octahedral(atr_Normal.xy) : atr_Normal;\n"
+                            "}\n"
+                            "\n"
+                            "vec3 get_tangent()\n"
+                            "{\n"
+                            "    return blk_Mesh.packed != 0 ? decode_octahedral(atr_Tangent.xy) : atr_Tangent;\n"
+                            "}\n";
+
 struct UniformSpec
 {
     pkzo::UniformLocation location;
@@ -102,18 +216,20 @@ const auto uniforms = std::vector<UniformSpec>{
     // Material
     {pkzo::UniformLocation::BASE_COLOR_FACTOR,      "vec4",        "uni_BaseColorFactor"},
     {pkzo::UniformLocation::BASE_COLOR_MAP,         "sampler2D",   "uni_BaseColorMap"},
-    {pkzo::UniformLocation::METALLIC_FACTOR,        "float",       "uni_MetallicFactor"},
-    {pkzo::UniformLocation::ROUGHNESS_FACTOR,       "float",       "uni_RoughnessFactor"},
     {pkzo::UniformLocation::METALLIC_ROUGHNESS_MAP, "sampler2D",   "uni_MetallicRoughnessMap"},
     {pkzo::UniformLocation::NORMAL_MAP,             "sampler2D",   "uni_NormalMap"},
-    {pkzo::UniformLocation::EMISSIVE_FACTOR,        "vec3",        "uni_EmissiveFactor"},
     {pkzo::UniformLocation::EMISSIVE_MAP,           "sampler2D",   "uni_EmissiveMap"},
     // Light
-    {pkzo::UniformLocation::LIGHT0_TYPE,            "Light",       "uni_Light", pkzo::MAX_LIGHTS},
     {pkzo::UniformLocation::SHADOW_MAP,             "sampler2D",   "uni_ShadowMap"},
     // Skybox / Environment Lighting
     {pkzo::UniformLocation::ENVIRONMENT,            "samplerCube", "uni_Environment"},
     {pkzo::UniformLocation::LIGHT_PROBE0_ENABLED,   "LightProbe",  "uni_LightProbes", pkzo::MAX_LIGHT_PROBES},
+    // Deferred Shading
+    {pkzo::UniformLocation::GBUFFER_BASE_COLOR,         "sampler2D", "uni_GBufferBaseColor"},
+    {pkzo::UniformLocation::GBUFFER_NORMAL,             "sampler2D", "uni_GBufferNormal"},
+    {pkzo::UniformLocation::GBUFFER_METALLIC_ROUGHNESS, "sampler2D", "uni_GBufferMetallicRoughness"},
+    {pkzo::UniformLocation::GBUFFER_EMISSIVE,           "sampler2D", "uni_GBufferEmissive"},
+    {pkzo::UniformLocation::GBUFFER_DEPTH,              "sampler2D", "uni_GBufferDepth"},
     // Texture / Cubemap Generation & Filter
     {pkzo::UniformLocation::MIPLEVEL,               "int",         "uni_MipLevel"},
     {pkzo::UniformLocation::TEXTURE,                "sampler2D",   "uni_Texture"},
@@ -121,6 +237,102 @@ const auto uniforms = std::vector<UniformSpec>{
     {pkzo::UniformLocation::CUBEMAP_TBN,            "mat3",        "uni_CubemapTBN"}
 };
 
+// std140 layout of the types usable in blocks
+struct TypeSpec
+{
+    std::string  cpp_type;
+    unsigned int alignment;
+    unsigned int size;
+};
+const auto types = std::map<std::string, TypeSpec>{
+    {"int",       {"int32_t",    4u,  4u}},
+    {"uint",      {"uint32_t",   4u,  4u}},
+    {"float",     {"float",      4u,  4u}},
+    {"vec2",      {"glm::vec2",  8u,  8u}},
+    {"ivec2",     {"glm::ivec2", 8u,  8u}},
+    {"uvec2",     {"glm::uvec2", 8u,  8u}},
+    {"vec3",      {"glm::vec3",  16u, 12u}},
+    {"ivec3",     {"glm::ivec3", 16u, 12u}},
+    {"vec4",      {"glm::vec4",  16u, 16u}},
+    {"ivec4",     {"glm::ivec4", 16u, 16u}},
+    {"mat4",      {"glm::mat4",  16u, 64u}},
+    {"LightData", {"LightData",  16u, 64u}}
+};
+
+unsigned int align_up(unsigned int value, unsigned int alignment)
+{
+    return (value + alignment - 1u) / alignment * alignment;
+}
+
+std::string make_glsl_members(const std::vector<MemberSpec>& members)
+{
+    auto result = std::string{};
+    for (const auto& member : members)
+    {
+        if (member.size == 0)
+        {
+            result += tfm::format("    %s %s;\n", member.type, member.id);
+        }
+        else
+        {
+            result += tfm::format("    %s %s[%d];\n", member.type, member.id, member.size);
+        }
+    }
+    return result;
+}
+
+// C++ struct with explicit padding to match std140 and asserts to check it
+std::string make_cpp_struct(const std::string& name, const std::vector<MemberSpec>& members)
+{
+    auto fields  = std::string{};
+    auto asserts = std::string{};
+    auto offset  = 0u;
+    auto padding = 0u;
+
+    for (const auto& member : members)
+    {
+        const auto& type = types.at(member.type);
+
+        auto alignment = member.size == 0 ? type.alignment : align_up(type.alignment, 16u);
+        auto size      = type.size;
+        if (member.size != 0)
+        {
+            if (type.size % 16u != 0u)
+            {
+                throw std::runtime_error(tfm::format("Array %s.%s needs a 16 byte element size.", name, member.id));
+            }
+            size = type.size * member.size;
+        }
+
+        auto aligned = align_up(offset, alignment);
+        if (aligned != offset)
+        {
+            fields += tfm::format("        uint8_t _pad%d[%d];\n", padding++, aligned - offset);
+        }
+
+        if (member.size == 0)
+        {
+            fields += tfm::format("        %s %s;\n", type.cpp_type, member.id);
+        }
+        else
+        {
+            fields += tfm::format("        %s %s[%d];\n", type.cpp_type, member.id, member.size);
+        }
+        asserts += tfm::format("    static_assert(offsetof(%s, %s) == %d);\n", name, member.id, aligned);
+
+        offset = aligned + size;
+    }
+
+    auto total = align_up(offset, 16u);
+    if (total != offset)
+    {
+        fields += tfm::format("        uint8_t _pad%d[%d];\n", padding++, total - offset);
+    }
+    asserts += tfm::format("    static_assert(sizeof(%s) == %d);\n", name, total);
+
+    return tfm::format("    struct %s\n    {\n%s    };\n%s", name, fields, asserts);
+}
+
 void write_file(const std::filesystem::path& filename, const std::string& contents)
 {
     auto output = std::ofstream(filename);
@@ -137,6 +349,12 @@ void make_attribute_glsl(const std::filesystem::path& filename)
     {
         output << tfm::format("layout(location = %d) in %s %s;\n", std::to_underlying(attribute.location), attribute.type, attribute.id);
     }
+    output << "\n";
+
+    output << tfm::format("layout(std140, binding = %d) uniform %s\n{\n%s} %s;\n", std::to_underlying(mesh_block.binding), mesh_block.name, make_glsl_members(mesh_block.members), mesh_block.instance);
+    output << "\n";
+
+    output << mesh_functions;
 }
 
 void make_uniforms_glsl(const std::filesystem::path& filename)
@@ -152,6 +370,10 @@ void make_uniforms_glsl(const std::filesystem::path& filename)
     }
     output << "\n";
     output << tfm::format("#define MAX_LIGHT_PROBES %d\n", pkzo::MAX_LIGHT_PROBES);
+    output << tfm::format("#define IRRADIANCE_COEFFICIENTS %d\n", pkzo::IRRADIANCE_COEFFICIENTS);
+    output << tfm::format("#define SPECULAR_MIP_LEVELS %d\n", pkzo::SPECULAR_MIP_LEVELS);
+    output << tfm::format("#define SHADOW_CASCADES %d\n", pkzo::SHADOW_CASCADES);
+    output << tfm::format("#define MAX_SHADOW_VIEWS %d\n", pkzo::MAX_SHADOW_VIEWS);
     output << "\n";
     for (auto lt : magic_enum::enum_values<pkzo::CubeFace>())
     {
@@ -165,6 +387,11 @@ void make_uniforms_glsl(const std::filesystem::path& filename)
     output << light_probe_struct;
     output << "\n";
 
+    for (const auto& st : structs)
+    {
+        output << tfm::format("struct %s\n{\n%s};\n", st.name, make_glsl_members(st.members));
+        output << "\n";
+    }
 
     for (const auto& uniform : uniforms)
     {
@@ -177,6 +404,140 @@ void make_uniforms_glsl(const std::filesystem::path& filename)
             output << tfm::format("layout(location = %d) uniform %s %s[%d];\n", std::to_underlying(uniform.location), uniform.type, uniform.id, uniform.size);
         }
     }
+    output << "\n";
+
+    for (const auto& block : blocks)
+    {
+        output << tfm::format("layout(std140, binding = %d) uniform %s\n{\n%s} %s;\n", std::to_underlying(block.binding), block.name, make_glsl_members(block.members), block.instance);
+        output << "\n";
+    }
+
+    for (const auto& storage : storages)
+    {
+        output << tfm::format("layout(std430, binding = %d) readonly buffer %s { %s %s[]; };\n", std::to_underlying(storage.binding), storage.block, storage.type, storage.id);
+    }
+}
+
+void make_uniform_blocks_h(const std::filesystem::path& filename)
+{
+    auto output = std::ofstream(filename);
+
+    output << legal;
+
+    output << "#pragma once\n"
+              "\n"
+              "#include <cstddef>\n"
+              "#include <cstdint>\n"
+              "\n"
+              "#include <glm/glm.hpp>\n"
+              "\n"
+              "namespace pkzo\n"
+              "{\n";
+
+    auto cpp_structs = std::vector<std::string>{};
+    for (const auto& st : structs)
+    {
+        cpp_structs.push_back(make_cpp_struct(st.name, st.members));
+    }
+    for (const auto& block : blocks)
+    {
+        cpp_structs.push_back(make_cpp_struct(block.name, block.members));
+    }
+    cpp_structs.push_back(make_cpp_struct(mesh_block.name, mesh_block.members));
+
+    for (auto i = 0u; i < cpp_structs.size(); i++)
+    {
+        output << (i == 0u ? "" : "\n") << cpp_structs[i];
+    }
+
+    output << "}\n";
+}
+
+// interleaved vertex, members in attribute order
+void make_packed_vertex_h(const std::filesystem::path& filename)
+{
+    auto output = std::ofstream(filename);
+
+    output << legal;
+
+    output << "#pragma once\n"
+              "\n"
+              "#include <cstddef>\n"
+              "#include <cstdint>\n"
+              "\n"
+              "namespace pkzo\n"
+              "{\n";
+
+    auto fields  = std::string{};
+    auto asserts = std::string{};
+    auto offset  = 0u;
+    for (const auto& attribute : attributes)
+    {
+        if (attribute.packed.components == 0)
+        {
+            continue;
+        }
+
+        if (offset % attribute.packed.size != 0u)
+        {
+            throw std::runtime_error(tfm::format("Packed attribute %s is not aligned.", attribute.id));
+        }
+
+        fields  += tfm::format("        %s %s;\n", attribute.packed.cpp_type, attribute.packed.id);
+        asserts += tfm::format("    static_assert(offsetof(PackedVertex, %s) == %d);\n", attribute.packed.id, offset);
+        offset += attribute.packed.size;
+    }
+    asserts += tfm::format("    static_assert(sizeof(PackedVertex) == %d);\n", align_up(offset, 8u));
+
+    output << tfm::format("    struct PackedVertex\n    {\n%s    };\n%s", fields, asserts);
+
+    output << "}\n";
+}
+
+// vertex array formats of the packed attributes
+void make_packed_attributes_h(const std::filesystem::path& filename)
+{
+    auto output = std::ofstream(filename);
+
+    output << legal;
+
+    output << "#pragma once\n"
+              "\n"
+              "#include <array>\n"
+              "#include <cstddef>\n"
+              "\n"
+              "#include <GL/glew.h>\n"
+              "\n"
+              "#include \"PackedVertex.h\"\n"
+              "\n"
+              "namespace pkzo\n"
+              "{\n"
+              "    struct PackedAttribute\n"
+              "    {\n"
+              "        GLuint    location;\n"
+              "        GLint     components;\n"
+              "        GLenum    type;\n"
+              "        GLboolean normalized;\n"
+              "        GLuint    offset;\n"
+              "    };\n"
+              "\n";
+
+    auto entries = std::string{};
+    auto count   = 0u;
+    for (const auto& attribute : attributes)
+    {
+        if (attribute.packed.components == 0)
+        {
+            continue;
+        }
+
+        entries += tfm::format("%s        {%d, %d, %s, %s, offsetof(PackedVertex, %s)}", count == 0u ? "" : ",\n", std::to_underlying(attribute.location), attribute.packed.components, attribute.packed.gl_type, attribute.packed.normalized ? "GL_TRUE" : "GL_FALSE", attribute.packed.id);
+        count++;
+    }
+
+    output << tfm::format("    constexpr auto PACKED_ATTRIBUTES = std::array<PackedAttribute, %d>{{\n%s\n    }};\n", count, entries);
+
+    output << "}\n";
 }
 
 void make_outputs_glsl(const std::filesystem::path& filename)
@@ -213,6 +574,18 @@ int main(int argc, const char* argv[])
                 tfm::printf("Generating %s\n", filename);
                 make_uniforms_glsl(path);
                 break;
+            case stdng::hash("UniformBlocks.h"):
+                tfm::printf("Generating %s\n", filename);
+                make_uniform_blocks_h(path);
+                break;
+            case stdng::hash("PackedVertex.h"):
+                tfm::printf("Generating %s\n", filename);
+                make_packed_vertex_h(path);
+                break;
+            case stdng::hash("PackedAttributes.h"):
+                tfm::printf("Generating %s\n", filename);
+                make_packed_attributes_h(path);
+                break;
             case stdng::hash("outputs.glsl"):
                 tfm::printf("Generating %s\n", filename);
                 make_outputs_glsl(path);
@@ -43,7 +43,7 @@ namespace lab
     App::App(int argc, char* argv[])
     {
         pkzo::on_quit([this] () { state_machine.queue_state(State::END); });
-        pkzo::on_input([this] (auto event) { state_machine.send_event(event); });
+        pkzo::on_input([this] (auto event) { handle_debug_input(event); state_machine.send_event(event); });
 
         settings = std::make_unique<Settings>();
         auto settings_file = get_user_folder() / "settings.yml";
@@ -53,17 +53,26 @@ namespace lab
         }
 
         window = std::make_unique<pkzo::Window>(pkzo::Window::Init{
-            .title = "pkzo Island Demo",
-            .size  = settings->get("Window", "size", glm::uvec2(800u, 600u)),
-            .state = settings->get("Window", "fullscreen", false) ? pkzo::WindowState::FULLSCREEN : pkzo::WindowState::WINDOW,
+            .title         = "pkzo Island Demo",
+            .size          = settings->get("Window", "size", glm::uvec2(800u, 600u)),
+            .state         = settings->get("Window", "fullscreen", false) ? pkzo::WindowState::FULLSCREEN : pkzo::WindowState::WINDOW,
+            .shader_cache  = get_user_folder() / "shaders",
+            .cubemap_cache = get_user_folder() / "cubemaps",
+            .vertex_format = settings->get("Renderer", "packed_vertexes", false) ? pkzo::VertexFormat::PACKED : pkzo::VertexFormat::FLOAT,
         });
         window->on_draw([this] (auto& gc) { handle_draw(gc); });
 
+        if (settings->get("Renderer", "render_thread", false))
+        {
+            render_thread = std::make_unique<pkzo::RenderThread>(*window);
+        }
+
         if (settings->get("Debug", "overlay", false) || pkzo::is_debugger_present())
         {
             debug_overlay = std::make_unique<DebugOverlay>(DebugOverlay::Init{
                 .size = glm::vec2(window->get_resolution())
             });
+            trace_key = settings->get("Debug", "trace_key", pkzo::ScanCode::F12);
         }
 
         // Main Menu State
@@ -106,13 +115,16 @@ namespace lab
 
         // Play
         state_machine.on_enter(State::PLAY, [this] (const auto& id) {
+            const auto init = pkzo::Scene::Init{
+                .render_thread = render_thread != nullptr
+            };
             if (std::any_cast<std::string>(id) == "materials")
             {
-                scene = std::make_unique<MaterialTestScene>();
+                scene = std::make_unique<MaterialTestScene>(init);
             }
             else if (std::any_cast<std::string>(id) == "physics")
             {
-                scene = std::make_unique<PhysicsTestScene>();
+                scene = std::make_unique<PhysicsTestScene>(init);
             }
             else
             {
@@ -120,6 +132,11 @@ namespace lab
                 state_machine.queue_state(State::MAIN_MENU);
                 return;
             }
+            if (settings->get("Renderer", "deferred", false))
+            {
+                scene->get_renderer()->set_render_mode(pkzo::SceneRenderer::RenderMode::DEFERRED);
+            }
+            scene->get_renderer()->set_occlusion_culling(settings->get("Renderer", "occlusion_culling", false));
             pawn = scene->add<Pawn>({
                 .fore_key     = settings->get("Pawn", "fore_key",     pkzo::ScanCode::W),
                 .back_key     = settings->get("Pawn", "back_key",     pkzo::ScanCode::S),
@@ -132,7 +149,11 @@ namespace lab
             });
         });
         state_machine.on_tick(State::PLAY, [this] (float dt) {
-            scene->update(dt);
+            // with a render thread the scene is updated while the last frame is drawn
+            if (!render_thread)
+            {
+                scene->update(dt);
+            }
         });
         state_machine.on_event(State::PLAY, [this] (auto event) {
             pawn->handle_input(event);
@@ -147,7 +168,8 @@ namespace lab
 
     App::~App()
     {
-        window = nullptr;
+        render_thread = nullptr;
+        window        = nullptr;
     }
 
     void App::run()
@@ -158,10 +180,36 @@ namespace lab
             auto dt  = std::chrono::duration_cast<fsec>(now - last_tick).count();
             last_tick = now;
 
-            pkzo::route_events();
-            state_machine.tick(dt); // screen & sceen are updated inside the state_machine
-            if (debug_overlay) debug_overlay->update(dt);
-            window->draw();
+            if (render_thread)
+            {
+                // The frame is drawn while the scene is updated, the scene
+                // draws the snapshot of the previous update. Everything else
+                // is only changed while no frame is drawn.
+                render_thread->wait();
+                pkzo::route_events();
+                state_machine.tick(dt); // screen & sceen are updated inside the state_machine
+                if (debug_overlay) debug_overlay->update(dt);
+                render_thread->draw();
+                if (scene) scene->update(dt);
+            }
+            else
+            {
+                pkzo::route_events();
+                state_machine.tick(dt); // screen & sceen are updated inside the state_machine
+                if (debug_overlay) debug_overlay->update(dt);
+                window->draw();
+            }
+        }
+
+        if (render_thread) render_thread->wait();
+    }
+
+    void App::handle_debug_input(const pkzo::InputEvent& event)
+    {
+        auto key = std::get_if<pkzo::KeyDownEvent>(&event);
+        if (debug_overlay && key != nullptr && key->scan == trace_key)
+        {
+            trace_requested = true;
         }
     }
 
@@ -169,6 +217,18 @@ namespace lab
     {
         if (scene)         scene->draw(gc);
         if (screen)        screen->draw(gc);
-        if (debug_overlay) debug_overlay->draw(gc);
+        if (debug_overlay)
+        {
+            debug_overlay->show_profile(gc);
+            debug_overlay->draw(gc);
+        }
+
+        if (trace_requested)
+        {
+            auto file = get_user_folder() / "trace.json";
+            gc.get_profiler().save_chrome_trace(file);
+            pkzo::trace(tfm::format("Saved frame trace to %s.", file));
+            trace_requested = false;
+        }
     }
 }
@@ -58,14 +58,18 @@ namespace lab
 
         std::unique_ptr<Settings>       settings;
         std::unique_ptr<pkzo::Window>   window;
+        std::unique_ptr<pkzo::RenderThread> render_thread;
 
         std::unique_ptr<pkzo::Screen>   screen;
         std::unique_ptr<pkzo::Scene>    scene;
         Pawn*                           pawn = nullptr;
         std::unique_ptr<DebugOverlay>   debug_overlay;
+        pkzo::ScanCode                  trace_key       = pkzo::ScanCode::F12;
+        bool                            trace_requested = false;
 
         rex::StateMachine<State, InputEvent> state_machine;
 
+        void handle_debug_input(const pkzo::InputEvent& event);
         void handle_draw(pkzo::GraphicContext& gc);
     };
 }
@@ -24,6 +24,9 @@ namespace lab
     constexpr auto LOG_LIFE      = 5s;
     constexpr auto LOG_FADE      = 1s;
 
+    constexpr auto PROFILE_INTERVAL = 1s;
+    constexpr auto PROFILE_OFFSET   = 20.0f;
+
     DebugOverlay::DebugOverlay(Init init)
     : Screen({init.size})
     {
@@ -38,14 +41,19 @@ namespace lab
         log_font_size  = ui_style.get<unsigned int>("text", "font_size");
         log_color      = ui_style.get<pkzo::color4>("log", "text_color");
 
+        text_font      = pkzo::Font::load(base / ui_style.get<std::string>("text", "font"));
+        text_font_size = ui_style.get<unsigned int>("text", "font_size");
+        text_color     = ui_style.get<pkzo::color4>("text", "text_color");
+
         fps_counter = add<Text>({
             .transform = position(half_size.x - 70.0f, half_size.y - 30.0f),
             .text      = u8"00.00 fps",
-            .color     = ui_style.get<pkzo::color4>("text", "text_color"),
-            .font      = pkzo::Font::load(base / ui_style.get<std::string>("text", "font")),
-            .font_size = ui_style.get<unsigned int>("text", "font_size")
+            .color     = text_color,
+            .font      = text_font,
+            .font_size = text_font_size
         });
-        last_fps_count = std::chrono::steady_clock::now();
+        last_fps_count      = std::chrono::steady_clock::now();
+        last_profile_update = last_fps_count;
     }
 
     void DebugOverlay::update(float dt)
@@ -73,6 +81,69 @@ namespace lab
         }
     }
 
+    void DebugOverlay::show_profile(const pkzo::GraphicContext& gc)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_profile_update < PROFILE_INTERVAL)
+        {
+            return;
+        }
+        last_profile_update = now;
+
+        const auto& profiler = gc.get_profiler();
+        const auto& stats    = gc.get_render_stats();
+
+        auto frame = profiler.get_frame_stats();
+        auto lines = std::vector<std::string>{
+            tfm::format("%-16s     %6.2f ms                 p95 %6.2f ms", "Frame", frame.average, frame.p95)
+        };
+        for (const auto& pass : profiler.get_pass_stats())
+        {
+            // the software context has no GPU times
+            if (pass.gpu_samples > 0u)
+            {
+                lines.push_back(tfm::format("%-16s cpu %6.2f ms  gpu %6.2f ms  p95 %6.2f ms", pass.name, pass.cpu.average, pass.gpu.average, pass.gpu.p95));
+            }
+            else
+            {
+                lines.push_back(tfm::format("%-16s cpu %6.2f ms                 p95 %6.2f ms", pass.name, pass.cpu.average, pass.cpu.p95));
+            }
+        }
+        lines.push_back(tfm::format("%d draws  %d triangles  %d lines", stats.draws, stats.triangles, stats.lines));
+        lines.push_back(tfm::format("%d uniforms  %d textures  %d shaders bound", stats.uniforms, stats.texture_binds, stats.shader_binds));
+        lines.push_back(tfm::format("%.1f KiB buffers  %.1f KiB textures uploaded", stats.buffer_bytes / 1024.0, stats.texture_bytes / 1024.0));
+        lines.push_back(tfm::format("%d textures  %d meshes cached", stats.textures, stats.meshes));
+
+        while (profile_lines.size() > lines.size())
+        {
+            remove(profile_lines.back());
+            profile_lines.pop_back();
+        }
+        while (profile_lines.size() < lines.size())
+        {
+            profile_lines.push_back(add<Text>({
+                .text      = u8" ",
+                .color     = text_color,
+                .font      = text_font,
+                .font_size = text_font_size
+            }));
+        }
+
+        // right aligned below the fps counter
+        auto half_size = get_size() / 2.0f;
+        auto pos       = glm::vec2(half_size.x - 30.0f, half_size.y - 60.0f);
+        for (auto i = 0u; i < lines.size(); i++)
+        {
+            auto widget = profile_lines[i];
+            widget->set_text(strconv::utf8(lines[i]));
+
+            auto whs = widget->get_size() / 2.0f;
+            widget->set_transform(position(pos.x - whs.x, pos.y - whs.y));
+
+            pos.y -= PROFILE_OFFSET;
+        }
+    }
+
     void DebugOverlay::prune_log_lines(bool inserting)
     {
         auto changed = inserting;
@@ -41,6 +41,9 @@ namespace lab
 
         void update(float dt) override;
 
+        //! Show the pass timings and render statistics, refreshed once per second.
+        void show_profile(const pkzo::GraphicContext& gc);
+
     private:
         using time_point = std::chrono::steady_clock::time_point;
 
@@ -48,6 +51,12 @@ namespace lab
         time_point  last_fps_count;
         size_t      frame_count = 0;
 
+        std::vector<pkzo::Text*>    profile_lines;
+        time_point                  last_profile_update;
+        std::shared_ptr<pkzo::Font> text_font;
+        unsigned int                text_font_size;
+        glm::vec4                   text_color;
+
         struct LogLine
         {
             time_point  time;
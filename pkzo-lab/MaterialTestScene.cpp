@@ -25,7 +25,8 @@
 
 namespace lab
 {
-    MaterialTestScene::MaterialTestScene()
+    MaterialTestScene::MaterialTestScene(pkzo::Scene::Init init)
+    : Scene(init)
     {
         constexpr auto MATERIAL_PER_ROW = 5u;
 
@@ -43,7 +44,8 @@ namespace lab
         // TODO get light dir and color from env
         add<pkzo::DirectionalLight>({
             .transform    = pkzo::lookat(glm::vec3(0.4f, 0.5f, 1.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
-            .color     = glm::vec3(0.55, 0.58, 0.65)
+            .color        = glm::vec3(0.55, 0.58, 0.65),
+            .cast_shadows = true
         });
 
         auto materials = std::vector<std::shared_ptr<pkzo::Material>>{};
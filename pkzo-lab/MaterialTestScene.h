@@ -28,7 +28,7 @@ namespace lab
     class MaterialTestScene : public pkzo::Scene
     {
     public:
-        MaterialTestScene();
+        MaterialTestScene(pkzo::Scene::Init init);
 
     private:
 
@@ -26,7 +26,8 @@
 
 namespace lab
 {
-    PhysicsTestScene::PhysicsTestScene()
+    PhysicsTestScene::PhysicsTestScene(pkzo::Scene::Init init)
+    : Scene(init)
     {
         auto base = get_asset_folder();
 
@@ -28,7 +28,7 @@ namespace lab
     class PhysicsTestScene : public pkzo::Scene
     {
     public:
-        PhysicsTestScene();
+        PhysicsTestScene(pkzo::Scene::Init init);
 
     private:
 
@@ -125,9 +125,9 @@ namespace pkzo::test
     }
 
     inline
-    AssertionResult compare_texture_reference(const char* expression, const char* abs_error_expr, const std::shared_ptr<Texture>& value, float abs_error)
+    AssertionResult compare_named_texture_reference(const char* name_expression, const char* expression, const char* abs_error_expr, const std::string& name, const std::shared_ptr<Texture>& value, float abs_error)
     {
-        auto ref_name = get_test_name() + "-ref.png";
+        auto ref_name = name + "-ref.png";
         auto ref_file = get_test_references() / ref_name;
 
         if (!std::filesystem::exists(ref_file))
@@ -145,6 +145,12 @@ namespace pkzo::test
 
         return compare_images(ref_name.data(), expression, abs_error_expr, ref_value, value, abs_error);
     }
+
+    inline
+    AssertionResult compare_texture_reference(const char* expression, const char* abs_error_expr, const std::shared_ptr<Texture>& value, float abs_error)
+    {
+        return compare_named_texture_reference("", expression, abs_error_expr, get_test_name(), value, abs_error);
+    }
 }
 
 #define EXPECT_TEXTURE_NEAR(val1, val2, abs_error) EXPECT_PRED_FORMAT3(::pkzo::test::compare_texture, val1, val2, abs_error)
@@ -156,3 +162,7 @@ namespace pkzo::test
 #define ASSERT_TEXTURE_REF_NEAR(val, abs_error) ASSERT_PRED_FORMAT2(::pkzo::test::compare_texture_reference, val, abs_error)
 #define EXPECT_TEXTURE_REF_EQ(val) EXPECT_TEXTURE_REF_NEAR(val, 0.0f)
 #define ASSERT_TEXTURE_REF_EQ(val) ASSERT_TEXTURE_REF_NEAR(val, 0.0f)
+
+// compares against the reference of another test, named suite-test
+#define EXPECT_TEXTURE_NAMED_REF_NEAR(name, val, abs_error) EXPECT_PRED_FORMAT3(::pkzo::test::compare_named_texture_reference, name, val, abs_error)
+#define ASSERT_TEXTURE_NAMED_REF_NEAR(name, val, abs_error) ASSERT_PRED_FORMAT3(::pkzo::test::compare_named_texture_reference, name, val, abs_error)
@@ -0,0 +1,91 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <pkzo/CommandBuffer.h>
+#include <pkzo/WorkerPool.h>
+
+TEST(command_buffer, sorts_by_key)
+{
+    auto commands = pkzo::CommandBuffer();
+    commands.draw(3u, 0u, 0u, glm::mat4(1.0f));
+    commands.draw(1u, 1u, 0u, glm::mat4(1.0f));
+    commands.draw(0x100000000u, 2u, 0u, glm::mat4(1.0f));
+    commands.draw(1u, 3u, 0u, glm::mat4(1.0f));
+    commands.sort();
+
+    const auto& sorted = commands.get_commands();
+    ASSERT_EQ(4u, sorted.size());
+    EXPECT_EQ(1u, sorted[0].state);
+    EXPECT_EQ(3u, sorted[1].state);
+    EXPECT_EQ(0u, sorted[2].state);
+    EXPECT_EQ(2u, sorted[3].state);
+}
+
+TEST(command_buffer, append)
+{
+    auto a = pkzo::CommandBuffer();
+    a.draw(0u, 0u, 1u, glm::mat4(1.0f));
+
+    auto b = pkzo::CommandBuffer();
+    b.draw(0u, 1u, 2u, glm::mat4(2.0f));
+    b.draw(0u, 2u, 3u, glm::mat4(3.0f));
+
+    a.append(b);
+    ASSERT_EQ(3u, a.get_size());
+    EXPECT_EQ(2u, a.get_commands()[1].mesh);
+    EXPECT_EQ(glm::mat4(3.0f), a.get_commands()[2].transform);
+
+    a.clear();
+    EXPECT_TRUE(a.empty());
+}
+
+TEST(command_buffer, records_in_parallel)
+{
+    constexpr auto COUNT = size_t{10000u};
+    constexpr auto JOBS  = size_t{8u};
+
+    auto workers   = pkzo::WorkerPool(3u);
+    auto recorders = std::vector<pkzo::CommandBuffer>(JOBS);
+    EXPECT_EQ(4u, workers.get_thread_count());
+
+    workers.parallel_for(JOBS, [&] (size_t job) {
+        for (auto i = COUNT * job / JOBS; i < COUNT * (job + 1u) / JOBS; i++)
+        {
+            // reverse order, to be sorted back
+            recorders[job].draw(COUNT - i, static_cast<uint32_t>(i), 0u, glm::mat4(1.0f));
+        }
+    });
+
+    auto commands = pkzo::CommandBuffer();
+    for (const auto& recorder : recorders)
+    {
+        commands.append(recorder);
+    }
+    commands.sort();
+
+    const auto& sorted = commands.get_commands();
+    ASSERT_EQ(COUNT, sorted.size());
+    for (auto i = size_t{0u}; i < COUNT; i++)
+    {
+        EXPECT_EQ(COUNT - 1u - i, sorted[i].state);
+    }
+}
@@ -0,0 +1,123 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <pkzo/pkzo.h>
+
+namespace
+{
+    std::filesystem::path make_cache_directory(const std::string& name)
+    {
+        auto directory = std::filesystem::temp_directory_path() / "pkzo-test" / name;
+        std::filesystem::remove_all(directory);
+        return directory;
+    }
+
+    pkzo::CubeMapData make_cubemap_data()
+    {
+        auto data = pkzo::CubeMapData{
+            .id        = "Test Cubemap",
+            .size      = 4u,
+            .data_type = pkzo::DataType::FLOAT,
+            .miplevels = 2u
+        };
+
+        for (auto face = 0u; face < 6u; face++)
+        {
+            for (auto mip = 0u; mip < data.miplevels; mip++)
+            {
+                auto& image = data.images.emplace_back();
+                image.size  = data.size >> mip;
+                image.pixels.resize(image.size * image.size * sizeof(glm::vec3), std::byte(face * 16u + mip));
+            }
+        }
+
+        return data;
+    }
+}
+
+TEST(content_hash, is_fnv1a)
+{
+    auto empty = pkzo::ContentHash{};
+    EXPECT_EQ(14695981039346656037ull, empty.get());
+
+    auto hash = pkzo::ContentHash{};
+    hash.add("a");
+    EXPECT_EQ(0xaf63dc4c8601ec8cull, hash.get());
+
+    auto seeded = pkzo::ContentHash{1u};
+    seeded.add("a");
+    EXPECT_NE(hash.get(), seeded.get());
+}
+
+TEST(cubemap_cache, stores_and_loads)
+{
+    auto cache = pkzo::CubeMapCache(make_cache_directory("stores_and_loads"));
+    ASSERT_TRUE(cache.is_enabled());
+
+    auto data = make_cubemap_data();
+    cache.store(42u, data);
+
+    auto loaded = cache.load(42u);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(data.id,         loaded->id);
+    EXPECT_EQ(data.size,       loaded->size);
+    EXPECT_EQ(data.data_type,  loaded->data_type);
+    EXPECT_EQ(data.color_mode, loaded->color_mode);
+    EXPECT_EQ(data.miplevels,  loaded->miplevels);
+    ASSERT_EQ(data.images.size(), loaded->images.size());
+    for (auto i = 0u; i < data.images.size(); i++)
+    {
+        EXPECT_EQ(data.images[i].size,   loaded->images[i].size);
+        EXPECT_EQ(data.images[i].pixels, loaded->images[i].pixels);
+    }
+
+    EXPECT_FALSE(cache.load(43u).has_value());
+}
+
+TEST(cubemap_cache, disabled_without_directory)
+{
+    auto cache = pkzo::CubeMapCache();
+    EXPECT_FALSE(cache.is_enabled());
+
+    cache.store(42u, make_cubemap_data());
+    EXPECT_FALSE(cache.load(42u).has_value());
+}
+
+TEST(cubemap_cache, ignores_damaged_files)
+{
+    auto directory = make_cache_directory("ignores_damaged_files");
+    auto cache     = pkzo::CubeMapCache(directory);
+    cache.store(42u, make_cubemap_data());
+
+    ASSERT_EQ(1, std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator()));
+    auto file = std::filesystem::directory_iterator(directory)->path();
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) / 2u);
+    EXPECT_FALSE(cache.load(42u).has_value());
+
+    {
+        auto output = std::ofstream(file, std::ios::binary | std::ios::trunc);
+        output << "PKZOSHB1 not a cube map";
+    }
+    EXPECT_FALSE(cache.load(42u).has_value());
+}
@@ -0,0 +1,46 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <pkzo/Frustum.h>
+
+TEST(frustum, intersects)
+{
+    auto projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    auto view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+    auto frustum    = pkzo::Frustum(projection * view);
+
+    auto unit = glm::vec3(0.5f);
+
+    // in front
+    EXPECT_TRUE(frustum.intersects(pkzo::Bounds3(glm::vec3(10.0f, 0.0f, 0.0f) - unit, glm::vec3(10.0f, 0.0f, 0.0f) + unit)));
+    // behind
+    EXPECT_FALSE(frustum.intersects(pkzo::Bounds3(glm::vec3(-10.0f, 0.0f, 0.0f) - unit, glm::vec3(-10.0f, 0.0f, 0.0f) + unit)));
+    // beyond far plane
+    EXPECT_FALSE(frustum.intersects(pkzo::Bounds3(glm::vec3(200.0f, 0.0f, 0.0f) - unit, glm::vec3(200.0f, 0.0f, 0.0f) + unit)));
+    // outside left
+    EXPECT_FALSE(frustum.intersects(pkzo::Bounds3(glm::vec3(10.0f, 20.0f, 0.0f) - unit, glm::vec3(10.0f, 20.0f, 0.0f) + unit)));
+    // straddling the left plane
+    EXPECT_TRUE(frustum.intersects(pkzo::Bounds3(glm::vec3(10.0f, 10.2f, 0.0f) - unit, glm::vec3(10.0f, 10.2f, 0.0f) + unit)));
+    // containing the camera
+    EXPECT_TRUE(frustum.intersects(pkzo::Bounds3(glm::vec3(-1000.0f), glm::vec3(1000.0f))));
+}
@@ -0,0 +1,166 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <array>
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <pkzo/pkzo.h>
+
+std::shared_ptr<pkzo::Texture> make_environment(glm::uvec2 size, const glm::vec3& sky, const glm::vec3& ground)
+{
+    // the upper half of the equirectangular map is the sky, +z
+    auto memory = std::vector<glm::vec3>();
+    for (auto y = 0u; y < size.y; y++)
+    {
+        for (auto x = 0u; x < size.x; x++)
+        {
+            memory.push_back(y < size.y / 2u ? ground : sky);
+        }
+    }
+
+    return pkzo::Texture::create({
+        .size       = size,
+        .data_type  = pkzo::DataType::FLOAT,
+        .color_mode = pkzo::ColorMode::RGB,
+        .memory     = memory.data()
+    });
+}
+
+TEST(irradiance, uniform_environment)
+{
+    auto texture = make_environment({64u, 32u}, glm::vec3(0.5f, 1.0f, 2.0f), glm::vec3(0.5f, 1.0f, 2.0f));
+
+    auto sh = pkzo::project_irradiance(texture);
+
+    for (auto normal : {glm::vec3(1, 0, 0), glm::vec3(0, -1, 0), glm::vec3(0, 0, 1), glm::normalize(glm::vec3(1, 1, -1))})
+    {
+        auto irradiance = pkzo::evaluate(sh, normal);
+        EXPECT_NEAR(0.5f, irradiance.r, 0.01f);
+        EXPECT_NEAR(1.0f, irradiance.g, 0.01f);
+        EXPECT_NEAR(2.0f, irradiance.b, 0.01f);
+    }
+}
+
+TEST(irradiance, sky_and_ground)
+{
+    auto texture = make_environment({128u, 64u}, glm::vec3(1.0f), glm::vec3(0.0f));
+
+    auto sh = pkzo::project_irradiance(texture);
+
+    // facing the sky sees only sky, sideways sees half of it
+    EXPECT_NEAR(1.0f, pkzo::evaluate(sh, glm::vec3(0, 0, 1)).r,  0.05f);
+    EXPECT_NEAR(0.5f, pkzo::evaluate(sh, glm::vec3(1, 0, 0)).r,  0.01f);
+    EXPECT_NEAR(0.5f, pkzo::evaluate(sh, glm::vec3(0, -1, 0)).r, 0.01f);
+    EXPECT_NEAR(0.0f, pkzo::evaluate(sh, glm::vec3(0, 0, -1)).r, 0.05f);
+}
+
+TEST(irradiance, compresses_bright_texels)
+{
+    auto texture = make_environment({64u, 32u}, glm::vec3(1000.0f), glm::vec3(1000.0f));
+
+    auto sh = pkzo::project_irradiance(texture);
+
+    auto irradiance = pkzo::evaluate(sh, glm::vec3(0, 0, 1));
+    EXPECT_LT(irradiance.r, 20.0f);
+    EXPECT_GT(irradiance.r, 10.0f);
+}
+
+TEST(irradiance, large_environment)
+{
+    // millions of texels, the polar rows must not be lost in the sums
+    auto size   = glm::uvec2(4096u, 2048u);
+    auto memory = std::vector<uint8_t>(size_t{size.x} * size.y * 3u, uint8_t{255u});
+
+    auto texture = pkzo::Texture::create({
+        .size       = size,
+        .data_type  = pkzo::DataType::UNSIGNED_BYTE,
+        .color_mode = pkzo::ColorMode::RGB,
+        .memory     = memory.data()
+    });
+
+    auto sh = pkzo::project_irradiance(texture);
+
+    for (auto normal : {glm::vec3(1, 0, 0), glm::vec3(0, 0, 1), glm::vec3(0, 0, -1)})
+    {
+        EXPECT_NEAR(1.0f, pkzo::evaluate(sh, normal).r, 0.01f);
+    }
+}
+
+pkzo::CubeMapData make_cubemap_data(unsigned int size, const std::array<glm::vec3, 6>& faces)
+{
+    auto data = pkzo::CubeMapData{
+        .size       = size,
+        .data_type  = pkzo::DataType::FLOAT,
+        .color_mode = pkzo::ColorMode::RGB
+    };
+
+    for (const auto& color : faces)
+    {
+        auto& image = data.images.emplace_back();
+        image.size  = size;
+        image.pixels.resize(size_t{size} * size * sizeof(glm::vec3));
+        for (auto i = 0u; i < size * size; i++)
+        {
+            std::memcpy(image.pixels.data() + i * sizeof(glm::vec3), &color, sizeof(glm::vec3));
+        }
+    }
+
+    return data;
+}
+
+TEST(irradiance, uniform_cubemap)
+{
+    auto data = make_cubemap_data(16u, {glm::vec3(0.5f, 1.0f, 2.0f), glm::vec3(0.5f, 1.0f, 2.0f), glm::vec3(0.5f, 1.0f, 2.0f),
+                                        glm::vec3(0.5f, 1.0f, 2.0f), glm::vec3(0.5f, 1.0f, 2.0f), glm::vec3(0.5f, 1.0f, 2.0f)});
+
+    auto sh = pkzo::project_irradiance(data);
+
+    for (auto normal : {glm::vec3(1, 0, 0), glm::vec3(0, -1, 0), glm::vec3(0, 0, 1), glm::normalize(glm::vec3(1, 1, -1))})
+    {
+        auto irradiance = pkzo::evaluate(sh, normal);
+        EXPECT_NEAR(0.5f, irradiance.r, 0.01f);
+        EXPECT_NEAR(1.0f, irradiance.g, 0.01f);
+        EXPECT_NEAR(2.0f, irradiance.b, 0.01f);
+    }
+}
+
+TEST(irradiance, cubemap_sky)
+{
+    // only the +z face is lit
+    auto data = make_cubemap_data(16u, {glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f),
+                                        glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(0.0f)});
+
+    auto sh = pkzo::project_irradiance(data);
+
+    EXPECT_GT(pkzo::evaluate(sh, glm::vec3(0, 0, 1)).r, pkzo::evaluate(sh, glm::vec3(1, 0, 0)).r);
+    EXPECT_GT(pkzo::evaluate(sh, glm::vec3(1, 0, 0)).r, pkzo::evaluate(sh, glm::vec3(0, 0, -1)).r);
+    EXPECT_NEAR(pkzo::evaluate(sh, glm::vec3(1, 0, 0)).r, pkzo::evaluate(sh, glm::vec3(0, 1, 0)).r, 0.01f);
+}
+
+TEST(irradiance, cubemap_without_pixels)
+{
+    auto data = pkzo::CubeMapData{.size = 16u};
+
+    auto sh = pkzo::project_irradiance(data);
+
+    EXPECT_EQ(glm::vec3(0.0f), pkzo::evaluate(sh, glm::vec3(0, 0, 1)));
+}
@@ -0,0 +1,123 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <pkzo/LightClusters.h>
+
+namespace
+{
+    std::vector<uint32_t> get_cluster_lights(const pkzo::LightClusters& clusters, const glm::uvec3& cluster)
+    {
+        const auto range   = clusters.get_cluster_ranges()[clusters.get_cluster_index(cluster)];
+        const auto& indexes = clusters.get_light_indexes();
+        return std::vector<uint32_t>(indexes.begin() + range.x, indexes.begin() + range.x + range.y);
+    }
+}
+
+TEST(light_clusters, near_far)
+{
+    auto clusters = pkzo::LightClusters();
+    clusters.update(glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f), glm::mat4(1.0f), {});
+
+    EXPECT_NEAR(0.1f,   clusters.get_near(), 1e-4f);
+    EXPECT_NEAR(100.0f, clusters.get_far(),  1e-1f);
+    EXPECT_TRUE(clusters.get_light_indexes().empty());
+}
+
+TEST(light_clusters, assign_lights)
+{
+    auto clusters = pkzo::LightClusters({.grid_size = {4u, 4u, 8u}});
+
+    // camera at the origin looking down -z
+    auto projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    auto view       = glm::mat4(1.0f);
+
+    clusters.update(projection, view, {
+        {.position = {0.0f, 0.0f, -10.0f}, .range = 0.5f},  // center of view
+        {.position = {0.0f, 0.0f,  10.0f}, .range = 0.5f},  // behind the camera
+        {.position = {0.0f, 0.0f, -10.0f}, .range = 500.0f} // everywhere
+    });
+
+    const auto grid = clusters.get_grid_size();
+    const auto& ranges = clusters.get_cluster_ranges();
+    ASSERT_EQ(grid.x * grid.y * grid.z, ranges.size());
+
+    auto total = 0u;
+    for (const auto& range : ranges)
+    {
+        EXPECT_EQ(total, range.x);
+        total += range.y;
+
+        // the big light touches every cluster
+        EXPECT_GE(range.y, 1u);
+    }
+    EXPECT_EQ(total, clusters.get_light_indexes().size());
+
+    for (const auto index : clusters.get_light_indexes())
+    {
+        EXPECT_NE(1u, index);
+    }
+
+    // the small light is in the central tiles of the slice that contains z = 10
+    auto slice = static_cast<unsigned int>(std::log(10.0f / 0.1f) / std::log(100.0f / 0.1f) * grid.z);
+    for (auto y = 0u; y < grid.y; y++)
+    {
+        for (auto x = 0u; x < grid.x; x++)
+        {
+            auto lights  = get_cluster_lights(clusters, {x, y, slice});
+            auto central = (x == 1u || x == 2u) && (y == 1u || y == 2u);
+            EXPECT_EQ(central, std::ranges::find(lights, 0u) != lights.end()) << x << ", " << y;
+        }
+    }
+
+    // and not in the first slice
+    for (auto y = 0u; y < grid.y; y++)
+    {
+        for (auto x = 0u; x < grid.x; x++)
+        {
+            auto lights = get_cluster_lights(clusters, {x, y, 0u});
+            EXPECT_EQ(lights.end(), std::ranges::find(lights, 0u));
+        }
+    }
+}
+
+TEST(light_clusters, unbounded_light)
+{
+    auto clusters = pkzo::LightClusters({.grid_size = {4u, 4u, 8u}});
+
+    auto projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    auto view       = glm::mat4(1.0f);
+
+    clusters.update(projection, view, {
+        {.position = {0.0f, 0.0f, 10.0f}, .range = std::numeric_limits<float>::infinity()}
+    });
+
+    for (const auto& range : clusters.get_cluster_ranges())
+    {
+        EXPECT_EQ(1u, range.y);
+    }
+}
@@ -0,0 +1,173 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include <gtest/gtest.h>
+#include <pkzo/MeshLod.h>
+
+namespace
+{
+    // UV sphere, the seam and the poles have duplicate vertexes
+    pkzo::MeshData make_sphere(unsigned int segments, unsigned int rings)
+    {
+        auto data = pkzo::MeshData{};
+        for (auto r = 0u; r <= rings; r++)
+        {
+            for (auto s = 0u; s <= segments; s++)
+            {
+                const auto theta = std::numbers::pi_v<float> * static_cast<float>(r) / static_cast<float>(rings);
+                const auto phi   = 2.0f * std::numbers::pi_v<float> * static_cast<float>(s) / static_cast<float>(segments);
+                const auto v     = glm::vec3(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+                data.vertexes.push_back(v);
+                data.normals.push_back(v);
+                data.texcoords.push_back(glm::vec2(static_cast<float>(s) / static_cast<float>(segments), static_cast<float>(r) / static_cast<float>(rings)));
+            }
+        }
+        for (auto r = 0u; r < rings; r++)
+        {
+            for (auto s = 0u; s < segments; s++)
+            {
+                const auto a = r * (segments + 1u) + s;
+                const auto b = a + segments + 1u;
+                data.faces.push_back({a, b, a + 1u});
+                data.faces.push_back({a + 1u, b, b + 1u});
+            }
+        }
+        data.compute_bounds();
+        return data;
+    }
+
+    // flat square from (0, 0) to (1, 1)
+    pkzo::MeshData make_grid(unsigned int n)
+    {
+        auto data = pkzo::MeshData{};
+        for (auto y = 0u; y <= n; y++)
+        {
+            for (auto x = 0u; x <= n; x++)
+            {
+                data.vertexes.push_back(glm::vec3(static_cast<float>(x) / static_cast<float>(n), static_cast<float>(y) / static_cast<float>(n), 0.0f));
+            }
+        }
+        for (auto y = 0u; y < n; y++)
+        {
+            for (auto x = 0u; x < n; x++)
+            {
+                const auto a = y * (n + 1u) + x;
+                const auto c = a + n + 1u;
+                data.faces.push_back({a, a + 1u, c + 1u});
+                data.faces.push_back({a, c + 1u, c});
+            }
+        }
+        data.compute_bounds();
+        return data;
+    }
+
+    float signed_area(const pkzo::MeshData& data)
+    {
+        auto area = 0.0f;
+        for (const auto& face : data.faces)
+        {
+            area += glm::cross(data.vertexes[face.y] - data.vertexes[face.x], data.vertexes[face.z] - data.vertexes[face.x]).z * 0.5f;
+        }
+        return area;
+    }
+}
+
+TEST(mesh_lod, simplify_keeps_shape)
+{
+    const auto sphere = make_sphere(64u, 32u);
+
+    const auto result = pkzo::simplify(sphere, 500u);
+
+    EXPECT_LE(result.faces.size(), 500u);
+    EXPECT_GT(result.faces.size(), 400u);
+    ASSERT_EQ(result.vertexes.size(), result.normals.size());
+    ASSERT_EQ(result.vertexes.size(), result.texcoords.size());
+    EXPECT_TRUE(result.tangents.empty());
+
+    // the vertexes are a subset of the sphere and no face turned inside out
+    for (const auto& v : result.vertexes)
+    {
+        EXPECT_NEAR(1.0f, glm::length(v), 1e-5f);
+    }
+    for (const auto& face : result.faces)
+    {
+        ASSERT_LT(std::max({face.x, face.y, face.z}), result.vertexes.size());
+        const auto normal = glm::cross(result.vertexes[face.y] - result.vertexes[face.x], result.vertexes[face.z] - result.vertexes[face.x]);
+        const auto center = result.vertexes[face.x] + result.vertexes[face.y] + result.vertexes[face.z];
+        EXPECT_GE(glm::dot(normal, center), 0.0f);
+    }
+}
+
+TEST(mesh_lod, simplify_keeps_borders)
+{
+    const auto grid = make_grid(32u);
+
+    const auto result = pkzo::simplify(grid, 8u);
+
+    EXPECT_LE(result.faces.size(), 8u);
+    EXPECT_NEAR(1.0f, signed_area(result), 1e-4f);
+}
+
+TEST(mesh_lod, generate_lods)
+{
+    const auto sphere = make_sphere(64u, 32u);
+
+    const auto lods = pkzo::generate_lods(sphere, 3u);
+
+    ASSERT_EQ(3u, lods.size());
+    auto faces       = sphere.faces.size();
+    auto screen_size = 1.0f;
+    for (const auto& lod : lods)
+    {
+        ASSERT_NE(nullptr, lod.mesh);
+        EXPECT_LE(lod.mesh->get_faces().size(), faces / 2u);
+        EXPECT_LT(lod.screen_size, screen_size);
+        faces       = lod.mesh->get_faces().size();
+        screen_size = lod.screen_size;
+    }
+
+    // too small to be worth it
+    EXPECT_TRUE(pkzo::generate_lods(make_grid(2u)).empty());
+}
+
+TEST(mesh_lod, select_lod_hysteresis)
+{
+    const auto lods = std::vector<pkzo::MeshLod>{
+        {.screen_size = 0.5f},
+        {.screen_size = 0.25f}
+    };
+
+    EXPECT_EQ(0u, pkzo::select_lod(lods, 1.0f, 0u));
+    EXPECT_EQ(2u, pkzo::select_lod(lods, 0.1f, 0u));
+    EXPECT_EQ(0u, pkzo::select_lod(lods, 1.0f, 2u));
+
+    // around the threshold the level sticks
+    EXPECT_EQ(0u, pkzo::select_lod(lods, 0.48f, 0u));
+    EXPECT_EQ(1u, pkzo::select_lod(lods, 0.44f, 0u));
+    EXPECT_EQ(1u, pkzo::select_lod(lods, 0.52f, 1u));
+    EXPECT_EQ(0u, pkzo::select_lod(lods, 0.56f, 1u));
+
+    EXPECT_EQ(0u, pkzo::select_lod({}, 0.01f, 3u));
+}
@@ -0,0 +1,228 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <pkzo/pkzo.h>
+#include <tinyformat.h>
+
+#include "glm_gtest.h"
+#include "pkzo_gtest.h"
+
+namespace
+{
+    // The world transform how it was computed before caching, walking the parent chain.
+    glm::mat4 walk_world_transform(const pkzo::SceneNode* node)
+    {
+        auto result = node->get_transform();
+        for (auto p = node->get_parent(); p != nullptr; p = p->get_parent())
+        {
+            result = p->get_transform() * result;
+        }
+        return result;
+    }
+
+    void build_tree(pkzo::SceneGroup& group, unsigned int depth, unsigned int branching, std::vector<pkzo::SceneNode*>& nodes)
+    {
+        if (depth == 0u)
+        {
+            return;
+        }
+
+        for (auto i = 0u; i < branching; i++)
+        {
+            auto child = group.add<pkzo::SceneGroup>({
+                .transform = glm::rotate(pkzo::position(1.0f, 0.0f, 0.5f), glm::radians(10.0f * i), glm::vec3(0.0f, 0.0f, 1.0f))
+            });
+            nodes.push_back(child);
+            build_tree(*child, depth - 1u, branching, nodes);
+        }
+    }
+
+    template <typename Func>
+    double measure_frames(unsigned int frames, Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (auto f = 0u; f < frames; f++)
+        {
+            func(f);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+    }
+}
+
+TEST(node, world_transform)
+{
+    auto scene = pkzo::Scene();
+
+    auto a = scene.add<pkzo::SceneGroup>({.transform = pkzo::position(1.0f, 0.0f, 0.0f)});
+    auto b = a->add<pkzo::SceneGroup>({.transform = pkzo::position(0.0f, 2.0f, 0.0f)});
+    auto c = b->add<pkzo::SceneGroup>({.transform = pkzo::position(0.0f, 0.0f, 3.0f)});
+
+    EXPECT_GLM_EQ(c->get_world_transform(), pkzo::position(1.0f, 2.0f, 3.0f));
+
+    a->set_transform(pkzo::position(-1.0f, 0.0f, 0.0f));
+    EXPECT_GLM_EQ(c->get_world_transform(), pkzo::position(-1.0f, 2.0f, 3.0f));
+    EXPECT_GLM_EQ(b->get_world_transform(), pkzo::position(-1.0f, 2.0f, 0.0f));
+
+    c->set_transform(pkzo::position(0.0f, 0.0f, 4.0f));
+    EXPECT_GLM_EQ(c->get_world_transform(), pkzo::position(-1.0f, 2.0f, 4.0f));
+
+    scene.set_transform(pkzo::position(0.0f, 0.0f, 10.0f));
+    EXPECT_GLM_EQ(c->get_world_transform(), pkzo::position(-1.0f, 2.0f, 14.0f));
+    EXPECT_GLM_EQ(a->get_world_transform(), pkzo::position(-1.0f, 0.0f, 10.0f));
+}
+
+TEST(node, world_transform_benchmark)
+{
+    constexpr auto DEPTH     = 8u;
+    constexpr auto BRANCHING = 3u; // 3 + 9 + ... + 3^8 = 9840 nodes
+    constexpr auto FRAMES    = 100u;
+
+    auto scene = pkzo::Scene();
+    auto nodes = std::vector<pkzo::SceneNode*>{};
+    build_tree(scene, DEPTH, BRANCHING, nodes);
+    ASSERT_EQ(nodes.size(), 9840u);
+
+    auto sink = glm::mat4(0.0f);
+
+    auto walk = measure_frames(FRAMES, [&] (auto) {
+        for (const auto* node : nodes)
+        {
+            sink += walk_world_transform(node);
+        }
+    });
+
+    auto cached_static = measure_frames(FRAMES, [&] (auto) {
+        for (const auto* node : nodes)
+        {
+            sink += node->get_world_transform();
+        }
+    });
+
+    auto cached_moving = measure_frames(FRAMES, [&] (auto f) {
+        scene.set_transform(pkzo::position(0.0f, 0.0f, static_cast<float>(f)));
+        for (const auto* node : nodes)
+        {
+            sink += node->get_world_transform();
+        }
+    });
+
+    for (const auto* node : nodes)
+    {
+        EXPECT_GLM_NEAR(node->get_world_transform(), walk_world_transform(node), 1e-3f);
+    }
+
+    tfm::printf("[ BENCH    ] %d nodes, %d deep\n", nodes.size(), DEPTH);
+    tfm::printf("[ BENCH    ] parent walk:            %8.1f us/frame\n", walk);
+    tfm::printf("[ BENCH    ] cached, static scene:   %8.1f us/frame\n", cached_static);
+    tfm::printf("[ BENCH    ] cached, root moved:     %8.1f us/frame\n", cached_moving);
+
+    RecordProperty("parent_walk_us", std::to_string(walk));
+    RecordProperty("cached_static_us", std::to_string(cached_static));
+    RecordProperty("cached_moving_us", std::to_string(cached_moving));
+}
+
+TEST(node, transform_store)
+{
+    auto scene = pkzo::Scene({.transform_store = true});
+    ASSERT_NE(scene.get_transform_store(), nullptr);
+
+    auto a = scene.add<pkzo::SceneGroup>({.transform = pkzo::position(1.0f, 0.0f, 0.0f)});
+    auto b = a->add<pkzo::SceneGroup>({.transform = pkzo::position(0.0f, 2.0f, 0.0f)});
+    auto c = b->add<pkzo::SceneGroup>({.transform = pkzo::position(0.0f, 0.0f, 3.0f)});
+    auto d = scene.add<pkzo::SceneGroup>({.transform = pkzo::position(5.0f, 0.0f, 0.0f)});
+
+    EXPECT_EQ(a->get_transform_store(), scene.get_transform_store());
+    EXPECT_EQ(scene.get_transform_store()->size(), 5u);
+    EXPECT_GLM_EQ(c->get_world_transform(), pkzo::position(1.0f, 2.0f, 3.0f));
+
+    a->set_transform(pkzo::position(-1.0f, 0.0f, 0.0f));
+    EXPECT_GLM_EQ(c->get_world_transform(), pkzo::position(-1.0f, 2.0f, 3.0f));
+
+    // the world transform is owned by the node, adding entries does not move it
+    const auto& world = d->get_world_transform();
+    auto f = a->add<pkzo::SceneGroup>({.transform = pkzo::position(0.0f, 0.0f, 1.0f)});
+    EXPECT_GLM_EQ(world, pkzo::position(5.0f, 0.0f, 0.0f));
+
+    a->remove(f);
+    a->remove(b);
+    EXPECT_EQ(scene.get_transform_store()->size(), 3u);
+
+    auto e = d->add<pkzo::SceneGroup>({.transform = pkzo::position(0.0f, 1.0f, 0.0f)});
+    scene.set_transform(pkzo::position(0.0f, 0.0f, 10.0f));
+    scene.update(0.0f);
+
+    EXPECT_GLM_EQ(a->get_world_transform(), pkzo::position(-1.0f, 0.0f, 10.0f));
+    EXPECT_GLM_EQ(e->get_world_transform(), pkzo::position(5.0f, 1.0f, 10.0f));
+}
+
+TEST(node, transform_store_benchmark)
+{
+    constexpr auto DEPTH     = 8u;
+    constexpr auto BRANCHING = 3u;
+    constexpr auto FRAMES    = 100u;
+
+    // the same tree once with cached world transforms, where moves cascade
+    // through the move signals, and once in a transform store
+    auto cached_scene = pkzo::Scene();
+    auto cached_nodes = std::vector<pkzo::SceneNode*>{};
+    build_tree(cached_scene, DEPTH, BRANCHING, cached_nodes);
+
+    auto store_scene = pkzo::Scene({.transform_store = true});
+    auto store_nodes = std::vector<pkzo::SceneNode*>{};
+    build_tree(store_scene, DEPTH, BRANCHING, store_nodes);
+
+    auto sink = glm::mat4(0.0f);
+
+    auto cached_moving = measure_frames(FRAMES, [&] (auto f) {
+        cached_scene.set_transform(pkzo::position(0.0f, 0.0f, static_cast<float>(f)));
+        for (const auto* node : cached_nodes)
+        {
+            sink += node->get_world_transform();
+        }
+    });
+
+    auto store_moving = measure_frames(FRAMES, [&] (auto f) {
+        store_scene.set_transform(pkzo::position(0.0f, 0.0f, static_cast<float>(f)));
+        store_scene.get_transform_store()->update();
+        for (const auto* node : store_nodes)
+        {
+            sink += node->get_world_transform();
+        }
+    });
+
+    for (const auto* node : store_nodes)
+    {
+        EXPECT_GLM_NEAR(node->get_world_transform(), walk_world_transform(node), 1e-3f);
+    }
+
+    tfm::printf("[ BENCH    ] %d nodes, %d deep\n", store_nodes.size(), DEPTH);
+    tfm::printf("[ BENCH    ] cached, root moved:          %8.1f us/frame\n", cached_moving);
+    tfm::printf("[ BENCH    ] transform store, root moved: %8.1f us/frame\n", store_moving);
+    tfm::printf("[ BENCH    ] speedup:                     %8.2fx\n", cached_moving / store_moving);
+
+    RecordProperty("cached_moving_us", std::to_string(cached_moving));
+    RecordProperty("store_moving_us", std::to_string(store_moving));
+}
@@ -0,0 +1,112 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <pkzo/OcclusionBuffer.h>
+
+namespace
+{
+    // camera at the origin looking down -z
+    const auto view_projection = glm::perspective(glm::radians(90.0f), 2.0f, 0.1f, 100.0f);
+
+    // 4x4 wall at z = -5
+    std::shared_ptr<pkzo::Mesh> make_wall()
+    {
+        return pkzo::Mesh::create({
+            .vertexes = {{-2.0f, -2.0f, -5.0f}, {2.0f, -2.0f, -5.0f}, {2.0f, 2.0f, -5.0f}, {-2.0f, 2.0f, -5.0f}},
+            .faces    = {{0u, 1u, 2u}, {0u, 2u, 3u}}
+        });
+    }
+
+    pkzo::OcclusionBuffer make_buffer()
+    {
+        auto buffer = pkzo::OcclusionBuffer({.size = {256u, 128u}});
+        buffer.begin(view_projection);
+        buffer.add_occluder(*make_wall(), glm::mat4(1.0f));
+        buffer.end();
+        return buffer;
+    }
+}
+
+TEST(occlusion_buffer, rasterizes_occluders)
+{
+    auto buffer = make_buffer();
+
+    EXPECT_EQ(glm::uvec2(256u, 128u), buffer.get_size());
+    EXPECT_EQ(9u, buffer.get_level_count());
+
+    // window depth of the wall in the center, nothing at the border
+    const auto clip = view_projection * glm::vec4(0.0f, 0.0f, -5.0f, 1.0f);
+    EXPECT_NEAR(clip.z / clip.w * 0.5f + 0.5f, buffer.get_depth({128u, 64u}), 1e-5f);
+    EXPECT_EQ(1.0f, buffer.get_depth({0u, 0u}));
+    EXPECT_EQ(1.0f, buffer.get_depth({255u, 127u}));
+}
+
+TEST(occlusion_buffer, culls_hidden_bounds)
+{
+    auto buffer = make_buffer();
+
+    // behind the wall
+    EXPECT_TRUE(buffer.is_occluded({{-0.5f, -0.5f, -11.0f}, {0.5f, 0.5f, -10.0f}}));
+    EXPECT_TRUE(buffer.is_occluded({{-3.0f, -3.0f, -30.0f}, {3.0f, 3.0f, -20.0f}}));
+
+    // in front of the wall
+    EXPECT_FALSE(buffer.is_occluded({{-0.5f, -0.5f, -3.0f}, {0.5f, 0.5f, -2.0f}}));
+
+    // next to it, and peeking out behind the edge
+    EXPECT_FALSE(buffer.is_occluded({{6.0f, -0.5f, -11.0f}, {7.0f, 0.5f, -10.0f}}));
+    EXPECT_FALSE(buffer.is_occluded({{3.0f, -0.5f, -11.0f}, {5.0f, 0.5f, -10.0f}}));
+
+    // through the near plane
+    EXPECT_FALSE(buffer.is_occluded({{-0.5f, -0.5f, -1.0f}, {0.5f, 0.5f, 1.0f}}));
+}
+
+TEST(occlusion_buffer, clips_occluders_at_the_near_plane)
+{
+    // a floor from behind the camera into the distance
+    auto floor = pkzo::Mesh::create({
+        .vertexes = {{-10.0f, -1.0f, 10.0f}, {10.0f, -1.0f, 10.0f}, {10.0f, -1.0f, -50.0f}, {-10.0f, -1.0f, -50.0f}},
+        .faces    = {{0u, 1u, 2u}, {0u, 2u, 3u}}
+    });
+
+    auto buffer = pkzo::OcclusionBuffer({.size = {64u, 32u}});
+    buffer.begin(view_projection);
+    buffer.add_occluder(*floor, glm::mat4(1.0f));
+    buffer.end();
+
+    // below the floor is hidden, above it is not
+    EXPECT_TRUE(buffer.is_occluded({{-0.5f, -3.0f, -11.0f}, {0.5f, -2.0f, -10.0f}}));
+    EXPECT_FALSE(buffer.is_occluded({{-0.5f, 0.0f, -11.0f}, {0.5f, 1.0f, -10.0f}}));
+
+    // the upper half of the screen is empty
+    EXPECT_EQ(1.0f, buffer.get_depth({32u, 31u}));
+    EXPECT_GT(1.0f, buffer.get_depth({32u, 0u}));
+}
+
+TEST(occlusion_buffer, empty)
+{
+    auto buffer = pkzo::OcclusionBuffer();
+    buffer.begin(view_projection);
+    buffer.end();
+
+    EXPECT_FALSE(buffer.is_occluded({{-0.5f, -0.5f, -11.0f}, {0.5f, 0.5f, -10.0f}}));
+}
@@ -0,0 +1,145 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include <pkzo/pkzo.h>
+
+TEST(frame_profiler, records_nested_passes)
+{
+    auto profiler = pkzo::FrameProfiler();
+
+    EXPECT_EQ(0u, profiler.start_pass("Forward"));
+    EXPECT_EQ(1u, profiler.start_pass("Generate Cubemap"));
+    profiler.end_pass();
+    profiler.end_pass();
+    EXPECT_EQ(2u, profiler.start_pass("Screen"));
+    profiler.end_pass();
+    profiler.end_frame();
+
+    ASSERT_EQ(1u, profiler.get_frames().size());
+    EXPECT_EQ(1u, profiler.get_frame());
+
+    const auto& passes = profiler.get_frames().front().passes;
+    ASSERT_EQ(3u, passes.size());
+    EXPECT_EQ("Forward", passes[0].name);
+    EXPECT_EQ(0u, passes[0].depth);
+    EXPECT_EQ("Generate Cubemap", passes[1].name);
+    EXPECT_EQ(1u, passes[1].depth);
+    EXPECT_EQ(0u, passes[2].depth);
+    EXPECT_GE(passes[0].cpu_time, passes[1].cpu_time);
+}
+
+TEST(frame_profiler, keeps_rolling_history)
+{
+    auto profiler = pkzo::FrameProfiler({.history = 4u});
+
+    for (auto i = 0; i < 10; i++)
+    {
+        profiler.start_pass("Forward");
+        profiler.end_pass();
+        profiler.end_frame();
+    }
+
+    ASSERT_EQ(4u, profiler.get_frames().size());
+    EXPECT_EQ(6u, profiler.get_frames().front().frame);
+    EXPECT_EQ(9u, profiler.get_frames().back().frame);
+
+    auto stats = profiler.get_pass_stats();
+    ASSERT_EQ(1u, stats.size());
+    EXPECT_EQ("Forward", stats[0].name);
+    EXPECT_EQ(4u, stats[0].cpu_samples);
+    EXPECT_EQ(0u, stats[0].gpu_samples);
+}
+
+TEST(frame_profiler, adds_late_gpu_times)
+{
+    auto profiler = pkzo::FrameProfiler({.history = 4u});
+
+    for (auto i = 0; i < 3; i++)
+    {
+        profiler.start_pass("Forward");
+        profiler.end_pass();
+        profiler.end_frame();
+    }
+
+    auto now = pkzo::FrameProfiler::clock::now();
+    profiler.set_gpu_time(1u, 0u, now, 2.0f);
+    profiler.set_gpu_time(1u, 5u, now, 3.0f);  // no such pass
+    profiler.set_gpu_time(42u, 0u, now, 4.0f); // no such frame
+
+    auto stats = profiler.get_pass_stats();
+    ASSERT_EQ(1u, stats.size());
+    EXPECT_EQ(1u, stats[0].gpu_samples);
+    EXPECT_FLOAT_EQ(2.0f, stats[0].gpu.average);
+    EXPECT_FLOAT_EQ(2.0f, stats[0].gpu.max);
+}
+
+TEST(frame_profiler, ignores_passes_while_disabled)
+{
+    auto profiler = pkzo::FrameProfiler({.enabled = false});
+
+    EXPECT_EQ(pkzo::FrameProfiler::NO_PASS, profiler.start_pass("Forward"));
+    profiler.end_pass();
+    profiler.end_frame();
+
+    ASSERT_EQ(1u, profiler.get_frames().size());
+    EXPECT_TRUE(profiler.get_frames().front().passes.empty());
+}
+
+TEST(frame_profiler, computes_percentiles)
+{
+    auto values = std::vector<float>();
+    for (auto i = 100; i > 0; i--)
+    {
+        values.push_back(static_cast<float>(i));
+    }
+
+    auto p = pkzo::compute_percentiles(values);
+    EXPECT_FLOAT_EQ(50.5f, p.average);
+    EXPECT_FLOAT_EQ(50.0f, p.median);
+    EXPECT_FLOAT_EQ(95.0f, p.p95);
+    EXPECT_FLOAT_EQ(99.0f, p.p99);
+    EXPECT_FLOAT_EQ(100.0f, p.max);
+
+    auto empty = pkzo::compute_percentiles({});
+    EXPECT_FLOAT_EQ(0.0f, empty.max);
+}
+
+TEST(frame_profiler, writes_chrome_trace)
+{
+    auto profiler = pkzo::FrameProfiler();
+
+    profiler.start_pass("Forward \"main\"");
+    profiler.end_pass();
+    profiler.end_frame();
+    profiler.set_gpu_time(0u, 0u, pkzo::FrameProfiler::clock::now(), 1.0f);
+
+    auto out = std::stringstream();
+    profiler.write_chrome_trace(out);
+
+    auto trace = out.str();
+    EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, trace.find("\"Frame 0\""));
+    EXPECT_NE(std::string::npos, trace.find("\"Forward \\\"main\\\"\""));
+    EXPECT_NE(std::string::npos, trace.find("\"gpu\""));
+}
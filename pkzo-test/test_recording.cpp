@@ -0,0 +1,594 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+#include <pkzo/pkzo.h>
+
+using CommandType = pkzo::RecordingGraphicContext::CommandType;
+
+size_t count_pass_commands(const pkzo::RecordingGraphicContext& gc, const std::string_view pass, CommandType type)
+{
+    auto count   = size_t{0u};
+    auto in_pass = false;
+    for (const auto& command : gc.get_commands())
+    {
+        if (command.type == CommandType::START_PASS)
+        {
+            in_pass = command.name == pass;
+        }
+        else if (in_pass && command.type == type)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+TEST(recording_graphic_context, empty_frame)
+{
+    auto gc = pkzo::RecordingGraphicContext();
+
+    gc.clear_screen();
+    gc.swap_buffers();
+
+    EXPECT_EQ(1u, gc.get_commands().size());
+    EXPECT_EQ(1u, gc.get_stats().commands);
+    EXPECT_EQ(0u, gc.get_stats().draws);
+    EXPECT_EQ(pkzo::Api::RECORDING, gc.get_api());
+}
+
+TEST(recording_graphic_context, culls_and_draws_scene)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+
+    scene.add<pkzo::AmbientLight>({
+        .color = glm::vec3(0.1f)
+    });
+
+    // two boxes in front of the camera, one behind it
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+        .material  = material
+    });
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 2.0f, 0.0f),
+        .material  = material
+    });
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(20.0f, 0.0f, 0.0f),
+        .material  = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    EXPECT_EQ(2u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    EXPECT_EQ(0u, count_pass_commands(gc, "Forward", CommandType::DRAW_INSTANCED));
+    EXPECT_EQ(24u, gc.get_stats().triangles);
+
+    const auto& cull_stats = scene.get_renderer()->get_cull_stats();
+    EXPECT_EQ(3u, cull_stats.tested);
+    EXPECT_EQ(1u, cull_stats.culled);
+}
+
+TEST(recording_graphic_context, draws_scene_deferred)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    scene.get_renderer()->set_render_mode(pkzo::SceneRenderer::RenderMode::DEFERRED);
+
+    auto material = pkzo::Material::create({});
+
+    scene.add<pkzo::AmbientLight>({
+        .color = glm::vec3(0.1f)
+    });
+
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+        .material  = material
+    });
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 2.0f, 0.0f),
+        .material  = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    EXPECT_EQ(2u, count_pass_commands(gc, "Geometry Buffer", CommandType::DRAW));
+    EXPECT_EQ(1u, count_pass_commands(gc, "Deferred Lighting", CommandType::DRAW_FULLSCREEN));
+    EXPECT_EQ(0u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+}
+
+TEST(recording_graphic_context, uploads_light_clusters_once)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    scene.get_renderer()->set_render_mode(pkzo::SceneRenderer::RenderMode::DEFERRED);
+
+    scene.add<pkzo::PointLight>({
+        .transform = pkzo::position(2.0f, 0.0f, 2.0f)
+    });
+
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+        .material  = pkzo::Material::create({})
+    });
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 2.0f, 0.0f),
+        .material  = pkzo::Material::create({.opacity_factor = 0.5f})
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    // the lighting and the transparent forward pass share the clusters
+    EXPECT_EQ(1u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    auto uploads = std::ranges::count_if(gc.get_commands(), [] (const auto& command) {
+        return command.type == CommandType::SET_STORAGE_BUFFER;
+    });
+    EXPECT_EQ(3, uploads);
+}
+
+TEST(recording_graphic_context, caches_static_shadows)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+
+    scene.add<pkzo::DirectionalLight>({
+        .transform    = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+        .cast_shadows = true
+    });
+
+    auto ground = scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, -0.5f),
+        .size      = glm::vec3(10.0f, 10.0f, 1.0f),
+        .material  = material
+    });
+
+    // geometry of a body casts a dynamic shadow
+    auto body = scene.add<pkzo::Body>({
+        .transform = pkzo::position(0.0f, 0.0f, 1.0f)
+    });
+    body->add<pkzo::BoxGeometry>({
+        .material = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    const auto& shadow_stats = scene.get_renderer()->get_shadow_stats();
+    EXPECT_EQ(size_t{pkzo::SHADOW_CASCADES}, shadow_stats.views);
+    EXPECT_EQ(size_t{pkzo::SHADOW_CASCADES}, shadow_stats.static_updates);
+    EXPECT_LT(0u, count_pass_commands(gc, "Dynamic Shadow", CommandType::DRAW));
+
+    // nothing static moved, the cached shadows are reused
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    EXPECT_EQ(0u, shadow_stats.static_updates);
+    EXPECT_EQ(0u, count_pass_commands(gc, "Static Shadow", CommandType::DRAW));
+    EXPECT_LT(0u, count_pass_commands(gc, "Dynamic Shadow", CommandType::DRAW));
+
+    // moving a body does not invalidate the cache, moving static geometry does
+    body->set_transform(pkzo::position(1.0f, 0.0f, 1.0f));
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(0u, shadow_stats.static_updates);
+
+    ground->set_transform(pkzo::position(0.0f, 0.0f, -0.6f));
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(size_t{pkzo::SHADOW_CASCADES}, shadow_stats.static_updates);
+}
+
+TEST(recording_graphic_context, caches_static_shadows_in_transform_store)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene({.transform_store = true});
+
+    auto material = pkzo::Material::create({});
+
+    scene.add<pkzo::DirectionalLight>({
+        .transform    = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+        .cast_shadows = true
+    });
+
+    auto group = scene.add<pkzo::SceneGroup>({});
+    group->add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, -0.5f),
+        .size      = glm::vec3(10.0f, 10.0f, 1.0f),
+        .material  = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    const auto& shadow_stats = scene.get_renderer()->get_shadow_stats();
+    EXPECT_EQ(size_t{pkzo::SHADOW_CASCADES}, shadow_stats.static_updates);
+
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(0u, shadow_stats.static_updates);
+
+    // the geometry is not notified when its group moves, the cache is invalidated all the same
+    group->set_transform(pkzo::position(0.0f, 0.0f, -0.1f));
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(size_t{pkzo::SHADOW_CASCADES}, shadow_stats.static_updates);
+}
+
+TEST(recording_graphic_context, casts_shadows_on_request)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+
+    scene.add<pkzo::DirectionalLight>({
+        .transform = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+    auto spot = scene.add<pkzo::SpotLight>({
+        .transform = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, -0.5f),
+        .size      = glm::vec3(10.0f, 10.0f, 1.0f),
+        .material  = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    // lights cast no shadows by default
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    const auto& shadow_stats = scene.get_renderer()->get_shadow_stats();
+    EXPECT_EQ(0u, shadow_stats.views);
+    EXPECT_EQ(0u, count_pass_commands(gc, "Static Shadow", CommandType::DRAW));
+
+    spot->set_cast_shadows(true);
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    EXPECT_EQ(1u, shadow_stats.views);
+    EXPECT_LT(0u, count_pass_commands(gc, "Static Shadow", CommandType::DRAW));
+}
+
+TEST(recording_graphic_context, draws_shared_meshes_instanced)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+    auto mesh     = pkzo::Mesh::create({
+        .vertexes = {{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+        .faces    = {{0u, 1u, 2u}}
+    });
+
+    for (auto i = 0; i < 4; i++)
+    {
+        scene.add<pkzo::MeshGeometry>({
+            .transform = pkzo::position(0.0f, static_cast<float>(i), 0.0f),
+            .mesh      = mesh,
+            .material  = material
+        });
+    }
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    EXPECT_EQ(0u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    EXPECT_EQ(1u, count_pass_commands(gc, "Forward", CommandType::DRAW_INSTANCED));
+    EXPECT_EQ(4u, gc.get_stats().instances);
+    EXPECT_EQ(4u, gc.get_stats().triangles);
+}
+
+TEST(recording_graphic_context, draws_mesh_lods)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+    auto quad     = pkzo::Mesh::create({
+        .vertexes = {{0.0f, -0.5f, -0.5f}, {0.0f, 0.5f, -0.5f}, {0.0f, 0.5f, 0.5f}, {0.0f, -0.5f, 0.5f}},
+        .faces    = {{0u, 1u, 2u}, {0u, 2u, 3u}}
+    });
+    auto triangle = pkzo::Mesh::create({
+        .vertexes = {{0.0f, -0.5f, -0.5f}, {0.0f, 0.5f, -0.5f}, {0.0f, 0.5f, 0.5f}},
+        .faces    = {{0u, 1u, 2u}}
+    });
+
+    scene.add<pkzo::MeshGeometry>({
+        .mesh     = quad,
+        .lods     = {{.mesh = triangle, .screen_size = 0.5f}},
+        .material = material
+    });
+
+    auto camera = scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(1.5f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(2u, gc.get_stats().triangles);
+
+    camera->set_transform(pkzo::lookat(glm::vec3(20.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(1u, gc.get_stats().triangles);
+}
+
+TEST(recording_graphic_context, culls_occluded_geometry)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+
+    // a wall between the camera and a box
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(5.0f, 0.0f, 0.0f),
+        .size      = glm::vec3(0.5f, 10.0f, 10.0f),
+        .material  = material
+    });
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+        .material  = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(2u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    EXPECT_EQ(0u, scene.get_renderer()->get_cull_stats().occluded);
+
+    scene.get_renderer()->set_occlusion_culling(true);
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(1u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+
+    const auto& cull_stats = scene.get_renderer()->get_cull_stats();
+    EXPECT_EQ(2u, cull_stats.tested);
+    EXPECT_EQ(0u, cull_stats.culled);
+    EXPECT_EQ(1u, cull_stats.occluded);
+}
+
+TEST(recording_graphic_context, records_draws_in_parallel)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene();
+
+    auto material = pkzo::Material::create({});
+    auto quad     = pkzo::Mesh::create({
+        .vertexes = {{0.0f, -0.5f, -0.5f}, {0.0f, 0.5f, -0.5f}, {0.0f, 0.5f, 0.5f}, {0.0f, -0.5f, 0.5f}},
+        .faces    = {{0u, 1u, 2u}, {0u, 2u, 3u}}
+    });
+
+    // enough geometry to be recorded by several jobs, merged into one instanced draw
+    for (auto i = 0; i < 2000; i++)
+    {
+        scene.add<pkzo::MeshGeometry>({
+            .transform = pkzo::position(-static_cast<float>(i % 40), static_cast<float>(i / 40) * 0.1f, 0.0f),
+            .mesh      = quad,
+            .material  = material
+        });
+    }
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 2.5f, 0.0f), glm::vec3(0.0f, 2.5f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    const auto& cull_stats = scene.get_renderer()->get_cull_stats();
+    EXPECT_EQ(2000u, cull_stats.tested);
+    EXPECT_EQ(0u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    EXPECT_EQ(1u, count_pass_commands(gc, "Forward", CommandType::DRAW_INSTANCED));
+    EXPECT_EQ((cull_stats.tested - cull_stats.culled) * 2u, gc.get_stats().triangles);
+}
+
+TEST(recording_graphic_context, draws_scene_snapshot)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene({.render_thread = true});
+
+    auto material = pkzo::Material::create({});
+
+    auto box = scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+        .material  = material
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    // nothing is drawn before the first update
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(0u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+
+    scene.update(0.1f);
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 2.0f, 0.0f),
+        .material  = material
+    });
+    scene.remove(box);
+
+    // the removed box is drawn from the snapshot, the added one is not
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(1u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    EXPECT_EQ(1u, scene.get_renderer()->get_cull_stats().tested);
+
+    scene.update(0.1f);
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(1u, count_pass_commands(gc, "Forward", CommandType::DRAW));
+    EXPECT_EQ(1u, scene.get_renderer()->get_cull_stats().tested);
+}
+
+TEST(recording_graphic_context, keeps_debug_lines_of_skipped_snapshot)
+{
+    auto gc    = pkzo::RecordingGraphicContext();
+    auto scene = pkzo::Scene({.render_thread = true});
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    // two updates without a draw in between, the lines of the first must survive
+    scene.get_renderer()->add_debug_line(glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec4(1.0f));
+    scene.update(0.1f);
+    scene.update(0.1f);
+
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(1u, count_pass_commands(gc, "Debug Lines", CommandType::DRAW));
+
+    scene.update(0.1f);
+    scene.draw(gc);
+    gc.swap_buffers();
+    EXPECT_EQ(0u, count_pass_commands(gc, "Debug Lines", CommandType::DRAW));
+}
+
+TEST(recording_graphic_context, counts_render_stats)
+{
+    auto gc = pkzo::RecordingGraphicContext();
+
+    auto shader = gc.compile({});
+    auto mesh   = gc.upload_mesh({
+        .vertexes = {{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+        .faces    = {{0u, 1u, 2u}},
+        .lines    = {{0u, 1u}}
+    });
+
+    gc.start_pass("Test", shader);
+    gc.set_uniform(0, 1.0f);
+    gc.set_uniform(1, glm::mat4(1.0f));
+    gc.bind_texture(0, std::shared_ptr<pkzo::Texture>());
+    gc.set_uniform_buffer(0, glm::vec4(1.0f));
+    gc.draw(mesh);
+    gc.draw_instanced(mesh, std::vector<glm::mat4>(3u, glm::mat4(1.0f)));
+    gc.end_pass();
+
+    EXPECT_EQ(0u, gc.get_render_stats().draws);
+    gc.swap_buffers();
+
+    const auto& stats = gc.get_render_stats();
+    EXPECT_EQ(2u, stats.draws);
+    EXPECT_EQ(4u, stats.triangles);
+    EXPECT_EQ(4u, stats.lines);
+    EXPECT_EQ(2u, stats.uniforms);
+    EXPECT_EQ(1u, stats.texture_binds);
+    EXPECT_EQ(1u, stats.shader_binds);
+    EXPECT_EQ(3u * sizeof(glm::vec3) + sizeof(glm::uvec3) + sizeof(glm::uvec2) + sizeof(glm::vec4) + 3u * sizeof(glm::mat4), stats.buffer_bytes);
+    EXPECT_EQ(0u, stats.texture_bytes);
+
+    // counters reset each frame
+    gc.swap_buffers();
+    EXPECT_EQ(0u, gc.get_render_stats().draws);
+    EXPECT_EQ(0u, gc.get_render_stats().buffer_bytes);
+}
+
+TEST(recording_graphic_context, generates_cubemap_over_frames)
+{
+    auto gc        = pkzo::RecordingGraphicContext();
+    auto generator = pkzo::IncrementalCubeMapGenerator({
+        .generator = {
+            .size      = 16u,
+            .shader    = gc.compile({}),
+            .miplevels = 2u
+        },
+        .texels    = 16u * 16u,
+        .budget    = std::chrono::seconds(1)
+    });
+
+    // one 16x16 face per frame, then up to four 8x8 faces per frame
+    const auto expected = std::vector<size_t>{1u, 1u, 1u, 1u, 1u, 1u, 4u, 2u};
+    auto       frames   = 0u;
+    auto       complete = false;
+    while (!complete)
+    {
+        EXPECT_EQ(nullptr, generator.get_cubemap());
+
+        complete = generator.update(gc);
+        gc.swap_buffers();
+
+        auto faces = size_t{0u};
+        for (const auto& command : gc.get_commands())
+        {
+            if (command.type == CommandType::GENERATE_CUBEMAP)
+            {
+                faces += command.count;
+            }
+        }
+        ASSERT_LT(frames, expected.size());
+        EXPECT_EQ(expected[frames], faces);
+        frames++;
+    }
+
+    EXPECT_EQ(expected.size(), frames);
+    EXPECT_FLOAT_EQ(1.0f, generator.get_progress());
+    ASSERT_NE(nullptr, generator.get_cubemap());
+    EXPECT_EQ(16u, generator.get_cubemap()->get_size());
+}
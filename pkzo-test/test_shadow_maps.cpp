@@ -0,0 +1,95 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <pkzo/ShadowMaps.h>
+
+namespace
+{
+    const auto scene_bounds = pkzo::Bounds3{glm::vec3(-50.0f), glm::vec3(50.0f)};
+    const auto sun          = glm::normalize(glm::vec3(-1.0f, -2.0f, -1.0f));
+}
+
+TEST(shadow_maps, cascade_splits)
+{
+    auto shadows = pkzo::ShadowMaps({.distance = 80.0f});
+    shadows.begin(glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 1000.0f), glm::mat4(1.0f), scene_bounds);
+
+    auto last = 0.1f;
+    for (const auto split : shadows.get_cascade_splits())
+    {
+        EXPECT_GT(split, last);
+        last = split;
+    }
+    EXPECT_NEAR(80.0f, last, 1e-3f);
+}
+
+TEST(shadow_maps, stable_cascades)
+{
+    auto shadows    = pkzo::ShadowMaps();
+    auto projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 1000.0f);
+    auto view       = glm::lookAt(glm::vec3(3.3f, -7.1f, 2.2f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+
+    shadows.begin(projection, view, scene_bounds);
+    ASSERT_EQ(0, shadows.add_directional(sun));
+    ASSERT_EQ(size_t{pkzo::SHADOW_CASCADES}, shadows.get_view_count());
+    auto first = std::vector<glm::mat4>();
+    for (auto i = 0u; i < shadows.get_view_count(); i++)
+    {
+        first.push_back(shadows.get_view_projection(i));
+    }
+
+    // a move well below a texel of the nearest cascade keeps the views
+    shadows.begin(projection, glm::translate(view, glm::vec3(1e-4f, 0.0f, 0.0f)), scene_bounds);
+    ASSERT_EQ(0, shadows.add_directional(sun));
+    for (auto i = 0u; i < shadows.get_view_count(); i++)
+    {
+        EXPECT_EQ(first[i], shadows.get_view_projection(i));
+    }
+}
+
+TEST(shadow_maps, full_atlas)
+{
+    auto shadows = pkzo::ShadowMaps({.tile_size = 256u});
+    shadows.begin(glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 1000.0f), glm::mat4(1.0f), scene_bounds);
+
+    EXPECT_EQ(0, shadows.add_directional(sun));
+    EXPECT_EQ(pkzo::SHADOW_CASCADES, shadows.add_directional(sun));
+    EXPECT_EQ(-1, shadows.add_directional(sun));
+    EXPECT_EQ(-1, shadows.add_spot(glm::vec3(0.0f), glm::vec3(0.0f, -1.0f, 0.0f), glm::radians(30.0f), 10.0f));
+    EXPECT_EQ(size_t{pkzo::MAX_SHADOW_VIEWS}, shadows.get_view_count());
+
+    // the tiles do not overlap and fit the atlas
+    const auto atlas = shadows.get_atlas_size();
+    for (auto i = 0u; i < shadows.get_view_count(); i++)
+    {
+        const auto offset = shadows.get_tile_offset(i);
+        EXPECT_LE(offset.x + 256u, atlas.x);
+        EXPECT_LE(offset.y + 256u, atlas.y);
+        for (auto j = 0u; j < i; j++)
+        {
+            EXPECT_NE(offset, shadows.get_tile_offset(j));
+        }
+    }
+}
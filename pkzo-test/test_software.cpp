@@ -0,0 +1,230 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <pkzo/pkzo.h>
+
+#include "pkzo_gtest.h"
+
+TEST(software_graphic_context, empty_frame)
+{
+    auto gc = pkzo::SoftwareGraphicContext({
+        .size = glm::uvec2(64u, 48u)
+    });
+
+    gc.clear_screen();
+    gc.swap_buffers();
+
+    auto screenshot = gc.screenshot();
+    EXPECT_EQ(glm::uvec2(64u, 48u), screenshot->get_size());
+    EXPECT_EQ(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), screenshot->get_pixel(glm::uvec2(32u, 24u)));
+    EXPECT_EQ(pkzo::Api::SOFTWARE, gc.get_api());
+}
+
+TEST(software_graphic_context, draws_lit_box)
+{
+    auto gc    = pkzo::SoftwareGraphicContext({
+        .size    = glm::uvec2(80u, 60u),
+        .threads = 2u
+    });
+    auto scene = pkzo::Scene();
+
+    scene.add<pkzo::AmbientLight>({
+        .color = glm::vec3(0.1f)
+    });
+
+    scene.add<pkzo::DirectionalLight>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+        .color     = glm::vec3(1.0f)
+    });
+
+    scene.add<pkzo::BoxGeometry>({
+        .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+        .material  = pkzo::Material::create({})
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    gc.clear_screen();
+    scene.draw(gc);
+    gc.swap_buffers();
+
+    auto screenshot = gc.screenshot();
+    auto center     = screenshot->get_pixel(glm::uvec2(40u, 30u));
+    auto corner     = screenshot->get_pixel(glm::uvec2(0u, 0u));
+    EXPECT_GT(center.r, 0.05f);
+    EXPECT_FLOAT_EQ(center.r, center.g);
+    EXPECT_FLOAT_EQ(center.r, center.b);
+    EXPECT_EQ(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), corner);
+}
+
+TEST(software_graphic_context, draws_lit_box_deferred)
+{
+    auto render = [] (pkzo::SceneRenderer::RenderMode mode) {
+        auto gc    = pkzo::SoftwareGraphicContext({
+            .size = glm::uvec2(80u, 60u)
+        });
+        auto scene = pkzo::Scene();
+
+        scene.get_renderer()->set_render_mode(mode);
+
+        scene.add<pkzo::AmbientLight>({
+            .color = glm::vec3(0.1f)
+        });
+
+        scene.add<pkzo::DirectionalLight>({
+            .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+            .color     = glm::vec3(1.0f)
+        });
+
+        scene.add<pkzo::BoxGeometry>({
+            .transform = pkzo::position(0.0f, 0.0f, 0.0f),
+            .material  = pkzo::Material::create({})
+        });
+
+        scene.add<pkzo::Camera>({
+            .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+        });
+
+        gc.clear_screen();
+        scene.draw(gc);
+        gc.swap_buffers();
+
+        return gc.screenshot();
+    };
+
+    auto forward  = render(pkzo::SceneRenderer::RenderMode::FORWARD);
+    auto deferred = render(pkzo::SceneRenderer::RenderMode::DEFERRED);
+
+    // the geometry buffer stores the base color at 8 bit
+    auto center = deferred->get_pixel(glm::uvec2(40u, 30u));
+    EXPECT_NEAR(forward->get_pixel(glm::uvec2(40u, 30u)).r, center.r, 0.02f);
+    EXPECT_FLOAT_EQ(center.r, center.g);
+    EXPECT_FLOAT_EQ(center.r, center.b);
+    EXPECT_EQ(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), deferred->get_pixel(glm::uvec2(0u, 0u)));
+}
+
+// The floor, box and camera of the render3d light tests.
+void add_render3d_scene(pkzo::Scene& scene)
+{
+    auto base = pkzo::test::get_test_input();
+    auto test_gray   = pkzo::Material::load(base / "materials/TestGray.yml");
+    auto test_orange = pkzo::Material::load(base / "materials/TestOrange.yml");
+
+    scene.add<pkzo::BoxGeometry>({
+        .transform     = pkzo::position(0.0f, 0.0f, -0.5f),
+        .size          = glm::vec3(10.0f, 10.0f, 1.0f),
+        .texture_scale = glm::vec3(10.0f, 10.0f, 1.0f),
+        .material      = test_gray
+    });
+
+    scene.add<pkzo::BoxGeometry>({
+        .transform     = pkzo::position(0.0f, 0.0f, 0.5f),
+        .size          = glm::vec3(1.0f),
+        .texture_scale = glm::vec3(1.0f),
+        .material      = test_orange
+    });
+
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(3.0f, 2.0f, 2.0f), glm::vec3(0.0), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+}
+
+std::shared_ptr<pkzo::MemoryTexture> render_render3d_scene(pkzo::Scene& scene)
+{
+    auto gc = pkzo::SoftwareGraphicContext({
+        .size = glm::uvec2(800u, 600u)
+    });
+
+    // two frames, like the OpenGL tests
+    for (auto i = 0u; i < 2u; i++)
+    {
+        gc.clear_screen();
+        scene.draw(gc);
+        gc.swap_buffers();
+    }
+
+    return gc.screenshot();
+}
+
+// The sum of the per pixel color distances to the OpenGL reference, a mean of
+// 0.02 per pixel; rasterization, filtering and the 8 bit references differ slightly.
+constexpr auto REFERENCE_TOLERANCE = 0.02f * 800.0f * 600.0f;
+
+TEST(software_graphic_context, render3d_ambient_light)
+{
+    auto scene = pkzo::Scene();
+
+    scene.add<pkzo::AmbientLight>({
+        .color = glm::vec3(0.55, 0.58, 0.65) * 0.1f
+    });
+    add_render3d_scene(scene);
+
+    EXPECT_TEXTURE_NAMED_REF_NEAR("render3d-ambient_light", render_render3d_scene(scene), REFERENCE_TOLERANCE);
+}
+
+TEST(software_graphic_context, render3d_directional_light)
+{
+    auto scene = pkzo::Scene();
+
+    scene.add<pkzo::DirectionalLight>({
+        .transform = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+        .color     = glm::vec3(0.55, 0.58, 0.65)
+    });
+    add_render3d_scene(scene);
+
+    EXPECT_TEXTURE_NAMED_REF_NEAR("render3d-directional_light", render_render3d_scene(scene), REFERENCE_TOLERANCE);
+}
+
+TEST(software_graphic_context, render3d_point_light)
+{
+    auto scene = pkzo::Scene();
+
+    scene.add<pkzo::PointLight>({
+        .transform = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+        .color     = glm::vec3(0.55, 0.58, 0.65)
+    });
+    add_render3d_scene(scene);
+
+    EXPECT_TEXTURE_NAMED_REF_NEAR("render3d-point_light", render_render3d_scene(scene), REFERENCE_TOLERANCE);
+}
+
+TEST(software_graphic_context, render3d_spot_light)
+{
+    auto scene = pkzo::Scene();
+
+    scene.add<pkzo::SpotLight>({
+        .transform = pkzo::lookat(glm::vec3(1.4f, 1.5f, 2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+        .color     = glm::vec3(0.55, 0.58, 0.65)
+    });
+    add_render3d_scene(scene);
+
+    EXPECT_TEXTURE_NAMED_REF_NEAR("render3d-spot_light", render_render3d_scene(scene), REFERENCE_TOLERANCE);
+}
+
+TEST(software_graphic_context, only_runs_builtin_shaders)
+{
+    auto gc = pkzo::SoftwareGraphicContext();
+
+    EXPECT_THROW(gc.compile({"void main() {}", "void main() {}"}), std::runtime_error);
+}
@@ -0,0 +1,112 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cmath>
+#include <numbers>
+
+#include <gtest/gtest.h>
+#include <glm/gtc/packing.hpp>
+#include <pkzo/VertexPacking.h>
+
+TEST(vertex_packing, octahedral_round_trip)
+{
+    for (auto i = 0u; i < 64u; i++)
+    {
+        for (auto j = 0u; j <= 32u; j++)
+        {
+            const auto phi   = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / 64.0f;
+            const auto theta = std::numbers::pi_v<float> * static_cast<float>(j) / 32.0f;
+            const auto n     = glm::vec3(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+
+            const auto e = pkzo::encode_octahedral(n);
+            EXPECT_LE(std::abs(e.x), 1.0f);
+            EXPECT_LE(std::abs(e.y), 1.0f);
+            EXPECT_NEAR(1.0f, glm::dot(n, pkzo::decode_octahedral(e)), 1e-5f);
+
+            // the error of the 16 bit encoding is far below a degree
+            const auto q = glm::unpackSnorm2x16(glm::packSnorm2x16(e));
+            EXPECT_LT(std::acos(std::min(glm::dot(n, pkzo::decode_octahedral(q)), 1.0f)), 0.001f);
+        }
+    }
+}
+
+TEST(vertex_packing, packs_relative_to_bounds)
+{
+    const auto data = pkzo::MeshData{
+        .vertexes  = {{-2.0f, 1.0f, 5.0f}, {3.0f, 1.0f, 7.0f}, {0.5f, 1.0f, 6.0f}},
+        .normals   = {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}, {1.0f, 0.0f, 0.0f}},
+        .texcoords = {{0.0f, 0.0f}, {1.0f, 0.5f}, {0.25f, 2.0f}},
+        .faces     = {{0u, 1u, 2u}}
+    };
+
+    const auto packed = pkzo::pack_vertexes(data);
+    ASSERT_EQ(3u, packed.vertexes.size());
+    EXPECT_EQ(glm::vec3(-2.0f, 1.0f, 5.0f), packed.position_offset);
+    // the flat y axis keeps a unit scale
+    EXPECT_EQ(glm::vec3(5.0f, 1.0f, 2.0f), packed.position_scale);
+
+    for (auto i = 0u; i < data.vertexes.size(); i++)
+    {
+        const auto& pv = packed.vertexes[i];
+
+        const auto v = glm::vec3(glm::unpackUnorm4x16(pv.vertex)) * packed.position_scale + packed.position_offset;
+        EXPECT_NEAR(data.vertexes[i].x, v.x, 5.0f / 65535.0f);
+        EXPECT_NEAR(data.vertexes[i].y, v.y, 1e-6f);
+        EXPECT_NEAR(data.vertexes[i].z, v.z, 2.0f / 65535.0f);
+
+        const auto n = pkzo::decode_octahedral(glm::unpackSnorm2x16(pv.normal));
+        EXPECT_NEAR(1.0f, glm::dot(data.normals[i], n), 1e-5f);
+
+        const auto uv = glm::unpackHalf2x16(pv.texcoord);
+        EXPECT_EQ(data.texcoords[i], uv);
+
+        // missing attributes are zero
+        EXPECT_EQ(0u, pv.tangent);
+        EXPECT_EQ(0u, pv.color);
+    }
+}
+
+TEST(vertex_packing, packs_colors)
+{
+    const auto data = pkzo::MeshData{
+        .vertexes = {{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+        .colors   = {{1.0f, 0.0f, 0.5f, 1.0f}, {0.25f, 0.75f, 1.0f, 0.0f}}
+    };
+
+    const auto packed = pkzo::pack_vertexes(data);
+    ASSERT_EQ(2u, packed.vertexes.size());
+    for (auto i = 0u; i < data.colors.size(); i++)
+    {
+        const auto color = glm::unpackUnorm4x8(packed.vertexes[i].color);
+        for (auto c = 0; c < 4; c++)
+        {
+            EXPECT_NEAR(data.colors[i][c], color[c], 1.0f / 255.0f);
+        }
+    }
+}
+
+TEST(vertex_packing, empty_mesh)
+{
+    const auto packed = pkzo::pack_vertexes({});
+    EXPECT_TRUE(packed.vertexes.empty());
+    EXPECT_EQ(glm::vec3(1.0f), packed.position_scale);
+    EXPECT_EQ(glm::vec3(0.0f), packed.position_offset);
+}
@@ -56,3 +56,143 @@ TEST(window, screenshot)
 
     EXPECT_TEXTURE_REF_EQ(window.screenshot());
 }
+
+TEST(window, streams_debug_lines)
+{
+    auto window = pkzo::Window({
+        .title = "test",
+        .size  = glm::uvec2(800u, 600u),
+        .state = pkzo::WindowState::WINDOW,
+        .api   = pkzo::Api::OPENGL
+    });
+
+    auto scene = pkzo::Scene();
+    scene.add<pkzo::Camera>({
+        .transform = pkzo::lookat(glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))
+    });
+
+    auto lines = std::vector<size_t>{};
+    window.on_draw([&] (auto& gc) {
+        lines.push_back(gc.get_render_stats().lines);
+        scene.draw(gc);
+    });
+
+    // more lines every frame, the stream buffer outgrows its initial size
+    for (auto frame = 1u; frame <= 6u; frame++)
+    {
+        for (auto i = 0u; i < frame * 10000u; i++)
+        {
+            auto y = static_cast<float>(i % 100u) * 0.01f;
+            scene.get_renderer()->add_debug_line(glm::vec3(0.0f, y, -1.0f), glm::vec3(0.0f, y, 1.0f), glm::vec4(1.0f));
+        }
+        window.draw();
+    }
+    window.draw();
+
+    EXPECT_EQ(std::vector<size_t>({0u, 10000u, 20000u, 30000u, 40000u, 50000u, 60000u}), lines);
+}
+
+TEST(window, stream_growth_between_draws)
+{
+    auto window = pkzo::Window({
+        .title = "test",
+        .size  = glm::uvec2(800u, 600u),
+        .state = pkzo::WindowState::WINDOW,
+        .api   = pkzo::Api::OPENGL
+    });
+
+    auto shader = std::shared_ptr<pkzo::Shader>();
+    auto quad   = std::shared_ptr<pkzo::Mesh>();
+    auto large  = std::shared_ptr<pkzo::Mesh>();
+    auto center = glm::vec4(0.0f);
+    window.on_draw([&] (auto& gc) {
+        if (shader == nullptr)
+        {
+            shader = gc.compile({
+                .vertex   = "#version 430 core\n"
+                            "layout(location = 0) in vec3 atr_Vertex;\n"
+                            "layout(location = 4) in vec4 atr_Color;\n"
+                            "out vec4 var_Color;\n"
+                            "void main() { var_Color = atr_Color; gl_Position = vec4(atr_Vertex, 1.0); }\n",
+                .fragment = "#version 430 core\n"
+                            "in vec4 var_Color;\n"
+                            "out vec4 out_Color;\n"
+                            "void main() { out_Color = var_Color; }\n"
+            });
+
+            quad = gc.upload_mesh({
+                .vertexes = {{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f}},
+                .colors   = {glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(1.0f, 0.0f, 0.0f, 1.0f)},
+                .faces    = {{0u, 1u, 2u}, {2u, 3u, 0u}}
+            }, true);
+
+            // degenerate faces, more than the initial size of the stream buffer
+            large = gc.upload_mesh({
+                .vertexes = {glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f)},
+                .faces    = std::vector<glm::uvec3>(200000u, glm::uvec3(0u, 1u, 2u))
+            }, true);
+        }
+
+        gc.start_pass("stream growth", shader);
+        gc.set_depth_test(pkzo::DepthTest::DISABLED);
+        gc.draw(quad);
+        gc.draw(large);
+        // the quad is not written again this frame, its indexes are in the grown out buffer
+        gc.clear_screen();
+        gc.draw(quad);
+        gc.end_pass();
+        center = gc.screenshot()->get_pixel(glm::uvec2(400u, 300u));
+    });
+
+    window.draw();
+
+    EXPECT_GLM_EQ(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), center);
+}
+
+TEST(window, uniform_stream_growth_keeps_bound_blocks)
+{
+    auto window = pkzo::Window({
+        .title = "test",
+        .size  = glm::uvec2(800u, 600u),
+        .state = pkzo::WindowState::WINDOW,
+        .api   = pkzo::Api::OPENGL
+    });
+
+    auto shader = std::shared_ptr<pkzo::Shader>();
+    auto center = glm::vec4(0.0f);
+    window.on_draw([&] (auto& gc) {
+        if (shader == nullptr)
+        {
+            shader = gc.compile({
+                .vertex   = "#version 430 core\n"
+                            "layout(location = 0) in vec3 atr_Vertex;\n"
+                            "void main() { gl_Position = vec4(atr_Vertex, 1.0); }\n",
+                .fragment = "#version 430 core\n"
+                            "layout(std140, binding = 0) uniform ColorBlock { vec4 color; } blk_Color;\n"
+                            "out vec4 out_Color;\n"
+                            "void main() { out_Color = blk_Color.color; }\n"
+            });
+        }
+
+        gc.start_pass("uniform growth", shader);
+        gc.set_depth_test(pkzo::DepthTest::DISABLED);
+
+        const auto red = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+        gc.set_uniform_buffer(0, sizeof(red), &red);
+
+        // enough blocks to outgrow the per frame uniform stream
+        const auto other = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
+        for (auto i = 0u; i < 4096u; i++)
+        {
+            gc.set_uniform_buffer(1, sizeof(other), &other);
+        }
+
+        gc.draw_fullscreen();
+        gc.end_pass();
+        center = gc.screenshot()->get_pixel(glm::uvec2(400u, 300u));
+    });
+
+    window.draw();
+
+    EXPECT_GLM_EQ(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), center);
+}
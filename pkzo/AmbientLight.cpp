@@ -61,4 +61,14 @@ namespace pkzo
     {
         return {};
     }
+
+    float AmbientLight::get_range() const
+    {
+        return 0.0f;
+    }
+
+    bool AmbientLight::get_cast_shadows() const
+    {
+        return false;
+    }
 }
@@ -45,6 +45,8 @@ namespace pkzo
         glm::vec3 get_direction() const override;
         glm::vec3 get_position() const override;
         glm::vec2 get_angles() const override;
+        float get_range() const override;
+        bool get_cast_shadows() const override;
 
     private:
         glm::vec3 color;
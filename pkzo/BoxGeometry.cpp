@@ -226,4 +226,9 @@ namespace pkzo
         mesh = generate_box_mesh(size, texture_scale);
         return mesh;
     }
+
+    std::shared_ptr<Mesh> BoxGeometry::get_occluder() const
+    {
+        return get_mesh();
+    }
 }
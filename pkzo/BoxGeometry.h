@@ -53,6 +53,9 @@ namespace pkzo
 
         std::shared_ptr<Mesh> get_mesh() const override;
 
+        //! A box is solid, it occludes with its own mesh.
+        std::shared_ptr<Mesh> get_occluder() const override;
+
     private:
         glm::vec3 size;
         glm::vec3 texture_scale;
@@ -0,0 +1,78 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "CacheFile.h"
+
+#include "debug.h"
+
+namespace pkzo
+{
+    ContentHash::ContentHash(uint64_t seed)
+    {
+        add_value(seed);
+    }
+
+    void ContentHash::add(const void* data, size_t size)
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (auto i = size_t{0u}; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    void ContentHash::add(std::string_view str)
+    {
+        add(str.data(), str.size());
+    }
+
+    uint64_t ContentHash::get() const
+    {
+        return hash;
+    }
+
+    bool write_cache_file(const std::filesystem::path& path, const std::function<void (std::ostream&)>& write)
+    {
+        auto tmp_path = std::filesystem::path(path).replace_extension(".tmp");
+        {
+            auto output = std::ofstream(tmp_path, std::ios::binary | std::ios::trunc);
+            write(output);
+            if (!output)
+            {
+                trace(tfm::format("Failed to write cache file %s.", tmp_path.string()));
+                return false;
+            }
+        }
+
+        auto ec = std::error_code{};
+        std::filesystem::rename(tmp_path, path, ec);
+        if (ec)
+        {
+            trace(tfm::format("Failed to write cache file %s: %s", path.string(), ec.message()));
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+        return true;
+    }
+}
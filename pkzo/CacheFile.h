@@ -0,0 +1,85 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+#include "api.h"
+
+namespace pkzo
+{
+    //! FNV-1a hash, stable across runs and platforms unlike std::hash.
+    class PKZO_EXPORT ContentHash
+    {
+    public:
+        ContentHash() = default;
+        ContentHash(uint64_t seed);
+
+        void add(const void* data, size_t size);
+        void add(std::string_view str);
+
+        template <typename T>
+        void add_value(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            add(&value, sizeof(T));
+        }
+
+        uint64_t get() const;
+
+    private:
+        uint64_t hash = 14695981039346656037ull;
+    };
+
+    //! Write a value of a cache file, in native byte order.
+    template <typename T>
+    void write_cache_value(std::ostream& out, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    //! Read a value written with write_cache_value, check the stream afterwards.
+    template <typename T>
+    T read_cache_value(std::istream& in)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto value = T{};
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        return value;
+    }
+
+    //! Write a cache file.
+    //!
+    //! The content is written to a temporary file that is renamed when
+    //! complete, so that a crash never leaves a truncated file behind.
+    //! Failures are traced, a cache file is never essential.
+    //!
+    //! @returns whether the file was written
+    PKZO_EXPORT bool write_cache_file(const std::filesystem::path& path, const std::function<void (std::ostream&)>& write);
+}
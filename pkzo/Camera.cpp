@@ -28,8 +28,18 @@
 
 namespace pkzo
 {
+    glm::mat4 make_projection_matrix(float fov, float distance, const glm::uvec2& resolution)
+    {
+        auto aspect = static_cast<float>(resolution.x) / static_cast<float>(resolution.y);
+        auto fovy   = 2.0f * std::atan(std::tan(glm::radians(fov) / 2.0f) / aspect);
+        return glm::perspective(fovy, aspect, 0.01f, distance);
+    }
+
     Camera::Camera(Init init)
-    : Node({init.parent, init.transform})
+    : Node({init.parent, init.transform}),
+      fov(init.fov),
+      distance(init.distance),
+      resolution(init.resolution)
     {
         auto renderer = get_root()->get_renderer();
         renderer->add(this);
@@ -85,9 +95,7 @@ namespace pkzo
             return *projection_matrix_cache;
         }
 
-        auto aspect            = static_cast<float>(resolution.x) / static_cast<float>(resolution.y);
-        auto fovy              = 2.0f * std::atan(std::tan(glm::radians(fov) / 2.0f) / aspect);
-        auto projection_matrix = glm::perspective(fovy, aspect, 0.01f, distance);
+        auto projection_matrix = make_projection_matrix(fov, distance, resolution);
 
         projection_matrix_cache = projection_matrix;
         return projection_matrix;
@@ -95,7 +103,8 @@ namespace pkzo
 
     glm::mat4 Camera::get_view_matrix() const
     {
-        if (view_matrix_cache)
+        // nodes in a transform store are not notified when an ancestor moves
+        if (view_matrix_cache && get_transform_store() == nullptr)
         {
             return *view_matrix_cache;
         }
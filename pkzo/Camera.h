@@ -29,6 +29,9 @@ namespace pkzo
 {
     class Scene;
 
+    //! Perspective projection with a horizontal field of view in degrees.
+    PKZO_EXPORT glm::mat4 make_projection_matrix(float fov, float distance, const glm::uvec2& resolution);
+
     class PKZO_EXPORT Camera : public SceneNode
     {
     public:
@@ -0,0 +1,62 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "CommandBuffer.h"
+
+namespace pkzo
+{
+    void CommandBuffer::clear()
+    {
+        commands.clear();
+    }
+
+    void CommandBuffer::draw(uint64_t key, uint32_t state, uint32_t mesh, const glm::mat4& transform)
+    {
+        commands.push_back({key, state, mesh, transform});
+    }
+
+    void CommandBuffer::append(const CommandBuffer& other)
+    {
+        commands.insert(end(commands), begin(other.commands), end(other.commands));
+    }
+
+    void CommandBuffer::sort()
+    {
+        radix_sort(commands, sort_buffer);
+    }
+
+    bool CommandBuffer::empty() const
+    {
+        return commands.empty();
+    }
+
+    size_t CommandBuffer::get_size() const
+    {
+        return commands.size();
+    }
+
+    const std::vector<DrawCommand>& CommandBuffer::get_commands() const
+    {
+        return commands;
+    }
+}
@@ -0,0 +1,122 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "api.h"
+
+namespace pkzo
+{
+    //! A recorded draw of a mesh.
+    //!
+    //! The mesh and state are indexes into tables of the producer, so that
+    //! commands can be recorded on any thread and copied around freely.
+    struct DrawCommand
+    {
+        uint64_t  key       = 0u; //!< Commands are submitted in the order of their keys.
+        uint32_t  state     = 0u; //!< Producer defined state, like a material.
+        uint32_t  mesh      = 0u; //!< Producer defined mesh.
+        glm::mat4 transform = glm::mat4(1.0f);
+    };
+    static_assert(std::is_trivially_copyable_v<DrawCommand>);
+
+    //! Draw commands recorded ahead of submission.
+    //!
+    //! Each recording thread fills its own buffer, the buffers are then
+    //! appended into one, sorted by key and replayed on the thread that owns
+    //! the graphic context. The buffer only holds the commands, it does not
+    //! know about any graphic context.
+    class PKZO_EXPORT CommandBuffer
+    {
+    public:
+        void clear();
+
+        void draw(uint64_t key, uint32_t state, uint32_t mesh, const glm::mat4& transform);
+
+        //! Append the commands of another buffer, like one recorded on another thread.
+        void append(const CommandBuffer& other);
+
+        //! Sort the commands by key, commands with equal keys keep their order.
+        void sort();
+
+        [[nodiscard]]
+        bool empty() const;
+
+        [[nodiscard]]
+        size_t get_size() const;
+
+        const std::vector<DrawCommand>& get_commands() const;
+
+    private:
+        std::vector<DrawCommand> commands;
+        std::vector<DrawCommand> sort_buffer;
+    };
+
+    //! LSD radix sort on 8 bit digits of the 64 bit key member, stable.
+    //!
+    //! Skips digits where all keys are equal, the buffer is scratch space.
+    template <typename Item>
+    void radix_sort(std::vector<Item>& items, std::vector<Item>& buffer)
+    {
+        if (items.size() < 2u)
+        {
+            return;
+        }
+
+        buffer.resize(items.size());
+
+        for (auto shift = 0u; shift < 64u; shift += 8u)
+        {
+            auto counts = std::array<size_t, 256>{};
+            for (const auto& item : items)
+            {
+                counts[(item.key >> shift) & 0xFFu]++;
+            }
+
+            if (counts[(items.front().key >> shift) & 0xFFu] == items.size())
+            {
+                continue;
+            }
+
+            auto offset = size_t{0u};
+            for (auto& count : counts)
+            {
+                auto n = count;
+                count  = offset;
+                offset += n;
+            }
+
+            for (const auto& item : items)
+            {
+                buffer[counts[(item.key >> shift) & 0xFFu]++] = item;
+            }
+
+            items.swap(buffer);
+        }
+    }
+}
@@ -21,7 +21,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <vector>
 
 #include <glm/glm.hpp>
 
@@ -40,6 +42,27 @@ namespace pkzo
         ZNEG
     };
 
+    //! Pixels of one face at one mip level, rows are tightly packed.
+    struct CubeMapImage
+    {
+        unsigned int           size = 0u;
+        std::vector<std::byte> pixels;
+    };
+
+    //! Pixels of all faces and mip levels of a cube map.
+    //!
+    //! The images are ordered by face and then mip level, the image of a face
+    //! and level is at face * miplevels + mip.
+    struct CubeMapData
+    {
+        std::string               id         = "unnamed";
+        unsigned int              size       = 0u;
+        DataType                  data_type  = DataType::FLOAT;
+        ColorMode                 color_mode = ColorMode::RGB;
+        unsigned int              miplevels  = 1u;
+        std::vector<CubeMapImage> images;
+    };
+
     class PKZO_EXPORT CubeMap
     {
     public:
@@ -0,0 +1,154 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "CubeMapCache.h"
+
+#include "debug.h"
+
+namespace pkzo
+{
+    constexpr auto CUBEMAP_MAGIC = std::string_view{"PKZOCMB1"};
+    constexpr auto MAX_ID_SIZE   = uint32_t{1024u};
+    constexpr auto MAX_MIPLEVELS = uint32_t{32u};
+
+    CubeMapCache::CubeMapCache(const std::filesystem::path& dir)
+    {
+        set_directory(dir);
+    }
+
+    void CubeMapCache::set_directory(const std::filesystem::path& value)
+    {
+        directory = value;
+        if (directory.empty())
+        {
+            return;
+        }
+
+        auto ec = std::error_code{};
+        std::filesystem::create_directories(directory, ec);
+        if (ec)
+        {
+            trace(tfm::format("Failed to create cube map cache directory %s: %s", directory.string(), ec.message()));
+            directory.clear();
+        }
+    }
+
+    const std::filesystem::path& CubeMapCache::get_directory() const
+    {
+        return directory;
+    }
+
+    bool CubeMapCache::is_enabled() const
+    {
+        return !directory.empty();
+    }
+
+    std::filesystem::path CubeMapCache::get_path(uint64_t key) const
+    {
+        return directory / tfm::format("%016x.cube", key);
+    }
+
+    std::optional<CubeMapData> CubeMapCache::load(uint64_t key) const
+    {
+        if (directory.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto input = std::ifstream(get_path(key), std::ios::binary);
+        if (!input)
+        {
+            return std::nullopt;
+        }
+
+        auto magic = std::string(CUBEMAP_MAGIC.size(), '\0');
+        input.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+        if (!input || magic != CUBEMAP_MAGIC)
+        {
+            return std::nullopt;
+        }
+
+        auto data       = CubeMapData{};
+        auto id_size    = read_cache_value<uint32_t>(input);
+        data.id.resize(std::min(id_size, MAX_ID_SIZE));
+        input.read(data.id.data(), static_cast<std::streamsize>(data.id.size()));
+        data.size       = read_cache_value<uint32_t>(input);
+        auto data_type  = read_cache_value<uint32_t>(input);
+        auto color_mode = read_cache_value<uint32_t>(input);
+        data.miplevels  = read_cache_value<uint32_t>(input);
+        if (!input || id_size > MAX_ID_SIZE || data_type > static_cast<uint32_t>(DataType::FLOAT) || color_mode > static_cast<uint32_t>(ColorMode::DEPTH) || data.miplevels == 0u || data.miplevels > MAX_MIPLEVELS)
+        {
+            return std::nullopt;
+        }
+        data.data_type  = static_cast<DataType>(data_type);
+        data.color_mode = static_cast<ColorMode>(color_mode);
+
+        // no image is larger than a RGBA float face, anything else is a damaged file
+        const auto max_image_bytes = uint64_t{data.size} * uint64_t{data.size} * sizeof(glm::vec4);
+
+        data.images.resize(6u * data.miplevels);
+        for (auto& image : data.images)
+        {
+            image.size     = read_cache_value<uint32_t>(input);
+            auto byte_size = read_cache_value<uint64_t>(input);
+            if (!input || image.size > data.size || byte_size > max_image_bytes)
+            {
+                return std::nullopt;
+            }
+
+            image.pixels.resize(static_cast<size_t>(byte_size));
+            input.read(reinterpret_cast<char*>(image.pixels.data()), static_cast<std::streamsize>(byte_size));
+            if (!input)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return data;
+    }
+
+    void CubeMapCache::store(uint64_t key, const CubeMapData& data) const
+    {
+        if (directory.empty() || data.images.empty())
+        {
+            return;
+        }
+        check(data.images.size() == 6u * data.miplevels, "The cube map data must have an image for each face and mip level.");
+
+        write_cache_file(get_path(key), [&] (std::ostream& output) {
+            output.write(CUBEMAP_MAGIC.data(), static_cast<std::streamsize>(CUBEMAP_MAGIC.size()));
+            write_cache_value(output, static_cast<uint32_t>(data.id.size()));
+            output.write(data.id.data(), static_cast<std::streamsize>(data.id.size()));
+            write_cache_value(output, static_cast<uint32_t>(data.size));
+            write_cache_value(output, static_cast<uint32_t>(data.data_type));
+            write_cache_value(output, static_cast<uint32_t>(data.color_mode));
+            write_cache_value(output, static_cast<uint32_t>(data.miplevels));
+            for (const auto& image : data.images)
+            {
+                write_cache_value(output, static_cast<uint32_t>(image.size));
+                write_cache_value(output, static_cast<uint64_t>(image.pixels.size()));
+                output.write(reinterpret_cast<const char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+            }
+        });
+    }
+}
@@ -0,0 +1,65 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+#include "api.h"
+#include "CacheFile.h"
+#include "CubeMap.h"
+
+namespace pkzo
+{
+    //! Disk cache of generated cube maps.
+    //!
+    //! Cube maps are stored with all faces and mip levels under a key that
+    //! the caller derives from everything that affects the result, such as
+    //! the source content, generator parameters and shader sources. The
+    //! files are loaded as is, a changed input yields a new key and the
+    //! stale file is never read again.
+    class PKZO_EXPORT CubeMapCache
+    {
+    public:
+        CubeMapCache() = default;
+
+        //! @param directory the directory for cube map files, empty disables the cache
+        CubeMapCache(const std::filesystem::path& directory);
+
+        void set_directory(const std::filesystem::path& value);
+        const std::filesystem::path& get_directory() const;
+
+        bool is_enabled() const;
+
+        //! Load the cube map with the key, nothing if it is not cached or the file is damaged.
+        std::optional<CubeMapData> load(uint64_t key) const;
+
+        //! Store the cube map under the key, data without images is ignored.
+        void store(uint64_t key, const CubeMapData& data) const;
+
+    private:
+        std::filesystem::path directory;
+
+        std::filesystem::path get_path(uint64_t key) const;
+    };
+}
@@ -29,5 +29,5 @@ out vec4 var_Color;
 void main()
 {
     var_Color   = atr_Color;
-    gl_Position = uni_ProjectionMatrix * uni_ViewMatrix * vec4(atr_Vertex, 1.0);
+    gl_Position = uni_ProjectionMatrix * uni_ViewMatrix * vec4(get_vertex(), 1.0);
 }
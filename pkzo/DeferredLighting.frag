@@ -0,0 +1,58 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#version 430 core
+
+#include "uniforms.glsl"
+#include "outputs.glsl"
+#include "math.glsl"
+#include "lighting.glsl"
+
+// Shades the pixels covered by the geometry buffer, the lights are
+// looked up in the light clusters like in the forward pass.
+
+in vec3 var_CameraPos;
+
+void main()
+{
+    ivec2 texel = ivec2(gl_FragCoord.xy);
+    float depth = texelFetch(uni_GBufferDepth, texel, 0).r;
+    if (depth == 1.0)
+    {
+        // nothing was drawn, the sky box shows through
+        discard;
+    }
+
+    vec2 uv       = gl_FragCoord.xy / vec2(textureSize(uni_GBufferDepth, 0));
+    vec4 world    = blk_Frame.inverse_view_projection_matrix * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+    vec3 position = world.xyz / world.w;
+
+    vec3  baseColor          = texelFetch(uni_GBufferBaseColor, texel, 0).rgb;
+    vec3  normal             = texelFetch(uni_GBufferNormal, texel, 0).xyz;
+    vec2  metallicRoughness  = texelFetch(uni_GBufferMetallicRoughness, texel, 0).rg;
+    vec3  emissive           = texelFetch(uni_GBufferEmissive, texel, 0).rgb;
+    vec3  view               = normalize(var_CameraPos - position);
+
+    vec3 result = shadeSurface(position, normal, view, baseColor, metallicRoughness.r, metallicRoughness.g, emissive);
+
+    out_FragColor0 = vec4(tonemap(result), 1.0);
+    gl_FragDepth   = depth;
+}
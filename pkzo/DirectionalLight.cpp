@@ -28,7 +28,8 @@ namespace pkzo
 
     DirectionalLight::DirectionalLight(Init init)
     : Light({init.parent, init.transform}),
-      color(init.color) {}
+      color(init.color),
+      cast_shadows(init.cast_shadows) {}
 
     DirectionalLight::~DirectionalLight() = default;
 
@@ -37,6 +38,11 @@ namespace pkzo
         color = value;
     }
 
+    void DirectionalLight::set_cast_shadows(bool value)
+    {
+        cast_shadows = value;
+    }
+
     LightType DirectionalLight::get_type() const
     {
         return LightType::DIRECTIONAL;
@@ -62,4 +68,14 @@ namespace pkzo
     {
         return {};
     }
+
+    float DirectionalLight::get_range() const
+    {
+        return 0.0f;
+    }
+
+    bool DirectionalLight::get_cast_shadows() const
+    {
+        return cast_shadows;
+    }
 }
@@ -30,23 +30,29 @@ namespace pkzo
     public:
         struct Init
         {
-            Node*     parent    = nullptr;
-            glm::mat4 transform = glm::mat4(1.0f);
-            glm::vec3 color     = glm::vec3(0.1f);
+            Node*     parent       = nullptr;
+            glm::mat4 transform    = glm::mat4(1.0f);
+            glm::vec3 color        = glm::vec3(0.1f);
+            //! Render cascaded shadow maps for this light.
+            bool      cast_shadows = false;
         };
 
         DirectionalLight(Init init);
         ~DirectionalLight();
 
         void set_color(const glm::vec3& value);
+        void set_cast_shadows(bool value);
 
         LightType get_type() const override;
         glm::vec3 get_color() const override;
         glm::vec3 get_direction() const override;
         glm::vec3 get_position() const override;
         glm::vec2 get_angles() const override;
+        float get_range() const override;
+        bool get_cast_shadows() const override;
 
     private:
         glm::vec3 color;
+        bool      cast_shadows;
     };
 }
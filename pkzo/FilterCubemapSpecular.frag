@@ -25,62 +25,63 @@
 #include "outputs.glsl"
 #include "math.glsl"
 
-#define SAMPLES 1024
-#define MIPS    6
+// GGX prefilter with filtered importance sampling: each sample reads the
+// mip of the source whose texels cover the solid angle of the sample, so
+// few samples give a smooth result.
 
 in vec3 var_Direction;
 
+// rough levels are small and blurry, they need few samples
+uint specularSamples(float roughness)
+{
+    return uint(mix(16.0, 64.0, roughness));
+}
+
 void main()
 {
-    if (uni_MipLevel > MIPS)
+    if (uni_MipLevel >= SPECULAR_MIP_LEVELS)
     {
         discard;
     }
 
-    out_FragColor0 = vec4(0, 0, 0, 1);
-    return;
-
-    float s[7];
-    s[0] = 1024.0;
-    s[1] = 512.0;
-    s[2] = 256.0;
-    s[3] = 128.0;
-    s[4] = 32.0;
-    s[5] = 16.0;
-    s[6] = 8.0;
+    vec3  normal    = normalize(var_Direction);
+    float roughness = specularMipRoughness(float(uni_MipLevel));
+    if (roughness == 0.0)
+    {
+        out_FragColor0 = vec4(textureLod(uni_CubeMap, normal, 0).rgb, 1);
+        return;
+    }
 
-    uint n[7];
-    n[0] = 2084;
-    n[1] = 2084;
-    n[2] = 1024;
-    n[3] = 1024;
-    n[4] = 512;
-    n[5] = 512;
-    n[6] = 512;
+    mat3  tbn     = tangentFrame(normal);
+    float alpha   = roughness * roughness;
+    uint  samples = specularSamples(roughness);
 
-    vec3 normal = normalize(var_Direction);
+    float size            = float(textureSize(uni_CubeMap, 0).x);
+    float texelSolidAngle = 4.0 * PI / (6.0 * size * size);
 
-    vec3 up = vec3(0,0,1);
-    vec3 right = normalize(cross(up,normal));
-    up = cross(normal,right);
+    vec3  color  = vec3(0);
+    float weight = 0;
 
-    mat3 tbn = mat3(right, up, normal);
+    // the view is the normal, the reflection lobe is centered on it
+    for (uint i = 0; i < samples; i++)
+    {
+        vec2 xi = hammersley2d(i, samples);
+        vec3 h  = tbn * importanceSample_ggx(xi.x, xi.y, alpha);
+        vec3 l  = reflect(-normal, h);
 
-    vec3  color = vec3(0);
-    float power = 0;
+        float NdotL = dot(normal, l);
+        if (NdotL > 0)
+        {
+            float NdotH = max(dot(normal, h), 0);
+            float pdf   = distribution_ggx(NdotH, alpha) * 0.25;
 
-    float fs = s[uni_MipLevel];
-    uint samples = n[uni_MipLevel];
+            float sampleSolidAngle = 1.0 / (float(samples) * pdf + 0.0001);
+            float mip              = max(0.5 * log2(sampleSolidAngle / texelSolidAngle) + 1.0, 0.0);
 
-    for (uint i = 0; i < samples; i++)
-    {
-        vec2 s = hammersley2d(i, samples);
-        vec3 l = hemisphereSample_cos(s.x, s.y);
-        l = tbn * l;
-        float NxL = pow(dot(normal, l), fs);
-        color += texture(uni_CubeMap, l).rgb * NxL;
-        power += NxL;
+            color  += textureLod(uni_CubeMap, l, mip).rgb * NdotL;
+            weight += NdotL;
+        }
     }
 
-    out_FragColor0 = vec4(color / power, 1);
-}
\ No newline at end of file
+    out_FragColor0 = vec4(color / max(weight, 0.0001), 1);
+}
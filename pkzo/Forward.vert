@@ -31,18 +31,19 @@ out mat3 var_TBN;
 
 void main()
 {
-    mat3 normalMatrix = mat3(transpose(inverse(uni_ModelMatrix)));
-    vec3 normal      = normalize(normalMatrix * atr_Normal);
-    vec3 tangent     = normalize(normalMatrix * atr_Tangent);
+    mat4 modelMatrix  = blk_Object.instanced != 0 ? atr_InstanceModelMatrix : blk_Object.model_matrix;
+    mat3 normalMatrix = mat3(transpose(inverse(modelMatrix)));
+    vec3 normal      = normalize(normalMatrix * get_normal());
+    vec3 tangent     = normalize(normalMatrix * get_tangent());
     vec3 bitangent   = cross(normal, tangent);
     var_TBN          = mat3(tangent, bitangent, normal);
 
     var_TexCoord     = atr_TexCoord;
 
-    vec4 world_pos  = uni_ModelMatrix * vec4(atr_Vertex, 1.0);
+    vec4 world_pos  = modelMatrix * vec4(get_vertex(), 1.0);
     var_Position    = world_pos.xyz;
 
-    var_CameraPos  = (inverse(uni_ViewMatrix) * vec4(0.0, 0.0, 0.0, 1.0)).xyz;
+    var_CameraPos  = (inverse(blk_Frame.view_matrix) * vec4(0.0, 0.0, 0.0, 1.0)).xyz;
 
-    gl_Position     = uni_ProjectionMatrix * uni_ViewMatrix * world_pos;
+    gl_Position     = blk_Frame.projection_matrix * blk_Frame.view_matrix * world_pos;
 }
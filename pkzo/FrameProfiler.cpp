@@ -0,0 +1,294 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <nlohmann/json.hpp>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    float to_milliseconds(FrameProfiler::clock::duration duration)
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+    FrameProfiler::FrameProfiler()
+    : FrameProfiler(Init{}) {}
+
+    FrameProfiler::FrameProfiler(Init init)
+    : history(std::max(init.history, size_t{1u})), enabled(init.enabled)
+    {
+        current.start = clock::now();
+    }
+
+    void FrameProfiler::set_enabled(bool value)
+    {
+        enabled = value;
+    }
+
+    bool FrameProfiler::is_enabled() const
+    {
+        return enabled;
+    }
+
+    uint64_t FrameProfiler::get_frame() const
+    {
+        return current.frame;
+    }
+
+    size_t FrameProfiler::start_pass(const std::string_view name)
+    {
+        if (!enabled)
+        {
+            return NO_PASS;
+        }
+
+        auto index = current.passes.size();
+        current.passes.push_back({
+            .name      = std::string(name),
+            .depth     = static_cast<unsigned int>(open_passes.size()),
+            .cpu_start = clock::now()
+        });
+        open_passes.push_back(index);
+        return index;
+    }
+
+    void FrameProfiler::end_pass()
+    {
+        // passes started while disabled are not tracked
+        if (open_passes.empty())
+        {
+            return;
+        }
+
+        auto& pass = current.passes[open_passes.back()];
+        pass.cpu_time = to_milliseconds(clock::now() - pass.cpu_start);
+        open_passes.pop_back();
+    }
+
+    void FrameProfiler::end_frame()
+    {
+        while (!open_passes.empty())
+        {
+            end_pass();
+        }
+
+        auto now = clock::now();
+        current.cpu_time = to_milliseconds(now - current.start);
+
+        auto frame = current.frame;
+        frames.push_back(std::move(current));
+        while (frames.size() > history)
+        {
+            frames.pop_front();
+        }
+
+        current = FrameTiming{
+            .frame = frame + 1u,
+            .start = now
+        };
+    }
+
+    void FrameProfiler::set_gpu_time(uint64_t frame, size_t pass, time_point start, float time)
+    {
+        FrameTiming* timing = nullptr;
+        if (frame == current.frame)
+        {
+            timing = &current;
+        }
+        else if (!frames.empty() && frame >= frames.front().frame && frame <= frames.back().frame)
+        {
+            timing = &frames[frame - frames.front().frame];
+        }
+
+        if (timing == nullptr || pass >= timing->passes.size())
+        {
+            return;
+        }
+
+        timing->passes[pass].gpu_start = start;
+        timing->passes[pass].gpu_time  = time;
+    }
+
+    const std::deque<FrameProfiler::FrameTiming>& FrameProfiler::get_frames() const
+    {
+        return frames;
+    }
+
+    std::vector<FrameProfiler::PassStats> FrameProfiler::get_pass_stats() const
+    {
+        struct Samples
+        {
+            std::string        name;
+            std::vector<float> cpu;
+            std::vector<float> gpu;
+        };
+        auto samples = std::vector<Samples>();
+
+        for (const auto& frame : frames)
+        {
+            for (const auto& pass : frame.passes)
+            {
+                auto i = std::ranges::find(samples, pass.name, &Samples::name);
+                if (i == end(samples))
+                {
+                    i = samples.insert(end(samples), {pass.name});
+                }
+
+                i->cpu.push_back(pass.cpu_time);
+                if (pass.gpu_start)
+                {
+                    i->gpu.push_back(pass.gpu_time);
+                }
+            }
+        }
+
+        auto result = std::vector<PassStats>();
+        result.reserve(samples.size());
+        for (auto& s : samples)
+        {
+            result.push_back({
+                .name        = s.name,
+                .cpu_samples = s.cpu.size(),
+                .cpu         = compute_percentiles(std::move(s.cpu)),
+                .gpu_samples = s.gpu.size(),
+                .gpu         = compute_percentiles(std::move(s.gpu))
+            });
+        }
+        return result;
+    }
+
+    FrameProfiler::Percentiles FrameProfiler::get_frame_stats() const
+    {
+        auto values = std::vector<float>();
+        values.reserve(frames.size());
+        for (const auto& frame : frames)
+        {
+            values.push_back(frame.cpu_time);
+        }
+        return compute_percentiles(std::move(values));
+    }
+
+    void FrameProfiler::write_chrome_trace(std::ostream& out) const
+    {
+        constexpr auto PID     = 1;
+        constexpr auto CPU_TID = 1;
+        constexpr auto GPU_TID = 2;
+
+        auto events = nlohmann::json::array();
+        events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", PID}, {"tid", CPU_TID}, {"args", {{"name", "CPU"}}}});
+        events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", PID}, {"tid", GPU_TID}, {"args", {{"name", "GPU"}}}});
+
+        if (!frames.empty())
+        {
+            const auto base = frames.front().start;
+            auto to_microseconds = [&] (time_point time) {
+                return std::chrono::duration<double, std::micro>(time - base).count();
+            };
+
+            for (const auto& frame : frames)
+            {
+                events.push_back({
+                    {"name", tfm::format("Frame %d", frame.frame)},
+                    {"cat",  "frame"},
+                    {"ph",   "X"},
+                    {"pid",  PID},
+                    {"tid",  CPU_TID},
+                    {"ts",   to_microseconds(frame.start)},
+                    {"dur",  frame.cpu_time * 1000.0}
+                });
+
+                for (const auto& pass : frame.passes)
+                {
+                    events.push_back({
+                        {"name", pass.name},
+                        {"cat",  "cpu"},
+                        {"ph",   "X"},
+                        {"pid",  PID},
+                        {"tid",  CPU_TID},
+                        {"ts",   to_microseconds(pass.cpu_start)},
+                        {"dur",  pass.cpu_time * 1000.0}
+                    });
+
+                    if (pass.gpu_start)
+                    {
+                        events.push_back({
+                            {"name", pass.name},
+                            {"cat",  "gpu"},
+                            {"ph",   "X"},
+                            {"pid",  PID},
+                            {"tid",  GPU_TID},
+                            {"ts",   to_microseconds(*pass.gpu_start)},
+                            {"dur",  pass.gpu_time * 1000.0}
+                        });
+                    }
+                }
+            }
+        }
+
+        auto trace = nlohmann::json{
+            {"traceEvents",     events},
+            {"displayTimeUnit", "ms"}
+        };
+        out << trace.dump(1);
+    }
+
+    void FrameProfiler::save_chrome_trace(const std::filesystem::path& file) const
+    {
+        auto out = std::ofstream(file);
+        if (!out)
+        {
+            throw std::runtime_error(tfm::format("Failed to open %s for writing.", file));
+        }
+        write_chrome_trace(out);
+    }
+
+    FrameProfiler::Percentiles compute_percentiles(std::vector<float> values)
+    {
+        if (values.empty())
+        {
+            return {};
+        }
+
+        std::ranges::sort(values);
+
+        // nearest rank
+        auto rank = [&] (float p) {
+            auto i = static_cast<size_t>(std::ceil(p * static_cast<float>(values.size())));
+            return values[std::clamp(i, size_t{1u}, values.size()) - 1u];
+        };
+
+        return {
+            .average = std::accumulate(begin(values), end(values), 0.0f) / static_cast<float>(values.size()),
+            .median  = rank(0.5f),
+            .p95     = rank(0.95f),
+            .p99     = rank(0.99f),
+            .max     = values.back()
+        };
+    }
+}
@@ -0,0 +1,151 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "api.h"
+
+namespace pkzo
+{
+    //! Per pass CPU and GPU timings of the recent frames.
+    //!
+    //! Graphic contexts time each pass between start_pass and end_pass. GPU
+    //! times are measured with timer queries and arrive a few frames late, so
+    //! reading them back never stalls the pipeline. Frames are kept in a
+    //! rolling history, from which the per pass statistics are computed.
+    class PKZO_EXPORT FrameProfiler
+    {
+    public:
+        using clock      = std::chrono::steady_clock;
+        using time_point = clock::time_point;
+
+        //! Returned by start_pass when the profiler is disabled.
+        static constexpr auto NO_PASS = static_cast<size_t>(-1);
+
+        struct Init
+        {
+            size_t history = 240u; //!< Number of frames kept.
+            bool   enabled = true;
+        };
+
+        //! A timed pass, times are in milliseconds.
+        struct PassTiming
+        {
+            std::string               name;
+            unsigned int              depth    = 0u;   //!< Nesting depth, passes may run inside passes.
+            time_point                cpu_start;
+            float                     cpu_time = 0.0f;
+            std::optional<time_point> gpu_start;       //!< Start on the GPU, mapped to the CPU clock.
+            float                     gpu_time = 0.0f;
+        };
+
+        struct FrameTiming
+        {
+            uint64_t                frame    = 0u;
+            time_point              start;
+            float                   cpu_time = 0.0f; //!< Time from the end of the previous frame.
+            std::vector<PassTiming> passes;
+        };
+
+        //! Summary of a series of times, in milliseconds.
+        struct Percentiles
+        {
+            float average = 0.0f;
+            float median  = 0.0f;
+            float p95     = 0.0f;
+            float p99     = 0.0f;
+            float max     = 0.0f;
+        };
+
+        struct PassStats
+        {
+            std::string name;
+            size_t      cpu_samples = 0u;
+            Percentiles cpu;
+            size_t      gpu_samples = 0u;
+            Percentiles gpu;
+        };
+
+        FrameProfiler();
+        FrameProfiler(Init init);
+
+        void set_enabled(bool value);
+        [[nodiscard]]
+        bool is_enabled() const;
+
+        //! Number of the frame being recorded.
+        [[nodiscard]]
+        uint64_t get_frame() const;
+
+        //! Start timing a pass.
+        //!
+        //! @returns The index of the pass in the current frame, or NO_PASS if disabled.
+        size_t start_pass(const std::string_view name);
+
+        //! Stop timing the innermost pass.
+        void end_pass();
+
+        //! Close the current frame and move it into the history.
+        void end_frame();
+
+        //! Add the GPU time of a pass, once it is known.
+        //!
+        //! Results for frames that already left the history are dropped.
+        void set_gpu_time(uint64_t frame, size_t pass, time_point start, float time);
+
+        //! The recorded frames, oldest first.
+        [[nodiscard]]
+        const std::deque<FrameTiming>& get_frames() const;
+
+        //! Statistics of each pass name over the history, in order of first appearance.
+        [[nodiscard]]
+        std::vector<PassStats> get_pass_stats() const;
+
+        //! Statistics of the frame times over the history.
+        [[nodiscard]]
+        Percentiles get_frame_stats() const;
+
+        //! Write the history in the Chrome trace event format.
+        //!
+        //! The output can be loaded in chrome://tracing or Perfetto.
+        void write_chrome_trace(std::ostream& out) const;
+        void save_chrome_trace(const std::filesystem::path& file) const;
+
+    private:
+        size_t                  history;
+        bool                    enabled;
+        FrameTiming             current;
+        std::vector<size_t>     open_passes;
+        std::deque<FrameTiming> frames;
+    };
+
+    //! Summarize a series of times.
+    PKZO_EXPORT FrameProfiler::Percentiles compute_percentiles(std::vector<float> values);
+}
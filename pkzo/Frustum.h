@@ -0,0 +1,101 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <glm/glm.hpp>
+
+#include "Bounds.h"
+
+namespace pkzo
+{
+    //! View frustum as six planes.
+    //!
+    //! The planes are extracted from a combined projection and view matrix
+    //! and point inwards, so a point p is inside when dot(plane.xyz, p) + plane.w >= 0
+    //! for all planes.
+    class Frustum
+    {
+    public:
+        enum Plane
+        {
+            LEFT_PLANE,
+            RIGHT_PLANE,
+            BOTTOM_PLANE,
+            TOP_PLANE,
+            NEAR_PLANE,
+            FAR_PLANE
+        };
+
+        Frustum() = default;
+
+        explicit Frustum(const glm::mat4& view_projection)
+        {
+            const auto r0 = glm::vec4(view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]);
+            const auto r1 = glm::vec4(view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]);
+            const auto r2 = glm::vec4(view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]);
+            const auto r3 = glm::vec4(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+
+            planes[LEFT_PLANE] = r3 + r0;
+            planes[RIGHT_PLANE] = r3 - r0;
+            planes[BOTTOM_PLANE] = r3 + r1;
+            planes[TOP_PLANE] = r3 - r1;
+            planes[NEAR_PLANE] = r3 + r2;
+            planes[FAR_PLANE]  = r3 - r2;
+
+            for (auto& plane : planes)
+            {
+                plane /= glm::length(glm::vec3(plane));
+            }
+        }
+
+        const glm::vec4& get_plane(Plane plane) const
+        {
+            return planes[plane];
+        }
+
+        //! Test if an axis aligned box is at least partially inside the frustum.
+        //!
+        //! The test is conservative; boxes near the frustum corners may be
+        //! reported as inside even if they are not.
+        bool intersects(const Bounds3& bounds) const
+        {
+            const auto center  = bounds.get_center();
+            const auto extents = bounds.get_extents();
+
+            for (const auto& plane : planes)
+            {
+                const auto normal   = glm::vec3(plane);
+                const auto distance = glm::dot(normal, center) + plane.w;
+                const auto radius   = glm::dot(extents, glm::abs(normal));
+                if (distance + radius < 0.0f)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::array<glm::vec4, 6> planes = {};
+    };
+}
@@ -23,44 +23,26 @@
 
 #include "uniforms.glsl"
 #include "outputs.glsl"
-#include "math.glsl"
 
-#define SAMPLES 1024
+// Writes the surface of opaque geometry for the deferred lighting, the
+// layout must match SceneRenderer's geometry buffer.
 
-in vec3 var_Direction;
+in vec2 var_TexCoord;
+in vec3 var_Position;
+in mat3 var_TBN;
 
 void main()
 {
-    vec3 normal = normalize(var_Direction);
-
-    vec3 up = abs(normal.z) < 0.999 ? vec3(0,0,1) : vec3(1,0,0);
-    vec3 right = normalize(cross(up,normal));
-    up = cross(normal,right);
-
-    mat3 tbn = mat3(right, up, normal);
-
-    vec3  color = vec3(0);
-    float power = 0;
-
-    for (int i = 0; i < SAMPLES; i++)
-    {
-        vec2 s = hammersley2d(i, SAMPLES);
-        vec3 l = hemisphereSample_cos(s.x, s.y);
-        l = tbn * l;
-        float NxL = dot(normal, l);
-
-        vec3 smp = texture(uni_CubeMap, l).rgb;
-        float lum = dot(smp, vec3(0.2126, 0.7152, 0.0722));
-        float limit = 10.0;
-
-        if (lum > limit)
-        {
-            float compressed = limit + log(1.0 + lum - limit);
-            smp *= compressed / lum;
-        }
-        color += smp * NxL;
-        power += NxL;
-    }
-
-    out_FragColor0 = vec4(color / power, 1);
+    vec4  baseColor     = texture(uni_BaseColorMap, var_TexCoord) * blk_Material.base_color_factor;
+    float roughness     = texture(uni_MetallicRoughnessMap, var_TexCoord).g * blk_Material.roughness_factor;
+    float metallic      = texture(uni_MetallicRoughnessMap, var_TexCoord).r * blk_Material.metallic_factor;
+    vec3  emissive      = texture(uni_EmissiveMap, var_TexCoord).rgb * blk_Material.emissive_factor;
+
+    vec3 normal_map     = texture(uni_NormalMap, var_TexCoord).rgb;
+    vec3 normal         = normalize(var_TBN * (normal_map * 2.0 - 1.0));
+
+    out_FragColor0 = vec4(baseColor.rgb, 1.0);
+    out_FragColor1 = vec4(normal, 0.0);
+    out_FragColor2 = vec4(metallic, roughness, 0.0, 1.0);
+    out_FragColor3 = vec4(emissive, 1.0);
 }
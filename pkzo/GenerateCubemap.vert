@@ -28,6 +28,7 @@ out vec3 var_Direction;
 
 void main()
 {
-    var_Direction = uni_CubemapTBN * vec3(atr_Vertex.x, -atr_Vertex.y, 1.0);
-    gl_Position   = vec4(atr_Vertex, 1.0);
+    vec3 vertex   = get_vertex();
+    var_Direction = uni_CubemapTBN * vec3(vertex.x, -vertex.y, 1.0);
+    gl_Position   = vec4(vertex, 1.0);
 }
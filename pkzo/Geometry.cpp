@@ -86,4 +86,15 @@ namespace pkzo
     {
         return material;
     }
+
+    const std::vector<MeshLod>& Geometry::get_lods() const
+    {
+        static const auto no_lods = std::vector<MeshLod>();
+        return no_lods;
+    }
+
+    std::shared_ptr<Mesh> Geometry::get_occluder() const
+    {
+        return nullptr;
+    }
 }
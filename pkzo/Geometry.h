@@ -25,6 +25,8 @@
 
 #include <pkzo/Mesh.h>
 
+#include "MeshLod.h"
+
 namespace pkzo
 {
     using pkzo::Mesh;
@@ -48,6 +50,14 @@ namespace pkzo
 
         virtual std::shared_ptr<Mesh> get_mesh() const = 0;
 
+        //! Coarser versions of the mesh, finest first; none by default.
+        virtual const std::vector<MeshLod>& get_lods() const;
+
+        //! Coarse mesh for occlusion culling, none by default.
+        //!
+        //! The occluder must lie inside the geometry, it hides what is behind it.
+        virtual std::shared_ptr<Mesh> get_occluder() const;
+
         void set_material(const std::shared_ptr<Material>& value);
         std::shared_ptr<Material> get_material() const;
 
@@ -23,17 +23,115 @@
 
 #include "GraphicContext.h"
 #include "OpenGLGraphicContext.h"
+#include "RecordingGraphicContext.h"
+#include "SoftwareGraphicContext.h"
 
 namespace pkzo
 {
-    std::unique_ptr<GraphicContext> GraphicContext::create(Api api, SDL_Window* window)
+    size_t get_pixel_bytes(ColorMode color_mode, DataType data_type)
+    {
+        auto type_size = data_type == DataType::FLOAT ? sizeof(float) : sizeof(uint8_t);
+        switch (color_mode)
+        {
+            case ColorMode::MONO:  return type_size * 1u;
+            case ColorMode::RGB:   return type_size * 3u;
+            case ColorMode::BGR:   return type_size * 3u;
+            case ColorMode::RGBA:  return type_size * 4u;
+            case ColorMode::BGRA:  return type_size * 4u;
+            case ColorMode::DEPTH: return sizeof(float);
+            default:               std::unreachable();
+        }
+    }
+
+    std::unique_ptr<GraphicContext> create_graphic_context(Api api, SDL_Window* window, const std::filesystem::path& shader_cache, VertexFormat vertex_format)
     {
         switch (api)
         {
             case Api::OPENGL:
-                return std::make_unique<OpenGLGraphicContext>(window);
+                return std::make_unique<OpenGLGraphicContext>(window, shader_cache, vertex_format);
+            case Api::SOFTWARE:
+                return std::make_unique<SoftwareGraphicContext>(window);
+            case Api::RECORDING:
+                return std::make_unique<RecordingGraphicContext>();
             default:
                 std::unreachable();
         }
     }
+
+    std::unique_ptr<GraphicContext> GraphicContext::create(Api api, SDL_Window* window, const std::filesystem::path& shader_cache, const std::filesystem::path& cubemap_cache, VertexFormat vertex_format)
+    {
+        auto gc = create_graphic_context(api, window, shader_cache, vertex_format);
+        gc->get_cubemap_cache().set_directory(cubemap_cache);
+        return gc;
+    }
+
+    void GraphicContext::make_current() {}
+
+    void GraphicContext::release_current() {}
+
+    FrameProfiler& GraphicContext::get_profiler()
+    {
+        return profiler;
+    }
+
+    const FrameProfiler& GraphicContext::get_profiler() const
+    {
+        return profiler;
+    }
+
+    const RenderStats& GraphicContext::get_render_stats() const
+    {
+        return last_render_stats;
+    }
+
+    CubeMapCache& GraphicContext::get_cubemap_cache()
+    {
+        return cubemap_cache;
+    }
+
+    const CubeMapCache& GraphicContext::get_cubemap_cache() const
+    {
+        return cubemap_cache;
+    }
+
+    void GraphicContext::count_draw(const Mesh& mesh, size_t instances)
+    {
+        render_stats.draws++;
+        render_stats.triangles += mesh.get_faces().size() * instances;
+        render_stats.lines     += mesh.get_lines().size() * instances;
+    }
+
+    void GraphicContext::count_upload(const MeshData& data)
+    {
+        render_stats.buffer_bytes += data.vertexes.size()  * sizeof(glm::vec3)
+                                   + data.normals.size()   * sizeof(glm::vec3)
+                                   + data.tangents.size()  * sizeof(glm::vec3)
+                                   + data.texcoords.size() * sizeof(glm::vec2)
+                                   + data.colors.size()    * sizeof(glm::vec4)
+                                   + data.faces.size()     * sizeof(glm::uvec3)
+                                   + data.lines.size()     * sizeof(glm::uvec2);
+    }
+
+    void GraphicContext::count_upload(const Texture& texture)
+    {
+        auto size = texture.get_size();
+        render_stats.texture_bytes += size_t{size.x} * size_t{size.y} * get_pixel_bytes(texture.get_color_mode(), texture.get_data_type());
+    }
+
+    void GraphicContext::count_upload(const CubeMapData& data)
+    {
+        for (const auto& image : data.images)
+        {
+            render_stats.texture_bytes += image.pixels.size();
+        }
+    }
+
+    void GraphicContext::end_render_stats(size_t textures, size_t meshes)
+    {
+        render_stats.textures = textures;
+        render_stats.meshes   = meshes;
+
+        last_render_stats = render_stats;
+        render_stats      = {};
+    }
 }
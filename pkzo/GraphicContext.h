@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <variant>
@@ -32,16 +33,22 @@
 #include "Shader.h"
 #include "Texture.h"
 #include "Mesh.h"
+#include "VertexPacking.h"
 #include "FrameBuffer.h"
 #include "CubeMap.h"
+#include "CubeMapCache.h"
+#include "UniformBuffer.h"
+#include "FrameProfiler.h"
 
 namespace pkzo
 {
     class MemoryTexture;
 
-    enum class Api : Uint64
+    enum class Api
     {
-        OPENGL = SDL_WINDOW_OPENGL,
+        OPENGL,
+        SOFTWARE,  //!< Rasterizes on the CPU, see SoftwareGraphicContext.
+        RECORDING, //!< Records commands without rendering, see RecordingGraphicContext.
         // VULKAN
     };
 
@@ -85,6 +92,21 @@ namespace pkzo
         std::shared_ptr<CubeMap>        target;
     };
 
+    //! Work submitted to a graphic context in one frame.
+    struct RenderStats
+    {
+        size_t draws         = 0u; //!< Draw calls, each instanced draw counts once.
+        size_t triangles     = 0u; //!< Triangles submitted, including all instances.
+        size_t lines         = 0u; //!< Lines submitted, including all instances.
+        size_t uniforms      = 0u; //!< Uniforms set.
+        size_t texture_binds = 0u; //!< Textures and cube maps bound.
+        size_t shader_binds  = 0u; //!< Shaders bound by start_pass.
+        size_t buffer_bytes  = 0u; //!< Uniform block, storage, instance and mesh data uploaded.
+        size_t texture_bytes = 0u; //!< Texture data uploaded.
+        size_t textures      = 0u; //!< Memory textures cached by the backend.
+        size_t meshes        = 0u; //!< Memory meshes cached by the backend.
+    };
+
     enum class FallbackTexture
     {
         WHITE,
@@ -94,7 +116,14 @@ namespace pkzo
     class PKZO_EXPORT GraphicContext
     {
     public:
-        static std::unique_ptr<GraphicContext> create(Api api, SDL_Window* window);
+        //! Create a graphic context for the window.
+        //!
+        //! @param api the graphics API to use
+        //! @param window the window to render to
+        //! @param shader_cache the directory to cache compiled shaders in, empty disables it
+        //! @param cubemap_cache the directory to cache generated cube maps in, empty disables it
+        //! @param vertex_format the layout of uploaded mesh data, only used by OpenGL
+        static std::unique_ptr<GraphicContext> create(Api api, SDL_Window* window, const std::filesystem::path& shader_cache, const std::filesystem::path& cubemap_cache, VertexFormat vertex_format = VertexFormat::FLOAT);
 
         virtual ~GraphicContext() = default;
 
@@ -110,8 +139,30 @@ namespace pkzo
 
         virtual std::shared_ptr<CubeMap> generate_cubemap(const CubeMapGenerator& generator) = 0;
 
+        //! Render some faces of a generated cube map.
+        //!
+        //! The faces are counted over all mip levels, face i is face i % 6 of
+        //! mip level i / 6. The target is created if the generator has none and
+        //! is returned for the following calls. Unlike generate_cubemap this does
+        //! not wait for the GPU, so the work can be spread over several frames.
+        virtual std::shared_ptr<CubeMap> generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count) = 0;
+
+        //! Read back all faces and mip levels of a cube map.
+        //!
+        //! The images are in the format the backend stores them, backends
+        //! without pixel storage return data without images.
+        virtual CubeMapData download_cubemap(const std::shared_ptr<CubeMap>& cubemap) = 0;
+
+        //! Create a cube map from data downloaded by the same backend.
+        virtual std::shared_ptr<CubeMap> upload_cubemap(const CubeMapData& data) = 0;
+
         virtual std::shared_ptr<Mesh> upload_mesh(MeshData data, bool stream = false) = 0;
 
+        virtual std::shared_ptr<UniformBuffer> create_uniform_buffer(size_t size) = 0;
+
+        //! Required alignment of offsets into uniform buffers.
+        virtual size_t get_uniform_buffer_alignment() const = 0;
+
         virtual void set_viewport(const Viewport& viewport) = 0;
         virtual Viewport get_viewport() const = 0;
 
@@ -138,12 +189,78 @@ namespace pkzo
         virtual void bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback = FallbackTexture::WHITE) = 0;
         virtual void bind_texture(int slot, const std::shared_ptr<CubeMap>& texture) = 0;
 
+        //! Upload data to the storage buffer at the given binding point.
+        virtual void set_storage_buffer(int binding, size_t size, const void* data) = 0;
+
+        template <typename T>
+        void set_storage_buffer(int binding, const std::vector<T>& data)
+        {
+            set_storage_buffer(binding, data.size() * sizeof(T), data.data());
+        }
+
+        //! Bind a range of a uniform buffer to the given binding point.
+        virtual void bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size) = 0;
+
+        //! Upload a uniform block for use until the end of the frame and bind it.
+        virtual void set_uniform_buffer(int binding, size_t size, const void* data) = 0;
+
+        template <typename T>
+        void set_uniform_buffer(int binding, const T& block)
+        {
+            set_uniform_buffer(binding, sizeof(T), &block);
+        }
+
         virtual void draw(const std::shared_ptr<Mesh>& mesh) = 0;
+
+        //! Draw the mesh once for each transform.
+        //!
+        //! The transforms are passed to the shader as the per instance attribute
+        //! atr_InstanceModelMatrix.
+        virtual void draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms) = 0;
         virtual void draw_fullscreen() = 0;
 
         virtual void end_pass() = 0;
 
         virtual void swap_buffers() = 0;
 
+        //! Make the context current on the calling thread.
+        //!
+        //! A context is current on at most one thread, release it on the
+        //! thread that used it before. Contexts that are not bound to a
+        //! thread ignore this.
+        virtual void make_current();
+
+        //! Release the context from the calling thread.
+        virtual void release_current();
+
+        //! Per pass timings of the recent frames.
+        FrameProfiler& get_profiler();
+        const FrameProfiler& get_profiler() const;
+
+        //! Counters of the last completed frame.
+        const RenderStats& get_render_stats() const;
+
+        //! Disk cache for generated cube maps, disabled unless a directory is set.
+        CubeMapCache& get_cubemap_cache();
+        const CubeMapCache& get_cubemap_cache() const;
+
+    protected:
+        //! Timed by the implementations in start_pass, end_pass and swap_buffers.
+        FrameProfiler profiler;
+
+        //! Counters of the current frame, counted by the implementations.
+        RenderStats render_stats;
+
+        void count_draw(const Mesh& mesh, size_t instances = 1u);
+        void count_upload(const MeshData& data);
+        void count_upload(const Texture& texture);
+        void count_upload(const CubeMapData& data);
+
+        //! Publish the counters of the current frame and reset them, called in swap_buffers.
+        void end_render_stats(size_t textures, size_t meshes);
+
+    private:
+        RenderStats  last_render_stats;
+        CubeMapCache cubemap_cache;
     };
 }
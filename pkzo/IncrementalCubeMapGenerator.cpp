@@ -0,0 +1,75 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "IncrementalCubeMapGenerator.h"
+
+#include "debug.h"
+
+namespace pkzo
+{
+    IncrementalCubeMapGenerator::IncrementalCubeMapGenerator(Init init)
+    : generator(std::move(init.generator)), texels(init.texels), budget(init.budget)
+    {
+        check(generator.shader, "The cube map generator needs a shader.");
+        generator.miplevels = std::max(generator.miplevels, 1u);
+        total_faces         = 6u * generator.miplevels;
+    }
+
+    bool IncrementalCubeMapGenerator::update(GraphicContext& gc)
+    {
+        using clock = std::chrono::steady_clock;
+
+        const auto start = clock::now();
+        auto       spent = size_t{0u};
+        while (next_face < total_faces)
+        {
+            const auto size        = std::max(generator.size >> (next_face / 6u), 1u);
+            const auto face_texels = size_t{size} * size;
+            if (spent > 0u && (spent + face_texels > texels || clock::now() - start > budget))
+            {
+                break;
+            }
+
+            generator.target = gc.generate_cubemap_faces(generator, next_face, 1u);
+            next_face++;
+            spent += face_texels;
+        }
+
+        return is_complete();
+    }
+
+    bool IncrementalCubeMapGenerator::is_complete() const
+    {
+        return next_face >= total_faces;
+    }
+
+    float IncrementalCubeMapGenerator::get_progress() const
+    {
+        return static_cast<float>(next_face) / static_cast<float>(total_faces);
+    }
+
+    std::shared_ptr<CubeMap> IncrementalCubeMapGenerator::get_cubemap() const
+    {
+        return is_complete() ? generator.target : nullptr;
+    }
+}
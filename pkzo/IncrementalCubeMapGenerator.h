@@ -0,0 +1,69 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "api.h"
+#include "GraphicContext.h"
+
+namespace pkzo
+{
+    //! Generates a cube map over several frames.
+    //!
+    //! Each update renders faces of all mip levels in order until the texel
+    //! or time budget of the frame is spent. The texel budget bounds the GPU
+    //! work, which the CPU time of the draw calls does not reflect. The cube
+    //! map is only handed out once all faces are rendered, so it can replace
+    //! the current one without ever showing a partial result.
+    class PKZO_EXPORT IncrementalCubeMapGenerator
+    {
+    public:
+        struct Init
+        {
+            CubeMapGenerator          generator;                                 //!< The target is created when not set, it must not be in use.
+            size_t                    texels = 1024u * 1024u;                    //!< Texels to render per update, at least one face is rendered.
+            std::chrono::microseconds budget = std::chrono::microseconds(1000); //!< CPU time to spend per update.
+        };
+
+        IncrementalCubeMapGenerator(Init init);
+
+        //! Render the next faces, true once the cube map is complete.
+        bool update(GraphicContext& gc);
+
+        bool is_complete() const;
+
+        //! Fraction of the faces rendered.
+        float get_progress() const;
+
+        //! The generated cube map, nullptr until it is complete.
+        std::shared_ptr<CubeMap> get_cubemap() const;
+
+    private:
+        CubeMapGenerator          generator;
+        size_t                    texels;
+        std::chrono::microseconds budget;
+        unsigned int              next_face   = 0u;
+        unsigned int              total_faces = 0u;
+    };
+}
@@ -48,5 +48,11 @@ namespace pkzo
         virtual glm::vec3 get_direction() const = 0;
         virtual glm::vec3 get_position() const = 0;
         virtual glm::vec2 get_angles() const = 0;
+
+        //! Distance at which the light fades out, 0 when it is unbounded.
+        virtual float get_range() const = 0;
+
+        //! Whether the light renders a shadow map.
+        virtual bool get_cast_shadows() const = 0;
     };
 }
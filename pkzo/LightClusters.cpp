@@ -0,0 +1,206 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "LightClusters.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    LightClusters::LightClusters()
+    : LightClusters(Init{}) {}
+
+    LightClusters::LightClusters(Init init)
+    : grid_size(init.grid_size)
+    {
+        check(grid_size.x > 0u && grid_size.y > 0u && grid_size.z > 0u);
+        cluster_bounds.resize(grid_size.x * grid_size.y * grid_size.z);
+        cluster_ranges.resize(cluster_bounds.size());
+    }
+
+    glm::uvec3 LightClusters::get_grid_size() const
+    {
+        return grid_size;
+    }
+
+    float LightClusters::get_near() const
+    {
+        return near_plane;
+    }
+
+    float LightClusters::get_far() const
+    {
+        return far_plane;
+    }
+
+    unsigned int LightClusters::get_cluster_index(const glm::uvec3& cluster) const
+    {
+        check(cluster.x < grid_size.x && cluster.y < grid_size.y && cluster.z < grid_size.z);
+        return cluster.x + grid_size.x * (cluster.y + grid_size.y * cluster.z);
+    }
+
+    const Bounds3& LightClusters::get_cluster_bounds(const glm::uvec3& cluster) const
+    {
+        return cluster_bounds[get_cluster_index(cluster)];
+    }
+
+    const std::vector<glm::uvec2>& LightClusters::get_cluster_ranges() const
+    {
+        return cluster_ranges;
+    }
+
+    const std::vector<uint32_t>& LightClusters::get_light_indexes() const
+    {
+        return light_indexes;
+    }
+
+    float sphere_box_distance2(const glm::vec3& center, const Bounds3& box)
+    {
+        auto closest = glm::clamp(center, box.get_min(), box.get_max());
+        auto d       = center - closest;
+        return glm::dot(d, d);
+    }
+
+    void LightClusters::update(const glm::mat4& new_projection, const glm::mat4& view, const std::vector<LightVolume>& lights)
+    {
+        if (new_projection != projection)
+        {
+            update_cluster_bounds(new_projection);
+        }
+
+        assignments.clear();
+        std::ranges::fill(cluster_ranges, glm::uvec2(0u));
+
+        const auto log_depth = std::log(far_plane / near_plane);
+
+        for (auto i = 0u; i < lights.size(); i++)
+        {
+            const auto& light = lights[i];
+            const auto center = glm::vec3(view * glm::vec4(light.position, 1.0f));
+            const auto depth  = -center.z;
+
+            if (depth + light.range < near_plane || depth - light.range > far_plane)
+            {
+                continue;
+            }
+
+            // depth slices are exponential, see Forward.frag; clamped before the
+            // conversion, the range of an unbounded light is infinite
+            auto slice_of = [&] (float z) {
+                auto s = std::floor(std::log(std::max(z, near_plane) / near_plane) / log_depth * static_cast<float>(grid_size.z));
+                return static_cast<unsigned int>(std::clamp(s, 0.0f, static_cast<float>(grid_size.z - 1u)));
+            };
+            const auto first_slice = slice_of(depth - light.range);
+            const auto last_slice  = slice_of(depth + light.range);
+
+            const auto range2 = light.range * light.range;
+            for (auto z = first_slice; z <= last_slice; z++)
+            {
+                for (auto y = 0u; y < grid_size.y; y++)
+                {
+                    for (auto x = 0u; x < grid_size.x; x++)
+                    {
+                        auto index = get_cluster_index({x, y, z});
+                        if (sphere_box_distance2(center, cluster_bounds[index]) <= range2)
+                        {
+                            assignments.push_back({index, i});
+                            cluster_ranges[index].y++;
+                        }
+                    }
+                }
+            }
+        }
+
+        auto offset = 0u;
+        for (auto& range : cluster_ranges)
+        {
+            range.x = offset;
+            offset += range.y;
+            range.y = 0u;
+        }
+
+        light_indexes.resize(assignments.size());
+        // assignment is (cluster, light)
+        for (const auto& assignment : assignments)
+        {
+            auto& range = cluster_ranges[assignment.x];
+            light_indexes[range.x + range.y] = assignment.y;
+            range.y++;
+        }
+    }
+
+    void LightClusters::update_cluster_bounds(const glm::mat4& new_projection)
+    {
+        projection = new_projection;
+
+        // near and far plane of a OpenGL perspective projection
+        near_plane = projection[3][2] / (projection[2][2] - 1.0f);
+        far_plane  = projection[3][2] / (projection[2][2] + 1.0f);
+        check(near_plane > 0.0f && far_plane > near_plane);
+
+        const auto inv_projection = glm::inverse(projection);
+
+        // view space point on the near plane for a NDC xy, scaled to the given depth
+        auto unproject = [&] (float nx, float ny, float depth) {
+            auto p = inv_projection * glm::vec4(nx, ny, -1.0f, 1.0f);
+            auto v = glm::vec3(p) / p.w;
+            return v * (depth / -v.z);
+        };
+
+        for (auto z = 0u; z < grid_size.z; z++)
+        {
+            auto z_near = near_plane * std::pow(far_plane / near_plane, static_cast<float>(z) / static_cast<float>(grid_size.z));
+            auto z_far  = near_plane * std::pow(far_plane / near_plane, static_cast<float>(z + 1u) / static_cast<float>(grid_size.z));
+
+            for (auto y = 0u; y < grid_size.y; y++)
+            {
+                auto y0 = -1.0f + 2.0f * static_cast<float>(y)      / static_cast<float>(grid_size.y);
+                auto y1 = -1.0f + 2.0f * static_cast<float>(y + 1u) / static_cast<float>(grid_size.y);
+
+                for (auto x = 0u; x < grid_size.x; x++)
+                {
+                    auto x0 = -1.0f + 2.0f * static_cast<float>(x)      / static_cast<float>(grid_size.x);
+                    auto x1 = -1.0f + 2.0f * static_cast<float>(x + 1u) / static_cast<float>(grid_size.x);
+
+                    auto min = glm::vec3(std::numeric_limits<float>::max());
+                    auto max = glm::vec3(std::numeric_limits<float>::lowest());
+                    for (auto depth : {z_near, z_far})
+                    {
+                        for (auto corner : {glm::vec2(x0, y0), glm::vec2(x1, y0), glm::vec2(x0, y1), glm::vec2(x1, y1)})
+                        {
+                            auto p = unproject(corner.x, corner.y, depth);
+                            min = glm::min(min, p);
+                            max = glm::max(max, p);
+                        }
+                    }
+
+                    cluster_bounds[get_cluster_index({x, y, z})] = Bounds3(min, max);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,94 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "api.h"
+#include "Bounds.h"
+
+namespace pkzo
+{
+    //! Assignment of local lights to a clustered view frustum.
+    //!
+    //! The view frustum is split into screen space tiles and exponential depth
+    //! slices. Each light is approximated by a sphere and assigned to all
+    //! clusters it touches. The result is a flat index list and an
+    //! (offset, count) pair per cluster, suitable for upload to storage buffers.
+    class PKZO_EXPORT LightClusters
+    {
+    public:
+        struct Init
+        {
+            glm::uvec3 grid_size = glm::uvec3(16u, 9u, 24u);
+        };
+
+        //! Light volume in world space.
+        struct LightVolume
+        {
+            glm::vec3 position;
+            float     range;
+        };
+
+        LightClusters();
+        LightClusters(Init init);
+
+        //! Assign the lights to the clusters.
+        //!
+        //! @param projection a perspective projection matrix
+        //! @param view the view matrix
+        //! @param lights the lights to assign
+        void update(const glm::mat4& projection, const glm::mat4& view, const std::vector<LightVolume>& lights);
+
+        glm::uvec3 get_grid_size() const;
+
+        float get_near() const;
+        float get_far() const;
+
+        unsigned int get_cluster_index(const glm::uvec3& cluster) const;
+
+        //! Get the view space bounds of a cluster.
+        const Bounds3& get_cluster_bounds(const glm::uvec3& cluster) const;
+
+        //! Get the (offset, count) into the light indexes for each cluster.
+        const std::vector<glm::uvec2>& get_cluster_ranges() const;
+
+        const std::vector<uint32_t>& get_light_indexes() const;
+
+    private:
+        glm::uvec3 grid_size;
+        glm::mat4  projection = glm::mat4(0.0f);
+        float      near_plane = 0.0f;
+        float      far_plane  = 0.0f;
+
+        std::vector<Bounds3>    cluster_bounds;
+        std::vector<glm::uvec2> cluster_ranges;
+        std::vector<uint32_t>   light_indexes;
+
+        std::vector<glm::uvec2> assignments;
+
+        void update_cluster_bounds(const glm::mat4& new_projection);
+    };
+}
@@ -36,7 +36,9 @@ namespace pkzo
         .visible    = init.visible,
         .collidable = init.collidable,
         .material   = init.material}),
-      mesh(init.mesh)
+      mesh(init.mesh),
+      lods(std::move(init.lods)),
+      occluder(init.occluder)
     {
         check(mesh);
     }
@@ -54,6 +56,26 @@ namespace pkzo
         return mesh;
     }
 
+    void MeshGeometry::set_lods(const std::vector<MeshLod>& value)
+    {
+        lods = value;
+    }
+
+    const std::vector<MeshLod>& MeshGeometry::get_lods() const
+    {
+        return lods;
+    }
+
+    void MeshGeometry::set_occluder(const std::shared_ptr<Mesh>& value)
+    {
+        occluder = value;
+    }
+
+    std::shared_ptr<Mesh> MeshGeometry::get_occluder() const
+    {
+        return occluder;
+    }
+
     Bounds3 MeshGeometry::get_bounds() const
     {
         check(mesh);
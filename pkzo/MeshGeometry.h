@@ -39,6 +39,8 @@ namespace pkzo
             bool                      visible    = true;
             bool                      collidable = true;
             std::shared_ptr<Mesh>     mesh;
+            std::vector<MeshLod>      lods;
+            std::shared_ptr<Mesh>     occluder;
             std::shared_ptr<Material> material;
         };
 
@@ -49,9 +51,17 @@ namespace pkzo
         void set_mesh(const std::shared_ptr<Mesh>& value);
         std::shared_ptr<Mesh> get_mesh() const override;
 
+        void set_lods(const std::vector<MeshLod>& value);
+        const std::vector<MeshLod>& get_lods() const override;
+
+        void set_occluder(const std::shared_ptr<Mesh>& value);
+        std::shared_ptr<Mesh> get_occluder() const override;
+
         Bounds get_bounds() const override;
 
     private:
         std::shared_ptr<Mesh> mesh;
+        std::vector<MeshLod>  lods;
+        std::shared_ptr<Mesh> occluder;
     };
 }
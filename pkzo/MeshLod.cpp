@@ -0,0 +1,482 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "MeshLod.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    // meshes with fewer faces are not worth reducing
+    constexpr auto MIN_LOD_FACES = size_t{64u};
+
+    // a level has to drop at least a quarter of the faces of the previous one
+    constexpr auto MIN_LOD_REDUCTION = 0.75f;
+
+    // relative margin around the screen size thresholds
+    constexpr auto LOD_HYSTERESIS = 0.1f;
+
+    // weight of the planes that hold open borders in place
+    constexpr auto BORDER_WEIGHT = 1000.0;
+
+    // a collapse may not turn a face by more than about 80 degrees
+    constexpr auto MIN_NORMAL_DOT = 0.2f;
+
+    // Error quadric of Garland and Heckbert, the upper triangle of a
+    // symmetric 4x4 matrix. Evaluated at a point it gives the weighted sum
+    // of squared distances to the planes it was built from.
+    struct Quadric
+    {
+        double a2 = 0.0, ab = 0.0, ac = 0.0, ad = 0.0;
+        double b2 = 0.0, bc = 0.0, bd = 0.0;
+        double c2 = 0.0, cd = 0.0;
+        double d2 = 0.0;
+    };
+
+    Quadric make_quadric(const glm::vec3& normal, const glm::vec3& point, double weight)
+    {
+        const double a = normal.x;
+        const double b = normal.y;
+        const double c = normal.z;
+        const double d = -glm::dot(normal, point);
+        return {
+            a * a * weight, a * b * weight, a * c * weight, a * d * weight,
+            b * b * weight, b * c * weight, b * d * weight,
+            c * c * weight, c * d * weight,
+            d * d * weight
+        };
+    }
+
+    Quadric& operator += (Quadric& q, const Quadric& r)
+    {
+        q.a2 += r.a2; q.ab += r.ab; q.ac += r.ac; q.ad += r.ad;
+        q.b2 += r.b2; q.bc += r.bc; q.bd += r.bd;
+        q.c2 += r.c2; q.cd += r.cd;
+        q.d2 += r.d2;
+        return q;
+    }
+
+    Quadric operator + (Quadric q, const Quadric& r)
+    {
+        q += r;
+        return q;
+    }
+
+    double quadric_error(const Quadric& q, const glm::vec3& p)
+    {
+        const double x = p.x;
+        const double y = p.y;
+        const double z = p.z;
+        return q.a2 * x * x + 2.0 * q.ab * x * y + 2.0 * q.ac * x * z + 2.0 * q.ad * x
+             + q.b2 * y * y + 2.0 * q.bc * y * z + 2.0 * q.bd * y
+             + q.c2 * z * z + 2.0 * q.cd * z
+             + q.d2;
+    }
+
+    uint64_t edge_key(uint32_t a, uint32_t b)
+    {
+        return (uint64_t{std::min(a, b)} << 32u) | uint64_t{std::max(a, b)};
+    }
+
+    template <typename T>
+    void copy_vertex(const std::vector<T>& from, std::vector<T>& to, size_t index)
+    {
+        if (!from.empty())
+        {
+            to.push_back(from[index]);
+        }
+    }
+
+    // Half edge collapses, cheapest first. A vertex is merged into a
+    // neighbor and keeps its position and attributes, so no attribute has
+    // to be interpolated. Costs are refreshed lazily: a queued collapse is
+    // stale when one of its vertexes changed since it was queued.
+    class QuadricSimplifier
+    {
+    public:
+        QuadricSimplifier(const MeshData& data)
+        : positions(data.vertexes), faces(data.faces)
+        {
+            const auto vertex_count = positions.size();
+            alive_faces  = faces.size();
+            face_alive.assign(faces.size(), true);
+            vertex_faces.resize(vertex_count);
+            quadrics.resize(vertex_count);
+            border.assign(vertex_count, false);
+            versions.assign(vertex_count, 0u);
+
+            auto edge_counts = std::unordered_map<uint64_t, unsigned int>();
+            for (auto f = 0u; f < faces.size(); f++)
+            {
+                const auto& face = faces[f];
+                check(face.x < vertex_count && face.y < vertex_count && face.z < vertex_count);
+
+                const auto normal = face_normal(face);
+                const auto area   = glm::length(normal) * 0.5f;
+                for (auto k = 0; k < 3; k++)
+                {
+                    vertex_faces[face[k]].push_back(f);
+                    edge_counts[edge_key(face[k], face[(k + 1) % 3])]++;
+                    if (area > 0.0f)
+                    {
+                        quadrics[face[k]] += make_quadric(glm::normalize(normal), positions[face.x], area);
+                    }
+                }
+            }
+
+            // Open borders get a plane through the edge, perpendicular to the
+            // face, so that collapses do not pull them in.
+            for (const auto& face : faces)
+            {
+                const auto normal = face_normal(face);
+                for (auto k = 0; k < 3; k++)
+                {
+                    const auto a = face[k];
+                    const auto b = face[(k + 1) % 3];
+                    if (edge_counts[edge_key(a, b)] != 1u)
+                    {
+                        continue;
+                    }
+
+                    border[a] = true;
+                    border[b] = true;
+
+                    const auto edge  = positions[b] - positions[a];
+                    const auto plane = glm::cross(edge, normal);
+                    if (glm::dot(plane, plane) > 0.0f)
+                    {
+                        const auto q = make_quadric(glm::normalize(plane), positions[a], BORDER_WEIGHT * glm::dot(edge, edge));
+                        quadrics[a] += q;
+                        quadrics[b] += q;
+                    }
+                }
+            }
+
+            for (const auto& [key, count] : edge_counts)
+            {
+                queue_edge(static_cast<uint32_t>(key >> 32u), static_cast<uint32_t>(key & 0xFFFFFFFFu));
+            }
+        }
+
+        void reduce(size_t target_faces)
+        {
+            while (alive_faces > target_faces && !collapses.empty())
+            {
+                const auto collapse = collapses.top();
+                collapses.pop();
+
+                if (collapse.from_version != versions[collapse.from] || collapse.to_version != versions[collapse.to])
+                {
+                    continue;
+                }
+
+                if (!is_manifold_collapse(collapse.from, collapse.to) || flips_face(collapse.from, collapse.to))
+                {
+                    continue;
+                }
+
+                apply(collapse.from, collapse.to);
+            }
+        }
+
+        MeshData get_result(const MeshData& data) const
+        {
+            auto result = MeshData{};
+            auto remap  = std::vector<uint32_t>(positions.size(), std::numeric_limits<uint32_t>::max());
+
+            result.faces.reserve(alive_faces);
+            for (auto f = 0u; f < faces.size(); f++)
+            {
+                if (!face_alive[f])
+                {
+                    continue;
+                }
+
+                auto face = faces[f];
+                for (auto k = 0; k < 3; k++)
+                {
+                    auto& index = remap[face[k]];
+                    if (index == std::numeric_limits<uint32_t>::max())
+                    {
+                        index = static_cast<uint32_t>(result.vertexes.size());
+                        copy_vertex(data.vertexes,  result.vertexes,  face[k]);
+                        copy_vertex(data.normals,   result.normals,   face[k]);
+                        copy_vertex(data.tangents,  result.tangents,  face[k]);
+                        copy_vertex(data.texcoords, result.texcoords, face[k]);
+                        copy_vertex(data.colors,    result.colors,    face[k]);
+                    }
+                    face[k] = index;
+                }
+                result.faces.push_back(face);
+            }
+
+            result.bounds = data.bounds;
+            return result;
+        }
+
+    private:
+        struct Collapse
+        {
+            double   cost;
+            uint32_t from;
+            uint32_t to;
+            uint32_t from_version;
+            uint32_t to_version;
+
+            bool operator > (const Collapse& other) const
+            {
+                return cost > other.cost;
+            }
+        };
+
+        const std::vector<glm::vec3>&      positions;
+        std::vector<glm::uvec3>            faces;
+        std::vector<bool>                  face_alive;
+        size_t                             alive_faces = 0u;
+        std::vector<std::vector<uint32_t>> vertex_faces;
+        std::vector<Quadric>               quadrics;
+        std::vector<bool>                  border;
+        std::vector<uint32_t>              versions;
+        std::vector<uint32_t>              neighbors;
+        std::vector<uint32_t>              other_neighbors;
+
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+        glm::vec3 face_normal(const glm::uvec3& face) const
+        {
+            return glm::cross(positions[face.y] - positions[face.x], positions[face.z] - positions[face.x]);
+        }
+
+        // border vertexes only move along the border
+        bool can_collapse(uint32_t from, uint32_t to) const
+        {
+            return !border[from] || border[to];
+        }
+
+        void queue_edge(uint32_t a, uint32_t b)
+        {
+            const auto q = quadrics[a] + quadrics[b];
+
+            auto best = Collapse{std::numeric_limits<double>::max(), a, b, versions[a], versions[b]};
+            if (can_collapse(a, b))
+            {
+                best.cost = quadric_error(q, positions[b]);
+            }
+            if (can_collapse(b, a))
+            {
+                const auto cost = quadric_error(q, positions[a]);
+                if (cost < best.cost)
+                {
+                    best = Collapse{cost, b, a, versions[b], versions[a]};
+                }
+            }
+
+            if (best.cost < std::numeric_limits<double>::max())
+            {
+                collapses.push(best);
+            }
+        }
+
+        void collect_neighbors(uint32_t vertex, std::vector<uint32_t>& result) const
+        {
+            result.clear();
+            for (const auto f : vertex_faces[vertex])
+            {
+                if (!face_alive[f])
+                {
+                    continue;
+                }
+                for (auto k = 0; k < 3; k++)
+                {
+                    if (faces[f][k] != vertex)
+                    {
+                        result.push_back(faces[f][k]);
+                    }
+                }
+            }
+            std::sort(begin(result), end(result));
+            result.erase(std::unique(begin(result), end(result)), end(result));
+        }
+
+        // The two vertexes may only share the neighbors across the faces of
+        // their edge, otherwise the collapse pinches the surface.
+        bool is_manifold_collapse(uint32_t from, uint32_t to)
+        {
+            collect_neighbors(from, neighbors);
+            collect_neighbors(to, other_neighbors);
+
+            auto shared_faces = 0u;
+            for (const auto f : vertex_faces[from])
+            {
+                const auto& face = faces[f];
+                if (face_alive[f] && (face.x == to || face.y == to || face.z == to))
+                {
+                    shared_faces++;
+                }
+            }
+
+            auto shared_neighbors = 0u;
+            auto i = neighbors.begin();
+            auto j = other_neighbors.begin();
+            while (i != neighbors.end() && j != other_neighbors.end())
+            {
+                if (*i < *j)
+                {
+                    i++;
+                }
+                else if (*j < *i)
+                {
+                    j++;
+                }
+                else
+                {
+                    shared_neighbors++;
+                    i++;
+                    j++;
+                }
+            }
+
+            return shared_faces > 0u && shared_neighbors <= shared_faces;
+        }
+
+        bool flips_face(uint32_t from, uint32_t to) const
+        {
+            for (const auto f : vertex_faces[from])
+            {
+                auto face = faces[f];
+                if (!face_alive[f] || face.x == to || face.y == to || face.z == to)
+                {
+                    continue;
+                }
+
+                const auto before = face_normal(face);
+                for (auto k = 0; k < 3; k++)
+                {
+                    if (face[k] == from)
+                    {
+                        face[k] = to;
+                    }
+                }
+                const auto after = face_normal(face);
+
+                if (glm::dot(after, after) == 0.0f)
+                {
+                    return true;
+                }
+                if (glm::dot(before, before) > 0.0f && glm::dot(glm::normalize(before), glm::normalize(after)) < MIN_NORMAL_DOT)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void apply(uint32_t from, uint32_t to)
+        {
+            for (const auto f : vertex_faces[from])
+            {
+                if (!face_alive[f])
+                {
+                    continue;
+                }
+
+                auto& face = faces[f];
+                if (face.x == to || face.y == to || face.z == to)
+                {
+                    face_alive[f] = false;
+                    alive_faces--;
+                    continue;
+                }
+
+                for (auto k = 0; k < 3; k++)
+                {
+                    if (face[k] == from)
+                    {
+                        face[k] = to;
+                    }
+                }
+                vertex_faces[to].push_back(f);
+            }
+            vertex_faces[from].clear();
+            std::erase_if(vertex_faces[to], [this] (uint32_t f) { return !face_alive[f]; });
+
+            quadrics[to] += quadrics[from];
+            versions[from]++;
+            versions[to]++;
+
+            collect_neighbors(to, neighbors);
+            for (const auto neighbor : neighbors)
+            {
+                queue_edge(to, neighbor);
+            }
+        }
+    };
+
+    MeshData simplify(const MeshData& data, size_t target_faces)
+    {
+        auto simplifier = QuadricSimplifier(data);
+        simplifier.reduce(target_faces);
+        return simplifier.get_result(data);
+    }
+
+    std::vector<MeshLod> generate_lods(const MeshData& data, unsigned int levels)
+    {
+        auto lods        = std::vector<MeshLod>();
+        auto source      = data;
+        auto screen_size = LOD_SCREEN_SIZE;
+
+        while (lods.size() < levels && source.faces.size() / 2u >= MIN_LOD_FACES)
+        {
+            auto reduced = simplify(source, source.faces.size() / 2u);
+            if (static_cast<float>(reduced.faces.size()) > static_cast<float>(source.faces.size()) * MIN_LOD_REDUCTION)
+            {
+                break;
+            }
+
+            lods.push_back({Mesh::create(reduced), screen_size});
+            source       = std::move(reduced);
+            screen_size *= 0.5f;
+        }
+
+        return lods;
+    }
+
+    size_t select_lod(const std::vector<MeshLod>& lods, float screen_size, size_t current)
+    {
+        auto level = std::min(current, lods.size());
+        while (level > 0u && screen_size > lods[level - 1u].screen_size * (1.0f + LOD_HYSTERESIS))
+        {
+            level--;
+        }
+        while (level < lods.size() && screen_size < lods[level].screen_size * (1.0f - LOD_HYSTERESIS))
+        {
+            level++;
+        }
+        return level;
+    }
+}
@@ -0,0 +1,59 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "api.h"
+#include "Mesh.h"
+
+namespace pkzo
+{
+    //! Screen size of the first level of detail, each further level halves it.
+    constexpr auto LOD_SCREEN_SIZE = 0.5f;
+
+    //! A coarser version of a mesh.
+    struct MeshLod
+    {
+        std::shared_ptr<Mesh> mesh;
+        float                 screen_size = 0.0f; //!< Projected bounding sphere diameter, relative to the viewport height, below which this level is drawn.
+    };
+
+    //! Reduce a mesh to about the given number of faces by quadric error edge collapses.
+    //!
+    //! Vertexes are collapsed into a neighbor, so all vertex attributes stay
+    //! valid. Open borders, which includes texture and normal seams, only
+    //! collapse along themselves. Lines are dropped and the bounds are kept.
+    PKZO_EXPORT MeshData simplify(const MeshData& data, size_t target_faces);
+
+    //! Generate a chain of levels, each with about half the faces and screen size of the previous.
+    //!
+    //! The chain ends early when a mesh gets too small or can not be reduced further.
+    PKZO_EXPORT std::vector<MeshLod> generate_lods(const MeshData& data, unsigned int levels = 3u);
+
+    //! Level to draw at a screen size, 0 being the mesh itself.
+    //!
+    //! The level only changes when the screen size is a margin past the
+    //! threshold, so that objects at a threshold do not pop every frame.
+    PKZO_EXPORT size_t select_lod(const std::vector<MeshLod>& lods, float screen_size, size_t current);
+}
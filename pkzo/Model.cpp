@@ -23,6 +23,7 @@
 
 #include "Model.h"
 
+#include <charconv>
 #include <map>
 
 #include <assimp/cimport.h>
@@ -278,35 +279,130 @@ namespace pkzo
         return Mesh::create(std::move(init));
     }
 
+    // "Rock_LOD2" is level 2 of "Rock", names without a suffix are level 0.
+    std::pair<std::string_view, unsigned int> parse_lod_name(std::string_view name)
+    {
+        constexpr auto suffix = std::string_view("_LOD");
+
+        const auto pos = name.rfind(suffix);
+        if (pos == std::string_view::npos || pos + suffix.size() == name.size())
+        {
+            return {name, 0u};
+        }
+
+        auto       level  = 0u;
+        const auto first  = name.data() + pos + suffix.size();
+        const auto last   = name.data() + name.size();
+        const auto result = std::from_chars(first, last, level);
+        if (result.ec != std::errc() || result.ptr != last)
+        {
+            return {name, 0u};
+        }
+
+        return {name.substr(0u, pos), level};
+    }
+
+    // Meshes named with a level above 0 are artist made levels of the mesh
+    // with the same base name; they are removed from the meshes so that
+    // they are not instantiated on their own. All other meshes get
+    // generated levels.
+    std::vector<std::vector<MeshLod>> assimp_load_lods(const aiScene* scene, std::vector<std::shared_ptr<Mesh>>& meshes)
+    {
+        auto names = std::vector<std::pair<std::string_view, unsigned int>>();
+        names.reserve(meshes.size());
+        for (auto i = 0u; i < meshes.size(); i++)
+        {
+            names.push_back(parse_lod_name(std::string_view(scene->mMeshes[i]->mName.data, scene->mMeshes[i]->mName.length)));
+        }
+
+        auto lods = std::vector<std::vector<MeshLod>>(meshes.size());
+        for (auto i = 0u; i < meshes.size(); i++)
+        {
+            if (names[i].second != 0u)
+            {
+                continue;
+            }
+
+            auto levels = std::map<unsigned int, std::shared_ptr<Mesh>>();
+            for (auto j = 0u; j < meshes.size(); j++)
+            {
+                if (names[j].second != 0u && names[j].first == names[i].first)
+                {
+                    levels[names[j].second] = meshes[j];
+                }
+            }
+
+            if (levels.empty())
+            {
+                lods[i] = generate_lods(*meshes[i]->get_data());
+                continue;
+            }
+
+            auto screen_size = LOD_SCREEN_SIZE;
+            for (const auto& [level, mesh] : levels)
+            {
+                lods[i].push_back({mesh, screen_size});
+                screen_size *= 0.5f;
+            }
+        }
+
+        for (auto i = 0u; i < meshes.size(); i++)
+        {
+            if (names[i].second != 0u)
+            {
+                meshes[i] = nullptr;
+            }
+        }
+
+        return lods;
+    }
+
     std::unique_ptr<Model::Node> assimp_load_node(aiNode* ainode,
                                                   const std::vector<std::shared_ptr<Material>>& materials,
                                                   const std::vector<unsigned int>& material_indexes,
-                                                  const std::vector<std::shared_ptr<Mesh>>& meshes)
+                                                  const std::vector<std::shared_ptr<Mesh>>& meshes,
+                                                  const std::vector<std::vector<MeshLod>>& lods)
     {
         auto node = std::make_unique<Model::Node>();
 
+        // Levels of detail are part of their base mesh.
+        auto mesh_indexes = std::vector<unsigned int>();
+        for (auto i = 0u; i < ainode->mNumMeshes; i++)
+        {
+            if (meshes.at(ainode->mMeshes[i]) != nullptr)
+            {
+                mesh_indexes.push_back(ainode->mMeshes[i]);
+            }
+        }
+
         // Collapse mesh node into this.
-        if (ainode->mNumMeshes == 1 && ainode->mNumChildren == 0)
+        if (mesh_indexes.size() == 1 && ainode->mNumChildren == 0)
         {
             node->transform = to_glm(ainode->mTransformation);
-            node->mesh      = meshes.at(ainode->mMeshes[0]);
-            node->material  = materials.at(material_indexes.at(ainode->mMeshes[0]));
+            node->mesh      = meshes.at(mesh_indexes[0]);
+            node->lods      = lods.at(mesh_indexes[0]);
+            node->material  = materials.at(material_indexes.at(mesh_indexes[0]));
         }
         else
         {
-            for (auto i = 0u; i < ainode->mNumMeshes; i++)
+            for (const auto index : mesh_indexes)
             {
                 auto child = std::make_unique<Model::Node>();
                 child->transform = to_glm(ainode->mTransformation);
-                child->mesh      = meshes.at(ainode->mMeshes[i]);
-                child->material  = materials.at(material_indexes.at(ainode->mMeshes[i]));
+                child->mesh      = meshes.at(index);
+                child->lods      = lods.at(index);
+                child->material  = materials.at(material_indexes.at(index));
                 node->children.push_back(std::move(child));
             }
         }
 
         for (auto i = 0u; i < ainode->mNumChildren; i++)
         {
-            auto child = assimp_load_node(ainode->mChildren[i], materials, material_indexes, meshes);
+            auto child = assimp_load_node(ainode->mChildren[i], materials, material_indexes, meshes, lods);
+            if (child->mesh == nullptr && child->children.empty())
+            {
+                continue;
+            }
             node->children.push_back(std::move(child));
         }
 
@@ -348,7 +444,9 @@ namespace pkzo
             material_indexes.push_back(scene->mMeshes[i]->mMaterialIndex);
         }
 
-        root_node = assimp_load_node(scene->mRootNode, materials, material_indexes, meshes);
+        auto lods = assimp_load_lods(scene, meshes);
+
+        root_node = assimp_load_node(scene->mRootNode, materials, material_indexes, meshes, lods);
     }
 
     Model::~Model() = default;
@@ -379,6 +477,7 @@ namespace pkzo
                     .transform  = child->transform,
                     .collidable = collidable,
                     .mesh       = child->mesh,
+                    .lods       = child->lods,
                     .material   = child->material
                 });
             }
@@ -399,6 +498,7 @@ namespace pkzo
                 .transform  = root_node->transform,
                 .collidable = collidable,
                 .mesh       = root_node->mesh,
+                .lods       = root_node->lods,
                 .material   = root_node->material
             });
         }
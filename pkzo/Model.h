@@ -31,6 +31,7 @@
 
 #include "api.h"
 #include "Material.h"
+#include "MeshLod.h"
 #include "Scene.h"
 
 namespace pkzo
@@ -46,6 +47,7 @@ namespace pkzo
             glm::mat4                          transform = glm::mat4(1.0f);
             std::shared_ptr<Material>          material;
             std::shared_ptr<Mesh>              mesh;
+            std::vector<MeshLod>               lods;
             std::vector<std::unique_ptr<Node>> children;
         };
 
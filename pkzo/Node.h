@@ -21,11 +21,15 @@
 
 #pragma once
 
+#include <memory>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <rsig/rsig.h>
 
+#include "debug.h"
 #include "Bounds.h"
+#include "TransformStore.h"
 
 namespace pkzo
 {
@@ -39,6 +43,7 @@ namespace pkzo
         using NodeT  = Node<Type>;
         using Matrix = NodeTraits<Type>::Matrix;
         using Bounds = NodeTraits<Type>::Bounds;
+        using Store  = TransformStore<Matrix>;
 
         struct Init
         {
@@ -51,13 +56,29 @@ namespace pkzo
         {
             if (parent != nullptr)
             {
-                parent_move_slot = parent->on_move([this] () {
-                    move_signal.emit();
-                });
+                if (parent->transform_store)
+                {
+                    // the dirty range of the store covers the descendants, moves do not cascade
+                    transform_store  = parent->transform_store;
+                    transform_handle = transform_store->add(parent->transform_handle, transform);
+                }
+                else
+                {
+                    parent_move_slot = parent->on_move([this] () {
+                        world_transform_dirty = true;
+                        move_signal.emit();
+                    });
+                }
             }
         }
 
-        virtual ~Node() = default;
+        virtual ~Node()
+        {
+            if (transform_store)
+            {
+                transform_store->remove(transform_handle);
+            }
+        }
 
         [[nodiscard]]
         NodeT* get_parent()
@@ -117,26 +138,57 @@ namespace pkzo
             return transform;
         }
 
+        //! Get the transform of this node relative to the root.
+        //!
+        //! The world transform is cached and only recomputed after this node
+        //! or one of its ancestors moved. If the node is part of a transform
+        //! store, the value is copied from the store.
         [[nodiscard]]
-        Matrix get_world_transform() const
+        const Matrix& get_world_transform() const
         {
-            if (parent)
+            if (transform_store)
             {
-                return parent->get_world_transform() * transform;
+                world_transform = transform_store->get_world(transform_handle);
+                return world_transform;
             }
-            else
+
+            if (world_transform_dirty)
             {
-                return transform;
+                if (parent)
+                {
+                    world_transform = parent->get_world_transform() * transform;
+                }
+                else
+                {
+                    world_transform = transform;
+                }
+                world_transform_dirty = false;
             }
+            return world_transform;
         }
 
         [[nodiscard]]
         void set_transform(const Matrix& value)
         {
-            transform = value;
+            transform             = value;
+            world_transform_dirty = true;
+            if (transform_store)
+            {
+                transform_store->set_local(transform_handle, value);
+            }
             move_signal.emit();
         }
 
+        //! Get the transform store this node is part of, if any.
+        [[nodiscard]]
+        Store* get_transform_store() const
+        {
+            return transform_store.get();
+        }
+
+        //! Called when this node or one of its ancestors moved.
+        //!
+        //! Nodes in a transform store are only notified of their own moves.
         rsig::connection on_move(const std::function<void ()>& handler)
         {
             return move_signal.connect(handler);
@@ -165,6 +217,19 @@ namespace pkzo
 
         virtual void update(float dt) {}
 
+    protected:
+        //! Make this node the root of a new transform store.
+        //!
+        //! All nodes subsequently created below this node keep their
+        //! transforms in the store. Must be called before any children are
+        //! added.
+        void create_transform_store()
+        {
+            check(transform_store == nullptr, "Node already has a transform store.");
+            transform_store  = std::make_shared<Store>();
+            transform_handle = transform_store->add(Store::NO_HANDLE, transform);
+        }
+
     private:
         Node<Type>*    parent    = nullptr;
         Matrix         transform = Matrix(1.0f);
@@ -172,6 +237,12 @@ namespace pkzo
         rsig::signal<> move_signal;
         rsig::slot     parent_move_slot;
 
+        mutable Matrix world_transform       = Matrix(1.0f);
+        mutable bool   world_transform_dirty = true;
+
+        std::shared_ptr<Store> transform_store;
+        typename Store::Handle transform_handle = Store::NO_HANDLE;
+
         Node(const Node<Type>&) = delete;
         Node<Type>& operator = (const Node<Type>&) = delete;
     };
@@ -0,0 +1,327 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "OcclusionBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    OcclusionBuffer::OcclusionBuffer()
+    : OcclusionBuffer(Init{}) {}
+
+    OcclusionBuffer::OcclusionBuffer(Init init)
+    {
+        check(init.size.x > 0u && init.size.y > 0u);
+
+        auto size = init.size;
+        while (true)
+        {
+            const auto count = static_cast<size_t>(size.x) * static_cast<size_t>(size.y);
+            levels.push_back({size, std::vector<float>(count, 1.0f), std::vector<float>(count, 1.0f)});
+            if (size.x == 1u && size.y == 1u)
+            {
+                break;
+            }
+            size = glm::uvec2(std::max((size.x + 1u) / 2u, 1u), std::max((size.y + 1u) / 2u, 1u));
+        }
+    }
+
+    void OcclusionBuffer::begin(const glm::mat4& new_view_projection)
+    {
+        view_projection = new_view_projection;
+        std::ranges::fill(levels.front().min_depth, 1.0f);
+    }
+
+    void OcclusionBuffer::add_occluder(const Mesh& mesh, const glm::mat4& transform)
+    {
+        const auto matrix = view_projection * transform;
+        const auto size   = glm::vec2(levels.front().size);
+
+        clip_vertexes.clear();
+        for (const auto& vertex : mesh.get_vertexes())
+        {
+            clip_vertexes.push_back(matrix * glm::vec4(vertex, 1.0f));
+        }
+
+        auto to_window = [&] (const glm::vec4& clip) {
+            const auto ndc = glm::vec3(clip) / clip.w;
+            return glm::vec3((ndc.x * 0.5f + 0.5f) * size.x, (ndc.y * 0.5f + 0.5f) * size.y, ndc.z * 0.5f + 0.5f);
+        };
+
+        for (const auto& face : mesh.get_faces())
+        {
+            // clip against the near plane, z >= -w; a triangle becomes at most a quad
+            auto polygon = std::array<glm::vec4, 4>{};
+            auto count   = 0u;
+            for (auto k = 0; k < 3; k++)
+            {
+                const auto& p  = clip_vertexes[face[k]];
+                const auto& q  = clip_vertexes[face[(k + 1) % 3]];
+                const auto  dp = p.z + p.w;
+                const auto  dq = q.z + q.w;
+                if (dp >= 0.0f)
+                {
+                    polygon[count++] = p;
+                }
+                if ((dp >= 0.0f) != (dq >= 0.0f))
+                {
+                    polygon[count++] = glm::mix(p, q, dp / (dp - dq));
+                }
+            }
+
+            if (count < 3u)
+            {
+                continue;
+            }
+
+            const auto a = to_window(polygon[0]);
+            for (auto k = 1u; k + 1u < count; k++)
+            {
+                rasterize(a, to_window(polygon[k]), to_window(polygon[k + 1u]));
+            }
+        }
+    }
+
+    // Twice the signed area of the triangle a, b, p; positive when p is left of a to b.
+    float edge_function(const glm::vec3& a, const glm::vec3& b, float px, float py)
+    {
+        return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+    }
+
+    // Half space rasterization at the texel centers. The edge functions and
+    // the depth are affine in window space and evaluated per texel without
+    // a running sum, so the row loop has no dependencies and vectorizes.
+    void OcclusionBuffer::rasterize(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+    {
+        auto& level = levels.front();
+
+        const auto signed_area = edge_function(a, b, c.x, c.y);
+        if (!std::isfinite(signed_area) || signed_area == 0.0f)
+        {
+            return;
+        }
+
+        // both sides are drawn, orient the triangle counter clockwise
+        const auto& v1   = signed_area > 0.0f ? b : c;
+        const auto& v2   = signed_area > 0.0f ? c : b;
+        const auto  area = std::abs(signed_area);
+
+        const auto width  = static_cast<float>(level.size.x);
+        const auto height = static_cast<float>(level.size.y);
+        const auto min_x  = static_cast<int>(std::clamp(std::floor(std::min({a.x, b.x, c.x})), 0.0f, width));
+        const auto min_y  = static_cast<int>(std::clamp(std::floor(std::min({a.y, b.y, c.y})), 0.0f, height));
+        const auto max_x  = static_cast<int>(std::clamp(std::ceil(std::max({a.x, b.x, c.x})), 0.0f, width));
+        const auto max_y  = static_cast<int>(std::clamp(std::ceil(std::max({a.y, b.y, c.y})), 0.0f, height));
+        if (min_x >= max_x || min_y >= max_y)
+        {
+            return;
+        }
+
+        // the weight of each vertex is the edge function of the opposite edge
+        const auto px = static_cast<float>(min_x) + 0.5f;
+        const auto py = static_cast<float>(min_y) + 0.5f;
+        const auto e0 = edge_function(v1, v2, px, py);
+        const auto e1 = edge_function(v2, a, px, py);
+        const auto e2 = edge_function(a, v1, px, py);
+
+        const auto e0_dx = v1.y - v2.y;
+        const auto e1_dx = v2.y - a.y;
+        const auto e2_dx = a.y - v1.y;
+        const auto e0_dy = v2.x - v1.x;
+        const auto e1_dy = a.x - v2.x;
+        const auto e2_dy = v1.x - a.x;
+
+        const auto depth    = (e0 * a.z + e1 * v1.z + e2 * v2.z) / area;
+        const auto depth_dx = (e0_dx * a.z + e1_dx * v1.z + e2_dx * v2.z) / area;
+        const auto depth_dy = (e0_dy * a.z + e1_dy * v1.z + e2_dy * v2.z) / area;
+
+        for (auto y = min_y; y < max_y; y++)
+        {
+            const auto dy     = static_cast<float>(y - min_y);
+            const auto row_e0 = e0 + e0_dy * dy;
+            const auto row_e1 = e1 + e1_dy * dy;
+            const auto row_e2 = e2 + e2_dy * dy;
+            const auto row_z  = depth + depth_dy * dy;
+
+            auto* row = level.min_depth.data() + static_cast<size_t>(y) * level.size.x;
+            for (auto x = min_x; x < max_x; x++)
+            {
+                const auto dx     = static_cast<float>(x - min_x);
+                const auto w0     = row_e0 + e0_dx * dx;
+                const auto w1     = row_e1 + e1_dx * dx;
+                const auto w2     = row_e2 + e2_dx * dx;
+                const auto z      = std::max(row_z + depth_dx * dx, 0.0f);
+                const auto inside = (w0 >= 0.0f) & (w1 >= 0.0f) & (w2 >= 0.0f);
+                row[x] = inside ? std::min(row[x], z) : row[x];
+            }
+        }
+    }
+
+    void OcclusionBuffer::end()
+    {
+        levels.front().max_depth = levels.front().min_depth;
+
+        for (auto l = size_t{1u}; l < levels.size(); l++)
+        {
+            const auto& fine   = levels[l - 1u];
+            auto&       coarse = levels[l];
+            for (auto y = 0u; y < coarse.size.y; y++)
+            {
+                for (auto x = 0u; x < coarse.size.x; x++)
+                {
+                    auto nearest  = 1.0f;
+                    auto farthest = 0.0f;
+                    for (auto fy = 2u * y; fy < std::min(2u * y + 2u, fine.size.y); fy++)
+                    {
+                        for (auto fx = 2u * x; fx < std::min(2u * x + 2u, fine.size.x); fx++)
+                        {
+                            const auto i = fy * fine.size.x + fx;
+                            nearest  = std::min(nearest, fine.min_depth[i]);
+                            farthest = std::max(farthest, fine.max_depth[i]);
+                        }
+                    }
+                    coarse.min_depth[y * coarse.size.x + x] = nearest;
+                    coarse.max_depth[y * coarse.size.x + x] = farthest;
+                }
+            }
+        }
+    }
+
+    glm::uvec2 shift_down(const glm::uvec2& texel, size_t level)
+    {
+        return glm::uvec2(texel.x >> level, texel.y >> level);
+    }
+
+    bool OcclusionBuffer::is_occluded(const Bounds3& bounds) const
+    {
+        const auto size = glm::vec2(levels.front().size);
+        const auto bmin = bounds.get_min();
+        const auto bmax = bounds.get_max();
+
+        auto lo    = glm::vec2(std::numeric_limits<float>::max());
+        auto hi    = glm::vec2(std::numeric_limits<float>::lowest());
+        auto depth = std::numeric_limits<float>::max();
+        for (auto i = 0u; i < 8u; i++)
+        {
+            const auto corner = glm::vec3((i & 1u) ? bmax.x : bmin.x, (i & 2u) ? bmax.y : bmin.y, (i & 4u) ? bmax.z : bmin.z);
+            const auto clip   = view_projection * glm::vec4(corner, 1.0f);
+            if (clip.z < -clip.w)
+            {
+                return false;
+            }
+
+            const auto ndc = glm::vec3(clip) / clip.w;
+            lo    = glm::min(lo, glm::vec2(ndc));
+            hi    = glm::max(hi, glm::vec2(ndc));
+            depth = std::min(depth, ndc.z * 0.5f + 0.5f);
+        }
+
+        // off screen and beyond the far plane is left to the frustum culling
+        lo = (lo * 0.5f + 0.5f) * size;
+        hi = (hi * 0.5f + 0.5f) * size;
+        if (hi.x < 0.0f || hi.y < 0.0f || lo.x >= size.x || lo.y >= size.y || depth >= 1.0f)
+        {
+            return false;
+        }
+
+        const auto first = glm::uvec2(glm::clamp(glm::floor(lo), glm::vec2(0.0f), size - 1.0f));
+        const auto last  = glm::uvec2(glm::clamp(glm::floor(hi), glm::vec2(0.0f), size - 1.0f));
+
+        // start at the coarsest level where the bounds cover at most 2x2 texels
+        auto level = size_t{0u};
+        while (level + 1u < levels.size() && (shift_down(last, level).x - shift_down(first, level).x > 1u || shift_down(last, level).y - shift_down(first, level).y > 1u))
+        {
+            level++;
+        }
+
+        const auto level_first = shift_down(first, level);
+        const auto level_last  = shift_down(last, level);
+        for (auto y = level_first.y; y <= level_last.y; y++)
+        {
+            for (auto x = level_first.x; x <= level_last.x; x++)
+            {
+                if (!is_hidden(level, glm::uvec2(x, y), first, last, depth))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool OcclusionBuffer::is_hidden(size_t level, const glm::uvec2& texel, const glm::uvec2& first, const glm::uvec2& last, float depth) const
+    {
+        const auto& current = levels[level];
+        const auto  index   = texel.y * current.size.x + texel.x;
+
+        // behind the farthest occluder in this region
+        if (depth > current.max_depth[index])
+        {
+            return true;
+        }
+
+        // in front of the nearest occluder, or no finer level to look at
+        if (level == 0u || depth <= current.min_depth[index])
+        {
+            return false;
+        }
+
+        const auto& fine       = levels[level - 1u];
+        const auto  fine_first = glm::max(texel * 2u, shift_down(first, level - 1u));
+        const auto  fine_last  = glm::min(glm::min(texel * 2u + 1u, shift_down(last, level - 1u)), fine.size - 1u);
+        for (auto y = fine_first.y; y <= fine_last.y; y++)
+        {
+            for (auto x = fine_first.x; x <= fine_last.x; x++)
+            {
+                if (!is_hidden(level - 1u, glm::uvec2(x, y), first, last, depth))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    glm::uvec2 OcclusionBuffer::get_size() const
+    {
+        return levels.front().size;
+    }
+
+    size_t OcclusionBuffer::get_level_count() const
+    {
+        return levels.size();
+    }
+
+    float OcclusionBuffer::get_depth(const glm::uvec2& texel) const
+    {
+        const auto& level = levels.front();
+        check(texel.x < level.size.x && texel.y < level.size.y);
+        return level.min_depth[texel.y * level.size.x + texel.x];
+    }
+}
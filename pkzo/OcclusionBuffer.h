@@ -0,0 +1,89 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "api.h"
+#include "Bounds.h"
+#include "Mesh.h"
+
+namespace pkzo
+{
+    //! CPU depth buffer of a few occluders, to cull geometry hidden behind them.
+    //!
+    //! The occluders are rasterized at a low resolution, keeping the nearest
+    //! window depth per texel. A hierarchy of 2x2 reduced levels holds the
+    //! nearest and farthest depth of each region, so that a bounding box is
+    //! tested against a few texels of a coarse level and only refined where
+    //! the answer is not clear. Occluders must lie inside the geometry they
+    //! stand for, otherwise visible geometry may be culled.
+    class PKZO_EXPORT OcclusionBuffer
+    {
+    public:
+        struct Init
+        {
+            glm::uvec2 size = glm::uvec2(256u, 128u);
+        };
+
+        OcclusionBuffer();
+        OcclusionBuffer(Init init);
+
+        //! Clear the buffer for a new view.
+        void begin(const glm::mat4& view_projection);
+
+        //! Rasterize the faces of an occluder mesh, both sides are drawn.
+        void add_occluder(const Mesh& mesh, const glm::mat4& transform);
+
+        //! Build the hierarchy, after all occluders are added.
+        void end();
+
+        //! Check if world space bounds are hidden behind the occluders.
+        //!
+        //! Bounds that cross the near plane are never hidden.
+        bool is_occluded(const Bounds3& bounds) const;
+
+        glm::uvec2 get_size() const;
+
+        size_t get_level_count() const;
+
+        //! Nearest window depth of an occluder in a texel of the full resolution level, 1 if there is none.
+        float get_depth(const glm::uvec2& texel) const;
+
+    private:
+        struct Level
+        {
+            glm::uvec2         size;
+            std::vector<float> min_depth;
+            std::vector<float> max_depth;
+        };
+
+        glm::mat4              view_projection = glm::mat4(1.0f);
+        std::vector<Level>     levels;
+        std::vector<glm::vec4> clip_vertexes;
+
+        void rasterize(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c);
+        bool is_hidden(size_t level, const glm::uvec2& texel, const glm::uvec2& first, const glm::uvec2& last, float depth) const;
+    };
+}
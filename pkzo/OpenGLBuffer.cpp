@@ -32,7 +32,7 @@ namespace pkzo
     OpenGLBuffer::OpenGLBuffer(Type type, Usage usage)
     : type(type), usage(usage)
     {
-        glGenBuffers(1, &handle);
+        glCreateBuffers(1, &handle);
     }
 
     OpenGLBuffer::~OpenGLBuffer()
@@ -70,24 +70,41 @@ namespace pkzo
         check(data != nullptr || new_size == 0);
         check(usage == Usage::STREAM || (capacity == 0u && usage == Usage::STATIC));
 
-        bind();
-
         if (new_size > capacity)
         {
             capacity = std::max(new_size, capacity * 2);
-            glBufferData(std::to_underlying(type), capacity, nullptr, std::to_underlying(usage));
+            glNamedBufferData(handle, capacity, nullptr, std::to_underlying(usage));
         }
 
         if (new_size > 0)
         {
-            glBufferSubData(std::to_underlying(type), 0, new_size, data);
+            glNamedBufferSubData(handle, 0, new_size, data);
         }
 
         size = new_size;
     }
 
-    void OpenGLBuffer::bind()
+    void OpenGLBuffer::upload(GLintptr offset, GLsizeiptr data_size, const void* data)
+    {
+        check(data != nullptr || data_size == 0);
+        check(usage != Usage::STATIC);
+        check(offset + data_size <= capacity);
+
+        if (data_size > 0)
+        {
+            glNamedBufferSubData(handle, offset, data_size, data);
+        }
+
+        size = std::max(size, offset + data_size);
+    }
+
+    void OpenGLBuffer::reserve(GLsizeiptr new_capacity)
     {
-        glBindBuffer(std::to_underlying(type), handle);
+        if (new_capacity > capacity)
+        {
+            capacity = std::max(new_capacity, capacity * 2);
+            glNamedBufferData(handle, capacity, nullptr, std::to_underlying(usage));
+            size = 0;
+        }
     }
 }
@@ -28,19 +28,23 @@
 
 namespace pkzo
 {
+    //! GPU buffer, uploads use direct state access and leave the current bindings untouched.
     class PKZO_EXPORT OpenGLBuffer
     {
     public:
         enum class Usage : GLenum
         {
-            STATIC = GL_STATIC_DRAW,
-            STREAM = GL_STREAM_DRAW
+            STATIC  = GL_STATIC_DRAW,
+            DYNAMIC = GL_DYNAMIC_DRAW,
+            STREAM  = GL_STREAM_DRAW
         };
 
         enum class Type : GLenum
         {
-            ARRAY         = GL_ARRAY_BUFFER,
-            ELEMENT_ARRAY = GL_ELEMENT_ARRAY_BUFFER
+            ARRAY          = GL_ARRAY_BUFFER,
+            ELEMENT_ARRAY  = GL_ELEMENT_ARRAY_BUFFER,
+            SHADER_STORAGE = GL_SHADER_STORAGE_BUFFER,
+            UNIFORM        = GL_UNIFORM_BUFFER
         };
 
         OpenGLBuffer(Type type, Usage usage);
@@ -54,11 +58,19 @@ namespace pkzo
 
         void upload(GLsizeiptr size, const void* data);
 
+        //! Write data into the buffer at the given offset.
+        //!
+        //! The data must fit into the current capacity, see reserve.
+        void upload(GLintptr offset, GLsizeiptr size, const void* data);
+
+        //! Grow the buffer to at least the given capacity.
+        //!
+        //! Growing the buffer discards the contents.
+        void reserve(GLsizeiptr new_capacity);
+
         template<glm::length_t N, typename T, glm::qualifier Q>
         void upload(const std::vector<glm::vec<N, T, Q>>& data);
 
-        void bind();
-
     private:
         GLuint     handle = 0;
         Type       type;
@@ -34,17 +34,34 @@ namespace pkzo
     GLenum gl_format(ColorMode format);
     GLenum gl_type(DataType type);
 
+    // implemented in GraphicContext.cpp
+    size_t get_pixel_bytes(ColorMode color_mode, DataType data_type);
+
     std::shared_ptr<OpenGLCubeMap> OpenGLCubeMap::create(const CreateSpecs& specs)
     {
         return std::make_shared<OpenGLCubeMap>(specs);
     }
 
+    std::shared_ptr<OpenGLCubeMap> OpenGLCubeMap::load_data(const CubeMapData& data)
+    {
+        auto cubemap = std::make_shared<OpenGLCubeMap>(CreateSpecs{
+            .id         = data.id,
+            .size       = data.size,
+            .data_type  = data.data_type,
+            .color_mode = data.color_mode,
+            .miplevels  = data.miplevels
+        });
+        cubemap->upload(data);
+        return cubemap;
+    }
+
     OpenGLCubeMap::OpenGLCubeMap(const CreateSpecs& specs)
     {
         id          = specs.id;
         size        = specs.size;
         color_mode  = specs.color_mode;
         data_type   = specs.data_type;
+        miplevels   = std::max(specs.miplevels, 1u);
 
         glGenTextures(1, &handle);
         glActiveTexture(UPLOAD_SLOT);
@@ -114,11 +131,67 @@ namespace pkzo
         return color_mode;
     }
 
+    unsigned int OpenGLCubeMap::get_miplevels() const
+    {
+        return miplevels;
+    }
+
     GLuint OpenGLCubeMap::get_handle() const
     {
         return handle;
     }
 
+    CubeMapData OpenGLCubeMap::download() const
+    {
+        auto data = CubeMapData{
+            .id         = id,
+            .size       = size,
+            .data_type  = data_type,
+            .color_mode = color_mode,
+            .miplevels  = miplevels
+        };
+
+        const auto pixel_bytes = get_pixel_bytes(color_mode, data_type);
+
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        for (auto face = 0u; face < 6u; face++)
+        {
+            for (auto mip = 0u; mip < miplevels; mip++)
+            {
+                auto& image = data.images.emplace_back();
+                image.size  = std::max(size >> mip, 1u);
+                image.pixels.resize(size_t{image.size} * image.size * pixel_bytes);
+
+                // a cube map is a texture with six layers, one per face
+                glGetTextureSubImage(handle, mip, 0, 0, face, image.size, image.size, 1, gl_format(color_mode), gl_type(data_type), static_cast<GLsizei>(image.pixels.size()), image.pixels.data());
+            }
+        }
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+        return data;
+    }
+
+    void OpenGLCubeMap::upload(const CubeMapData& data)
+    {
+        check(data.images.size() == 6u * miplevels, "The cube map data must have an image for each face and mip level.");
+
+        const auto pixel_bytes = get_pixel_bytes(color_mode, data_type);
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (auto face = 0u; face < 6u; face++)
+        {
+            for (auto mip = 0u; mip < miplevels; mip++)
+            {
+                const auto& image = data.images[face * miplevels + mip];
+                const auto  s     = std::max(size >> mip, 1u);
+                check(image.size == s && image.pixels.size() == size_t{s} * s * pixel_bytes, "The cube map image does not match its face size.");
+
+                glTextureSubImage3D(handle, mip, 0, 0, face, s, s, 1, gl_format(color_mode), gl_type(data_type), image.pixels.data());
+            }
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
     void OpenGLCubeMap::bind(int slot)
     {              \
         check(slot >= 0);
@@ -32,6 +32,7 @@ namespace pkzo
     {
     public:
         static std::shared_ptr<OpenGLCubeMap> create(const CreateSpecs& specs);
+        static std::shared_ptr<OpenGLCubeMap> load_data(const CubeMapData& data);
 
         OpenGLCubeMap(const CreateSpecs& specs);
         ~OpenGLCubeMap();
@@ -40,9 +41,13 @@ namespace pkzo
         unsigned int get_size() const override;
         DataType get_data_type() const override;
         ColorMode get_color_mode() const override;
+        unsigned int get_miplevels() const;
 
         GLuint get_handle() const;
 
+        //! Read back all faces and mip levels.
+        CubeMapData download() const;
+
         void bind(int slot);
 
     private:
@@ -50,6 +55,9 @@ namespace pkzo
         unsigned    size;
         DataType    data_type;
         ColorMode   color_mode;
+        unsigned    miplevels;
         GLuint      handle;
+
+        void upload(const CubeMapData& data);
     };
 }
@@ -72,7 +72,6 @@ namespace pkzo
     std::shared_ptr<OpenGLFrameBuffer> OpenGLFrameBuffer::create(const BufferConfig& config)
     {
         auto buffer = std::make_shared<OpenGLFrameBuffer>();
-        buffer->bind();
 
         if (config.depth)
         {
@@ -94,6 +93,13 @@ namespace pkzo
             }));
         }
 
+        // depth only, like shadow maps
+        if (config.colors.empty())
+        {
+            glNamedFramebufferDrawBuffer(buffer->handle, GL_NONE);
+            glNamedFramebufferReadBuffer(buffer->handle, GL_NONE);
+        }
+
         if (buffer->check_buffer() == false)
         {
             throw std::runtime_error("Failed to create frame buffer.");
@@ -104,7 +110,7 @@ namespace pkzo
 
     OpenGLFrameBuffer::OpenGLFrameBuffer()
     {
-        glGenFramebuffers(1, &handle);
+        glCreateFramebuffers(1, &handle);
     }
 
     OpenGLFrameBuffer::~OpenGLFrameBuffer()
@@ -152,11 +158,11 @@ namespace pkzo
 
         if (texture != nullptr)
         {
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texture->get_handle(), 0);
+            glNamedFramebufferTexture(handle, GL_DEPTH_ATTACHMENT, texture->get_handle(), 0);
         }
         else
         {
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, 0, 0);
+            glNamedFramebufferTexture(handle, GL_DEPTH_ATTACHMENT, 0, 0);
         }
         depth_attachment = texture;
     }
@@ -171,7 +177,7 @@ namespace pkzo
             color_attachement.resize(slot + 1);
         }
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + slot, GL_TEXTURE_2D, texture->get_handle(), level);
+        glNamedFramebufferTexture(handle, GL_COLOR_ATTACHMENT0 + slot, texture->get_handle(), level);
 
         // Assumption: we are assuming frame buffers are not sparse.
         glNamedFramebufferDrawBuffers(handle, slot + 1, buffers);
@@ -189,8 +195,9 @@ namespace pkzo
             color_attachement.resize(slot + 1);
         }
 
-        GLenum target = GL_TEXTURE_CUBE_MAP_POSITIVE_X + static_cast<GLenum>(face);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + slot, target, texture->get_handle(), level);
+        // cube map faces are layers in the order of the face targets
+        auto layer = static_cast<GLint>(face);
+        glNamedFramebufferTextureLayer(handle, GL_COLOR_ATTACHMENT0 + slot, texture->get_handle(), level, layer);
 
         // Assumption: we are assuming frame buffers are not sparse.
         glNamedFramebufferDrawBuffers(handle, slot + 1, buffers);
@@ -198,7 +205,7 @@ namespace pkzo
 
     bool OpenGLFrameBuffer::check_buffer() const
     {
-        auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        auto status = glCheckNamedFramebufferStatus(handle, GL_FRAMEBUFFER);
         return status == GL_FRAMEBUFFER_COMPLETE;
     }
 
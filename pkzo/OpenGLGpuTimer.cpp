@@ -0,0 +1,130 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "OpenGLGpuTimer.h"
+
+namespace pkzo
+{
+    OpenGLGpuTimer::OpenGLGpuTimer()
+    {
+        calibrate();
+    }
+
+    OpenGLGpuTimer::~OpenGLGpuTimer()
+    {
+        for (const auto& query : open_queries)
+        {
+            release(query);
+        }
+        for (const auto& query : pending_queries)
+        {
+            release(query);
+        }
+        glDeleteQueries(static_cast<GLsizei>(free_queries.size()), free_queries.data());
+    }
+
+    void OpenGLGpuTimer::start(uint64_t frame, size_t pass)
+    {
+        auto query = Query{
+            .frame = frame,
+            .pass  = pass,
+            .start = acquire(),
+            .end   = acquire()
+        };
+        glQueryCounter(query.start, GL_TIMESTAMP);
+        open_queries.push_back(query);
+    }
+
+    void OpenGLGpuTimer::end()
+    {
+        if (open_queries.empty())
+        {
+            return;
+        }
+
+        auto query = open_queries.back();
+        open_queries.pop_back();
+
+        glQueryCounter(query.end, GL_TIMESTAMP);
+        pending_queries.push_back(query);
+    }
+
+    void OpenGLGpuTimer::collect(FrameProfiler& profiler)
+    {
+        calibrate();
+
+        const auto frame = profiler.get_frame();
+        std::erase_if(pending_queries, [&] (const Query& query) {
+            if (query.frame + LATENCY > frame)
+            {
+                return false;
+            }
+
+            auto available = GLint{GL_FALSE};
+            glGetQueryObjectiv(query.end, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == GL_FALSE)
+            {
+                return false;
+            }
+
+            auto start = GLuint64{0u};
+            auto end   = GLuint64{0u};
+            glGetQueryObjectui64v(query.start, GL_QUERY_RESULT, &start);
+            glGetQueryObjectui64v(query.end,   GL_QUERY_RESULT, &end);
+
+            const auto offset = std::chrono::nanoseconds(static_cast<GLint64>(start) - gpu_reference);
+            const auto time   = std::chrono::duration<float, std::milli>(std::chrono::nanoseconds(end - start)).count();
+            profiler.set_gpu_time(query.frame, query.pass, cpu_reference + std::chrono::duration_cast<FrameProfiler::clock::duration>(offset), time);
+
+            release(query);
+            return true;
+        });
+    }
+
+    GLuint OpenGLGpuTimer::acquire()
+    {
+        if (free_queries.empty())
+        {
+            auto id = GLuint{0u};
+            glGenQueries(1, &id);
+            return id;
+        }
+
+        auto id = free_queries.back();
+        free_queries.pop_back();
+        return id;
+    }
+
+    void OpenGLGpuTimer::release(const Query& query)
+    {
+        free_queries.push_back(query.start);
+        free_queries.push_back(query.end);
+    }
+
+    void OpenGLGpuTimer::calibrate()
+    {
+        // the GL time of commands reaching the server, does not wait for them to finish
+        glGetInteger64v(GL_TIMESTAMP, &gpu_reference);
+        cpu_reference = FrameProfiler::clock::now();
+    }
+}
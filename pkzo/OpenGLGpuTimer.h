@@ -0,0 +1,81 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include "api.h"
+#include "FrameProfiler.h"
+
+namespace pkzo
+{
+    //! Measures the GPU time of passes with timestamp queries.
+    //!
+    //! The results are only read back once the queries are LATENCY frames
+    //! old and the GPU reports them available, so timing never waits for
+    //! the GPU to catch up.
+    class PKZO_EXPORT OpenGLGpuTimer
+    {
+    public:
+        //! Frames to wait before reading a query back.
+        static constexpr auto LATENCY = uint64_t{3u};
+
+        OpenGLGpuTimer();
+        ~OpenGLGpuTimer();
+
+        OpenGLGpuTimer(const OpenGLGpuTimer&) = delete;
+        OpenGLGpuTimer& operator = (const OpenGLGpuTimer&) = delete;
+
+        //! Start timing a pass of the profiler.
+        void start(uint64_t frame, size_t pass);
+
+        //! Stop timing the innermost pass.
+        void end();
+
+        //! Pass the available results to the profiler, call once per frame.
+        void collect(FrameProfiler& profiler);
+
+    private:
+        struct Query
+        {
+            uint64_t frame = 0u;
+            size_t   pass  = 0u;
+            GLuint   start = 0u;
+            GLuint   end   = 0u;
+        };
+
+        std::vector<GLuint> free_queries;
+        std::vector<Query>  open_queries;
+        std::deque<Query>   pending_queries;
+
+        // maps GPU timestamps to the CPU clock
+        GLint64                   gpu_reference = 0;
+        FrameProfiler::time_point cpu_reference;
+
+        GLuint acquire();
+        void release(const Query& query);
+        void calibrate();
+    };
+}
@@ -23,6 +23,9 @@
 
 #include "OpenGLGraphicContext.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <stdexcept>
 #include <GL/glew.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -35,6 +38,7 @@
 #include "OpenGLMesh.h"
 #include "OpenGLFrameBuffer.h"
 #include "OpenGLCubeMap.h"
+#include "OpenGLUniformBuffer.h"
 
 namespace pkzo
 {
@@ -108,8 +112,15 @@ namespace pkzo
         }
     }
 
-    OpenGLGraphicContext::OpenGLGraphicContext(SDL_Window* window)
-    : window(window)
+    // initial size of the streamed mesh data per frame, it grows as needed
+    constexpr auto MESH_STREAM_FRAME_SIZE = GLsizeiptr{1024 * 1024};
+    // initial size of the uniform blocks per frame, it grows as needed
+    constexpr auto UNIFORM_STREAM_FRAME_SIZE = GLsizeiptr{256 * 1024};
+    // initial size of the shader storage per frame, it grows as needed
+    constexpr auto STORAGE_STREAM_FRAME_SIZE = GLsizeiptr{256 * 1024};
+
+    OpenGLGraphicContext::OpenGLGraphicContext(SDL_Window* window, const std::filesystem::path& shader_cache_directory, VertexFormat vertex_format)
+    : window(window), vertex_format(vertex_format)
     {
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
@@ -129,10 +140,28 @@ namespace pkzo
 
         white_fallback_texture  = OpenGLTexture::create(glm::vec4(1.0f), "Fallback White");
         normal_fallback_texture = OpenGLTexture::create(glm::vec4(0.5f, 0.5f, 1.0f, 1.0f), "Fallback Normal");
+
+        auto alignment = GLint{0};
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        uniform_buffer_alignment = static_cast<size_t>(std::max(alignment, 1));
+
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        storage_buffer_alignment = static_cast<GLsizeiptr>(std::max(alignment, 1));
+
+        shader_cache   = std::make_unique<OpenGLShaderCache>(shader_cache_directory);
+        gpu_timer      = std::make_unique<OpenGLGpuTimer>();
+        mesh_stream    = std::make_shared<OpenGLStreamBuffer>(MESH_STREAM_FRAME_SIZE);
+        uniform_stream = std::make_shared<OpenGLStreamBuffer>(UNIFORM_STREAM_FRAME_SIZE);
+        storage_stream = std::make_shared<OpenGLStreamBuffer>(STORAGE_STREAM_FRAME_SIZE);
     }
 
     OpenGLGraphicContext::~OpenGLGraphicContext()
     {
+        shader_cache   = nullptr;
+        gpu_timer      = nullptr;
+        mesh_stream    = nullptr;
+        uniform_stream = nullptr;
+        storage_stream = nullptr;
         SDL_GL_DestroyContext(glcontext);
         glcontext = nullptr;
     }
@@ -157,8 +186,7 @@ namespace pkzo
 
     std::shared_ptr<Shader> OpenGLGraphicContext::compile(const Shader::Source& source)
     {
-        // TODO caching
-        return std::make_shared<OpenGLShader>(source);
+        return shader_cache->compile(source);
     }
 
     std::shared_ptr<FrameBuffer> OpenGLGraphicContext::create_frame_buffer(const FrameBuffer::BufferConfig& config)
@@ -166,10 +194,9 @@ namespace pkzo
         return OpenGLFrameBuffer::create(config);
     }
 
-    std::shared_ptr<CubeMap> OpenGLGraphicContext::generate_cubemap(const CubeMapGenerator& generator)
+    std::shared_ptr<OpenGLCubeMap> OpenGLGraphicContext::get_generator_target(const CubeMapGenerator& generator) const
     {
-        auto framebuffer = std::make_shared<OpenGLFrameBuffer>();
-        auto cubemap     = std::dynamic_pointer_cast<OpenGLCubeMap>(generator.target);
+        auto cubemap = std::dynamic_pointer_cast<OpenGLCubeMap>(generator.target);
         if (cubemap == nullptr)
         {
             check(generator.target == nullptr, "The cube map passed to the OpenGL generator must be an OpenGL cubemap.");
@@ -181,9 +208,11 @@ namespace pkzo
                 .miplevels   = generator.miplevels
             });
         }
+        return cubemap;
+    }
 
-        glFinish();
-
+    void OpenGLGraphicContext::render_cubemap_faces(const CubeMapGenerator& generator, const std::shared_ptr<OpenGLCubeMap>& cubemap, unsigned int first, unsigned int count)
+    {
         static glm::mat3 cube_tbn[6] = {
             glm::mat3(glm::vec3( 0,  0, -1), glm::vec3( 0,  1,  0), glm::vec3( 1,  0,  0)),
             glm::mat3(glm::vec3( 0,  0,  1), glm::vec3( 0,  1,  0), glm::vec3(-1,  0,  0)),
@@ -193,7 +222,14 @@ namespace pkzo
             glm::mat3(glm::vec3(-1,  0,  0), glm::vec3( 0,  1,  0), glm::vec3( 0,  0, -1))
         };
 
-        auto size = generator.size;
+        const auto last = std::min(first + count, 6u * generator.miplevels);
+        if (first >= last)
+        {
+            return;
+        }
+
+        auto framebuffer = std::make_shared<OpenGLFrameBuffer>();
+        auto viewport    = get_viewport();
 
         start_pass("Generate Cubemap", generator.shader, framebuffer);
 
@@ -207,28 +243,74 @@ namespace pkzo
             std::visit([&] (auto&& tex) { bind_texture(slot, tex); }, texture);
         }
 
-        for (auto mip = 0u; mip < generator.miplevels; mip++)
+        for (auto i = first; i < last; i++)
         {
+            const auto face = i % 6u;
+            const auto mip  = i / 6u;
+            const auto size = std::max(generator.size >> mip, 1u);
+
             glViewport(0, 0, size, size);
-            for (auto face = 0u; face < 6; face++)
-            {
-                framebuffer->attach_color(0, cubemap, static_cast<CubeFace>(face), mip);
+            framebuffer->attach_color(0, cubemap, static_cast<CubeFace>(face), mip);
 
-                set_uniform(std::to_underlying(UniformLocation::MIPLEVEL),    static_cast<int>(mip));
-                set_uniform(std::to_underlying(UniformLocation::CUBEMAP_TBN), cube_tbn[face]);
+            set_uniform(std::to_underlying(UniformLocation::MIPLEVEL),    static_cast<int>(mip));
+            set_uniform(std::to_underlying(UniformLocation::CUBEMAP_TBN), cube_tbn[face]);
 
-                draw_fullscreen();
-            }
-            size = size / 2u;
+            draw_fullscreen();
         }
         end_pass();
 
+        set_viewport(viewport);
+    }
+
+    std::shared_ptr<CubeMap> OpenGLGraphicContext::generate_cubemap(const CubeMapGenerator& generator)
+    {
+        auto cubemap = get_generator_target(generator);
+
+        glFinish();
+
+        render_cubemap_faces(generator, cubemap, 0u, 6u * generator.miplevels);
+
         return cubemap;
     }
 
+    std::shared_ptr<CubeMap> OpenGLGraphicContext::generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count)
+    {
+        auto cubemap = get_generator_target(generator);
+        render_cubemap_faces(generator, cubemap, first, count);
+        return cubemap;
+    }
+
+    CubeMapData OpenGLGraphicContext::download_cubemap(const std::shared_ptr<CubeMap>& cubemap)
+    {
+        auto gl_cubemap = std::dynamic_pointer_cast<OpenGLCubeMap>(cubemap);
+        check(gl_cubemap, "The cube map to download must be an OpenGL cubemap.");
+        return gl_cubemap->download();
+    }
+
+    std::shared_ptr<CubeMap> OpenGLGraphicContext::upload_cubemap(const CubeMapData& data)
+    {
+        count_upload(data);
+        return OpenGLCubeMap::load_data(data);
+    }
+
     std::shared_ptr<Mesh> OpenGLGraphicContext::upload_mesh(MeshData data, bool stream)
     {
-        return OpenGLMesh::create(std::move(data), stream ? OpenGLBuffer::Usage::STREAM : OpenGLBuffer::Usage::STATIC);
+        count_upload(data);
+        if (stream)
+        {
+            return OpenGLMesh::create(std::move(data), mesh_stream);
+        }
+        return OpenGLMesh::create(std::move(data), OpenGLBuffer::Usage::STATIC, vertex_format);
+    }
+
+    std::shared_ptr<UniformBuffer> OpenGLGraphicContext::create_uniform_buffer(size_t size)
+    {
+        return std::make_shared<OpenGLUniformBuffer>(size);
+    }
+
+    size_t OpenGLGraphicContext::get_uniform_buffer_alignment() const
+    {
+        return uniform_buffer_alignment;
     }
 
     void OpenGLGraphicContext::set_viewport(const Viewport& viewport)
@@ -248,6 +330,9 @@ namespace pkzo
 
     void OpenGLGraphicContext::clear_screen()
     {
+        // depth writes may be off after a DepthTest::READ pass, but they mask the clear
+        state.set_depth_mask(true);
+
         glClearColor(0, 0, 0, 1);
         glClearDepth(1);
         glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
@@ -262,20 +347,23 @@ namespace pkzo
     {
         glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, static_cast<GLsizei>(name.size()), name.data());
 
+        auto pass = profiler.start_pass(name);
+        if (pass != FrameProfiler::NO_PASS)
+        {
+            gpu_timer->start(profiler.get_frame(), pass);
+        }
+
         current_shader = std::dynamic_pointer_cast<OpenGLShader>(shader);
         check(current_shader);
-        current_shader->bind();
+        state.use_program(current_shader);
+        render_stats.shader_binds++;
 
         if (frame_buffer)
         {
             current_frame_buffer = std::dynamic_pointer_cast<OpenGLFrameBuffer>(frame_buffer);
             check(current_frame_buffer);
-            current_frame_buffer->bind();
-        }
-        else
-        {
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
         }
+        state.bind_frame_buffer(current_frame_buffer);
     }
 
     void OpenGLGraphicContext::set_blend_mode(BlendMode mode)
@@ -283,15 +371,15 @@ namespace pkzo
         switch (mode)
         {
             case BlendMode::DISABLED:
-                glDisable(GL_BLEND);
+                state.set_blend(false);
                 break;
             case BlendMode::ALPHA:
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                state.set_blend(true);
+                state.set_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
                 break;
             case BlendMode::ONE:
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_ONE, GL_ONE);
+                state.set_blend(true);
+                state.set_blend_func(GL_ONE, GL_ONE);
                 break;
             default:
                 std::unreachable();
@@ -304,17 +392,17 @@ namespace pkzo
         switch (mode)
         {
             case DepthTest::DISABLED:
-                glDisable(GL_DEPTH_TEST);
+                state.set_depth_test(false);
                 break;
             case DepthTest::READ:
-                glEnable(GL_DEPTH_TEST);
-                glDepthFunc(GL_LEQUAL);
-                glDepthMask(GL_FALSE);
+                state.set_depth_test(true);
+                state.set_depth_func(GL_LEQUAL);
+                state.set_depth_mask(false);
                 break;
             case DepthTest::ENABLED:
-                glEnable(GL_DEPTH_TEST);
-                glDepthFunc(GL_LEQUAL);
-                glDepthMask(GL_TRUE);
+                state.set_depth_test(true);
+                state.set_depth_func(GL_LEQUAL);
+                state.set_depth_mask(true);
                 break;
             default:
                 std::unreachable();
@@ -325,66 +413,77 @@ namespace pkzo
     void OpenGLGraphicContext::set_uniform(int loc, int value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform1i(loc, value);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, float value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform1f(loc, value);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::ivec2& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform2i(loc, value.x, value.y);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::ivec3& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform3i(loc, value.x, value.y, value.z);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::ivec4& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform4i(loc, value.x, value.y, value.z, value.w);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::vec2& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform2f(loc, value.x, value.y);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::vec3& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform3f(loc, value.x, value.y, value.z);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::vec4& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniform4f(loc, value.x, value.y, value.z, value.w);
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::mat2& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniformMatrix2fv(loc, 1u, GL_FALSE, glm::value_ptr(value));
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::mat3& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniformMatrix3fv(loc, 1u, GL_FALSE, glm::value_ptr(value));
     }
 
     void OpenGLGraphicContext::set_uniform(int loc, const glm::mat4& value)
     {
         check(loc >= 0);
+        render_stats.uniforms++;
         glUniformMatrix4fv(loc, 1u, GL_FALSE, glm::value_ptr(value));
     }
 
@@ -396,16 +495,17 @@ namespace pkzo
     void OpenGLGraphicContext::bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback)
     {
         check(slot >= 0);
+        render_stats.texture_binds++;
 
         if (texture == nullptr)
         {
             switch (fallback)
             {
                 case FallbackTexture::WHITE:
-                    white_fallback_texture->bind(slot);
+                    state.bind_texture(slot, white_fallback_texture);
                     return;
                 case FallbackTexture::NORMAL:
-                    normal_fallback_texture->bind(slot);
+                    state.bind_texture(slot, normal_fallback_texture);
                     return;
                 default:
                     std::unreachable();
@@ -417,16 +517,57 @@ namespace pkzo
         {
             odl_texture = upload(texture);
         }
-        odl_texture->bind(slot);
+        state.bind_texture(slot, odl_texture);
     }
 
     void OpenGLGraphicContext::bind_texture(int slot, const std::shared_ptr<CubeMap>& texture)
     {
         check(slot >= 0);
+        render_stats.texture_binds++;
 
         auto odl_texture = std::dynamic_pointer_cast<OpenGLCubeMap>(texture);
         check(odl_texture != nullptr); // we don't have memory cube maps yet.
-        odl_texture->bind(slot);
+        state.bind_texture(slot, odl_texture);
+    }
+
+    void OpenGLGraphicContext::set_storage_buffer(int binding, size_t size, const void* data)
+    {
+        // binding a buffer without storage is an error, even if the shader reads nothing
+        constexpr auto MIN_STORAGE_SIZE = size_t{16u};
+
+        // small data is padded, the range must not reach past the written bytes
+        auto padded = std::array<std::byte, MIN_STORAGE_SIZE>{};
+        if (size < MIN_STORAGE_SIZE)
+        {
+            if (size > 0u)
+            {
+                std::memcpy(padded.data(), data, size);
+            }
+            data = padded.data();
+        }
+
+        const auto range    = static_cast<GLsizeiptr>(std::max(size, MIN_STORAGE_SIZE));
+        const auto position = storage_stream->write(range, data, storage_buffer_alignment);
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, storage_stream->get_handle(), position, range);
+        render_stats.buffer_bytes += size;
+    }
+
+    void OpenGLGraphicContext::bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size)
+    {
+        auto gl_buffer = std::dynamic_pointer_cast<OpenGLUniformBuffer>(buffer);
+        check(gl_buffer);
+        check(offset % uniform_buffer_alignment == 0u);
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, gl_buffer->get_handle(), static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+    }
+
+    void OpenGLGraphicContext::set_uniform_buffer(int binding, size_t size, const void* data)
+    {
+        // Growing moves on to a new buffer, ranges bound earlier in the
+        // pass stay valid in the old one until the end of the frame.
+        auto position = uniform_stream->write(static_cast<GLsizeiptr>(size), data, static_cast<GLsizeiptr>(uniform_buffer_alignment));
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, uniform_stream->get_handle(), position, static_cast<GLsizeiptr>(size));
+
+        render_stats.buffer_bytes += size;
     }
 
     void OpenGLGraphicContext::draw(const std::shared_ptr<Mesh>& mesh)
@@ -436,7 +577,34 @@ namespace pkzo
         {
             odl_mesh = upload(mesh);
         }
+        bind_mesh(odl_mesh);
         odl_mesh->draw();
+        count_draw(*odl_mesh);
+    }
+
+    void OpenGLGraphicContext::draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms)
+    {
+        if (transforms.empty())
+        {
+            return;
+        }
+
+        auto odl_mesh = std::dynamic_pointer_cast<OpenGLMesh>(mesh);
+        if (odl_mesh == nullptr)
+        {
+            odl_mesh = upload(mesh);
+        }
+
+        // The transforms go into the region of the stream buffer the GPU is
+        // done with, aligned so that they start at a whole instance.
+        auto data_size     = transforms.size() * sizeof(glm::mat4);
+        auto position      = mesh_stream->write(static_cast<GLsizeiptr>(data_size), transforms.data(), sizeof(glm::mat4));
+        auto base_instance = static_cast<GLuint>(position / static_cast<GLintptr>(sizeof(glm::mat4)));
+        bind_mesh(odl_mesh);
+        odl_mesh->draw_instanced(mesh_stream->get_handle(), base_instance, static_cast<GLsizei>(transforms.size()));
+
+        render_stats.buffer_bytes += data_size;
+        count_draw(*odl_mesh, transforms.size());
     }
 
     void OpenGLGraphicContext::draw_fullscreen()
@@ -453,13 +621,49 @@ namespace pkzo
         current_shader       = nullptr;
         current_frame_buffer = nullptr;
 
+        gpu_timer->end();
+        profiler.end_pass();
+
         glPopDebugGroup();
     }
 
     void OpenGLGraphicContext::swap_buffers()
     {
         SDL_GL_SwapWindow(window);
+        mesh_stream->end_frame();
+        uniform_stream->end_frame();
+        storage_stream->end_frame();
         collect_garbage();
+        current_mesh_block = std::nullopt;
+
+        state_stats = state.get_stats();
+        state.reset_stats();
+
+        end_render_stats(texture_cache.size(), mesh_cache.size());
+
+        profiler.end_frame();
+        gpu_timer->collect(profiler);
+    }
+
+    void OpenGLGraphicContext::make_current()
+    {
+        if (!SDL_GL_MakeCurrent(window, glcontext))
+        {
+            throw std::runtime_error(SDL_GetError());
+        }
+    }
+
+    void OpenGLGraphicContext::release_current()
+    {
+        if (!SDL_GL_MakeCurrent(window, nullptr))
+        {
+            throw std::runtime_error(SDL_GetError());
+        }
+    }
+
+    const OpenGLStateCache::Stats& OpenGLGraphicContext::get_state_stats() const
+    {
+        return state_stats;
     }
 
     std::shared_ptr<OpenGLTexture> OpenGLGraphicContext::upload(const std::shared_ptr<Texture>& texture)
@@ -472,6 +676,7 @@ namespace pkzo
         }
 
         auto oglt = std::make_shared<OpenGLTexture>(texture);
+        count_upload(*texture);
         texture_cache.insert_or_assign(texture, oglt);
         return oglt;
     }
@@ -485,11 +690,29 @@ namespace pkzo
             return i->second;
         }
 
-        auto oglm = std::make_shared<OpenGLMesh>(mesh);
+        auto oglm = std::make_shared<OpenGLMesh>(mesh, vertex_format);
+        count_upload(*mesh->get_data());
         mesh_cache.insert_or_assign(mesh, oglm);
         return oglm;
     }
 
+    // Meshes in the float format share one mesh block, so it only changes
+    // between packed meshes or when switching the format.
+    void OpenGLGraphicContext::bind_mesh(const std::shared_ptr<OpenGLMesh>& mesh)
+    {
+        state.bind_vertex_array(mesh);
+
+        const auto& block = mesh->get_mesh_block();
+        if (!current_mesh_block ||
+            current_mesh_block->position_scale != block.position_scale ||
+            current_mesh_block->position_offset != block.position_offset ||
+            current_mesh_block->packed != block.packed)
+        {
+            set_uniform_buffer(std::to_underlying(UniformBinding::MESH), sizeof(MeshBlock), &block);
+            current_mesh_block = block;
+        }
+    }
+
     void OpenGLGraphicContext::collect_garbage()
     {
         std::erase_if(texture_cache, [] (const auto& pair) { return pair.first.expired(); });
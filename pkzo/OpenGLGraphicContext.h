@@ -23,21 +23,29 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 
 #include "GraphicContext.h"
+#include "OpenGLStateCache.h"
+#include "OpenGLShaderCache.h"
+#include "OpenGLGpuTimer.h"
+#include "UniformBlocks.h"
+#include "VertexPacking.h"
 
 namespace pkzo
 {
     class OpenGLShader;
     class OpenGLTexture;
+    class OpenGLCubeMap;
     class OpenGLMesh;
     class OpenGLFrameBuffer;
     class OpenGLDebugRenderer;
+    class OpenGLStreamBuffer;
 
     class PKZO_EXPORT OpenGLGraphicContext : public GraphicContext
     {
     public:
-        OpenGLGraphicContext(SDL_Window* window);
+        OpenGLGraphicContext(SDL_Window* window, const std::filesystem::path& shader_cache, VertexFormat vertex_format = VertexFormat::FLOAT);
         ~OpenGLGraphicContext();
 
         Api get_api() const override;
@@ -48,9 +56,15 @@ namespace pkzo
         std::shared_ptr<FrameBuffer> create_frame_buffer(const FrameBuffer::BufferConfig& config) override;
 
         std::shared_ptr<CubeMap> generate_cubemap(const CubeMapGenerator& generator) override;
+        std::shared_ptr<CubeMap> generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count) override;
+        CubeMapData download_cubemap(const std::shared_ptr<CubeMap>& cubemap) override;
+        std::shared_ptr<CubeMap> upload_cubemap(const CubeMapData& data) override;
 
         std::shared_ptr<Mesh> upload_mesh(MeshData data, bool stream = false) override;
 
+        std::shared_ptr<UniformBuffer> create_uniform_buffer(size_t size) override;
+        size_t get_uniform_buffer_alignment() const override;
+
         void set_viewport(const Viewport& viewport) override;
         Viewport get_viewport() const override;
 
@@ -78,19 +92,41 @@ namespace pkzo
         void bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback = FallbackTexture::WHITE) override;
         void bind_texture(int slot, const std::shared_ptr<CubeMap>& texture) override;
 
+        using GraphicContext::set_storage_buffer;
+        void set_storage_buffer(int binding, size_t size, const void* data) override;
+
+        void bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size) override;
+
+        using GraphicContext::set_uniform_buffer;
+        void set_uniform_buffer(int binding, size_t size, const void* data) override;
+
         void draw(const std::shared_ptr<Mesh>& mesh) override;
+        void draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms) override;
         void draw_fullscreen() override;
 
         void end_pass() override;
 
         void swap_buffers() override;
 
+        void make_current() override;
+        void release_current() override;
+
+        //! Issued and elided state changes of the last frame.
+        const OpenGLStateCache::Stats& get_state_stats() const;
+
     private:
         SDL_Window*   window    = nullptr;
         SDL_GLContext glcontext = nullptr;
+        VertexFormat  vertex_format = VertexFormat::FLOAT;
 
         std::weak_ptr<OpenGLDebugRenderer> weak_debug_renderer;
 
+        OpenGLStateCache        state;
+        OpenGLStateCache::Stats state_stats;
+
+        std::unique_ptr<OpenGLShaderCache> shader_cache;
+        std::unique_ptr<OpenGLGpuTimer>    gpu_timer;
+
         std::shared_ptr<OpenGLShader>      current_shader;
         std::shared_ptr<OpenGLFrameBuffer> current_frame_buffer;
 
@@ -102,8 +138,26 @@ namespace pkzo
 
         std::shared_ptr<OpenGLMesh> fullscreen_mesh;
 
+        std::shared_ptr<OpenGLCubeMap> get_generator_target(const CubeMapGenerator& generator) const;
+        void render_cubemap_faces(const CubeMapGenerator& generator, const std::shared_ptr<OpenGLCubeMap>& cubemap, unsigned int first, unsigned int count);
+
+        // per frame uniform blocks, advanced in swap_buffers
+        size_t                              uniform_buffer_alignment = 256u;
+        std::shared_ptr<OpenGLStreamBuffer> uniform_stream;
+
+        // per frame shader storage, advanced in swap_buffers
+        GLsizeiptr                          storage_buffer_alignment = 256;
+        std::shared_ptr<OpenGLStreamBuffer> storage_stream;
+
+        // data of meshes uploaded with stream and instance transforms, advanced in swap_buffers
+        std::shared_ptr<OpenGLStreamBuffer> mesh_stream;
+
+        // mesh block of the last draw, reset in swap_buffers
+        std::optional<MeshBlock> current_mesh_block;
+
         std::shared_ptr<OpenGLTexture> upload(const std::shared_ptr<Texture>& texture);
         std::shared_ptr<OpenGLMesh> upload(const std::shared_ptr<Mesh>& mesh);
+        void bind_mesh(const std::shared_ptr<OpenGLMesh>& mesh);
         void collect_garbage();
     };
 }
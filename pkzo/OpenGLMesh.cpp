@@ -24,11 +24,12 @@
 #include "OpenGLMesh.h"
 
 #include "debug.h"
+#include "PackedAttributes.h"
 
 namespace pkzo
 {
     template<glm::length_t N, glm::qualifier Q>
-    std::shared_ptr<OpenGLBuffer> upload_values(AttributeLocation attr, const std::vector<glm::vec<N, float, Q>>& data, OpenGLBuffer::Usage usage)
+    std::shared_ptr<OpenGLBuffer> upload_values(GLuint vao, AttributeLocation attr, const std::vector<glm::vec<N, float, Q>>& data, OpenGLBuffer::Usage usage)
     {
         if (data.empty())
         {
@@ -38,9 +39,12 @@ namespace pkzo
         auto buffer = std::make_shared<OpenGLBuffer>(OpenGLBuffer::Type::ARRAY, usage);
         buffer->upload(data);
 
-        buffer->bind();
-        glVertexAttribPointer(std::to_underlying(attr), N, GL_FLOAT, GL_FALSE, 0, nullptr);
-        glEnableVertexAttribArray(std::to_underlying(attr));
+        // each attribute reads from the buffer binding with the same index
+        auto index = static_cast<GLuint>(std::to_underlying(attr));
+        glVertexArrayVertexBuffer(vao, index, buffer->get_handle(), 0, sizeof(glm::vec<N, float, Q>));
+        glVertexArrayAttribFormat(vao, index, N, GL_FLOAT, GL_FALSE, 0);
+        glVertexArrayAttribBinding(vao, index, index);
+        glEnableVertexArrayAttrib(vao, index);
 
         return buffer;
     }
@@ -83,34 +87,136 @@ namespace pkzo
         buffer->upload(data);
     }
 
-    std::shared_ptr<OpenGLMesh> OpenGLMesh::create(MeshData data, OpenGLBuffer::Usage usage)
+    bool has_attribute(const MeshData& data, AttributeLocation attr)
     {
-        return std::make_shared<OpenGLMesh>(std::move(data), usage);
+        switch (attr)
+        {
+            case AttributeLocation::VERTEX:   return !data.vertexes.empty();
+            case AttributeLocation::NORMAL:   return !data.normals.empty();
+            case AttributeLocation::TANGENT:  return !data.tangents.empty();
+            case AttributeLocation::TEXCOORD: return !data.texcoords.empty();
+            case AttributeLocation::COLOR:    return !data.colors.empty();
+            default:                          return false;
+        }
+    }
+
+    // All packed attributes read from the interleaved buffer at binding 0.
+    std::shared_ptr<OpenGLBuffer> upload_packed(GLuint vao, const MeshData& data, const PackedVertexes& packed, OpenGLBuffer::Usage usage)
+    {
+        auto buffer = std::make_shared<OpenGLBuffer>(OpenGLBuffer::Type::ARRAY, usage);
+        buffer->upload(static_cast<GLsizeiptr>(packed.vertexes.size() * sizeof(PackedVertex)), packed.vertexes.data());
+
+        glVertexArrayVertexBuffer(vao, 0u, buffer->get_handle(), 0, sizeof(PackedVertex));
+        for (const auto& attribute : PACKED_ATTRIBUTES)
+        {
+            if (!has_attribute(data, static_cast<AttributeLocation>(attribute.location)))
+            {
+                continue;
+            }
+
+            glVertexArrayAttribFormat(vao, attribute.location, attribute.components, attribute.type, attribute.normalized, attribute.offset);
+            glVertexArrayAttribBinding(vao, attribute.location, 0u);
+            glEnableVertexArrayAttrib(vao, attribute.location);
+        }
+
+        return buffer;
+    }
+
+    // Attributes of streamed meshes are set up once, each frame only the offsets are rebound.
+    void setup_stream_attribute(GLuint vao, AttributeLocation attr, GLint size, bool present)
+    {
+        if (!present)
+        {
+            return;
+        }
+
+        auto index = static_cast<GLuint>(std::to_underlying(attr));
+        glVertexArrayAttribFormat(vao, index, size, GL_FLOAT, GL_FALSE, 0);
+        glVertexArrayAttribBinding(vao, index, index);
+        glEnableVertexArrayAttrib(vao, index);
     }
 
-    OpenGLMesh::OpenGLMesh(MeshData&& data, OpenGLBuffer::Usage usage)
-    : OpenGLMesh(std::make_shared<MeshData>(std::move(data)), usage) {}
+    template<glm::length_t N, glm::qualifier Q>
+    void stream_values(GLuint vao, AttributeLocation attr, OpenGLStreamBuffer& stream, const std::vector<glm::vec<N, float, Q>>& data)
+    {
+        if (data.empty())
+        {
+            return;
+        }
+
+        auto index  = static_cast<GLuint>(std::to_underlying(attr));
+        auto offset = stream.write(static_cast<GLsizeiptr>(data.size() * sizeof(glm::vec<N, float, Q>)), data.data());
+        glVertexArrayVertexBuffer(vao, index, stream.get_handle(), offset, sizeof(glm::vec<N, float, Q>));
+    }
 
-    OpenGLMesh::OpenGLMesh(const std::shared_ptr<MeshData>& data, OpenGLBuffer::Usage usage)
+    template<glm::length_t N, glm::qualifier Q>
+    GLintptr stream_indexes(OpenGLStreamBuffer& stream, const std::vector<glm::vec<N, glm::uint, Q>>& data)
+    {
+        if (data.empty())
+        {
+            return 0;
+        }
+
+        return stream.write(static_cast<GLsizeiptr>(data.size() * sizeof(glm::vec<N, glm::uint, Q>)), data.data());
+    }
+
+    std::shared_ptr<OpenGLMesh> OpenGLMesh::create(MeshData data, OpenGLBuffer::Usage usage, VertexFormat format)
+    {
+        return std::make_shared<OpenGLMesh>(std::move(data), usage, format);
+    }
+
+    std::shared_ptr<OpenGLMesh> OpenGLMesh::create(MeshData data, const std::shared_ptr<OpenGLStreamBuffer>& stream)
+    {
+        return std::make_shared<OpenGLMesh>(std::move(data), stream);
+    }
+
+    OpenGLMesh::OpenGLMesh(MeshData&& data, OpenGLBuffer::Usage usage, VertexFormat format)
+    : OpenGLMesh(std::make_shared<MeshData>(std::move(data)), usage, format) {}
+
+    OpenGLMesh::OpenGLMesh(const std::shared_ptr<MeshData>& data, OpenGLBuffer::Usage usage, VertexFormat format)
     : data(data)
     {
         check(data);
 
-        glGenVertexArrays(1, &vao);
-        glBindVertexArray(vao);
+        // The vertex array is set up with direct state access, so creating
+        // a mesh does not disturb the vertex array bound for drawing.
+        glCreateVertexArrays(1, &vao);
+
+        face_buffer = upload_indexes(data->faces, usage);
+        line_buffer = upload_indexes(data->lines, usage);
+
+        if (format == VertexFormat::PACKED && !data->vertexes.empty())
+        {
+            auto packed = pack_vertexes(*data);
+            packed_buffer = upload_packed(vao, *data, packed, usage);
+            mesh_block = {glm::vec4(packed.position_scale, 0.0f), glm::vec4(packed.position_offset, 0.0f), 1};
+            return;
+        }
+
+        vertex_buffer   = upload_values(vao, AttributeLocation::VERTEX,   data->vertexes,  usage);
+        normal_buffer   = upload_values(vao, AttributeLocation::NORMAL,   data->normals,   usage);
+        tangent_buffer  = upload_values(vao, AttributeLocation::TANGENT,  data->tangents,  usage);
+        texcoord_buffer = upload_values(vao, AttributeLocation::TEXCOORD, data->texcoords, usage);
+        color_buffer    = upload_values(vao, AttributeLocation::COLOR,    data->colors,    usage);
+    }
+
+    OpenGLMesh::OpenGLMesh(MeshData&& data, const std::shared_ptr<OpenGLStreamBuffer>& stream)
+    : data(std::make_shared<MeshData>(std::move(data))), stream(stream)
+    {
+        check(stream);
 
-        vertex_buffer   = upload_values(AttributeLocation::VERTEX,   data->vertexes,  usage);
-        normal_buffer   = upload_values(AttributeLocation::NORMAL,   data->normals,   usage);
-        tangent_buffer  = upload_values(AttributeLocation::TANGENT,  data->tangents,  usage);
-        texcoord_buffer = upload_values(AttributeLocation::TEXCOORD, data->texcoords, usage);
-        color_buffer    = upload_values(AttributeLocation::COLOR,    data->colors,    usage);
+        glCreateVertexArrays(1, &vao);
 
-        face_buffer     = upload_indexes(data->faces, usage);
-        line_buffer     = upload_indexes(data->lines, usage);
+        // the attributes present at creation are streamed, as with buffers
+        setup_stream_attribute(vao, AttributeLocation::VERTEX,   3, !this->data->vertexes.empty());
+        setup_stream_attribute(vao, AttributeLocation::NORMAL,   3, !this->data->normals.empty());
+        setup_stream_attribute(vao, AttributeLocation::TANGENT,  3, !this->data->tangents.empty());
+        setup_stream_attribute(vao, AttributeLocation::TEXCOORD, 2, !this->data->texcoords.empty());
+        setup_stream_attribute(vao, AttributeLocation::COLOR,    4, !this->data->colors.empty());
     }
 
-    OpenGLMesh::OpenGLMesh(const std::shared_ptr<Mesh>& source)
-    : OpenGLMesh(safe_ptr(source)->get_data(), OpenGLBuffer::Usage::STATIC) {}
+    OpenGLMesh::OpenGLMesh(const std::shared_ptr<Mesh>& source, VertexFormat format)
+    : OpenGLMesh(safe_ptr(source)->get_data(), OpenGLBuffer::Usage::STATIC, format) {}
 
     OpenGLMesh::~OpenGLMesh()
     {
@@ -119,6 +225,7 @@ namespace pkzo
         tangent_buffer  = nullptr;
         texcoord_buffer = nullptr;
         color_buffer    = nullptr;
+        packed_buffer   = nullptr;
         face_buffer     = nullptr;
         line_buffer     = nullptr;
         glDeleteVertexArrays(1, &vao);
@@ -178,6 +285,24 @@ namespace pkzo
     {
         data = std::make_shared<MeshData>(std::move(new_data));
 
+        if (stream)
+        {
+            stream_dirty = true;
+            return;
+        }
+
+        if (packed_buffer)
+        {
+            // the bounds may have changed, so everything is quantized again
+            auto packed = pack_vertexes(*data);
+            packed_buffer->upload(static_cast<GLsizeiptr>(packed.vertexes.size() * sizeof(PackedVertex)), packed.vertexes.data());
+            mesh_block = {glm::vec4(packed.position_scale, 0.0f), glm::vec4(packed.position_offset, 0.0f), 1};
+
+            update_indexes(face_buffer, data->faces);
+            update_indexes(line_buffer, data->lines);
+            return;
+        }
+
         update_values(vertex_buffer,   data->vertexes);
         update_values(normal_buffer,   data->normals);
         update_values(tangent_buffer,  data->tangents);
@@ -188,20 +313,106 @@ namespace pkzo
         update_indexes(line_buffer,    data->lines);
     }
 
-    void OpenGLMesh::draw()
+    const MeshBlock& OpenGLMesh::get_mesh_block() const
+    {
+        return mesh_block;
+    }
+
+    void OpenGLMesh::bind()
     {
         glBindVertexArray(vao);
+    }
+
+    // The region of the stream buffer written in is reused a few frames
+    // later, so the data is written again in every frame the mesh is drawn.
+    void OpenGLMesh::write_stream()
+    {
+        if (!stream || (!stream_dirty && stream_frame == stream->get_frame()))
+        {
+            return;
+        }
+
+        stream_values(vao, AttributeLocation::VERTEX,   *stream, data->vertexes);
+        stream_values(vao, AttributeLocation::NORMAL,   *stream, data->normals);
+        stream_values(vao, AttributeLocation::TANGENT,  *stream, data->tangents);
+        stream_values(vao, AttributeLocation::TEXCOORD, *stream, data->texcoords);
+        stream_values(vao, AttributeLocation::COLOR,    *stream, data->colors);
+
+        face_offset        = stream_indexes(*stream, data->faces);
+        face_stream_buffer = stream->get_handle();
+        line_offset        = stream_indexes(*stream, data->lines);
+        line_stream_buffer = stream->get_handle();
+
+        stream_frame = stream->get_frame();
+        stream_dirty = false;
+    }
+
+    void OpenGLMesh::use_faces()
+    {
+        use_element_buffer(stream ? face_stream_buffer : safe_ptr(face_buffer)->get_handle());
+    }
+
+    void OpenGLMesh::use_lines()
+    {
+        use_element_buffer(stream ? line_stream_buffer : safe_ptr(line_buffer)->get_handle());
+    }
+
+    void OpenGLMesh::use_element_buffer(GLuint buffer)
+    {
+        if (element_buffer != buffer)
+        {
+            glVertexArrayElementBuffer(vao, buffer);
+            element_buffer = buffer;
+        }
+    }
+
+    void OpenGLMesh::draw()
+    {
+        write_stream();
+
+        if (!data->faces.empty())
+        {
+            use_faces();
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(data->faces.size() * 3u), GL_UNSIGNED_INT, reinterpret_cast<const void*>(face_offset));
+        }
+
+        if (!data->lines.empty())
+        {
+            use_lines();
+            glDrawElements(GL_LINES, static_cast<GLsizei>(data->lines.size() * 2u), GL_UNSIGNED_INT, reinterpret_cast<const void*>(line_offset));
+        }
+    }
+
+    void OpenGLMesh::draw_instanced(GLuint instances, GLuint base_instance, GLsizei count)
+    {
+        // The attribute setup is stored in the VAO and only needs to be done once per instance buffer.
+        if (instance_buffer != instances)
+        {
+            auto binding = static_cast<GLuint>(std::to_underlying(AttributeLocation::INSTANCE_MODEL_MATRIX));
+            glVertexArrayVertexBuffer(vao, binding, instances, 0, sizeof(glm::mat4));
+            glVertexArrayBindingDivisor(vao, binding, 1);
+            for (auto column = 0u; column < 4u; column++)
+            {
+                auto loc = binding + column;
+                glVertexArrayAttribFormat(vao, loc, 4, GL_FLOAT, GL_FALSE, static_cast<GLuint>(column * sizeof(glm::vec4)));
+                glVertexArrayAttribBinding(vao, loc, binding);
+                glEnableVertexArrayAttrib(vao, loc);
+            }
+            instance_buffer = instances;
+        }
+
+        write_stream();
 
         if (!data->faces.empty())
         {
-            face_buffer->bind();
-            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(data->faces.size() * 3u), GL_UNSIGNED_INT, nullptr);
+            use_faces();
+            glDrawElementsInstancedBaseInstance(GL_TRIANGLES, static_cast<GLsizei>(data->faces.size() * 3u), GL_UNSIGNED_INT, reinterpret_cast<const void*>(face_offset), count, base_instance);
         }
 
         if (!data->lines.empty())
         {
-            line_buffer->bind();
-            glDrawElements(GL_LINES, static_cast<GLsizei>(data->lines.size() * 2u), GL_UNSIGNED_INT, nullptr);
+            use_lines();
+            glDrawElementsInstancedBaseInstance(GL_LINES, static_cast<GLsizei>(data->lines.size() * 2u), GL_UNSIGNED_INT, reinterpret_cast<const void*>(line_offset), count, base_instance);
         }
     }
 }
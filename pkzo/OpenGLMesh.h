@@ -29,6 +29,9 @@
 #include <glm/glm.hpp>
 
 #include "OpenGLBuffer.h"
+#include "OpenGLStreamBuffer.h"
+#include "UniformBlocks.h"
+#include "VertexPacking.h"
 
 namespace pkzo
 {
@@ -39,17 +42,25 @@ namespace pkzo
         TANGENT,
         TEXCOORD,
         COLOR,
+        INSTANCE_MODEL_MATRIX, // mat4, occupies four locations
     };
 
     class PKZO_EXPORT OpenGLMesh : public Mesh
     {
     public:
 
-        static std::shared_ptr<OpenGLMesh> create(MeshData data, OpenGLBuffer::Usage usage = OpenGLBuffer::Usage::STATIC);
+        static std::shared_ptr<OpenGLMesh> create(MeshData data, OpenGLBuffer::Usage usage = OpenGLBuffer::Usage::STATIC, VertexFormat format = VertexFormat::FLOAT);
 
-        OpenGLMesh(MeshData&& data, OpenGLBuffer::Usage usage);
-        OpenGLMesh(const std::shared_ptr<MeshData>& data, OpenGLBuffer::Usage usage);
-        OpenGLMesh(const std::shared_ptr<Mesh>& source);
+        //! Create a mesh that is written into the stream buffer.
+        //!
+        //! The data is written once per frame it is drawn in, update only
+        //! replaces the data.
+        static std::shared_ptr<OpenGLMesh> create(MeshData data, const std::shared_ptr<OpenGLStreamBuffer>& stream);
+
+        OpenGLMesh(MeshData&& data, OpenGLBuffer::Usage usage, VertexFormat format = VertexFormat::FLOAT);
+        OpenGLMesh(MeshData&& data, const std::shared_ptr<OpenGLStreamBuffer>& stream);
+        OpenGLMesh(const std::shared_ptr<MeshData>& data, OpenGLBuffer::Usage usage, VertexFormat format = VertexFormat::FLOAT);
+        OpenGLMesh(const std::shared_ptr<Mesh>& source, VertexFormat format = VertexFormat::FLOAT);
         ~OpenGLMesh();
 
         const std::vector<glm::vec3>&  get_vertexes() const override;
@@ -66,7 +77,15 @@ namespace pkzo
 
         void update(MeshData new_data) override;
 
+        //! Values the vertex shader decodes the attributes with.
+        const MeshBlock& get_mesh_block() const;
+
+        void bind();
+
+        //! Draw the mesh, the mesh must be bound.
         void draw();
+        //! Draw count instances of the mesh, the mesh must be bound.
+        void draw_instanced(GLuint instances, GLuint base_instance, GLsizei count);
 
     private:
         std::shared_ptr<MeshData> data;
@@ -77,7 +96,25 @@ namespace pkzo
         std::shared_ptr<OpenGLBuffer> tangent_buffer;
         std::shared_ptr<OpenGLBuffer> texcoord_buffer;
         std::shared_ptr<OpenGLBuffer> color_buffer;
+        std::shared_ptr<OpenGLBuffer> packed_buffer;
         std::shared_ptr<OpenGLBuffer> face_buffer;
         std::shared_ptr<OpenGLBuffer> line_buffer;
+        GLuint                        instance_buffer = 0u;
+        GLuint                        element_buffer  = 0u;
+        MeshBlock                     mesh_block      = {glm::vec4(1.0f), glm::vec4(0.0f), 0};
+
+        std::shared_ptr<OpenGLStreamBuffer> stream;
+        uint64_t                            stream_frame = 0u;
+        bool                                stream_dirty = true;
+        GLintptr                            face_offset  = 0;
+        GLintptr                            line_offset  = 0;
+        // the stream buffer the indexes were written to, it changes when the stream grows
+        GLuint                              face_stream_buffer = 0u;
+        GLuint                              line_stream_buffer = 0u;
+
+        void write_stream();
+        void use_faces();
+        void use_lines();
+        void use_element_buffer(GLuint buffer);
     };
 }
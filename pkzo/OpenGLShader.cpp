@@ -142,6 +142,7 @@ namespace pkzo
         ShaderProgram()
         {
             handle = glCreateProgram();
+            glProgramParameteri(handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         }
 
         ShaderProgram(ShaderProgram&& rhs) noexcept
@@ -191,6 +192,16 @@ namespace pkzo
             return success;
         }
 
+        bool load(const OpenGLShader::Binary& binary)
+        {
+            glProgramBinary(handle, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
+
+            // a binary from a different driver is rejected by failing to link
+            auto success = GLint{0};
+            glGetProgramiv(handle, GL_LINK_STATUS, &success);
+            return success;
+        }
+
         GLuint release()
         {
             auto t = handle;
@@ -246,10 +257,36 @@ namespace pkzo
         assert(handle != 0u);
     }
 
+    OpenGLShader::OpenGLShader(const Binary& binary)
+    {
+        auto program = ShaderProgram();
+        if (program.load(binary) == false)
+        {
+            throw std::runtime_error("Failed to load shader binary");
+        }
+        handle = program.release();
+    }
+
     OpenGLShader::~OpenGLShader()
     {
         assert(handle != 0);
-        glDeleteShader(handle);
+        glDeleteProgram(handle);
+    }
+
+    OpenGLShader::Binary OpenGLShader::get_binary() const
+    {
+        assert(handle != 0);
+
+        auto length = GLint{0};
+        glGetProgramiv(handle, GL_PROGRAM_BINARY_LENGTH, &length);
+
+        auto binary = Binary{};
+        if (length > 0)
+        {
+            binary.data.resize(static_cast<size_t>(length));
+            glGetProgramBinary(handle, length, nullptr, &binary.format, binary.data.data());
+        }
+        return binary;
     }
 
     void OpenGLShader::bind()
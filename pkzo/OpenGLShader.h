@@ -23,6 +23,8 @@
 
 #include "Shader.h"
 
+#include <vector>
+
 #include <GL/glew.h>
 
 namespace pkzo
@@ -30,9 +32,20 @@ namespace pkzo
     class PKZO_EXPORT OpenGLShader : public Shader
     {
     public:
+        //! Driver specific program binary, see glGetProgramBinary.
+        struct Binary
+        {
+            GLenum               format = 0u;
+            std::vector<uint8_t> data;
+        };
+
         OpenGLShader(const Source& source);
+        //! Load a program binary, throws if the driver rejects it.
+        OpenGLShader(const Binary& binary);
         ~OpenGLShader();
 
+        Binary get_binary() const;
+
         void bind();
 
         int get_uniform_location(const std::string_view name) const override;
@@ -0,0 +1,185 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "OpenGLShaderCache.h"
+
+#include <GL/glew.h>
+
+#include "CacheFile.h"
+#include "OpenGLShader.h"
+#include "debug.h"
+
+namespace pkzo
+{
+    constexpr auto BINARY_MAGIC = std::string_view{"PKZOSHB1"};
+
+    uint64_t hash_source(const Shader::Source& source)
+    {
+        auto hash = ContentHash{};
+        hash.add(source.vertex);
+        hash.add(std::string_view{"\0", 1u});
+        hash.add(source.fragment);
+        return hash.get();
+    }
+
+    std::string get_gl_string(GLenum name)
+    {
+        auto value = reinterpret_cast<const char*>(glGetString(name));
+        return value != nullptr ? std::string(value) : std::string{};
+    }
+
+    OpenGLShaderCache::OpenGLShaderCache(const std::filesystem::path& dir)
+    : directory(dir)
+    {
+        if (directory.empty())
+        {
+            return;
+        }
+
+        auto formats = GLint{0};
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (formats == 0)
+        {
+            trace("The driver does not support program binaries, the shader disk cache is disabled.");
+            directory.clear();
+            return;
+        }
+
+        driver = tfm::format("%s|%s|%s", get_gl_string(GL_VENDOR), get_gl_string(GL_RENDERER), get_gl_string(GL_VERSION));
+
+        auto ec = std::error_code{};
+        std::filesystem::create_directories(directory, ec);
+        if (ec)
+        {
+            trace(tfm::format("Failed to create shader cache directory %s: %s", directory.string(), ec.message()));
+            directory.clear();
+        }
+    }
+
+    OpenGLShaderCache::~OpenGLShaderCache() = default;
+
+    std::shared_ptr<OpenGLShader> OpenGLShaderCache::compile(const Shader::Source& source)
+    {
+        auto key = hash_source(source);
+
+        auto i = programs.find(key);
+        if (i != end(programs))
+        {
+            return i->second;
+        }
+
+        auto shader = load(key);
+        if (shader == nullptr)
+        {
+            shader = std::make_shared<OpenGLShader>(source);
+            store(key, *shader);
+        }
+
+        programs.emplace(key, shader);
+        return shader;
+    }
+
+    std::filesystem::path OpenGLShaderCache::get_binary_path(uint64_t key) const
+    {
+        return directory / tfm::format("%016x.bin", key);
+    }
+
+    std::shared_ptr<OpenGLShader> OpenGLShaderCache::load(uint64_t key) const
+    {
+        if (directory.empty())
+        {
+            return nullptr;
+        }
+
+        auto input = std::ifstream(get_binary_path(key), std::ios::binary);
+        if (!input)
+        {
+            return nullptr;
+        }
+
+        auto magic = std::string(BINARY_MAGIC.size(), '\0');
+        input.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+
+        auto driver_size = read_cache_value<uint32_t>(input);
+        if (!input || magic != BINARY_MAGIC || driver_size != driver.size())
+        {
+            return nullptr;
+        }
+
+        auto file_driver = std::string(driver_size, '\0');
+        input.read(file_driver.data(), static_cast<std::streamsize>(driver_size));
+        if (!input || file_driver != driver)
+        {
+            // written by a different driver, it will be replaced
+            return nullptr;
+        }
+
+        auto binary = OpenGLShader::Binary{};
+        binary.format  = read_cache_value<GLenum>(input);
+        auto data_size = read_cache_value<uint64_t>(input);
+        if (!input || data_size == 0u)
+        {
+            return nullptr;
+        }
+
+        binary.data.resize(static_cast<size_t>(data_size));
+        input.read(reinterpret_cast<char*>(binary.data.data()), static_cast<std::streamsize>(data_size));
+        if (!input)
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            return std::make_shared<OpenGLShader>(binary);
+        }
+        catch (const std::exception& ex)
+        {
+            trace(tfm::format("Ignoring cached shader %016x: %s", key, ex.what()));
+            return nullptr;
+        }
+    }
+
+    void OpenGLShaderCache::store(uint64_t key, const OpenGLShader& shader) const
+    {
+        if (directory.empty())
+        {
+            return;
+        }
+
+        auto binary = shader.get_binary();
+        if (binary.data.empty())
+        {
+            return;
+        }
+
+        write_cache_file(get_binary_path(key), [&] (std::ostream& output) {
+            output.write(BINARY_MAGIC.data(), static_cast<std::streamsize>(BINARY_MAGIC.size()));
+            write_cache_value(output, static_cast<uint32_t>(driver.size()));
+            output.write(driver.data(), static_cast<std::streamsize>(driver.size()));
+            write_cache_value(output, binary.format);
+            write_cache_value(output, static_cast<uint64_t>(binary.data.size()));
+            output.write(reinterpret_cast<const char*>(binary.data.data()), static_cast<std::streamsize>(binary.data.size()));
+        });
+    }
+}
@@ -0,0 +1,66 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "api.h"
+#include "Shader.h"
+
+namespace pkzo
+{
+    class OpenGLShader;
+
+    //! Cache of compiled shader programs.
+    //!
+    //! Programs are kept in memory by a hash of their source, so renderers
+    //! compiling the same sources share one program. When a directory is
+    //! given, program binaries are also stored on disk and reused across
+    //! runs, as long as the driver vendor, renderer and version match.
+    class PKZO_EXPORT OpenGLShaderCache
+    {
+    public:
+        //! Create the cache, the OpenGL context must be current.
+        //!
+        //! @param directory the directory for program binaries, empty disables the disk cache
+        OpenGLShaderCache(const std::filesystem::path& directory);
+        ~OpenGLShaderCache();
+
+        std::shared_ptr<OpenGLShader> compile(const Shader::Source& source);
+
+    private:
+        std::filesystem::path directory;
+        std::string           driver;
+
+        std::unordered_map<uint64_t, std::shared_ptr<OpenGLShader>> programs;
+
+        std::filesystem::path get_binary_path(uint64_t key) const;
+        std::shared_ptr<OpenGLShader> load(uint64_t key) const;
+        void store(uint64_t key, const OpenGLShader& shader) const;
+
+        OpenGLShaderCache(const OpenGLShaderCache&) = delete;
+        OpenGLShaderCache& operator = (const OpenGLShaderCache&) = delete;
+    };
+}
@@ -0,0 +1,215 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "OpenGLStateCache.h"
+
+#include "OpenGLShader.h"
+#include "OpenGLFrameBuffer.h"
+#include "OpenGLMesh.h"
+#include "OpenGLTexture.h"
+#include "OpenGLCubeMap.h"
+
+#include "debug.h"
+
+namespace pkzo
+{
+    template <typename T>
+    bool OpenGLStateCache::should_bind(Binding& binding, const std::shared_ptr<T>& object)
+    {
+        // Equivalent ownership means the same object, the weak pointer keeps the
+        // control block alive, so it can not be reused by a different object.
+        if (binding && !binding->owner_before(object) && !object.owner_before(*binding))
+        {
+            stats.elided++;
+            return false;
+        }
+
+        binding = std::weak_ptr<void>(object);
+        stats.issued++;
+        return true;
+    }
+
+    template <typename T>
+    bool OpenGLStateCache::should_set(std::optional<T>& current, const T& value)
+    {
+        if (current == value)
+        {
+            stats.elided++;
+            return false;
+        }
+
+        current = value;
+        stats.issued++;
+        return true;
+    }
+
+    void OpenGLStateCache::use_program(const std::shared_ptr<OpenGLShader>& shader)
+    {
+        check(shader);
+        if (should_bind(program, shader))
+        {
+            shader->bind();
+        }
+    }
+
+    void OpenGLStateCache::bind_frame_buffer(const std::shared_ptr<OpenGLFrameBuffer>& value)
+    {
+        if (should_bind(frame_buffer, value))
+        {
+            if (value)
+            {
+                value->bind();
+            }
+            else
+            {
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            }
+        }
+    }
+
+    void OpenGLStateCache::bind_vertex_array(const std::shared_ptr<OpenGLMesh>& mesh)
+    {
+        check(mesh);
+        if (should_bind(vertex_array, mesh))
+        {
+            mesh->bind();
+        }
+    }
+
+    void OpenGLStateCache::bind_texture(int slot, const std::shared_ptr<OpenGLTexture>& texture)
+    {
+        check(slot >= 0);
+        check(texture);
+
+        if (slot >= MAX_TEXTURE_UNITS)
+        {
+            stats.issued++;
+            texture->bind(slot);
+            return;
+        }
+
+        if (should_bind(textures[slot], texture))
+        {
+            texture->bind(slot);
+        }
+    }
+
+    void OpenGLStateCache::bind_texture(int slot, const std::shared_ptr<OpenGLCubeMap>& texture)
+    {
+        check(slot >= 0);
+        check(texture);
+
+        if (slot >= MAX_TEXTURE_UNITS)
+        {
+            stats.issued++;
+            texture->bind(slot);
+            return;
+        }
+
+        if (should_bind(textures[slot], texture))
+        {
+            texture->bind(slot);
+        }
+    }
+
+    void OpenGLStateCache::set_blend(bool enabled)
+    {
+        if (should_set(blend, enabled))
+        {
+            if (enabled)
+            {
+                glEnable(GL_BLEND);
+            }
+            else
+            {
+                glDisable(GL_BLEND);
+            }
+        }
+    }
+
+    void OpenGLStateCache::set_blend_func(GLenum src, GLenum dst)
+    {
+        if (should_set(blend_func, std::make_pair(src, dst)))
+        {
+            glBlendFunc(src, dst);
+        }
+    }
+
+    void OpenGLStateCache::set_depth_test(bool enabled)
+    {
+        if (should_set(depth_test, enabled))
+        {
+            if (enabled)
+            {
+                glEnable(GL_DEPTH_TEST);
+            }
+            else
+            {
+                glDisable(GL_DEPTH_TEST);
+            }
+        }
+    }
+
+    void OpenGLStateCache::set_depth_func(GLenum func)
+    {
+        if (should_set(depth_func, func))
+        {
+            glDepthFunc(func);
+        }
+    }
+
+    void OpenGLStateCache::set_depth_mask(bool enabled)
+    {
+        if (should_set(depth_mask, enabled))
+        {
+            glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+        }
+    }
+
+    void OpenGLStateCache::invalidate()
+    {
+        program.reset();
+        frame_buffer.reset();
+        vertex_array.reset();
+        for (auto& texture : textures)
+        {
+            texture.reset();
+        }
+
+        blend.reset();
+        blend_func.reset();
+        depth_test.reset();
+        depth_func.reset();
+        depth_mask.reset();
+    }
+
+    const OpenGLStateCache::Stats& OpenGLStateCache::get_stats() const
+    {
+        return stats;
+    }
+
+    void OpenGLStateCache::reset_stats()
+    {
+        stats = {};
+    }
+}
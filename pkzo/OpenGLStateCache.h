@@ -0,0 +1,110 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <GL/glew.h>
+
+#include "api.h"
+
+namespace pkzo
+{
+    class OpenGLShader;
+    class OpenGLFrameBuffer;
+    class OpenGLMesh;
+    class OpenGLTexture;
+    class OpenGLCubeMap;
+
+    //! Shadow copy of the OpenGL state that drops redundant state changes.
+    //!
+    //! Bound objects are tracked by ownership through weak pointers, so a
+    //! destroyed object can never be mistaken for a new one that happens to
+    //! get the same GL name. All state changes of the objects tracked here
+    //! must go through the cache, or it must be invalidated.
+    class PKZO_EXPORT OpenGLStateCache
+    {
+    public:
+        struct Stats
+        {
+            size_t issued = 0u;
+            size_t elided = 0u;
+        };
+
+        //! Texture units above this are not tracked, they are used for uploads.
+        static constexpr auto MAX_TEXTURE_UNITS = 16;
+
+        OpenGLStateCache() = default;
+
+        void use_program(const std::shared_ptr<OpenGLShader>& shader);
+
+        //! Bind the frame buffer, nullptr binds the default frame buffer.
+        void bind_frame_buffer(const std::shared_ptr<OpenGLFrameBuffer>& frame_buffer);
+
+        void bind_vertex_array(const std::shared_ptr<OpenGLMesh>& mesh);
+
+        void bind_texture(int slot, const std::shared_ptr<OpenGLTexture>& texture);
+        void bind_texture(int slot, const std::shared_ptr<OpenGLCubeMap>& texture);
+
+        void set_blend(bool enabled);
+        void set_blend_func(GLenum src, GLenum dst);
+
+        void set_depth_test(bool enabled);
+        void set_depth_func(GLenum func);
+        void set_depth_mask(bool enabled);
+
+        //! Forget all tracked state, the next change of each kind is issued.
+        void invalidate();
+
+        //! Issued and elided state changes since the last reset_stats.
+        const Stats& get_stats() const;
+        void reset_stats();
+
+    private:
+        using Binding = std::optional<std::weak_ptr<void>>;
+
+        Stats stats;
+
+        Binding                                program;
+        Binding                                frame_buffer;
+        Binding                                vertex_array;
+        std::array<Binding, MAX_TEXTURE_UNITS> textures;
+
+        std::optional<bool>                      blend;
+        std::optional<std::pair<GLenum, GLenum>> blend_func;
+        std::optional<bool>                      depth_test;
+        std::optional<GLenum>                    depth_func;
+        std::optional<bool>                      depth_mask;
+
+        template <typename T>
+        bool should_bind(Binding& binding, const std::shared_ptr<T>& object);
+
+        template <typename T>
+        bool should_set(std::optional<T>& current, const T& value);
+
+        OpenGLStateCache(const OpenGLStateCache&) = delete;
+        OpenGLStateCache& operator = (const OpenGLStateCache&) = delete;
+    };
+}
@@ -0,0 +1,146 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "OpenGLStreamBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    constexpr auto STREAM_STORAGE_FLAGS = GLbitfield{GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT};
+
+    OpenGLStreamBuffer::OpenGLStreamBuffer(GLsizeiptr frame_capacity)
+    {
+        check(frame_capacity > 0);
+        allocate(frame_capacity);
+    }
+
+    OpenGLStreamBuffer::~OpenGLStreamBuffer()
+    {
+        for (auto fence : fences)
+        {
+            if (fence != nullptr)
+            {
+                glDeleteSync(fence);
+            }
+        }
+
+        for (const auto& buffer : retired)
+        {
+            glDeleteBuffers(1, &buffer.handle);
+        }
+
+        glUnmapNamedBuffer(handle);
+        glDeleteBuffers(1, &handle);
+    }
+
+    GLuint OpenGLStreamBuffer::get_handle() const
+    {
+        return handle;
+    }
+
+    uint64_t OpenGLStreamBuffer::get_frame() const
+    {
+        return frame;
+    }
+
+    GLsizeiptr OpenGLStreamBuffer::get_frame_capacity() const
+    {
+        return frame_capacity;
+    }
+
+    GLintptr OpenGLStreamBuffer::write(GLsizeiptr size, const void* data, GLsizeiptr alignment)
+    {
+        check(data != nullptr || size == 0);
+        check(alignment > 0);
+
+        // the alignment applies to the position in the buffer, regions
+        // start at multiples of the frame capacity which may not be aligned
+        auto align_position = [&] (GLintptr from) {
+            auto base = static_cast<GLintptr>(region) * frame_capacity;
+            return (base + from + alignment - 1) / alignment * alignment;
+        };
+
+        auto position = align_position(frame_offset);
+        if (position + size > static_cast<GLintptr>(region + 1u) * frame_capacity)
+        {
+            allocate(std::max(size + alignment, frame_capacity * 2));
+            position = align_position(0);
+        }
+
+        if (size > 0)
+        {
+            std::memcpy(memory + position, data, static_cast<size_t>(size));
+        }
+
+        frame_offset = position + size - static_cast<GLintptr>(region) * frame_capacity;
+        return position;
+    }
+
+    void OpenGLStreamBuffer::end_frame()
+    {
+        fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        region       = (region + 1u) % FRAME_COUNT;
+        frame_offset = 0;
+        frame++;
+
+        // the GPU may still read the region written FRAME_COUNT frames ago
+        if (auto fence = std::exchange(fences[region], nullptr))
+        {
+            constexpr auto TIMEOUT = GLuint64{1000000000u};
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, TIMEOUT) == GL_TIMEOUT_EXPIRED) {}
+            glDeleteSync(fence);
+        }
+
+        std::erase_if(retired, [this] (const Retired& buffer) {
+            if (buffer.frame + FRAME_COUNT > frame)
+            {
+                return false;
+            }
+            glDeleteBuffers(1, &buffer.handle);
+            return true;
+        });
+    }
+
+    void OpenGLStreamBuffer::allocate(GLsizeiptr new_frame_capacity)
+    {
+        if (handle != 0u)
+        {
+            glUnmapNamedBuffer(handle);
+            retired.push_back({handle, frame});
+        }
+
+        frame_capacity = new_frame_capacity;
+        frame_offset   = 0;
+
+        // immutable storage can not grow, every growth is a new buffer
+        glCreateBuffers(1, &handle);
+        glNamedBufferStorage(handle, frame_capacity * FRAME_COUNT, nullptr, STREAM_STORAGE_FLAGS);
+        memory = static_cast<std::byte*>(glMapNamedBufferRange(handle, 0, frame_capacity * FRAME_COUNT, STREAM_STORAGE_FLAGS));
+        check(memory != nullptr);
+    }
+}
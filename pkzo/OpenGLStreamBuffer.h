@@ -0,0 +1,94 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include "api.h"
+
+namespace pkzo
+{
+    //! Persistently mapped ring buffer for data that is written every frame.
+    //!
+    //! The buffer is split into one region per frame in flight. Data is
+    //! copied straight into the mapped region of the current frame, and
+    //! end_frame fences the region and waits until the GPU is done with
+    //! the next one, so writing never stalls on or reallocates storage the
+    //! GPU still reads.
+    class PKZO_EXPORT OpenGLStreamBuffer
+    {
+    public:
+        //! Frames the CPU may run ahead of the GPU.
+        static constexpr auto FRAME_COUNT = 3u;
+
+        //! Create a buffer with the given capacity per frame.
+        OpenGLStreamBuffer(GLsizeiptr frame_capacity);
+        ~OpenGLStreamBuffer();
+
+        //! The buffer written to, it changes when the buffer grows.
+        GLuint get_handle() const;
+
+        //! Counts the frames ended.
+        uint64_t get_frame() const;
+
+        GLsizeiptr get_frame_capacity() const;
+
+        //! Copy data into the region of the current frame.
+        //!
+        //! The region grows when it is full, data written before stays
+        //! valid in the previous buffer until the end of the frame.
+        //!
+        //! @returns the offset of the data in the buffer get_handle returns
+        GLintptr write(GLsizeiptr size, const void* data, GLsizeiptr alignment = 16);
+
+        //! Fence the current region and continue in the next one.
+        void end_frame();
+
+    private:
+        GLuint     handle         = 0u;
+        std::byte* memory         = nullptr;
+        GLsizeiptr frame_capacity = 0;
+        GLsizeiptr frame_offset   = 0;
+        unsigned   region         = 0u;
+        uint64_t   frame          = 0u;
+
+        std::array<GLsync, FRAME_COUNT> fences = {};
+
+        // grown out buffers, deleted once their frame completed
+        struct Retired
+        {
+            GLuint   handle;
+            uint64_t frame;
+        };
+        std::vector<Retired> retired;
+
+        void allocate(GLsizeiptr new_frame_capacity);
+
+        OpenGLStreamBuffer(const OpenGLStreamBuffer&) = delete;
+        OpenGLStreamBuffer& operator = (const OpenGLStreamBuffer&) = delete;
+    };
+}
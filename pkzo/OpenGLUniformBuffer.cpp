@@ -0,0 +1,53 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "OpenGLUniformBuffer.h"
+
+#include "debug.h"
+
+namespace pkzo
+{
+    OpenGLUniformBuffer::OpenGLUniformBuffer(size_t size)
+    : buffer(OpenGLBuffer::Type::UNIFORM, OpenGLBuffer::Usage::DYNAMIC)
+    {
+        buffer.reserve(static_cast<GLsizeiptr>(size));
+    }
+
+    OpenGLUniformBuffer::~OpenGLUniformBuffer() = default;
+
+    size_t OpenGLUniformBuffer::get_size() const
+    {
+        return static_cast<size_t>(buffer.get_capacity());
+    }
+
+    void OpenGLUniformBuffer::upload(size_t offset, size_t size, const void* data)
+    {
+        check(offset + size <= get_size());
+        buffer.upload(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+    }
+
+    GLuint OpenGLUniformBuffer::get_handle() const
+    {
+        return buffer.get_handle();
+    }
+}
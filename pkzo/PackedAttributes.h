@@ -0,0 +1,51 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// This file is generated, do not edit.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <GL/glew.h>
+
+#include "PackedVertex.h"
+
+namespace pkzo
+{
+    struct PackedAttribute
+    {
+        GLuint    location;
+        GLint     components;
+        GLenum    type;
+        GLboolean normalized;
+        GLuint    offset;
+    };
+
+    constexpr auto PACKED_ATTRIBUTES = std::array<PackedAttribute, 5>{{
+        {0, 3, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(PackedVertex, vertex)},
+        {1, 2, GL_SHORT, GL_TRUE, offsetof(PackedVertex, normal)},
+        {2, 2, GL_SHORT, GL_TRUE, offsetof(PackedVertex, tangent)},
+        {3, 2, GL_HALF_FLOAT, GL_FALSE, offsetof(PackedVertex, texcoord)},
+        {4, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(PackedVertex, color)}
+    }};
+}
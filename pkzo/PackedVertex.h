@@ -0,0 +1,45 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// This file is generated, do not edit.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pkzo
+{
+    struct PackedVertex
+    {
+        uint64_t vertex;
+        uint32_t normal;
+        uint32_t tangent;
+        uint32_t texcoord;
+        uint32_t color;
+    };
+    static_assert(offsetof(PackedVertex, vertex) == 0);
+    static_assert(offsetof(PackedVertex, normal) == 8);
+    static_assert(offsetof(PackedVertex, tangent) == 12);
+    static_assert(offsetof(PackedVertex, texcoord) == 16);
+    static_assert(offsetof(PackedVertex, color) == 20);
+    static_assert(sizeof(PackedVertex) == 24);
+}
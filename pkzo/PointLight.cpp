@@ -27,7 +27,8 @@ namespace pkzo
 {
     PointLight::PointLight(Init init)
     : Light({init.parent, init.transform}),
-      color(init.color) {}
+      color(init.color),
+      range(init.range) {}
 
     PointLight::~PointLight() = default;
 
@@ -36,6 +37,11 @@ namespace pkzo
         color = value;
     }
 
+    void PointLight::set_range(float value)
+    {
+        range = value;
+    }
+
     LightType PointLight::get_type() const
     {
         return LightType::POINT;
@@ -61,4 +67,14 @@ namespace pkzo
     {
         return {};
     }
+
+    float PointLight::get_range() const
+    {
+        return range;
+    }
+
+    bool PointLight::get_cast_shadows() const
+    {
+        return false;
+    }
 }
@@ -33,20 +33,26 @@ namespace pkzo
             Node*     parent    = nullptr;
             glm::mat4 transform = glm::mat4(1.0f);
             glm::vec3 color     = glm::vec3(0.1f);
+            //! Distance at which the light fades out, 0 keeps the 1/d^2 falloff unbounded.
+            float     range     = 0.0f;
         };
 
         PointLight(Init init);
         ~PointLight();
 
         void set_color(const glm::vec3& value);
+        void set_range(float value);
 
         LightType get_type() const override;
         glm::vec3 get_color() const override;
         glm::vec3 get_direction() const override;
         glm::vec3 get_position() const override;
         glm::vec2 get_angles() const override;
+        float get_range() const override;
+        bool get_cast_shadows() const override;
 
     private:
         glm::vec3 color;
+        float     range;
     };
 }
@@ -0,0 +1,488 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "RecordingGraphicContext.h"
+
+#include <cstring>
+
+#include "MemoryMesh.h"
+#include "MemoryTexture.h"
+#include "debug.h"
+
+namespace pkzo
+{
+    class RecordingShader : public Shader
+    {
+    public:
+        int get_uniform_location(const std::string_view name) const override
+        {
+            return -1;
+        }
+
+        int get_attribute_location(const std::string_view name) const override
+        {
+            return -1;
+        }
+    };
+
+    class RecordingFrameBuffer : public FrameBuffer
+    {
+    public:
+        RecordingFrameBuffer(const BufferConfig& config)
+        : size(config.size), colors(config.colors.size()) {}
+
+        glm::uvec2 get_size() const override
+        {
+            return size;
+        }
+
+        std::shared_ptr<Texture> get_depth() const override
+        {
+            return nullptr;
+        }
+
+        std::vector<std::shared_ptr<Texture>> get_colors() const override
+        {
+            return std::vector<std::shared_ptr<Texture>>(colors);
+        }
+
+        std::shared_ptr<Texture> get_color(unsigned int slot) const override
+        {
+            return nullptr;
+        }
+
+    private:
+        glm::uvec2 size;
+        size_t     colors;
+    };
+
+    class RecordingCubeMap : public CubeMap
+    {
+    public:
+        RecordingCubeMap(const CubeMapGenerator& generator)
+        : id(generator.id), size(generator.size), data_type(generator.data_type), color_mode(generator.color_mode) {}
+
+        RecordingCubeMap(const CubeMapData& data)
+        : id(data.id), size(data.size), data_type(data.data_type), color_mode(data.color_mode) {}
+
+        std::string get_id() const override
+        {
+            return id;
+        }
+
+        unsigned int get_size() const override
+        {
+            return size;
+        }
+
+        DataType get_data_type() const override
+        {
+            return data_type;
+        }
+
+        ColorMode get_color_mode() const override
+        {
+            return color_mode;
+        }
+
+    private:
+        std::string  id;
+        unsigned int size;
+        DataType     data_type;
+        ColorMode    color_mode;
+    };
+
+    class RecordingUniformBuffer : public UniformBuffer
+    {
+    public:
+        RecordingUniformBuffer(size_t size)
+        : data(size, 0u) {}
+
+        size_t get_size() const override
+        {
+            return data.size();
+        }
+
+        void upload(size_t offset, size_t size, const void* value) override
+        {
+            check(offset + size <= data.size());
+            std::memcpy(data.data() + offset, value, size);
+        }
+
+    private:
+        std::vector<uint8_t> data;
+    };
+
+    size_t get_mesh_bytes(const MeshData& data)
+    {
+        return data.vertexes.size()  * sizeof(glm::vec3)
+             + data.normals.size()   * sizeof(glm::vec3)
+             + data.tangents.size()  * sizeof(glm::vec3)
+             + data.texcoords.size() * sizeof(glm::vec2)
+             + data.colors.size()    * sizeof(glm::vec4)
+             + data.faces.size()     * sizeof(glm::uvec3)
+             + data.lines.size()     * sizeof(glm::uvec2);
+    }
+
+    RecordingGraphicContext::RecordingGraphicContext()
+    : RecordingGraphicContext(Init{}) {}
+
+    RecordingGraphicContext::RecordingGraphicContext(Init init)
+    {
+        viewport.size = init.size;
+    }
+
+    RecordingGraphicContext::~RecordingGraphicContext() = default;
+
+    Api RecordingGraphicContext::get_api() const
+    {
+        return Api::RECORDING;
+    }
+
+    std::shared_ptr<MemoryTexture> RecordingGraphicContext::screenshot() const
+    {
+        auto buffer = std::vector<uint8_t>(viewport.size.x * viewport.size.y * 3u, 0u);
+        return MemoryTexture::create({
+            .size       = viewport.size,
+            .data_type  = DataType::UNSIGNED_BYTE,
+            .color_mode = ColorMode::BGR,
+            .memory     = buffer.data()
+        });
+    }
+
+    std::shared_ptr<Shader> RecordingGraphicContext::compile(const Shader::Source& source)
+    {
+        return std::make_shared<RecordingShader>();
+    }
+
+    std::shared_ptr<FrameBuffer> RecordingGraphicContext::create_frame_buffer(const FrameBuffer::BufferConfig& config)
+    {
+        return std::make_shared<RecordingFrameBuffer>(config);
+    }
+
+    std::shared_ptr<CubeMap> RecordingGraphicContext::generate_cubemap(const CubeMapGenerator& generator)
+    {
+        return generate_cubemap_faces(generator, 0u, 6u * generator.miplevels);
+    }
+
+    std::shared_ptr<CubeMap> RecordingGraphicContext::generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count)
+    {
+        auto& command = record(CommandType::GENERATE_CUBEMAP);
+        command.count = std::min(first + count, 6u * generator.miplevels) - std::min(first, 6u * generator.miplevels);
+
+        if (generator.target)
+        {
+            return generator.target;
+        }
+        return std::make_shared<RecordingCubeMap>(generator);
+    }
+
+    CubeMapData RecordingGraphicContext::download_cubemap(const std::shared_ptr<CubeMap>& cubemap)
+    {
+        check(cubemap);
+        // recorded cube maps have no pixels
+        return {
+            .id         = cubemap->get_id(),
+            .size       = cubemap->get_size(),
+            .data_type  = cubemap->get_data_type(),
+            .color_mode = cubemap->get_color_mode()
+        };
+    }
+
+    std::shared_ptr<CubeMap> RecordingGraphicContext::upload_cubemap(const CubeMapData& data)
+    {
+        count_upload(data);
+        return std::make_shared<RecordingCubeMap>(data);
+    }
+
+    std::shared_ptr<Mesh> RecordingGraphicContext::upload_mesh(MeshData data, bool stream)
+    {
+        stats.bytes += get_mesh_bytes(data);
+        count_upload(data);
+        return std::make_shared<MemoryMesh>(std::move(data));
+    }
+
+    std::shared_ptr<UniformBuffer> RecordingGraphicContext::create_uniform_buffer(size_t size)
+    {
+        return std::make_shared<RecordingUniformBuffer>(size);
+    }
+
+    size_t RecordingGraphicContext::get_uniform_buffer_alignment() const
+    {
+        // the common alignment of desktop GPUs, so that layouts match
+        return 256u;
+    }
+
+    void RecordingGraphicContext::set_viewport(const Viewport& value)
+    {
+        record(CommandType::SET_VIEWPORT);
+        viewport = value;
+    }
+
+    Viewport RecordingGraphicContext::get_viewport() const
+    {
+        return viewport;
+    }
+
+    void RecordingGraphicContext::clear_screen()
+    {
+        record(CommandType::CLEAR_SCREEN);
+    }
+
+    void RecordingGraphicContext::start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader)
+    {
+        start_pass(name, shader, nullptr);
+    }
+
+    void RecordingGraphicContext::start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader, const std::shared_ptr<FrameBuffer>& frame_buffer)
+    {
+        check(shader);
+
+        auto& command = record(CommandType::START_PASS);
+        command.name = name;
+        stats.passes++;
+        render_stats.shader_binds++;
+
+        profiler.start_pass(name);
+    }
+
+    void RecordingGraphicContext::set_blend_mode(BlendMode mode)
+    {
+        auto& command = record(CommandType::SET_BLEND_MODE);
+        command.blend_mode = mode;
+    }
+
+    void RecordingGraphicContext::set_depth_test(DepthTest mode)
+    {
+        auto& command = record(CommandType::SET_DEPTH_TEST);
+        command.depth_test = mode;
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, int value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, float value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::ivec2& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::ivec3& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::ivec4& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::vec2& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::vec3& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::vec4& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::mat2& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::mat3& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const glm::mat4& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::set_uniform(int loc, const UniformValue& value)
+    {
+        record_uniform(loc, value);
+    }
+
+    void RecordingGraphicContext::bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback)
+    {
+        check(slot >= 0);
+
+        auto& command = record(CommandType::BIND_TEXTURE);
+        command.slot = slot;
+        stats.texture_binds++;
+        render_stats.texture_binds++;
+    }
+
+    void RecordingGraphicContext::bind_texture(int slot, const std::shared_ptr<CubeMap>& texture)
+    {
+        check(slot >= 0);
+        check(texture);
+
+        auto& command = record(CommandType::BIND_TEXTURE);
+        command.slot = slot;
+        stats.texture_binds++;
+        render_stats.texture_binds++;
+    }
+
+    void RecordingGraphicContext::set_storage_buffer(int binding, size_t size, const void* data)
+    {
+        auto& command = record(CommandType::SET_STORAGE_BUFFER);
+        command.slot  = binding;
+        command.bytes = size;
+        stats.buffer_binds++;
+        stats.bytes += size;
+        render_stats.buffer_bytes += size;
+    }
+
+    void RecordingGraphicContext::bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size)
+    {
+        check(buffer);
+        check(offset % get_uniform_buffer_alignment() == 0u);
+        check(offset + size <= buffer->get_size());
+
+        auto& command = record(CommandType::BIND_UNIFORM_BUFFER);
+        command.slot = binding;
+        stats.buffer_binds++;
+    }
+
+    void RecordingGraphicContext::set_uniform_buffer(int binding, size_t size, const void* data)
+    {
+        auto& command = record(CommandType::SET_UNIFORM_BUFFER);
+        command.slot  = binding;
+        command.bytes = size;
+        stats.buffer_binds++;
+        stats.bytes += size;
+        render_stats.buffer_bytes += size;
+    }
+
+    void RecordingGraphicContext::draw(const std::shared_ptr<Mesh>& mesh)
+    {
+        check(mesh);
+        record_draw(CommandType::DRAW, mesh.get(), 1u);
+    }
+
+    void RecordingGraphicContext::draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms)
+    {
+        check(mesh);
+        if (transforms.empty())
+        {
+            return;
+        }
+
+        record_draw(CommandType::DRAW_INSTANCED, mesh.get(), transforms.size());
+        commands.back().bytes = transforms.size() * sizeof(glm::mat4);
+        stats.bytes += transforms.size() * sizeof(glm::mat4);
+        render_stats.buffer_bytes += transforms.size() * sizeof(glm::mat4);
+    }
+
+    void RecordingGraphicContext::draw_fullscreen()
+    {
+        record_draw(CommandType::DRAW_FULLSCREEN, nullptr, 1u);
+        stats.triangles += 2u;
+        render_stats.triangles += 2u;
+    }
+
+    void RecordingGraphicContext::end_pass()
+    {
+        record(CommandType::END_PASS);
+
+        profiler.end_pass();
+    }
+
+    void RecordingGraphicContext::swap_buffers()
+    {
+        frame_commands = std::move(commands);
+        frame_stats    = stats;
+
+        commands.clear();
+        stats = {};
+
+        end_render_stats(0u, 0u);
+
+        profiler.end_frame();
+    }
+
+    const std::vector<RecordingGraphicContext::Command>& RecordingGraphicContext::get_commands() const
+    {
+        return frame_commands;
+    }
+
+    const RecordingGraphicContext::Stats& RecordingGraphicContext::get_stats() const
+    {
+        return frame_stats;
+    }
+
+    RecordingGraphicContext::Command& RecordingGraphicContext::record(CommandType type)
+    {
+        stats.commands++;
+        return commands.emplace_back(Command{.type = type});
+    }
+
+    void RecordingGraphicContext::record_uniform(int loc, const UniformValue& value)
+    {
+        check(loc >= 0);
+
+        auto& command = record(CommandType::SET_UNIFORM);
+        command.slot  = loc;
+        command.bytes = std::visit([] (auto&& v) { return sizeof(v); }, value);
+        command.value = value;
+
+        stats.uniforms++;
+        stats.bytes += command.bytes;
+        render_stats.uniforms++;
+    }
+
+    void RecordingGraphicContext::record_draw(CommandType type, const Mesh* mesh, size_t instances)
+    {
+        auto& command = record(type);
+        command.count = instances;
+        command.mesh  = mesh;
+
+        stats.draws++;
+        stats.instances += instances;
+        if (mesh != nullptr)
+        {
+            stats.triangles += mesh->get_faces().size() * instances;
+            count_draw(*mesh, instances);
+        }
+        else
+        {
+            render_stats.draws++;
+        }
+    }
+}
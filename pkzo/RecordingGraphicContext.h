@@ -0,0 +1,177 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GraphicContext.h"
+
+namespace pkzo
+{
+    //! Graphic context that records commands instead of rendering.
+    //!
+    //! Implements the full GraphicContext interface without a GPU, so the
+    //! render path can be tested and benchmarked headless. Resources are
+    //! plain memory objects, frame buffers and cube maps have no storage
+    //! and screenshots are black.
+    //!
+    //! Commands and statistics are collected per frame, swap_buffers ends
+    //! the frame and makes them available through get_commands and get_stats.
+    class PKZO_EXPORT RecordingGraphicContext : public GraphicContext
+    {
+    public:
+        struct Init
+        {
+            glm::uvec2 size = glm::uvec2(800u, 600u); //!< Initial viewport size.
+        };
+
+        enum class CommandType
+        {
+            CLEAR_SCREEN,
+            SET_VIEWPORT,
+            START_PASS,
+            END_PASS,
+            SET_BLEND_MODE,
+            SET_DEPTH_TEST,
+            SET_UNIFORM,
+            BIND_TEXTURE,
+            SET_STORAGE_BUFFER,
+            BIND_UNIFORM_BUFFER,
+            SET_UNIFORM_BUFFER,
+            DRAW,
+            DRAW_INSTANCED,
+            DRAW_FULLSCREEN,
+            GENERATE_CUBEMAP
+        };
+
+        struct Command
+        {
+            CommandType                 type;
+            std::string                 name;              //!< Pass name of START_PASS.
+            int                         slot  = -1;        //!< Uniform location, texture slot or buffer binding.
+            size_t                      count = 0u;        //!< Instances of draws, faces of GENERATE_CUBEMAP.
+            size_t                      bytes = 0u;        //!< Data uploaded by the command.
+            const Mesh*                 mesh  = nullptr;   //!< Mesh of DRAW and DRAW_INSTANCED.
+            std::optional<UniformValue> value;             //!< Value of SET_UNIFORM.
+            std::optional<BlendMode>    blend_mode;        //!< Mode of SET_BLEND_MODE.
+            std::optional<DepthTest>    depth_test;        //!< Mode of SET_DEPTH_TEST.
+        };
+
+        struct Stats
+        {
+            size_t commands      = 0u;
+            size_t passes        = 0u;
+            size_t draws         = 0u; //!< Draw calls, each instanced draw counts once.
+            size_t instances     = 0u;
+            size_t triangles     = 0u;
+            size_t uniforms      = 0u;
+            size_t texture_binds = 0u;
+            size_t buffer_binds  = 0u;
+            size_t bytes         = 0u; //!< Uniform, buffer and mesh data uploaded.
+        };
+
+        RecordingGraphicContext();
+        RecordingGraphicContext(Init init);
+        ~RecordingGraphicContext();
+
+        Api get_api() const override;
+
+        std::shared_ptr<MemoryTexture> screenshot() const override;
+
+        std::shared_ptr<Shader> compile(const Shader::Source& source) override;
+        std::shared_ptr<FrameBuffer> create_frame_buffer(const FrameBuffer::BufferConfig& config) override;
+
+        std::shared_ptr<CubeMap> generate_cubemap(const CubeMapGenerator& generator) override;
+        std::shared_ptr<CubeMap> generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count) override;
+        CubeMapData download_cubemap(const std::shared_ptr<CubeMap>& cubemap) override;
+        std::shared_ptr<CubeMap> upload_cubemap(const CubeMapData& data) override;
+
+        std::shared_ptr<Mesh> upload_mesh(MeshData data, bool stream = false) override;
+
+        std::shared_ptr<UniformBuffer> create_uniform_buffer(size_t size) override;
+        size_t get_uniform_buffer_alignment() const override;
+
+        void set_viewport(const Viewport& viewport) override;
+        Viewport get_viewport() const override;
+
+        void clear_screen() override;
+
+        void start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader) override;
+        void start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader, const std::shared_ptr<FrameBuffer>& frame_buffer) override;
+
+        void set_blend_mode(BlendMode mode) override;
+        void set_depth_test(DepthTest mode) override;
+
+        void set_uniform(int loc, int value) override;
+        void set_uniform(int loc, float value) override;
+        void set_uniform(int loc, const glm::ivec2& value) override;
+        void set_uniform(int loc, const glm::ivec3& value) override;
+        void set_uniform(int loc, const glm::ivec4& value) override;
+        void set_uniform(int loc, const glm::vec2& value) override;
+        void set_uniform(int loc, const glm::vec3& value) override;
+        void set_uniform(int loc, const glm::vec4& value) override;
+        void set_uniform(int loc, const glm::mat2& value) override;
+        void set_uniform(int loc, const glm::mat3& value) override;
+        void set_uniform(int loc, const glm::mat4& value) override;
+        void set_uniform(int loc, const UniformValue& value) override;
+
+        void bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback = FallbackTexture::WHITE) override;
+        void bind_texture(int slot, const std::shared_ptr<CubeMap>& texture) override;
+
+        using GraphicContext::set_storage_buffer;
+        void set_storage_buffer(int binding, size_t size, const void* data) override;
+
+        void bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size) override;
+
+        using GraphicContext::set_uniform_buffer;
+        void set_uniform_buffer(int binding, size_t size, const void* data) override;
+
+        void draw(const std::shared_ptr<Mesh>& mesh) override;
+        void draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms) override;
+        void draw_fullscreen() override;
+
+        void end_pass() override;
+
+        void swap_buffers() override;
+
+        //! Commands of the last completed frame.
+        const std::vector<Command>& get_commands() const;
+
+        //! Statistics of the last completed frame.
+        const Stats& get_stats() const;
+
+    private:
+        Viewport viewport;
+
+        std::vector<Command> commands;
+        Stats                stats;
+
+        std::vector<Command> frame_commands;
+        Stats                frame_stats;
+
+        Command& record(CommandType type);
+        void record_uniform(int loc, const UniformValue& value);
+        void record_draw(CommandType type, const Mesh* mesh, size_t instances);
+    };
+}
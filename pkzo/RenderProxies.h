@@ -0,0 +1,111 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Bounds.h"
+#include "CubeMap.h"
+#include "Light.h"
+#include "Mesh.h"
+#include "MeshLod.h"
+#include "Texture.h"
+
+namespace pkzo
+{
+    class Material;
+
+    // The proxies are copies of the renderable state of scene nodes. The ids
+    // identify a node across frames and are never dereferenced, the node
+    // may be gone by the time its proxy is rendered.
+
+    struct GeometryProxy
+    {
+        const void*               id          = nullptr;
+        glm::mat4                 transform   = glm::mat4(1.0f); //!< World transform.
+        Bounds3                   bounds;                        //!< Local bounds, empty if the geometry can not be culled.
+        std::shared_ptr<Mesh>     mesh;
+        std::vector<MeshLod>      lods;
+        std::shared_ptr<Mesh>     occluder;
+        std::shared_ptr<Material> material;
+        bool                      dynamic     = false;           //!< Part of a body, the shadow is not cached.
+        uint32_t                  material_id = 0u;              //!< Index in `RenderSnapshot::materials`.
+        std::vector<uint32_t>     mesh_ids;                      //!< Index of the mesh and of each level of detail in `RenderSnapshot::meshes`.
+    };
+
+    struct LightProxy
+    {
+        LightType type         = LightType::NONE;
+        glm::vec3 color        = glm::vec3(0.0f);
+        glm::vec3 direction    = glm::vec3(0.0f);
+        glm::vec3 position     = glm::vec3(0.0f);
+        glm::vec2 angles       = glm::vec2(0.0f);
+        float     range        = 0.0f;
+        bool      cast_shadows = false;
+    };
+
+    struct CameraProxy
+    {
+        glm::mat4 transform  = glm::mat4(1.0f); //!< World transform.
+        glm::mat4 view       = glm::mat4(1.0f);
+        glm::mat4 projection = glm::mat4(1.0f); //!< Computed for the viewport it is rendered to.
+        float     fov        = 70.0f;
+        float     distance   = 1000.0f;
+    };
+
+    struct SkyBoxProxy
+    {
+        const void*              id = nullptr;
+        std::shared_ptr<Texture> texture;
+        std::shared_ptr<CubeMap> cubemap; //!< Set by the application, generated from the texture otherwise.
+    };
+
+    //! Renderable state of a scene at the end of an update.
+    struct RenderSnapshot
+    {
+        std::optional<CameraProxy> camera;
+        std::vector<SkyBoxProxy>   skyboxes;
+        std::vector<GeometryProxy> geometries;
+        std::vector<LightProxy>    lights;
+
+        //! Draw tables, the materials and meshes of the geometries.
+        std::vector<std::shared_ptr<Material>> materials;
+        std::vector<std::shared_ptr<Mesh>>     meshes;
+
+        //! Indexes of the geometries with an occluder.
+        std::vector<size_t> occluders;
+
+        //! Changes when static geometry is added, moved or removed.
+        uint64_t static_version = 0u;
+
+        //! Geometries removed since the previous snapshot.
+        std::vector<const void*> removed_geometries;
+
+        std::vector<glm::vec3> line_vertexes;
+        std::vector<glm::vec4> line_colors;
+    };
+}
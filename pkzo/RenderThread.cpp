@@ -0,0 +1,119 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "RenderThread.h"
+
+#include "Window.h"
+
+namespace pkzo
+{
+    RenderThread::RenderThread(Window& window)
+    : window(window)
+    {
+        window.release_current();
+        thread = std::thread([this] () { run(); });
+    }
+
+    RenderThread::~RenderThread()
+    {
+        {
+            auto lock = std::unique_lock(mutex);
+            stop = true;
+        }
+        condition.notify_all();
+
+        thread.join();
+        window.make_current();
+    }
+
+    void RenderThread::draw()
+    {
+        wait();
+
+        {
+            auto lock = std::unique_lock(mutex);
+            pending = true;
+        }
+        condition.notify_all();
+    }
+
+    void RenderThread::wait()
+    {
+        auto lock = std::unique_lock(mutex);
+        condition.wait(lock, [this] () { return !pending; });
+
+        if (error)
+        {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+    void RenderThread::run()
+    {
+        // without a current context no frame can be drawn, each one reports it
+        auto context_error = std::exception_ptr{};
+        try
+        {
+            window.make_current();
+        }
+        catch (...)
+        {
+            context_error = std::current_exception();
+        }
+
+        auto lock = std::unique_lock(mutex);
+        while (true)
+        {
+            condition.wait(lock, [this] () { return pending || stop; });
+            if (stop)
+            {
+                break;
+            }
+            lock.unlock();
+
+            auto frame_error = context_error;
+            if (!frame_error)
+            {
+                try
+                {
+                    window.draw();
+                }
+                catch (...)
+                {
+                    frame_error = std::current_exception();
+                }
+            }
+
+            lock.lock();
+            pending = false;
+            error   = frame_error;
+            condition.notify_all();
+        }
+        lock.unlock();
+
+        if (!context_error)
+        {
+            window.release_current();
+        }
+    }
+}
@@ -0,0 +1,74 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "api.h"
+
+namespace pkzo
+{
+    class Window;
+
+    //! Draws a window on a dedicated thread.
+    //!
+    //! The graphic context of the window is current on the render thread
+    //! for the lifetime of the RenderThread. Each frame is started with
+    //! draw() and runs while the caller updates the next frame; the draw
+    //! callbacks must only read state that is not changed until wait()
+    //! returns, such as the snapshot of a Scene with Init::render_thread.
+    class PKZO_EXPORT RenderThread
+    {
+    public:
+        //! Release the graphic context of the window and start the thread.
+        RenderThread(Window& window);
+
+        //! Stop the thread and make the context current on the caller again.
+        ~RenderThread();
+
+        //! Wait for the previous frame and start drawing the next one.
+        void draw();
+
+        //! Wait for the current frame to complete.
+        //!
+        //! Exceptions thrown while drawing are rethrown here.
+        void wait();
+
+    private:
+        Window&                 window;
+        std::thread             thread;
+
+        std::mutex              mutex;
+        std::condition_variable condition;
+        bool                    pending = false;
+        bool                    stop    = false;
+        std::exception_ptr      error;
+
+        void run();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator = (const RenderThread&) = delete;
+    };
+}
@@ -32,7 +32,17 @@ namespace pkzo
 {
     using pkzo::check;
 
-    Scene::Scene() = default;
+    Scene::Scene()
+    : Scene(Init{}) {}
+
+    Scene::Scene(Init init)
+    : render_thread(init.render_thread)
+    {
+        if (init.transform_store)
+        {
+            create_transform_store();
+        }
+    }
 
     Scene::~Scene()
     {
@@ -130,12 +140,26 @@ namespace pkzo
         }
 
         Group::update(dt);
+
+        if (auto store = get_transform_store())
+        {
+            store->update();
+        }
+
+        if (render_thread && renderer)
+        {
+            renderer->extract();
+        }
     }
 
     void Scene::draw(pkzo::GraphicContext& gc)
     {
         if (renderer)
         {
+            if (!render_thread)
+            {
+                renderer->extract();
+            }
             renderer->render(gc);
         }
     }
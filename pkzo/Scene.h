@@ -54,8 +54,23 @@ namespace pkzo
     class PKZO_EXPORT Scene : public SceneGroup
     {
     public:
+        struct Init
+        {
+            //! Keep all node transforms in a contiguous TransformStore.
+            bool transform_store = false;
+
+            //! The scene is drawn on a render thread, see RenderThread.
+            //!
+            //! The renderable state is extracted at the end of update and
+            //! draw renders the state of the last update. Otherwise draw
+            //! extracts and renders the current state.
+            bool render_thread = false;
+        };
+
         Scene();
 
+        Scene(Init init);
+
         ~Scene();
 
         SceneRenderer* get_renderer();
@@ -77,6 +92,8 @@ namespace pkzo
         void draw(pkzo::GraphicContext& gc);
 
     private:
+        bool render_thread = false;
+
         std::unique_ptr<SceneRenderer>     renderer;
         std::unique_ptr<PhysicsSimulation> physics_simulation;
     };
@@ -28,7 +28,14 @@
 #include <fstream>
 #include <filesystem>
 #include <map>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <future>
+#include <limits>
 #include <numbers>
+#include <thread>
 
 #include <magic_enum/magic_enum.hpp>
 #include <tinyformat.h>
@@ -36,11 +43,15 @@
 #include <pkzo/debug.h>
 
 #include "resources.h"
+#include "Body.h"
 #include "SkyBox.h"
 #include "Camera.h"
 #include "Geometry.h"
 #include "Light.h"
 #include "Material.h"
+#include "MemoryTexture.h"
+#include "Frustum.h"
+#include "WorkerPool.h"
 #include <pkzo/OpenGLMesh.h>
 
 namespace pkzo
@@ -54,6 +65,7 @@ namespace pkzo
         {"uniforms.glsl", std::string(get_resource("uniforms.glsl"))},
         {"outputs.glsl", std::string(get_resource("outputs.glsl"))},
         {"math.glsl", std::string(get_resource("math.glsl"))},
+        {"lighting.glsl", std::string(get_resource("lighting.glsl"))},
     };
 
     std::string expand_includes(const std::string_view src, int depth = 0)
@@ -125,12 +137,16 @@ namespace pkzo
 
     void SceneRenderer::add_debug_line(const glm::vec3& start, const glm::vec3& end, const glm::vec4& color)
     {
-        debug_line_renderer.add_line(start, end, color, color);
+        add_debug_line(start, end, color, color);
     }
 
     void SceneRenderer::add_debug_line(const glm::vec3& start, const glm::vec3& end, const glm::vec4& start_color, const glm::vec4& end_color)
     {
-        debug_line_renderer.add_line(start, end, start_color, end_color);
+        line_vertexes.push_back(start);
+        line_vertexes.push_back(end);
+
+        line_colors.push_back(start_color);
+        line_colors.push_back(end_color);
     }
 
     void SceneRenderer::add(Camera* camera)
@@ -156,11 +172,33 @@ namespace pkzo
     void SceneRenderer::add(Geometry* geometry)
     {
         geometries.push_back(geometry);
+
+        if (geometry->find_ancestor<Body>() == nullptr)
+        {
+            auto& entry = static_geometries[geometry];
+            if (geometry->get_transform_store() == nullptr)
+            {
+                entry.move_slot = geometry->on_move([this] () {
+                    static_version++;
+                });
+            }
+            else
+            {
+                entry.transform = geometry->get_world_transform();
+            }
+            static_version++;
+        }
     }
 
     void SceneRenderer::remove(Geometry* geometry)
     {
         std::erase(geometries, geometry);
+        removed_geometries.push_back(geometry);
+
+        if (static_geometries.erase(geometry) > 0u)
+        {
+            static_version++;
+        }
     }
 
     void SceneRenderer::add(Light* light)
@@ -173,29 +211,203 @@ namespace pkzo
         std::erase(lights, light);
     }
 
-    void SceneRenderer::render(pkzo::GraphicContext& gc)
+    // Index of the value in the draw table, appended on first use.
+    template <typename T>
+    uint32_t get_table_id(std::unordered_map<const T*, uint32_t>& ids, std::vector<std::shared_ptr<T>>& table, const std::shared_ptr<T>& value)
     {
-        if (!cameras.empty() && !geometries.empty())
+        const auto [i, added] = ids.try_emplace(value.get(), static_cast<uint32_t>(table.size()));
+        if (added)
         {
-            load_shaders(gc);
+            table.push_back(value);
+        }
+        return i->second;
+    }
 
-            auto viewport = gc.get_viewport();
+    void SceneRenderer::extract()
+    {
+        auto& snapshot = back_snapshot;
+
+        snapshot.camera.reset();
+        if (!cameras.empty())
+        {
             check(cameras.size() == 1);
-            auto* camera = cameras[0];
-            camera->set_resolution({viewport.size.x, viewport.size.y});
+            const auto* camera = cameras[0];
+            snapshot.camera = CameraProxy{
+                .transform  = camera->get_world_transform(),
+                .view       = camera->get_view_matrix(),
+                .projection = camera->get_projection_matrix(),
+                .fov        = camera->get_fov(),
+                .distance   = camera->get_distance()
+            };
+        }
+
+        snapshot.skyboxes.clear();
+        for (const auto* sky_box : skyboxes)
+        {
+            snapshot.skyboxes.push_back({sky_box, sky_box->get_texture(), sky_box->get_cubemap()});
+        }
+
+        // the draw tables are built with the proxies, the render jobs only read them
+        snapshot.materials.clear();
+        snapshot.meshes.clear();
+        snapshot.occluders.clear();
+        material_ids.clear();
+        mesh_ids.clear();
+
+        // assigned in place, so the level of detail vectors keep their memory
+        snapshot.geometries.resize(geometries.size());
+        for (auto i = size_t{0u}; i < geometries.size(); i++)
+        {
+            const auto* geometry = geometries[i];
+            auto&       proxy    = snapshot.geometries[i];
+
+            proxy.id        = geometry;
+            proxy.transform = geometry->get_world_transform();
+            proxy.bounds    = geometry->get_bounds();
+            proxy.mesh      = geometry->get_mesh();
+            proxy.lods      = geometry->get_lods();
+            proxy.occluder  = geometry->get_occluder();
+            proxy.material  = geometry->get_material();
+
+            auto static_geometry = static_geometries.find(geometry);
+            proxy.dynamic = static_geometry == static_geometries.end();
+            if (!proxy.dynamic && geometry->get_transform_store() != nullptr && static_geometry->second.transform != proxy.transform)
+            {
+                static_geometry->second.transform = proxy.transform;
+                static_version++;
+            }
 
-            if (!skyboxes.empty())
+            proxy.material_id = get_table_id(material_ids, snapshot.materials, proxy.material);
+            proxy.mesh_ids.clear();
+            proxy.mesh_ids.push_back(get_table_id(mesh_ids, snapshot.meshes, proxy.mesh));
+            for (const auto& lod : proxy.lods)
             {
-                render_skybox(gc);
+                proxy.mesh_ids.push_back(get_table_id(mesh_ids, snapshot.meshes, lod.mesh));
             }
 
-            render_forward(gc);
+            if (proxy.occluder != nullptr)
+            {
+                snapshot.occluders.push_back(i);
+            }
         }
 
-        if (!cameras.empty())
+        snapshot.lights.clear();
+        for (const auto* light : lights)
+        {
+            snapshot.lights.push_back({light->get_type(), light->get_color(), light->get_direction(), light->get_position(), light->get_angles(), light->get_range(), light->get_cast_shadows()});
+        }
+
+        snapshot.static_version = static_version;
+
+        std::swap(snapshot.removed_geometries, removed_geometries);
+        std::swap(snapshot.line_vertexes,      line_vertexes);
+        std::swap(snapshot.line_colors,        line_colors);
+        removed_geometries.clear();
+        line_vertexes.clear();
+        line_colors.clear();
+
+        auto lock = std::unique_lock(snapshot_mutex);
+        if (front_pending)
+        {
+            // the front snapshot was never rendered, carry its removals and lines over
+            const auto& front = front_snapshot;
+            snapshot.removed_geometries.insert(begin(snapshot.removed_geometries), begin(front.removed_geometries), end(front.removed_geometries));
+            snapshot.line_vertexes.insert(begin(snapshot.line_vertexes), begin(front.line_vertexes), end(front.line_vertexes));
+            snapshot.line_colors.insert(begin(snapshot.line_colors), begin(front.line_colors), end(front.line_colors));
+        }
+        std::swap(front_snapshot, back_snapshot);
+        front_pending = true;
+    }
+
+    void SceneRenderer::render(pkzo::GraphicContext& gc)
+    {
+        auto lock = std::unique_lock(snapshot_mutex);
+        const auto& snapshot = front_snapshot;
+        front_pending = false;
+
+        for (const auto* id : snapshot.removed_geometries)
+        {
+            lod_levels.erase(id);
+        }
+
+        if (!snapshot.camera)
+        {
+            return;
+        }
+
+        // the projection follows the viewport, not the resolution of the camera node
+        auto viewport = gc.get_viewport();
+        auto camera   = *snapshot.camera;
+        camera.projection = make_projection_matrix(camera.fov, camera.distance, viewport.size);
+
+        if (!snapshot.geometries.empty())
         {
-            debug_line_renderer.render(gc, cameras[0]);
+            load_shaders(gc);
+
+            record_draws(camera);
+            update_lights(camera);
+            upload_lights(gc);
+
+            render_shadows(gc);
+
+            if (!snapshot.skyboxes.empty())
+            {
+                render_skybox(gc, camera);
+            }
+
+            switch (render_mode)
+            {
+                case RenderMode::FORWARD:
+                    render_forward(gc, camera);
+                    break;
+                case RenderMode::DEFERRED:
+                    render_deferred(gc, camera);
+                    break;
+                default:
+                    std::unreachable();
+            }
         }
+
+        debug_line_renderer.render(gc, snapshot.line_vertexes, snapshot.line_colors, camera);
+    }
+
+    const SceneRenderer::CullStats& SceneRenderer::get_cull_stats() const
+    {
+        return cull_stats;
+    }
+
+    const SceneRenderer::ShadowStats& SceneRenderer::get_shadow_stats() const
+    {
+        return shadow_stats;
+    }
+
+    void SceneRenderer::set_render_mode(RenderMode mode)
+    {
+        render_mode = mode;
+    }
+
+    SceneRenderer::RenderMode SceneRenderer::get_render_mode() const
+    {
+        return render_mode;
+    }
+
+    void SceneRenderer::set_occlusion_culling(bool value)
+    {
+        occlusion_culling = value;
+    }
+
+    bool SceneRenderer::get_occlusion_culling() const
+    {
+        return occlusion_culling;
+    }
+
+    uint64_t hash_cubemap_source(const Shader::Source& source)
+    {
+        auto hash = ContentHash{};
+        hash.add(source.vertex);
+        hash.add(std::string_view{"\0", 1u});
+        hash.add(source.fragment);
+        return hash.get();
     }
 
     void SceneRenderer::load_shaders(GraphicContext& gc)
@@ -210,252 +422,1211 @@ namespace pkzo
             .fragment = load_glsl_resource("Forward.frag"),
         });
 
+        geometry_buffer_shader = gc.compile({
+            .vertex   = load_glsl_resource("Forward.vert"),
+            .fragment = load_glsl_resource("GBuffer.frag"),
+        });
+
+        deferred_lighting_shader = gc.compile({
+            .vertex   = load_glsl_resource("DeferredLighting.vert"),
+            .fragment = load_glsl_resource("DeferredLighting.frag"),
+        });
+
+        shadow_shader = gc.compile({
+            .vertex   = load_glsl_resource("Shadow.vert"),
+            .fragment = load_glsl_resource("Shadow.frag"),
+        });
+
+        shadow_copy_shader = gc.compile({
+            .vertex   = load_glsl_resource("ShadowCopy.vert"),
+            .fragment = load_glsl_resource("ShadowCopy.frag"),
+        });
+
         skybox_shader = gc.compile({
             .vertex   = load_glsl_resource("Skybox.vert"),
             .fragment = load_glsl_resource("Skybox.frag"),
         });
 
-        cubemap_generator_shader = gc.compile({
+        auto generator_source = Shader::Source{
             .vertex   = load_glsl_resource("GenerateCubemap.vert"),
             .fragment = load_glsl_resource("GenerateCubemap.frag"),
-        });
-
-        cubemap_diffuse_filter_shader = gc.compile({
-            .vertex   = load_glsl_resource("GenerateCubemap.vert"),
-            .fragment = load_glsl_resource("FilterCubemapDiffuse.frag"),
-        });
+        };
+        cubemap_generator_shader  = gc.compile(generator_source);
+        cubemap_generator_version = hash_cubemap_source(generator_source);
 
-        cubemap_specular_filter_shader = gc.compile({
+        auto specular_filter_source = Shader::Source{
             .vertex   = load_glsl_resource("GenerateCubemap.vert"),
             .fragment = load_glsl_resource("FilterCubemapSpecular.frag"),
-        });
+        };
+        cubemap_specular_filter_shader  = gc.compile(specular_filter_source);
+        cubemap_specular_filter_version = hash_cubemap_source(specular_filter_source);
     }
 
-    void apply_camera(GraphicContext& gc, const Camera* camera)
+    void apply_camera(GraphicContext& gc, const CameraProxy& camera)
     {
-        check(camera);
-        gc.set_uniform(std::to_underlying(UniformLocation::PROJECTION_MATRIX), camera->get_projection_matrix());
-        gc.set_uniform(std::to_underlying(UniformLocation::VIEW_MATRIX),       camera->get_view_matrix());
+        gc.set_uniform(std::to_underlying(UniformLocation::PROJECTION_MATRIX), camera.projection);
+        gc.set_uniform(std::to_underlying(UniformLocation::VIEW_MATRIX),       camera.view);
     }
 
-    auto generate_cubemap(pkzo::GraphicContext& gc, const std::shared_ptr<Shader>& shader, const pkzo::TextureOrCubeMap& texture, unsigned int mips = 1u)
+    constexpr auto CUBEMAP_SIZE      = 1024u;
+    constexpr auto SKY_UPDATE_BUDGET = std::chrono::microseconds(2000);
+
+    // the specular filter reads coarser mips of the environment for wide lobes
+    constexpr auto ENVIRONMENT_MIPS = static_cast<unsigned int>(std::bit_width(CUBEMAP_SIZE));
+    constexpr auto SPECULAR_MIPS    = static_cast<unsigned int>(pkzo::SPECULAR_MIP_LEVELS);
+
+    CubeMapGenerator make_cubemap_generator(const std::shared_ptr<Shader>& shader, const pkzo::TextureOrCubeMap& texture, unsigned int mips)
     {
         constexpr auto TEXTURE0_SLOT = 0;
 
-        return gc.generate_cubemap({
-            .size      = 1024,
+        auto source = std::holds_alternative<std::shared_ptr<CubeMap>>(texture) ? UniformLocation::CUBEMAP : UniformLocation::TEXTURE;
+
+        return {
+            .size      = CUBEMAP_SIZE,
             .data_type = pkzo::DataType::FLOAT,
             .shader    = shader,
             .uniforms  = {
-                {std::to_underlying(UniformLocation::TEXTURE), TEXTURE0_SLOT}
+                {std::to_underlying(source), TEXTURE0_SLOT}
             },
             .textures  = {
                 {TEXTURE0_SLOT, texture}
             },
             .miplevels = mips
-        });
+        };
     }
 
-    SceneRenderer::IblMaps SceneRenderer::genrate_ibl_maps(GraphicContext& gc, const std::shared_ptr<CubeMap>& light_probe)
+    auto generate_cubemap(pkzo::GraphicContext& gc, const std::shared_ptr<Shader>& shader, const pkzo::TextureOrCubeMap& texture, unsigned int mips = 1u)
     {
-        constexpr auto MIPS = 7;
-        check(light_probe);
+        return gc.generate_cubemap(make_cubemap_generator(shader, texture, mips));
+    }
 
-        auto i = ibl_cache.find(light_probe);
-        if (i != end(ibl_cache))
-        {
-            return i->second;
-        }
+    // implemented in GraphicContext.cpp
+    size_t get_pixel_bytes(ColorMode color_mode, DataType data_type);
 
-        auto diffuse  = generate_cubemap(gc, cubemap_diffuse_filter_shader, light_probe);
-        auto specular = generate_cubemap(gc, cubemap_specular_filter_shader, light_probe, MIPS);
+    uint64_t hash_texture(const std::shared_ptr<Texture>& texture)
+    {
+        check(texture);
 
-        ibl_cache.try_emplace(light_probe, diffuse, specular);
+        auto source = std::shared_ptr<Texture>(texture);
+        if (source->get_memory() == nullptr)
+        {
+            source = texture->download();
+            check(source && source->get_memory(), "Failed to download the environment texture.");
+        }
 
-        return {diffuse, specular};
+        const auto size       = source->get_size();
+        const auto data_type  = source->get_data_type();
+        const auto color_mode = source->get_color_mode();
+        // rows are 4 byte aligned, the default GL_UNPACK_ALIGNMENT
+        const auto pitch      = (size_t{size.x} * get_pixel_bytes(color_mode, data_type) + 3u) / 4u * 4u;
+
+        auto hash = ContentHash{};
+        hash.add_value(size);
+        hash.add_value(data_type);
+        hash.add_value(color_mode);
+        hash.add(source->get_memory(), pitch * size.y);
+        return hash.get();
     }
 
-    int uniform_location_offset(UniformLocation base, int offset)
+    std::shared_ptr<CubeMap> SceneRenderer::load_or_generate_cubemap(GraphicContext& gc, std::optional<uint64_t> key, const std::shared_ptr<Shader>& shader, const TextureOrCubeMap& texture, unsigned int mips)
     {
-        return static_cast<int>(base) + offset;
-    }
+        auto& cache = gc.get_cubemap_cache();
+        if (!key || !cache.is_enabled())
+        {
+            return generate_cubemap(gc, shader, texture, mips);
+        }
 
-    void SceneRenderer::apply_light(GraphicContext& gc, int i, const Light* light)
-    {
-        check(i < MAX_LIGHTS);
+        auto cubemap = std::shared_ptr<CubeMap>{};
+        if (auto data = cache.load(*key))
+        {
+            try
+            {
+                cubemap = gc.upload_cubemap(*data);
+            }
+            catch (const std::exception& ex)
+            {
+                trace(tfm::format("Ignoring cached cube map %016x: %s", *key, ex.what()));
+            }
+        }
 
-        constexpr auto LIGHT_COMPONENTS = 5;
-        if (light)
+        if (cubemap == nullptr)
         {
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT0_TYPE,      i * LIGHT_COMPONENTS),  std::to_underlying(light->get_type()));
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT0_COLOR,     i * LIGHT_COMPONENTS),  light->get_color());
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT0_DIRECTION, i * LIGHT_COMPONENTS),  light->get_direction());
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT0_POSITION,  i * LIGHT_COMPONENTS),  light->get_position());
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT0_ANGLES,    i * LIGHT_COMPONENTS),  light->get_angles());
+            cubemap = generate_cubemap(gc, shader, texture, mips);
+            cache.store(*key, gc.download_cubemap(cubemap));
         }
-        else
+
+        cubemap_keys[cubemap] = *key;
+        return cubemap;
+    }
+
+    std::shared_ptr<CubeMap> SceneRenderer::get_skybox_cubemap(const SkyBoxProxy& sky_box) const
+    {
+        if (sky_box.cubemap != nullptr)
         {
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT0_TYPE, i * LIGHT_COMPONENTS),   std::to_underlying(LightType::NONE));
+            return sky_box.cubemap;
         }
+        return sky_box.id == skybox_id ? skybox_cubemap : nullptr;
     }
 
-    void SceneRenderer::apply_light_probe(GraphicContext& gc, int i, const std::shared_ptr<CubeMap>& probe)
+    SceneRenderer::IblMaps SceneRenderer::genrate_ibl_maps(GraphicContext& gc, const SkyBoxProxy& sky_box)
     {
-        check(i < MAX_LIGHT_PROBES);
+        auto light_probe = get_skybox_cubemap(sky_box);
+        check(light_probe);
 
-        constexpr auto LIGHT_PROBE_COMPONENTS = 4;
-        constexpr auto LIGHT_PROBE_SLOTS      = 3;
-        constexpr auto LIGHT_ENVIRONMENT_SLOT = 4;
-        constexpr auto LIGHT_DIFFUSE_SLOT     = 5;
-        constexpr auto LIGHT_SPECULAR_SLOT    = 6;
-        if (probe)
+        auto i = ibl_cache.find(light_probe);
+        if (i != end(ibl_cache))
         {
-            auto maps = genrate_ibl_maps(gc, probe);
-
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_ENABLED,     i * LIGHT_PROBE_COMPONENTS), 1);
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_ENVIRONMENT, i * LIGHT_PROBE_COMPONENTS), LIGHT_ENVIRONMENT_SLOT + i * LIGHT_PROBE_SLOTS);
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_DIFFUSE,     i * LIGHT_PROBE_COMPONENTS), LIGHT_DIFFUSE_SLOT     + i * LIGHT_PROBE_SLOTS);
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_SPECULAR,    i * LIGHT_PROBE_COMPONENTS), LIGHT_SPECULAR_SLOT    + i * LIGHT_PROBE_SLOTS);
+            return i->second;
+        }
 
-            gc.bind_texture(LIGHT_ENVIRONMENT_SLOT, probe);
-            gc.bind_texture(LIGHT_DIFFUSE_SLOT,     maps.diffuse);
-            gc.bind_texture(LIGHT_SPECULAR_SLOT,    maps.specular);
+        // The diffuse irradiance is projected on the CPU, convolving a cube map
+        // on the GPU took seconds. Sky boxes made from a cube map only are
+        // projected from a small mip level of the downloaded cube map.
+        auto irradiance = IrradianceSH{};
+        if (sky_box.texture != nullptr)
+        {
+            irradiance = project_irradiance(sky_box.texture);
         }
         else
         {
-            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_ENABLED, i* LIGHT_PROBE_COMPONENTS), 0);
+            irradiance = project_irradiance(gc.download_cubemap(light_probe));
+        }
+
+        // only cube maps generated here have a key, a cube map set by the
+        // application has unknown content and is filtered every time
+        auto key = std::optional<uint64_t>{};
+        auto j   = cubemap_keys.find(light_probe);
+        if (j != end(cubemap_keys))
+        {
+            auto hash = ContentHash{j->second};
+            hash.add("specular");
+            hash.add_value(SPECULAR_MIPS);
+            hash.add_value(cubemap_specular_filter_version);
+            key = hash.get();
         }
+        auto specular = load_or_generate_cubemap(gc, key, cubemap_specular_filter_shader, light_probe, SPECULAR_MIPS);
+
+        auto maps = IblMaps{irradiance, specular};
+        ibl_cache.try_emplace(light_probe, maps);
+        return maps;
     }
 
-    void SceneRenderer::apply_material(GraphicContext& gc, const std::shared_ptr<Material>& material)
+    int uniform_location_offset(UniformLocation base, int offset)
     {
-        constexpr auto BASE_COLOR_SLOT          = 0;
-        constexpr auto METALLIC_ROUGHNESS_SLOT  = 1;
-        constexpr auto NORMAL_SLOT              = 2;
-        constexpr auto EMISSIVE_SLOT            = 3;
-
-        check(material);
+        return static_cast<int>(base) + offset;
+    }
 
-        gc.set_uniform(std::to_underlying(UniformLocation::BASE_COLOR_FACTOR),      glm::vec4(material->get_base_color_factor(), material->get_opacity_factor()));
-        gc.set_uniform(std::to_underlying(UniformLocation::BASE_COLOR_MAP),         BASE_COLOR_SLOT);
-        gc.set_uniform(std::to_underlying(UniformLocation::METALLIC_FACTOR),        material->get_metallic_factor());
-        gc.set_uniform(std::to_underlying(UniformLocation::ROUGHNESS_FACTOR),       material->get_roughness_factor());
-        gc.set_uniform(std::to_underlying(UniformLocation::METALLIC_ROUGHNESS_MAP), METALLIC_ROUGHNESS_SLOT);
-        gc.set_uniform(std::to_underlying(UniformLocation::NORMAL_MAP),             NORMAL_SLOT);
-        gc.set_uniform(std::to_underlying(UniformLocation::EMISSIVE_FACTOR),        material->get_emissive_factor());
-        gc.set_uniform(std::to_underlying(UniformLocation::EMISSIVE_MAP),           EMISSIVE_SLOT);
+    // Distance at which the 1/d^2 falloff of a light drops below the cutoff,
+    // bounds the shadow of an unbounded spot light.
+    float light_range(const glm::vec3& color)
+    {
+        constexpr auto LIGHT_CUTOFF = 1.0f / 256.0f;
 
-        gc.bind_texture(BASE_COLOR_SLOT,         material->get_base_color_map());
-        gc.bind_texture(METALLIC_ROUGHNESS_SLOT, material->get_metallic_roughness_map());
-        gc.bind_texture(NORMAL_SLOT,             material->get_normal_map(), pkzo::FallbackTexture::NORMAL);
-        gc.bind_texture(EMISSIVE_SLOT,           material->get_emissive_map());
+        auto intensity = std::max({color.r, color.g, color.b});
+        return std::sqrt(intensity / LIGHT_CUTOFF);
     }
 
-    void SceneRenderer::render_skybox(pkzo::GraphicContext& gc)
+    // Volume of a point or spot light, unbounded lights touch every cluster.
+    LightClusters::LightVolume make_light_volume(const LightProxy& light)
     {
-        constexpr auto SKYBOX_SLOT = 0;
+        const auto range = light.range > 0.0f ? light.range : std::numeric_limits<float>::infinity();
+        return {light.position, range};
+    }
 
-        check(!skyboxes.empty());
-        auto skybox = skyboxes[0];
+    // position.w is the range, 0 for unbounded, angles.z is the shadow view, -1 without shadow
+    LightData make_light_data(const LightProxy& light, int shadow = -1)
+    {
+        return {
+            .position  = glm::vec4(light.position, light.range),
+            .direction = glm::vec4(light.direction, static_cast<float>(std::to_underlying(light.type))),
+            .color     = glm::vec4(light.color, 1.0f),
+            .angles    = glm::vec4(light.angles, static_cast<float>(shadow), 0.0f)
+        };
+    }
 
-        if (skybox->get_cubemap() == nullptr)
+    Bounds3 SceneRenderer::get_caster_bounds() const
+    {
+        auto result = std::optional<Bounds3>{};
+        for (const auto& geometry : front_snapshot.geometries)
         {
-            auto cubemap = generate_cubemap(gc, cubemap_generator_shader, skybox->get_texture());
-            skybox->set_cubemap(cubemap);
+            // geometry without bounds can not be culled and does not widen the shadows
+            if (geometry.bounds.get_size() == glm::vec3(0.0f))
+            {
+                continue;
+            }
+
+            const auto world = transform(geometry.transform, geometry.bounds);
+            result = result ? merge(*result, world) : world;
         }
+        return result.value_or(Bounds3{});
+    }
 
-        gc.start_pass("Skybox", skybox_shader);
-        gc.set_blend_mode(pkzo::BlendMode::DISABLED);
-        gc.set_depth_test(pkzo::DepthTest::DISABLED);
+    // Sorts the lights and assigns point and spot lights to the clusters, once per frame.
+    void SceneRenderer::update_lights(const CameraProxy& camera)
+    {
+        // Ambient and directional lights affect everything and are passed in the frame block,
+        // point and spot lights are assigned to the light clusters.
+        auto global_count = 0;
+        cluster_lights.clear();
+        light_volumes.clear();
 
-        apply_camera(gc, cameras.at(0));
+        // shadow views are handed out in light order until the atlas is full
+        shadow_maps.begin(camera.projection, camera.view, get_caster_bounds());
 
-        gc.set_uniform(std::to_underlying(UniformLocation::ENVIRONMENT), SKYBOX_SLOT);
+        for (const auto& light : front_snapshot.lights)
+        {
+            switch (light.type)
+            {
+                case LightType::POINT:
+                {
+                    cluster_lights.push_back(make_light_data(light));
+                    light_volumes.push_back(make_light_volume(light));
+                    break;
+                }
+                case LightType::SPOT:
+                {
+                    auto range  = light.range > 0.0f ? light.range : light_range(light.color);
+                    auto shadow = light.cast_shadows ? shadow_maps.add_spot(light.position, light.direction, light.angles.y, range) : -1;
+                    cluster_lights.push_back(make_light_data(light, shadow));
+                    light_volumes.push_back(make_light_volume(light));
+                    break;
+                }
+                case LightType::DIRECTIONAL:
+                    if (global_count < MAX_LIGHTS)
+                    {
+                        auto shadow = light.cast_shadows ? shadow_maps.add_directional(light.direction) : -1;
+                        global_lights[global_count++] = make_light_data(light, shadow);
+                    }
+                    break;
+                default:
+                    if (global_count < MAX_LIGHTS)
+                    {
+                        global_lights[global_count++] = make_light_data(light);
+                    }
+                    break;
+            }
+        }
 
-        gc.bind_texture(SKYBOX_SLOT, skybox->get_cubemap());
+        // unused lights are zero, which is LightType::NONE
+        for (auto i = global_count; i < MAX_LIGHTS; i++)
+        {
+            global_lights[i] = {};
+        }
 
-        gc.draw_fullscreen();
+        light_clusters.update(camera.projection, camera.view, light_volumes);
+    }
 
-        gc.end_pass();
+    void SceneRenderer::apply_lights(GraphicContext& gc, FrameBlock& frame)
+    {
+        std::ranges::copy(global_lights, frame.lights);
 
+        const auto grid     = light_clusters.get_grid_size();
+        const auto viewport = gc.get_viewport();
+        frame.cluster_grid      = glm::ivec3(grid);
+        frame.cluster_tile_size = glm::vec2(viewport.size) / glm::vec2(grid.x, grid.y);
+        frame.cluster_depth     = glm::vec2(light_clusters.get_near(), light_clusters.get_far());
     }
 
-    void SceneRenderer::render_forward(pkzo::GraphicContext& gc)
+    // The storage bindings outlive the passes, so the clusters are uploaded once per frame.
+    void SceneRenderer::upload_lights(GraphicContext& gc)
     {
-        gc.start_pass("Forward", forward_shader);
-        gc.set_blend_mode(pkzo::BlendMode::ALPHA);
-        gc.set_depth_test(pkzo::DepthTest::ENABLED);
+        gc.set_storage_buffer(std::to_underlying(StorageBinding::CLUSTER_LIGHTS),        cluster_lights);
+        gc.set_storage_buffer(std::to_underlying(StorageBinding::CLUSTER_RANGES),        light_clusters.get_cluster_ranges());
+        gc.set_storage_buffer(std::to_underlying(StorageBinding::CLUSTER_LIGHT_INDEXES), light_clusters.get_light_indexes());
+    }
 
-        apply_camera(gc, cameras.at(0));
+    constexpr auto SHADOW_MAP_SLOT = 7;
 
-        for (auto i = 0u; i < MAX_LIGHT_PROBES; i++)
+    void SceneRenderer::apply_shadows(GraphicContext& gc, FrameBlock& frame)
+    {
+        for (auto i = 0u; i < shadow_maps.get_view_count(); i++)
         {
-            if (i < skyboxes.size())
-            {
-                apply_light_probe(gc, i, skyboxes[i]->get_cubemap());
-            }
-            else
-            {
-                apply_light_probe(gc, i, nullptr);
-            }
+            frame.shadow_matrices[i] = shadow_maps.get_view_projection(i);
+            frame.shadow_tiles[i]    = shadow_maps.get_tile(i);
         }
 
-        // TODO select the most relevant lights.
-        for (unsigned int i = 0u; i < MAX_LIGHTS; i++)
+        const auto& splits = shadow_maps.get_cascade_splits();
+        frame.shadow_cascade_splits = glm::vec4(splits[0], splits[1], splits[2], splits[3]);
+
+        gc.set_uniform(std::to_underlying(UniformLocation::SHADOW_MAP), SHADOW_MAP_SLOT);
+        gc.bind_texture(SHADOW_MAP_SLOT, shadow_atlas != nullptr ? shadow_atlas->get_depth() : nullptr);
+    }
+
+    void SceneRenderer::apply_light_probe(GraphicContext& gc, int i, const SkyBoxProxy* sky_box, FrameBlock& frame)
+    {
+        check(i < MAX_LIGHT_PROBES);
+
+        constexpr auto LIGHT_PROBE_COMPONENTS = 3;
+        constexpr auto LIGHT_PROBE_SLOTS      = 2;
+        constexpr auto LIGHT_ENVIRONMENT_SLOT = 4;
+        constexpr auto LIGHT_SPECULAR_SLOT    = 5;
+
+        auto irradiance = IrradianceSH{};
+        auto probe = sky_box != nullptr ? get_skybox_cubemap(*sky_box) : nullptr;
+        if (probe != nullptr)
+        {
+            auto maps  = genrate_ibl_maps(gc, *sky_box);
+            irradiance = maps.irradiance;
+
+            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_ENABLED,     i * LIGHT_PROBE_COMPONENTS), 1);
+            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_ENVIRONMENT, i * LIGHT_PROBE_COMPONENTS), LIGHT_ENVIRONMENT_SLOT + i * LIGHT_PROBE_SLOTS);
+            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_SPECULAR,    i * LIGHT_PROBE_COMPONENTS), LIGHT_SPECULAR_SLOT    + i * LIGHT_PROBE_SLOTS);
+
+            gc.bind_texture(LIGHT_ENVIRONMENT_SLOT, probe);
+            gc.bind_texture(LIGHT_SPECULAR_SLOT,    maps.specular);
+        }
+        else
         {
-            auto light = i < lights.size() ? lights[i] : nullptr;
-            apply_light(gc, i, light);
+            gc.set_uniform(uniform_location_offset(UniformLocation::LIGHT_PROBE0_ENABLED, i* LIGHT_PROBE_COMPONENTS), 0);
         }
 
-        for (const auto* geometry : geometries)
+        for (auto c = 0; c < IRRADIANCE_COEFFICIENTS; c++)
         {
-            gc.set_uniform(std::to_underlying(UniformLocation::MODEL_MATRIX),  geometry->get_world_transform());
-            apply_material(gc, geometry->get_material());
-            gc.draw(geometry->get_mesh());
+            frame.light_probe_irradiance[i * IRRADIANCE_COEFFICIENTS + c] = glm::vec4(irradiance.coefficients[c], 0.0f);
         }
+    }
 
-        gc.end_pass();
+    constexpr auto BASE_COLOR_SLOT          = 0;
+    constexpr auto METALLIC_ROUGHNESS_SLOT  = 1;
+    constexpr auto NORMAL_SLOT              = 2;
+    constexpr auto EMISSIVE_SLOT            = 3;
+
+    MaterialBlock make_material_block(const Material& material)
+    {
+        return {
+            .base_color_factor = glm::vec4(material.get_base_color_factor(), material.get_opacity_factor()),
+            .emissive_factor   = material.get_emissive_factor(),
+            .metallic_factor   = material.get_metallic_factor(),
+            .roughness_factor  = material.get_roughness_factor()
+        };
     }
 
-    void SceneRenderer::LineRenderer::add_line(const glm::vec3& start, const glm::vec3& end, const glm::vec4& start_color, const glm::vec4& end_color)
+    size_t SceneRenderer::get_material_block(GraphicContext& gc, const std::shared_ptr<Material>& material)
     {
-        line_vertexes.push_back(start);
-        line_vertexes.push_back(end);
+        constexpr auto MIN_MATERIAL_BLOCKS = size_t{64u};
 
-        line_colors.push_back(start_color);
-        line_colors.push_back(end_color);
+        auto& blocks = material_blocks;
 
-        line_indexes.push_back({line_indexes.size() * 2u, line_indexes.size() * 2u + 1u});
-    }
+        auto i = blocks.slots.find(material);
+        if (i != end(blocks.slots))
+        {
+            return i->second * blocks.stride;
+        }
 
-    void SceneRenderer::LineRenderer::render(GraphicContext& gc, const Camera* camera)
-    {
-        if (line_vertexes.empty())
+        if (blocks.stride == 0u)
         {
-            return;
+            auto alignment = gc.get_uniform_buffer_alignment();
+            blocks.stride  = (sizeof(MaterialBlock) + alignment - 1u) / alignment * alignment;
         }
 
-        if (line_vertex_buffer == nullptr)
+        auto slot = blocks.next_slot;
+        if (!blocks.free_slots.empty())
         {
-            line_vertex_buffer = gc.upload_mesh({
-                .vertexes = std::move(line_vertexes),
-                .colors   = std::move(line_colors),
-                .lines    = std::move(line_indexes)
-            }, true);
-            check(line_vertex_buffer);
+            slot = blocks.free_slots.back();
+            blocks.free_slots.pop_back();
         }
         else
         {
-            line_vertex_buffer->update({
-                .vertexes = std::move(line_vertexes),
-                .colors   = std::move(line_colors),
-                .lines    = std::move(line_indexes)
-            });
+            blocks.next_slot++;
         }
+        blocks.slots.emplace(material, slot);
 
-        line_vertexes.clear();
-        line_colors.clear();
-        line_indexes.clear();
+        if (slot >= blocks.capacity)
+        {
+            // materials are immutable, so a new buffer is filled from the live materials
+            blocks.capacity = std::max(MIN_MATERIAL_BLOCKS, blocks.capacity * 2u);
+            blocks.buffer   = gc.create_uniform_buffer(blocks.capacity * blocks.stride);
+            for (const auto& [weak_material, s] : blocks.slots)
+            {
+                if (auto m = weak_material.lock())
+                {
+                    auto block = make_material_block(*m);
+                    blocks.buffer->upload(s * blocks.stride, sizeof(block), &block);
+                }
+            }
+        }
+        else
+        {
+            auto block = make_material_block(*material);
+            blocks.buffer->upload(slot * blocks.stride, sizeof(block), &block);
+        }
+
+        return slot * blocks.stride;
+    }
+
+    void SceneRenderer::collect_material_blocks()
+    {
+        auto& blocks = material_blocks;
+        for (auto i = begin(blocks.slots); i != end(blocks.slots);)
+        {
+            if (i->first.expired())
+            {
+                blocks.free_slots.push_back(i->second);
+                i = blocks.slots.erase(i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    void SceneRenderer::apply_material(GraphicContext& gc, const std::shared_ptr<Material>& material)
+    {
+        check(material);
+
+        auto offset = get_material_block(gc, material);
+        gc.bind_uniform_buffer(std::to_underlying(UniformBinding::MATERIAL), material_blocks.buffer, offset, sizeof(MaterialBlock));
+
+        gc.bind_texture(BASE_COLOR_SLOT,         material->get_base_color_map());
+        gc.bind_texture(METALLIC_ROUGHNESS_SLOT, material->get_metallic_roughness_map());
+        gc.bind_texture(NORMAL_SLOT,             material->get_normal_map(), pkzo::FallbackTexture::NORMAL);
+        gc.bind_texture(EMISSIVE_SLOT,           material->get_emissive_map());
+    }
+
+    void SceneRenderer::update_skybox(GraphicContext& gc, const std::shared_ptr<Texture>& texture)
+    {
+        if (!sky_update || sky_update->texture != texture)
+        {
+            // The irradiance projection only reads memory and runs on a worker,
+            // a texture without memory is downloaded when the update completes.
+            auto launch = texture->get_memory() != nullptr ? std::launch::async : std::launch::deferred;
+
+            sky_update = SkyUpdate{
+                .texture     = texture,
+                .environment = std::make_unique<IncrementalCubeMapGenerator>(IncrementalCubeMapGenerator::Init{
+                    .generator = make_cubemap_generator(cubemap_generator_shader, texture, ENVIRONMENT_MIPS),
+                    .budget    = SKY_UPDATE_BUDGET
+                }),
+                .irradiance  = std::async(launch, [texture] () { return project_irradiance(texture); })
+            };
+        }
+
+        if (sky_update->specular == nullptr)
+        {
+            if (sky_update->environment->update(gc))
+            {
+                sky_update->specular = std::make_unique<IncrementalCubeMapGenerator>(IncrementalCubeMapGenerator::Init{
+                    .generator = make_cubemap_generator(cubemap_specular_filter_shader, sky_update->environment->get_cubemap(), SPECULAR_MIPS),
+                    .budget    = SKY_UPDATE_BUDGET
+                });
+            }
+            return;
+        }
+
+        if (!sky_update->specular->update(gc))
+        {
+            return;
+        }
+
+        // swap in the sky and its light probe maps together
+        auto environment = sky_update->environment->get_cubemap();
+        ibl_cache.try_emplace(environment, IblMaps{sky_update->irradiance.get(), sky_update->specular->get_cubemap()});
+        skybox_cubemap = environment;
+        skybox_texture = texture;
+        sky_update.reset();
+
+        std::erase_if(ibl_cache,    [] (const auto& entry) { return entry.first.expired(); });
+        std::erase_if(cubemap_keys, [] (const auto& entry) { return entry.first.expired(); });
+    }
+
+    void SceneRenderer::render_skybox(pkzo::GraphicContext& gc, const CameraProxy& camera)
+    {
+        constexpr auto SKYBOX_SLOT = 0;
+
+        check(!front_snapshot.skyboxes.empty());
+        const auto& skybox = front_snapshot.skyboxes[0];
+
+        if (skybox.id != skybox_id)
+        {
+            skybox_id = skybox.id;
+            skybox_cubemap.reset();
+            skybox_texture.reset();
+            sky_update.reset();
+        }
+
+        if (get_skybox_cubemap(skybox) == nullptr)
+        {
+            auto texture = skybox.texture;
+
+            auto key = std::optional<uint64_t>{};
+            if (gc.get_cubemap_cache().is_enabled())
+            {
+                auto hash = ContentHash{hash_texture(texture)};
+                hash.add("environment");
+                hash.add_value(gc.get_api());
+                hash.add_value(CUBEMAP_SIZE);
+                hash.add_value(ENVIRONMENT_MIPS);
+                hash.add_value(cubemap_generator_version);
+                key = hash.get();
+            }
+
+            // nothing to show yet, the first cube map is generated at once
+            skybox_cubemap = load_or_generate_cubemap(gc, key, cubemap_generator_shader, texture, ENVIRONMENT_MIPS);
+            skybox_texture = texture;
+        }
+        else if (skybox.cubemap == nullptr && skybox.texture != nullptr && skybox.texture != skybox_texture.lock())
+        {
+            // the texture changed, the current sky is shown until the new one is complete
+            update_skybox(gc, skybox.texture);
+        }
+
+        gc.start_pass("Skybox", skybox_shader);
+        gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+        gc.set_depth_test(pkzo::DepthTest::DISABLED);
+
+        apply_camera(gc, camera);
+
+        gc.set_uniform(std::to_underlying(UniformLocation::ENVIRONMENT), SKYBOX_SLOT);
+
+        gc.bind_texture(SKYBOX_SLOT, get_skybox_cubemap(skybox));
+
+        gc.draw_fullscreen();
+
+        gc.end_pass();
+
+    }
+
+    // Projected diameter of the bounding sphere, relative to the viewport height.
+    float get_screen_size(const glm::mat4& projection, const glm::vec3& eye, const Bounds3& bounds)
+    {
+        const auto radius   = glm::length(bounds.get_size()) * 0.5f;
+        const auto distance = glm::distance(eye, bounds.get_center());
+        if (distance <= radius)
+        {
+            return std::numeric_limits<float>::max();
+        }
+        return radius * projection[1][1] / distance;
+    }
+
+    // Only the largest occluders on screen are rasterized, small ones hide little.
+    constexpr auto MAX_OCCLUDERS = 32u;
+
+    // Rasterizes the occluders in view, false if there are none.
+    bool SceneRenderer::render_occluders(const CameraProxy& camera)
+    {
+        const auto& snapshot   = front_snapshot;
+        const auto  projection = camera.projection;
+        const auto  eye        = glm::vec3(camera.transform[3]);
+        const auto  frustum    = Frustum(projection * camera.view);
+
+        occluders.clear();
+        for (const auto i : snapshot.occluders)
+        {
+            const auto& geometry = snapshot.geometries[i];
+            const auto& material = geometry.material;
+            if (material == nullptr || material->get_opacity_factor() < 1.0f)
+            {
+                continue;
+            }
+
+            const auto bounds = transform(geometry.transform, geometry.bounds);
+            if (geometry.bounds.get_size() != glm::vec3(0.0f) && !frustum.intersects(bounds))
+            {
+                continue;
+            }
+
+            occluders.push_back({get_screen_size(projection, eye, bounds), &geometry});
+        }
+
+        const auto count = std::min<size_t>(occluders.size(), MAX_OCCLUDERS);
+        std::partial_sort(begin(occluders), begin(occluders) + count, end(occluders), [] (const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+
+        occlusion_buffer.begin(projection * camera.view);
+        for (auto i = 0u; i < count; i++)
+        {
+            const auto* geometry = occluders[i].second;
+            occlusion_buffer.add_occluder(*geometry->occluder, geometry->transform);
+        }
+        occlusion_buffer.end();
+
+        return count != 0u;
+    }
+
+    // Sort key layout, most significant first:
+    //
+    //   opaque:      shader (8) | material (16) | mesh (16) | depth (24)
+    //   transparent: shader (8) | ~depth (24) | material (16) | mesh (16)
+    //
+    // Opaque draws are grouped by state and front to back within a group,
+    // transparent draws are strictly back to front.
+    constexpr auto SORT_KEY_SHADER_BITS   = 8u;
+    constexpr auto SORT_KEY_MATERIAL_BITS = 16u;
+    constexpr auto SORT_KEY_MESH_BITS     = 16u;
+    constexpr auto SORT_KEY_DEPTH_BITS    = 24u;
+    static_assert(SORT_KEY_SHADER_BITS + SORT_KEY_MATERIAL_BITS + SORT_KEY_MESH_BITS + SORT_KEY_DEPTH_BITS == 64u);
+
+    constexpr auto FORWARD_SHADER_ID = uint64_t{0u};
+
+    constexpr uint64_t sort_key_mask(unsigned int bits)
+    {
+        return (uint64_t{1u} << bits) - 1u;
+    }
+
+    // Non negative floats compare like their bit pattern, keep the top bits.
+    uint64_t quantize_depth(float depth)
+    {
+        auto bits = std::bit_cast<uint32_t>(std::max(depth, 0.0f));
+        return bits >> (32u - SORT_KEY_DEPTH_BITS);
+    }
+
+    uint64_t make_opaque_key(uint64_t shader, uint64_t material, uint64_t mesh, uint64_t depth)
+    {
+        auto key = shader & sort_key_mask(SORT_KEY_SHADER_BITS);
+        key = (key << SORT_KEY_MATERIAL_BITS) | (material & sort_key_mask(SORT_KEY_MATERIAL_BITS));
+        key = (key << SORT_KEY_MESH_BITS)     | (mesh     & sort_key_mask(SORT_KEY_MESH_BITS));
+        key = (key << SORT_KEY_DEPTH_BITS)    | (depth    & sort_key_mask(SORT_KEY_DEPTH_BITS));
+        return key;
+    }
+
+    uint64_t make_transparent_key(uint64_t shader, uint64_t material, uint64_t mesh, uint64_t depth)
+    {
+        auto key = shader & sort_key_mask(SORT_KEY_SHADER_BITS);
+        key = (key << SORT_KEY_DEPTH_BITS)    | (~depth   & sort_key_mask(SORT_KEY_DEPTH_BITS));
+        key = (key << SORT_KEY_MATERIAL_BITS) | (material & sort_key_mask(SORT_KEY_MATERIAL_BITS));
+        key = (key << SORT_KEY_MESH_BITS)     | (mesh     & sort_key_mask(SORT_KEY_MESH_BITS));
+        return key;
+    }
+
+    std::shared_ptr<Mesh> get_lod_mesh(const GeometryProxy* geometry, size_t lod)
+    {
+        return lod == 0u ? geometry->mesh : geometry->lods.at(lod - 1u).mesh;
+    }
+
+    // Shadows use the level of the camera, casters out of view keep their last level.
+    size_t SceneRenderer::get_lod(const GeometryProxy* geometry) const
+    {
+        if (geometry->lods.empty())
+        {
+            return 0u;
+        }
+
+        auto i = lod_levels.find(geometry->id);
+        return i != lod_levels.end() ? i->second : 0u;
+    }
+
+    // geometries culled and recorded by one job, fewer are not worth waking a worker
+    constexpr auto MIN_RECORD_JOB_SIZE = size_t{256u};
+
+    WorkerPool& SceneRenderer::get_workers()
+    {
+        if (!workers)
+        {
+            workers = std::make_unique<WorkerPool>(std::max(std::thread::hardware_concurrency(), 1u) - 1u);
+        }
+        return *workers;
+    }
+
+    // The geometries are culled, their level of detail is selected and their
+    // draws are recorded on the workers. The jobs only read the snapshot, its
+    // draw tables, the occlusion buffer and the levels of detail of the last
+    // frame. Only the occluders are rasterized up front and the changed levels
+    // are stored after the jobs, the level map is shared with the shadows.
+    void SceneRenderer::record_draws(const CameraProxy& camera)
+    {
+        const auto& geometries = front_snapshot.geometries;
+        const auto  projection = camera.projection;
+        const auto  view       = camera.view;
+        const auto  eye        = glm::vec3(camera.transform[3]);
+        const auto  frustum    = Frustum(projection * view);
+        const auto  occlusion  = occlusion_culling && render_occluders(camera);
+
+        const auto threads = size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+        const auto jobs    = std::clamp(geometries.size() / MIN_RECORD_JOB_SIZE, size_t{1u}, threads);
+        if (record_jobs.size() < jobs)
+        {
+            record_jobs.resize(jobs);
+        }
+
+        auto record = [&] (size_t job) {
+            auto& result = record_jobs[job];
+            result.opaque.clear();
+            result.transparent.clear();
+            result.stats = {};
+            result.lods.clear();
+
+            const auto first = geometries.size() * job / jobs;
+            const auto last  = geometries.size() * (job + 1u) / jobs;
+            for (auto i = first; i < last; i++)
+            {
+                const auto& geometry = geometries[i];
+                const auto  bounds   = transform(geometry.transform, geometry.bounds);
+                result.stats.tested++;
+
+                // geometry without bounds can not be culled, occluders do
+                // not hide themselves, their bounds enclose them
+                if (geometry.bounds.get_size() != glm::vec3(0.0f))
+                {
+                    if (!frustum.intersects(bounds))
+                    {
+                        result.stats.culled++;
+                        continue;
+                    }
+                    if (occlusion && occlusion_buffer.is_occluded(bounds))
+                    {
+                        result.stats.occluded++;
+                        continue;
+                    }
+                }
+
+                auto lod = size_t{0u};
+                if (!geometry.lods.empty())
+                {
+                    const auto current = get_lod(&geometry);
+                    lod = select_lod(geometry.lods, get_screen_size(projection, eye, bounds), current);
+                    if (lod != current)
+                    {
+                        result.lods.push_back({&geometry, lod});
+                    }
+                }
+
+                const auto& material = geometry.material;
+                const auto  mesh     = geometry.mesh_ids.at(lod);
+                const auto  depth    = quantize_depth(-(view * glm::vec4(bounds.get_center(), 1.0f)).z);
+                if (material != nullptr && material->get_opacity_factor() < 1.0f)
+                {
+                    result.transparent.draw(make_transparent_key(FORWARD_SHADER_ID, geometry.material_id, mesh, depth), geometry.material_id, mesh, geometry.transform);
+                }
+                else
+                {
+                    result.opaque.draw(make_opaque_key(FORWARD_SHADER_ID, geometry.material_id, mesh, depth), geometry.material_id, mesh, geometry.transform);
+                }
+            }
+        };
+
+        // small scenes never pay for the threads
+        if (jobs == 1u)
+        {
+            record(0u);
+        }
+        else
+        {
+            get_workers().parallel_for(jobs, record);
+        }
+
+        cull_stats = {};
+        opaque_commands.clear();
+        transparent_commands.clear();
+        for (auto job = size_t{0u}; job < jobs; job++)
+        {
+            const auto& result = record_jobs[job];
+            cull_stats.tested   += result.stats.tested;
+            cull_stats.culled   += result.stats.culled;
+            cull_stats.occluded += result.stats.occluded;
+
+            for (const auto& [geometry, level] : result.lods)
+            {
+                if (!geometry->dynamic)
+                {
+                    // the cached shadows use the level too
+                    lod_changes++;
+                }
+                lod_levels[geometry->id] = level;
+            }
+
+            opaque_commands.append(result.opaque);
+            transparent_commands.append(result.transparent);
+        }
+        opaque_commands.sort();
+        transparent_commands.sort();
+    }
+
+    FrameBlock make_frame_block(const CameraProxy& camera)
+    {
+        return {
+            .projection_matrix              = camera.projection,
+            .view_matrix                    = camera.view,
+            .inverse_view_projection_matrix = glm::inverse(camera.projection * camera.view)
+        };
+    }
+
+    // The frame block, lights and light probes of a lit pass.
+    void SceneRenderer::apply_frame(GraphicContext& gc, const CameraProxy& camera)
+    {
+        auto frame = make_frame_block(camera);
+        apply_lights(gc, frame);
+        apply_shadows(gc, frame);
+
+        for (auto i = 0u; i < MAX_LIGHT_PROBES; i++)
+        {
+            if (i < front_snapshot.skyboxes.size())
+            {
+                apply_light_probe(gc, i, &front_snapshot.skyboxes[i], frame);
+            }
+            else
+            {
+                apply_light_probe(gc, i, nullptr, frame);
+            }
+        }
+
+        gc.set_uniform_buffer(std::to_underlying(UniformBinding::FRAME), frame);
+    }
+
+    void apply_material_maps(GraphicContext& gc)
+    {
+        gc.set_uniform(std::to_underlying(UniformLocation::BASE_COLOR_MAP),         BASE_COLOR_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::METALLIC_ROUGHNESS_MAP), METALLIC_ROUGHNESS_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::NORMAL_MAP),             NORMAL_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::EMISSIVE_MAP),           EMISSIVE_SLOT);
+    }
+
+    void SceneRenderer::render_forward(pkzo::GraphicContext& gc, const CameraProxy& camera)
+    {
+        gc.start_pass("Forward", forward_shader);
+
+        apply_frame(gc, camera);
+        apply_material_maps(gc);
+
+        collect_material_blocks();
+
+        gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+        gc.set_depth_test(pkzo::DepthTest::ENABLED);
+        draw(gc, opaque_commands);
+
+        gc.set_blend_mode(pkzo::BlendMode::ALPHA);
+        gc.set_depth_test(pkzo::DepthTest::READ);
+        draw(gc, transparent_commands);
+
+        gc.end_pass();
+    }
+
+    void SceneRenderer::render_geometry_buffer(pkzo::GraphicContext& gc, const CameraProxy& camera)
+    {
+        const auto size = gc.get_viewport().size;
+        if (geometry_buffer == nullptr || geometry_buffer->get_size() != size)
+        {
+            // the layout must match GBuffer.frag
+            geometry_buffer = gc.create_frame_buffer({
+                .id     = "Geometry Buffer",
+                .size   = size,
+                .depth  = pkzo::DataType::FLOAT,
+                .colors = {
+                    {pkzo::DataType::UNSIGNED_BYTE, pkzo::ColorMode::RGBA}, // base color
+                    {pkzo::DataType::FLOAT,         pkzo::ColorMode::RGBA}, // normal
+                    {pkzo::DataType::UNSIGNED_BYTE, pkzo::ColorMode::RGBA}, // metallic, roughness
+                    {pkzo::DataType::FLOAT,         pkzo::ColorMode::RGBA}  // emissive
+                }
+            });
+        }
+
+        gc.start_pass("Geometry Buffer", geometry_buffer_shader, geometry_buffer);
+        gc.clear_screen();
+
+        gc.set_uniform_buffer(std::to_underlying(UniformBinding::FRAME), make_frame_block(camera));
+        apply_material_maps(gc);
+
+        collect_material_blocks();
+
+        gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+        gc.set_depth_test(pkzo::DepthTest::ENABLED);
+        draw(gc, opaque_commands);
+
+        gc.end_pass();
+    }
+
+    // Opaque geometry is written to the geometry buffer and lit in one full
+    // screen pass, so overdraw costs no lighting. Transparent geometry needs
+    // the surface behind it and is drawn forward on top.
+    void SceneRenderer::render_deferred(pkzo::GraphicContext& gc, const CameraProxy& camera)
+    {
+        // slots 4 and 5 hold the light probe
+        constexpr auto GBUFFER_BASE_COLOR_SLOT         = 0;
+        constexpr auto GBUFFER_NORMAL_SLOT             = 1;
+        constexpr auto GBUFFER_METALLIC_ROUGHNESS_SLOT = 2;
+        constexpr auto GBUFFER_EMISSIVE_SLOT           = 3;
+        constexpr auto GBUFFER_DEPTH_SLOT              = 6;
+
+        render_geometry_buffer(gc, camera);
+
+        gc.start_pass("Deferred Lighting", deferred_lighting_shader);
+
+        apply_frame(gc, camera);
+
+        gc.set_uniform(std::to_underlying(UniformLocation::GBUFFER_BASE_COLOR),         GBUFFER_BASE_COLOR_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::GBUFFER_NORMAL),             GBUFFER_NORMAL_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::GBUFFER_METALLIC_ROUGHNESS), GBUFFER_METALLIC_ROUGHNESS_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::GBUFFER_EMISSIVE),           GBUFFER_EMISSIVE_SLOT);
+        gc.set_uniform(std::to_underlying(UniformLocation::GBUFFER_DEPTH),              GBUFFER_DEPTH_SLOT);
+
+        gc.bind_texture(GBUFFER_BASE_COLOR_SLOT,         geometry_buffer->get_color(0u));
+        gc.bind_texture(GBUFFER_NORMAL_SLOT,             geometry_buffer->get_color(1u));
+        gc.bind_texture(GBUFFER_METALLIC_ROUGHNESS_SLOT, geometry_buffer->get_color(2u));
+        gc.bind_texture(GBUFFER_EMISSIVE_SLOT,           geometry_buffer->get_color(3u));
+        gc.bind_texture(GBUFFER_DEPTH_SLOT,              geometry_buffer->get_depth());
+
+        // the lighting writes the depth of the geometry buffer for the transparent geometry
+        gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+        gc.set_depth_test(pkzo::DepthTest::ENABLED);
+        gc.draw_fullscreen();
+
+        gc.end_pass();
+
+        if (!transparent_commands.empty())
+        {
+            gc.start_pass("Forward", forward_shader);
+
+            apply_frame(gc, camera);
+            apply_material_maps(gc);
+
+            gc.set_blend_mode(pkzo::BlendMode::ALPHA);
+            gc.set_depth_test(pkzo::DepthTest::READ);
+            draw(gc, transparent_commands);
+
+            gc.end_pass();
+        }
+    }
+
+    // runs shorter than this are not worth the instance buffer upload
+    constexpr auto MIN_INSTANCED_RUN = size_t{2u};
+
+    void SceneRenderer::draw(pkzo::GraphicContext& gc, const CommandBuffer& commands)
+    {
+        // The material and mesh are part of the sort key, so commands
+        // that share both are adjacent and can be drawn instanced.
+        const auto& draws = commands.get_commands();
+
+        auto current_material = std::numeric_limits<uint32_t>::max();
+
+        auto i = size_t{0u};
+        while (i < draws.size())
+        {
+            const auto material = draws[i].state;
+            const auto mesh     = draws[i].mesh;
+
+            auto end = i + 1u;
+            while (end < draws.size() && draws[end].state == material && draws[end].mesh == mesh)
+            {
+                end++;
+            }
+
+            if (material != current_material)
+            {
+                apply_material(gc, front_snapshot.materials.at(material));
+                current_material = material;
+            }
+
+            if ((end - i) >= MIN_INSTANCED_RUN)
+            {
+                instance_transforms.clear();
+                for (auto j = i; j < end; j++)
+                {
+                    instance_transforms.push_back(draws[j].transform);
+                }
+                gc.set_uniform_buffer(std::to_underlying(UniformBinding::OBJECT), ObjectBlock{.model_matrix = glm::mat4(1.0f), .instanced = 1});
+                gc.draw_instanced(front_snapshot.meshes.at(mesh), instance_transforms);
+            }
+            else
+            {
+                for (auto j = i; j < end; j++)
+                {
+                    gc.set_uniform_buffer(std::to_underlying(UniformBinding::OBJECT), ObjectBlock{.model_matrix = draws[j].transform, .instanced = 0});
+                    gc.draw(front_snapshot.meshes.at(mesh));
+                }
+            }
+
+            i = end;
+        }
+    }
+
+    // Draws the casters in the view frustum, instanced by mesh.
+    void SceneRenderer::draw_shadow_casters(GraphicContext& gc, const glm::mat4& view_projection, const std::vector<const GeometryProxy*>& casters)
+    {
+        const auto frustum = Frustum(view_projection);
+
+        shadow_draws.clear();
+        for (const auto* geometry : casters)
+        {
+            const auto& bounds = geometry->bounds;
+            if (bounds.get_size() == glm::vec3(0.0f) || frustum.intersects(transform(geometry->transform, bounds)))
+            {
+                const auto lod = get_lod(geometry);
+                shadow_draws.push_back({reinterpret_cast<uintptr_t>(get_lod_mesh(geometry, lod).get()), geometry, lod});
+            }
+        }
+        radix_sort(shadow_draws, sort_buffer);
+        shadow_stats.casters += shadow_draws.size();
+
+        gc.set_uniform_buffer(std::to_underlying(UniformBinding::FRAME), FrameBlock{.projection_matrix = view_projection, .view_matrix = glm::mat4(1.0f)});
+
+        auto i = size_t{0u};
+        while (i < shadow_draws.size())
+        {
+            const auto mesh = get_lod_mesh(shadow_draws[i].geometry, shadow_draws[i].lod);
+
+            auto end = i + 1u;
+            while (end < shadow_draws.size() && shadow_draws[end].key == shadow_draws[i].key)
+            {
+                end++;
+            }
+
+            if ((end - i) >= MIN_INSTANCED_RUN)
+            {
+                instance_transforms.clear();
+                for (auto j = i; j < end; j++)
+                {
+                    instance_transforms.push_back(shadow_draws[j].geometry->transform);
+                }
+                gc.set_uniform_buffer(std::to_underlying(UniformBinding::OBJECT), ObjectBlock{.model_matrix = glm::mat4(1.0f), .instanced = 1});
+                gc.draw_instanced(mesh, instance_transforms);
+            }
+            else
+            {
+                gc.set_uniform_buffer(std::to_underlying(UniformBinding::OBJECT), ObjectBlock{.model_matrix = shadow_draws[i].geometry->transform, .instanced = 0});
+                gc.draw(mesh);
+            }
+
+            i = end;
+        }
+    }
+
+    // The static geometry is rendered into a shadow map per view, which is
+    // kept until the view or the static geometry changes. Each frame the
+    // cached maps are copied into the atlas and the bodies are drawn on top,
+    // so only moving geometry costs draw calls in a steady scene.
+    void SceneRenderer::render_shadows(GraphicContext& gc)
+    {
+        constexpr auto STATIC_SHADOW_SLOT = 0;
+
+        shadow_stats = {};
+
+        const auto view_count = shadow_maps.get_view_count();
+        if (view_count == 0u)
+        {
+            return;
+        }
+
+        const auto tile_size = glm::uvec2(shadow_maps.get_tile_size());
+        if (shadow_atlas == nullptr)
+        {
+            shadow_atlas = gc.create_frame_buffer({
+                .id     = "Shadow Atlas",
+                .size   = shadow_maps.get_atlas_size(),
+                .depth  = pkzo::DataType::FLOAT,
+                .colors = {}
+            });
+        }
+
+        const auto viewport = gc.get_viewport();
+
+        static_casters.clear();
+        dynamic_casters.clear();
+        for (const auto& geometry : front_snapshot.geometries)
+        {
+            if (geometry.dynamic)
+            {
+                dynamic_casters.push_back(&geometry);
+            }
+            else
+            {
+                static_casters.push_back(&geometry);
+            }
+        }
+
+        // level of detail changes of static casters are seen by the renderer only
+        const auto version = front_snapshot.static_version + lod_changes;
+
+        for (auto i = 0u; i < view_count; i++)
+        {
+            const auto& view_projection = shadow_maps.get_view_projection(i);
+
+            auto& cache = static_shadows[i];
+            if (cache.buffer != nullptr && cache.version == version && cache.view_projection == view_projection)
+            {
+                continue;
+            }
+
+            if (cache.buffer == nullptr)
+            {
+                cache.buffer = gc.create_frame_buffer({
+                    .id     = tfm::format("Static Shadow %d", i),
+                    .size   = tile_size,
+                    .depth  = pkzo::DataType::FLOAT,
+                    .colors = {}
+                });
+            }
+
+            gc.start_pass("Static Shadow", shadow_shader, cache.buffer);
+            gc.set_viewport({.size = tile_size});
+            gc.clear_screen();
+
+            gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+            gc.set_depth_test(pkzo::DepthTest::ENABLED);
+            draw_shadow_casters(gc, view_projection, static_casters);
+
+            gc.end_pass();
+
+            cache.view_projection = view_projection;
+            cache.version         = version;
+            shadow_stats.static_updates++;
+        }
+
+        gc.start_pass("Shadow Atlas", shadow_copy_shader, shadow_atlas);
+        gc.set_viewport({.size = shadow_atlas->get_size()});
+        gc.clear_screen();
+
+        gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+        gc.set_depth_test(pkzo::DepthTest::ENABLED);
+        gc.set_uniform(std::to_underlying(UniformLocation::TEXTURE), STATIC_SHADOW_SLOT);
+        for (auto i = 0u; i < view_count; i++)
+        {
+            gc.set_viewport({.position = shadow_maps.get_tile_offset(i), .size = tile_size});
+            gc.bind_texture(STATIC_SHADOW_SLOT, static_shadows[i].buffer->get_depth());
+            gc.draw_fullscreen();
+        }
+
+        gc.end_pass();
+
+        if (!dynamic_casters.empty())
+        {
+            gc.start_pass("Dynamic Shadow", shadow_shader, shadow_atlas);
+
+            gc.set_blend_mode(pkzo::BlendMode::DISABLED);
+            gc.set_depth_test(pkzo::DepthTest::ENABLED);
+            for (auto i = 0u; i < view_count; i++)
+            {
+                gc.set_viewport({.position = shadow_maps.get_tile_offset(i), .size = tile_size});
+                draw_shadow_casters(gc, shadow_maps.get_view_projection(i), dynamic_casters);
+            }
+
+            gc.end_pass();
+        }
+
+        gc.set_viewport(viewport);
+        shadow_stats.views = view_count;
+    }
+
+    void SceneRenderer::LineRenderer::render(GraphicContext& gc, const std::vector<glm::vec3>& vertexes, const std::vector<glm::vec4>& colors, const CameraProxy& camera)
+    {
+        if (vertexes.empty())
+        {
+            return;
+        }
+
+        auto lines = std::vector<glm::uvec2>(vertexes.size() / 2u);
+        for (auto i = 0u; i < lines.size(); i++)
+        {
+            lines[i] = {i * 2u, i * 2u + 1u};
+        }
+
+        if (line_vertex_buffer == nullptr)
+        {
+            line_vertex_buffer = gc.upload_mesh({
+                .vertexes = vertexes,
+                .colors   = colors,
+                .lines    = std::move(lines)
+            }, true);
+            check(line_vertex_buffer);
+        }
+        else
+        {
+            line_vertex_buffer->update({
+                .vertexes = vertexes,
+                .colors   = colors,
+                .lines    = std::move(lines)
+            });
+        }
 
         if (line_shader == nullptr)
         {
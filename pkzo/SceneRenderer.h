@@ -21,15 +21,31 @@
 
 #pragma once
 
+#include <array>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <rsig/rsig.h>
 
 #include <pkzo/GraphicContext.h>
 #include <pkzo/Shader.h>
 #include <pkzo/CubeMap.h>
+#include <pkzo/FrameBuffer.h>
 #include <pkzo/Mesh.h>
 
 #include "api.h"
+#include "CommandBuffer.h"
+#include "IncrementalCubeMapGenerator.h"
+#include "LightClusters.h"
+#include "OcclusionBuffer.h"
+#include "RenderProxies.h"
+#include "ShadowMaps.h"
+#include "SphericalHarmonics.h"
+#include "UniformBlocks.h"
 
 namespace pkzo
 {
@@ -38,6 +54,7 @@ namespace pkzo
     class Geometry;
     class Light;
     class Material;
+    class WorkerPool;
 
     using pkzo::GraphicContext;
     using pkzo::Shader;
@@ -47,6 +64,27 @@ namespace pkzo
     class PKZO_EXPORT SceneRenderer
     {
     public:
+        struct CullStats
+        {
+            size_t tested   = 0u;
+            size_t culled   = 0u;
+            size_t occluded = 0u; //!< Culled behind occluders, not counted in culled.
+        };
+
+        struct ShadowStats
+        {
+            size_t views          = 0u; //!< Shadow views in the atlas.
+            size_t static_updates = 0u; //!< Views whose cached static shadow map was rendered.
+            size_t casters        = 0u; //!< Shadow casters drawn, static and dynamic.
+        };
+
+        //! How opaque geometry is lit.
+        enum class RenderMode
+        {
+            FORWARD,  //!< Every fragment drawn is lit.
+            DEFERRED  //!< The surfaces are written to a geometry buffer and only the visible pixels are lit.
+        };
+
         SceneRenderer();
 
         ~SceneRenderer();
@@ -66,49 +104,215 @@ namespace pkzo
         void add(Light* light);
         void remove(Light* light);
 
+        //! Copy the renderable state of the scene into a new snapshot.
+        //!
+        //! Runs on the thread that changes the scene. The new snapshot
+        //! replaces the rendered one once a render in progress is done.
+        void extract();
+
+        //! Render the last extracted snapshot.
+        //!
+        //! May run on another thread than extract(), it does not touch the scene.
         void render(GraphicContext& gc);
 
+        //! Culling statistics of the last rendered frame.
+        const CullStats& get_cull_stats() const;
+
+        //! Shadow statistics of the last rendered frame.
+        const ShadowStats& get_shadow_stats() const;
+
+        //! Selects how opaque geometry is lit, `RenderMode::FORWARD` by default.
+        void set_render_mode(RenderMode mode);
+        RenderMode get_render_mode() const;
+
+        //! Cull geometry hidden behind the occluders of opaque geometry, off by default.
+        //!
+        //! See `Geometry::get_occluder`.
+        void set_occlusion_culling(bool value);
+        bool get_occlusion_culling() const;
+
     private:
-        std::vector<Camera*>   cameras;
-        std::vector<SkyBox*>   skyboxes;
-        std::vector<Geometry*> geometries;
-        std::vector<Light*>    lights;
+        // the scene side, used by the thread that changes the scene
+        std::vector<Camera*>     cameras;
+        std::vector<SkyBox*>     skyboxes;
+        std::vector<Geometry*>   geometries;
+        std::vector<Light*>      lights;
+        std::vector<const void*> removed_geometries;
+        std::vector<glm::vec3>   line_vertexes;
+        std::vector<glm::vec4>   line_colors;
+
+        // geometry of bodies moves and casts shadows every frame, the shadows
+        // of all other geometry are cached until it moves; nodes in a transform
+        // store are not notified when an ancestor moves, their world transform
+        // is compared on extraction instead
+        struct StaticGeometry
+        {
+            rsig::slot move_slot;
+            glm::mat4  transform = glm::mat4(1.0f);
+        };
+        std::map<const Geometry*, StaticGeometry> static_geometries;
+        uint64_t                                  static_version = 0u;
+
+        // indexes of the draw tables of the snapshot being extracted
+        std::unordered_map<const Material*, uint32_t> material_ids;
+        std::unordered_map<const Mesh*, uint32_t>     mesh_ids;
+
+        // extract fills the back snapshot and swaps it to the front, render
+        // holds the mutex while it draws the front snapshot; front_pending is
+        // set until the front snapshot was rendered
+        RenderSnapshot back_snapshot;
+        RenderSnapshot front_snapshot;
+        bool           front_pending = false;
+        std::mutex     snapshot_mutex;
+
+        RenderMode render_mode = RenderMode::FORWARD;
+
+        CullStats cull_stats;
+
+        // occlusion culling, the occluders are sorted by screen size
+        bool                                                occlusion_culling = false;
+        OcclusionBuffer                                     occlusion_buffer;
+        std::vector<std::pair<float, const GeometryProxy*>> occluders;
+
+        // the geometries are culled and their draws recorded on the workers,
+        // each job fills its own command buffers, statistics and changed levels
+        // of detail; the workers are only started once a frame has enough
+        // geometries to split
+        struct RecordJob
+        {
+            CommandBuffer                                        opaque;
+            CommandBuffer                                        transparent;
+            CullStats                                            stats;
+            std::vector<std::pair<const GeometryProxy*, size_t>> lods;
+        };
+        std::unique_ptr<WorkerPool> workers;
+        std::vector<RecordJob>      record_jobs;
+        CommandBuffer               opaque_commands;
+        CommandBuffer               transparent_commands;
+
+        struct DrawItem
+        {
+            uint64_t             key;
+            const GeometryProxy* geometry;
+            size_t               lod;
+        };
+        std::vector<DrawItem>  sort_buffer;
+        std::vector<glm::mat4> instance_transforms;
+
+        // level of detail of the geometries with levels, kept for the hysteresis,
+        // changes of static casters count towards the cached shadows
+        std::unordered_map<const void*, size_t> lod_levels;
+        uint64_t                                lod_changes = 0u;
+
+        LightClusters                           light_clusters;
+        std::array<LightData, MAX_LIGHTS>       global_lights;
+        std::vector<LightData>                  cluster_lights;
+        std::vector<LightClusters::LightVolume> light_volumes;
+
+        ShadowMaps                   shadow_maps;
+        ShadowStats                  shadow_stats;
+        std::shared_ptr<FrameBuffer> shadow_atlas;
+        std::vector<DrawItem>        shadow_draws;
+
+        std::vector<const GeometryProxy*> static_casters;
+        std::vector<const GeometryProxy*> dynamic_casters;
+
+        // shadow maps of the static geometry, per atlas view
+        struct StaticShadow
+        {
+            std::shared_ptr<FrameBuffer> buffer;
+            glm::mat4                    view_projection = glm::mat4(0.0f);
+            std::optional<uint64_t>      version;
+        };
+        std::array<StaticShadow, MAX_SHADOW_VIEWS> static_shadows;
+
+        // material blocks are uploaded once and bound by offset
+        struct MaterialBlocks
+        {
+            std::shared_ptr<UniformBuffer>                                buffer;
+            size_t                                                        stride    = 0u;
+            size_t                                                        capacity  = 0u;
+            size_t                                                        next_slot = 0u;
+            std::vector<size_t>                                           free_slots;
+            std::map<std::weak_ptr<Material>, size_t, std::owner_less<>> slots;
+        } material_blocks;
 
         std::shared_ptr<Shader> forward_shader;
+        std::shared_ptr<Shader> geometry_buffer_shader;
+        std::shared_ptr<Shader> deferred_lighting_shader;
+        std::shared_ptr<Shader> shadow_shader;
+        std::shared_ptr<Shader> shadow_copy_shader;
         std::shared_ptr<Shader> skybox_shader;
         std::shared_ptr<Shader> cubemap_generator_shader;
-        std::shared_ptr<Shader> cubemap_diffuse_filter_shader;
         std::shared_ptr<Shader> cubemap_specular_filter_shader;
 
+        // base color, normal, metallic/roughness and emissive of the deferred mode
+        std::shared_ptr<FrameBuffer> geometry_buffer;
+
+        // hashes of the generator sources, part of the cube map cache keys
+        uint64_t cubemap_generator_version       = 0u;
+        uint64_t cubemap_specular_filter_version = 0u;
+
+        // cache keys of the generated cube maps, the keys of maps filtered from them derive from these
+        std::map<std::weak_ptr<CubeMap>, uint64_t, std::owner_less<>> cubemap_keys;
+
         struct IblMaps
         {
-            std::shared_ptr<CubeMap> diffuse;
+            IrradianceSH             irradiance;
             std::shared_ptr<CubeMap> specular;
         };
         std::map<std::weak_ptr<CubeMap>, IblMaps, std::owner_less<>> ibl_cache;
 
-        struct LineRenderer
+        // the cube map generated here for a sky box without one and its source texture
+        const void*              skybox_id = nullptr;
+        std::shared_ptr<CubeMap> skybox_cubemap;
+        std::weak_ptr<Texture>   skybox_texture;
+
+        // a changed sky box texture is captured and filtered over several frames
+        struct SkyUpdate
         {
-            std::vector<glm::vec3>  line_vertexes;
-            std::vector<glm::vec4>  line_colors;
-            std::vector<glm::uvec2> line_indexes;
+            std::shared_ptr<Texture>                     texture;
+            std::unique_ptr<IncrementalCubeMapGenerator> environment;
+            std::unique_ptr<IncrementalCubeMapGenerator> specular;
+            std::future<IrradianceSH>                    irradiance;
+        };
+        std::optional<SkyUpdate> sky_update;
 
+        struct LineRenderer
+        {
             std::shared_ptr<Mesh>   line_vertex_buffer;
             std::shared_ptr<Shader> line_shader;
 
-            void add_line(const glm::vec3& start, const glm::vec3& end, const glm::vec4& start_color, const glm::vec4& end_color);
-
-            void render(GraphicContext& gc, const Camera* camera);
+            void render(GraphicContext& gc, const std::vector<glm::vec3>& vertexes, const std::vector<glm::vec4>& colors, const CameraProxy& camera);
 
         } debug_line_renderer;
 
         void load_shaders(GraphicContext& gc);
-        IblMaps genrate_ibl_maps(GraphicContext& gc, const std::shared_ptr<CubeMap>& light_probe);
-        void apply_light(GraphicContext& gc, int i, const Light* light);
-        void apply_light_probe(GraphicContext& gc, int i, const std::shared_ptr<CubeMap>& probe);
+        std::shared_ptr<CubeMap> load_or_generate_cubemap(GraphicContext& gc, std::optional<uint64_t> key, const std::shared_ptr<Shader>& shader, const TextureOrCubeMap& texture, unsigned int mips);
+        std::shared_ptr<CubeMap> get_skybox_cubemap(const SkyBoxProxy& sky_box) const;
+        IblMaps genrate_ibl_maps(GraphicContext& gc, const SkyBoxProxy& sky_box);
+        Bounds3 get_caster_bounds() const;
+        void update_lights(const CameraProxy& camera);
+        void upload_lights(GraphicContext& gc);
+        void apply_lights(GraphicContext& gc, FrameBlock& frame);
+        void apply_shadows(GraphicContext& gc, FrameBlock& frame);
+        void apply_light_probe(GraphicContext& gc, int i, const SkyBoxProxy* sky_box, FrameBlock& frame);
+        void apply_frame(GraphicContext& gc, const CameraProxy& camera);
+        size_t get_material_block(GraphicContext& gc, const std::shared_ptr<Material>& material);
+        void collect_material_blocks();
         void apply_material(GraphicContext& gc, const std::shared_ptr<Material>& material);
-        void render_skybox(GraphicContext& gc);
-        void render_forward(GraphicContext& gc);
+        bool render_occluders(const CameraProxy& camera);
+        size_t get_lod(const GeometryProxy* geometry) const;
+        WorkerPool& get_workers();
+        void record_draws(const CameraProxy& camera);
+        void draw(GraphicContext& gc, const CommandBuffer& commands);
+        void draw_shadow_casters(GraphicContext& gc, const glm::mat4& view_projection, const std::vector<const GeometryProxy*>& casters);
+        void render_shadows(GraphicContext& gc);
+        void update_skybox(GraphicContext& gc, const std::shared_ptr<Texture>& texture);
+        void render_skybox(GraphicContext& gc, const CameraProxy& camera);
+        void render_forward(GraphicContext& gc, const CameraProxy& camera);
+        void render_geometry_buffer(GraphicContext& gc, const CameraProxy& camera);
+        void render_deferred(GraphicContext& gc, const CameraProxy& camera);
 
         SceneRenderer(const SceneRenderer&) = delete;
         SceneRenderer& operator = (const SceneRenderer&) = delete;
@@ -29,5 +29,5 @@ out vec2 var_TexCoord;
 void main()
 {
     var_TexCoord = atr_TexCoord;
-    gl_Position  = uni_ProjectionMatrix * uni_ViewMatrix * uni_ModelMatrix * vec4(atr_Vertex, 1.0);
+    gl_Position  = uni_ProjectionMatrix * uni_ViewMatrix * uni_ModelMatrix * vec4(get_vertex(), 1.0);
 }
@@ -30,6 +30,14 @@ namespace pkzo
 {
     constexpr int MAX_LIGHTS = 4;
     constexpr int MAX_LIGHT_PROBES = 1;
+    //! Spherical harmonics coefficients of the light probe irradiance, see SphericalHarmonics.h.
+    constexpr int IRRADIANCE_COEFFICIENTS = 9;
+    //! Mip levels of the specular light probe, level i holds roughness i / (SPECULAR_MIP_LEVELS - 1).
+    constexpr int SPECULAR_MIP_LEVELS = 7;
+    //! Cascades of a directional light shadow, see ShadowMaps.h.
+    constexpr int SHADOW_CASCADES = 4;
+    //! Views in the shadow atlas, shared by the directional light cascades and the spot lights.
+    constexpr int MAX_SHADOW_VIEWS = 8;
 
     enum class UniformLocation : int
     {
@@ -40,40 +48,22 @@ namespace pkzo
         // Material
         BASE_COLOR_FACTOR,
         BASE_COLOR_MAP,
-        METALLIC_FACTOR,
-        ROUGHNESS_FACTOR,
         METALLIC_ROUGHNESS_MAP,
         NORMAL_MAP,
-        EMISSIVE_FACTOR,
         EMISSIVE_MAP,
         // Light
-        LIGHT0_TYPE,
-        LIGHT0_DIRECTION,
-        LIGHT0_POSITION,
-        LIGHT0_COLOR,
-        LIGHT0_ANGLES,
-        LIGHT1_TYPE,
-        LIGHT1_DIRECTION,
-        LIGHT1_POSITION,
-        LIGHT1_COLOR,
-        LIGHT1_ANGLES,
-        LIGHT2_TYPE,
-        LIGHT2_DIRECTION,
-        LIGHT2_POSITION,
-        LIGHT2_COLOR,
-        LIGHT2_ANGLES,
-        LIGHT3_TYPE,
-        LIGHT3_DIRECTION,
-        LIGHT3_POSITION,
-        LIGHT3_COLOR,
-        LIGHT3_ANGLES,
         SHADOW_MAP,
         // SkyBox & Light Probes
         ENVIRONMENT,
         LIGHT_PROBE0_ENABLED,
         LIGHT_PROBE0_ENVIRONMENT,
-        LIGHT_PROBE0_DIFFUSE,
         LIGHT_PROBE0_SPECULAR,
+        // Deferred Shading
+        GBUFFER_BASE_COLOR,
+        GBUFFER_NORMAL,
+        GBUFFER_METALLIC_ROUGHNESS,
+        GBUFFER_EMISSIVE,
+        GBUFFER_DEPTH,
         // Cubemap/Texture Generator & Filter
         MIPLEVEL,
         TEXTURE,
@@ -81,6 +71,22 @@ namespace pkzo
         CUBEMAP_TBN
     };
 
+    //! Binding points of the std140 uniform blocks, see UniformBlocks.h.
+    enum class UniformBinding : int
+    {
+        FRAME,
+        MATERIAL,
+        OBJECT,
+        MESH
+    };
+
+    enum class StorageBinding : int
+    {
+        CLUSTER_LIGHTS,
+        CLUSTER_RANGES,
+        CLUSTER_LIGHT_INDEXES
+    };
+
     class PKZO_EXPORT Shader
     {
     public:
@@ -0,0 +1,225 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "ShadowMaps.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    // the atlas is a grid of square tiles
+    constexpr auto ATLAS_COLUMNS = 4u;
+    constexpr auto ATLAS_ROWS    = (static_cast<unsigned int>(MAX_SHADOW_VIEWS) + ATLAS_COLUMNS - 1u) / ATLAS_COLUMNS;
+
+    // texels the surface is pushed along its normal before the lookup
+    constexpr auto NORMAL_OFFSET_TEXELS = 1.5f;
+
+    // the splits are passed to the shaders in a vec4
+    static_assert(SHADOW_CASCADES == 4);
+
+    ShadowMaps::ShadowMaps()
+    : ShadowMaps(Init{}) {}
+
+    ShadowMaps::ShadowMaps(Init init)
+    : tile_size(init.tile_size), distance(init.distance), split_lambda(init.split_lambda)
+    {
+        check(tile_size > 0u);
+        check(distance > 0.0f);
+        views.reserve(MAX_SHADOW_VIEWS);
+    }
+
+    void ShadowMaps::begin(const glm::mat4& projection, const glm::mat4& view, const Bounds3& casters)
+    {
+        camera_projection = projection;
+        camera_view       = view;
+        caster_bounds     = casters;
+        views.clear();
+
+        // near and far plane of a OpenGL perspective projection
+        const auto near_plane = projection[3][2] / (projection[2][2] - 1.0f);
+        const auto far_plane  = std::min(projection[3][2] / (projection[2][2] + 1.0f), distance);
+        check(near_plane > 0.0f && far_plane > near_plane);
+
+        for (auto i = 0; i < SHADOW_CASCADES; i++)
+        {
+            const auto t       = static_cast<float>(i + 1) / static_cast<float>(SHADOW_CASCADES);
+            const auto uniform = near_plane + (far_plane - near_plane) * t;
+            const auto log     = near_plane * std::pow(far_plane / near_plane, t);
+            cascade_splits[i]  = glm::mix(uniform, log, split_lambda);
+        }
+    }
+
+    // pkzo is z up, lights looking straight up or down need another up vector
+    glm::mat4 light_view(const glm::vec3& position, const glm::vec3& direction)
+    {
+        const auto up = std::abs(direction.z) < 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        return glm::lookAt(position, position + direction, up);
+    }
+
+    float snap_down(float value, float step)
+    {
+        return std::floor(value / step) * step;
+    }
+
+    float snap_up(float value, float step)
+    {
+        return std::ceil(value / step) * step;
+    }
+
+    int ShadowMaps::add_directional(const glm::vec3& direction)
+    {
+        if (views.size() + SHADOW_CASCADES > MAX_SHADOW_VIEWS)
+        {
+            return -1;
+        }
+
+        const auto inv_projection = glm::inverse(camera_projection);
+        const auto inv_view       = glm::inverse(camera_view);
+        const auto rotation       = light_view(glm::vec3(0.0f), glm::normalize(direction));
+        const auto casters        = transform(rotation, caster_bounds);
+
+        // view space point on the near plane for a NDC xy, scaled to the given depth
+        auto unproject = [&] (float nx, float ny, float depth) {
+            auto p = inv_projection * glm::vec4(nx, ny, -1.0f, 1.0f);
+            auto v = glm::vec3(p) / p.w;
+            return v * (depth / -v.z);
+        };
+
+        const auto first = static_cast<int>(views.size());
+        auto z_near = camera_projection[3][2] / (camera_projection[2][2] - 1.0f);
+        for (auto i = 0; i < SHADOW_CASCADES; i++)
+        {
+            const auto z_far = cascade_splits[i];
+
+            auto corners = std::array<glm::vec3, 8>{};
+            auto center  = glm::vec3(0.0f);
+            auto c       = 0u;
+            for (auto depth : {z_near, z_far})
+            {
+                for (auto corner : {glm::vec2(-1.0f, -1.0f), glm::vec2(1.0f, -1.0f), glm::vec2(-1.0f, 1.0f), glm::vec2(1.0f, 1.0f)})
+                {
+                    corners[c] = unproject(corner.x, corner.y, depth);
+                    center    += corners[c] / 8.0f;
+                    c++;
+                }
+            }
+
+            // The sphere only depends on the slice, not the camera orientation.
+            // The radius is rounded up so that it does not flicker.
+            auto radius = 0.0f;
+            for (const auto& corner : corners)
+            {
+                radius = std::max(radius, glm::length(corner - center));
+            }
+            radius = snap_up(radius, 1.0f / 16.0f);
+
+            const auto texel = 2.0f * radius / static_cast<float>(tile_size);
+            const auto light = glm::vec3(rotation * inv_view * glm::vec4(center, 1.0f));
+            const auto x     = snap_down(light.x, texel);
+            const auto y     = snap_down(light.y, texel);
+
+            // Casters between the light and the cascade are included. The depth
+            // range is snapped coarsely, moving casters rarely change it.
+            const auto z_step = 2.0f * radius;
+            const auto z_max  = snap_up(std::max(casters.get_max().z, light.z + radius), z_step);
+            const auto z_min  = snap_down(light.z - radius, z_step);
+
+            const auto projection = glm::ortho(x - radius, x + radius, y - radius, y + radius, -z_max, -z_min);
+            add_view(projection * rotation, texel * NORMAL_OFFSET_TEXELS);
+
+            z_near = z_far;
+        }
+
+        return first;
+    }
+
+    int ShadowMaps::add_spot(const glm::vec3& position, const glm::vec3& direction, float outer_angle, float range)
+    {
+        constexpr auto SPOT_NEAR      = 0.05f;
+        constexpr auto MAX_SPOT_ANGLE = glm::radians(85.0f);
+
+        if (views.size() >= MAX_SHADOW_VIEWS)
+        {
+            return -1;
+        }
+
+        const auto angle      = std::min(outer_angle, MAX_SPOT_ANGLE);
+        const auto projection = glm::perspective(2.0f * angle, 1.0f, SPOT_NEAR, std::max(range, SPOT_NEAR * 2.0f));
+        const auto texel      = 2.0f * std::tan(angle) / static_cast<float>(tile_size);
+
+        return add_view(projection * light_view(position, glm::normalize(direction)), texel * NORMAL_OFFSET_TEXELS);
+    }
+
+    int ShadowMaps::add_view(const glm::mat4& view_projection, float normal_offset)
+    {
+        const auto index  = views.size();
+        const auto offset = glm::vec2(get_tile_offset(index));
+        views.push_back({view_projection, glm::vec4(offset, static_cast<float>(tile_size), normal_offset)});
+        return static_cast<int>(index);
+    }
+
+    size_t ShadowMaps::get_view_count() const
+    {
+        return views.size();
+    }
+
+    const glm::mat4& ShadowMaps::get_view_projection(size_t view) const
+    {
+        check(view < views.size());
+        return views[view].view_projection;
+    }
+
+    glm::uvec2 ShadowMaps::get_tile_offset(size_t view) const
+    {
+        check(view < MAX_SHADOW_VIEWS);
+        const auto i = static_cast<unsigned int>(view);
+        return glm::uvec2(i % ATLAS_COLUMNS, i / ATLAS_COLUMNS) * tile_size;
+    }
+
+    const glm::vec4& ShadowMaps::get_tile(size_t view) const
+    {
+        check(view < views.size());
+        return views[view].tile;
+    }
+
+    unsigned int ShadowMaps::get_tile_size() const
+    {
+        return tile_size;
+    }
+
+    glm::uvec2 ShadowMaps::get_atlas_size() const
+    {
+        return glm::uvec2(ATLAS_COLUMNS, ATLAS_ROWS) * tile_size;
+    }
+
+    const std::array<float, SHADOW_CASCADES>& ShadowMaps::get_cascade_splits() const
+    {
+        return cascade_splits;
+    }
+}
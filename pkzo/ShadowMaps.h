@@ -0,0 +1,112 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "api.h"
+#include "Bounds.h"
+#include "Shader.h"
+
+namespace pkzo
+{
+    //! Shadow views of the lights, laid out as tiles of one depth texture.
+    //!
+    //! A directional light gets SHADOW_CASCADES orthographic views, each
+    //! covering a depth range of the camera frustum; a spot light gets one
+    //! perspective view. The cascades are fitted to a bounding sphere of their
+    //! frustum slice and snapped to whole texels, so a cascade only changes
+    //! when the camera moved by a texel. This keeps shadow edges from crawling
+    //! and lets shadow maps of static geometry be reused over frames.
+    class PKZO_EXPORT ShadowMaps
+    {
+    public:
+        struct Init
+        {
+            unsigned int tile_size    = 1024u;  //!< Resolution of one view.
+            float        distance     = 100.0f; //!< View depth at which shadows end.
+            float        split_lambda = 0.75f;  //!< Blend of uniform (0) and logarithmic (1) cascade splits.
+        };
+
+        ShadowMaps();
+        ShadowMaps(Init init);
+
+        //! Start a frame, removes all views.
+        //!
+        //! @param projection the camera's perspective projection
+        //! @param view the camera's view matrix
+        //! @param casters world bounds of all shadow casters
+        void begin(const glm::mat4& projection, const glm::mat4& view, const Bounds3& casters);
+
+        //! Add the cascades of a directional light.
+        //!
+        //! @return the first of SHADOW_CASCADES consecutive views, -1 if the atlas is full
+        int add_directional(const glm::vec3& direction);
+
+        //! Add the view of a spot light.
+        //!
+        //! @return the view, -1 if the atlas is full
+        int add_spot(const glm::vec3& position, const glm::vec3& direction, float outer_angle, float range);
+
+        size_t get_view_count() const;
+
+        const glm::mat4& get_view_projection(size_t view) const;
+
+        //! Pixel offset of a view in the atlas.
+        glm::uvec2 get_tile_offset(size_t view) const;
+
+        //! Pixel offset and size of a view in the atlas, and the normal offset against acne.
+        //!
+        //! The normal offset is in world units; for spot lights it is at unit
+        //! distance and scaled by the distance to the light.
+        const glm::vec4& get_tile(size_t view) const;
+
+        unsigned int get_tile_size() const;
+        glm::uvec2 get_atlas_size() const;
+
+        //! View depth at which each cascade ends.
+        const std::array<float, SHADOW_CASCADES>& get_cascade_splits() const;
+
+    private:
+        struct View
+        {
+            glm::mat4 view_projection;
+            glm::vec4 tile;
+        };
+
+        unsigned int tile_size;
+        float        distance;
+        float        split_lambda;
+
+        glm::mat4 camera_projection = glm::mat4(1.0f);
+        glm::mat4 camera_view       = glm::mat4(1.0f);
+        Bounds3   caster_bounds;
+
+        std::array<float, SHADOW_CASCADES> cascade_splits = {};
+        std::vector<View>                  views;
+
+        int add_view(const glm::mat4& view_projection, float normal_offset);
+    };
+}
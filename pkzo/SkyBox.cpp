@@ -47,6 +47,11 @@ namespace pkzo
         return texture;
     }
 
+    void SkyBox::set_texture(const std::shared_ptr<pkzo::Texture>& value)
+    {
+        texture = value;
+    }
+
     std::shared_ptr<pkzo::CubeMap> SkyBox::get_cubemap() const
     {
         return cubemap;
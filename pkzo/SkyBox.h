@@ -43,6 +43,12 @@ namespace pkzo
 
         std::shared_ptr<pkzo::Texture> get_texture() const;
 
+        //! Change the sky texture.
+        //!
+        //! The sky and its light probe are regenerated over the following
+        //! frames, the current sky is shown until they are complete.
+        void set_texture(const std::shared_ptr<pkzo::Texture>& value);
+
         std::shared_ptr<pkzo::CubeMap> get_cubemap() const;
         void set_cubemap(const std::shared_ptr<pkzo::CubeMap>& value);
 
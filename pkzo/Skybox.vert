@@ -30,6 +30,7 @@ void main()
 {
     mat4 inv_ProjectionMatrix = inverse(uni_ProjectionMatrix);
     mat3 cameraRotation   = inverse(mat3(uni_ViewMatrix));
-    var_Direction = cameraRotation * vec3(inv_ProjectionMatrix * vec4(atr_Vertex.xy, 1.0, 1.0));
-    gl_Position   = vec4(atr_Vertex, 1.0);
+    vec3 vertex   = get_vertex();
+    var_Direction = cameraRotation * vec3(inv_ProjectionMatrix * vec4(vertex.xy, 1.0, 1.0));
+    gl_Position   = vec4(vertex, 1.0);
 }
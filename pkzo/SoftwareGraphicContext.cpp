@@ -0,0 +1,2708 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "SoftwareGraphicContext.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#include "Light.h"
+#include "MemoryMesh.h"
+#include "MemoryTexture.h"
+#include "SphericalHarmonics.h"
+#include "UniformBlocks.h"
+#include "WorkerPool.h"
+#include "resources.h"
+#include "debug.h"
+
+namespace pkzo
+{
+    // TODO: Move the entire concept of includes to Shader
+    std::string expand_includes(const std::string_view src, int depth = 0);
+
+    constexpr auto PI = std::numbers::pi_v<float>;
+
+    // Pixels in each direction of a screen tile.
+    constexpr auto TILE_SIZE = 64;
+
+    // Vertexes transformed as one job.
+    constexpr auto VERTEX_BATCH_SIZE = size_t{1024u};
+
+    constexpr auto MAX_VARYINGS = 16u;
+
+    // The outputs declared in outputs.glsl.
+    constexpr auto MAX_COLOR_OUTPUTS = 8u;
+
+    // The filtered maps are smooth, shading them at full size would take seconds.
+    constexpr auto MAX_FILTERED_CUBEMAP_SIZE = 32u;
+
+    enum class SoftwareProgram
+    {
+        FORWARD,
+        GEOMETRY_BUFFER,
+        DEFERRED_LIGHTING,
+        SHADOW,
+        SHADOW_COPY,
+        SKYBOX,
+        SCREEN,
+        DEBUG_LINE,
+        GENERATE_CUBEMAP,
+        FILTER_CUBEMAP_SPECULAR
+    };
+
+    SoftwareProgram identify_program(const Shader::Source& source)
+    {
+        // the fragment shaders are unique, the vertex shader follows from them
+        static const auto programs = std::map<std::string, SoftwareProgram>{
+            {expand_includes(get_resource("Forward.frag")),               SoftwareProgram::FORWARD},
+            {expand_includes(get_resource("GBuffer.frag")),               SoftwareProgram::GEOMETRY_BUFFER},
+            {expand_includes(get_resource("DeferredLighting.frag")),      SoftwareProgram::DEFERRED_LIGHTING},
+            {expand_includes(get_resource("Shadow.frag")),                SoftwareProgram::SHADOW},
+            {expand_includes(get_resource("ShadowCopy.frag")),            SoftwareProgram::SHADOW_COPY},
+            {expand_includes(get_resource("Skybox.frag")),                SoftwareProgram::SKYBOX},
+            {expand_includes(get_resource("Screen.frag")),                SoftwareProgram::SCREEN},
+            {expand_includes(get_resource("DebugLine.frag")),             SoftwareProgram::DEBUG_LINE},
+            {expand_includes(get_resource("GenerateCubemap.frag")),       SoftwareProgram::GENERATE_CUBEMAP},
+            {expand_includes(get_resource("FilterCubemapSpecular.frag")), SoftwareProgram::FILTER_CUBEMAP_SPECULAR}
+        };
+
+        auto i = programs.find(source.fragment);
+        if (i == end(programs))
+        {
+            throw std::runtime_error("The software graphic context can only run the built in shaders.");
+        }
+        return i->second;
+    }
+
+    size_t get_varying_count(SoftwareProgram program)
+    {
+        switch (program)
+        {
+            case SoftwareProgram::FORWARD:
+            case SoftwareProgram::GEOMETRY_BUFFER:
+                return 14u; // texcoord, position, tangent, bitangent, normal
+            case SoftwareProgram::DEFERRED_LIGHTING:
+            case SoftwareProgram::SHADOW:
+                return 0u;
+            case SoftwareProgram::SCREEN:
+            case SoftwareProgram::SHADOW_COPY:
+                return 2u;  // texcoord
+            case SoftwareProgram::DEBUG_LINE:
+                return 4u;  // color
+            case SoftwareProgram::SKYBOX:
+            case SoftwareProgram::GENERATE_CUBEMAP:
+            case SoftwareProgram::FILTER_CUBEMAP_SPECULAR:
+                return 3u;  // direction
+            default:
+                std::unreachable();
+        }
+    }
+
+    bool has_texcoords(SoftwareProgram program)
+    {
+        return program == SoftwareProgram::FORWARD || program == SoftwareProgram::GEOMETRY_BUFFER || program == SoftwareProgram::SCREEN;
+    }
+
+    // Programs that write gl_FragDepth are depth tested after shading.
+    bool writes_depth(SoftwareProgram program)
+    {
+        return program == SoftwareProgram::DEFERRED_LIGHTING || program == SoftwareProgram::SHADOW_COPY;
+    }
+
+    class SoftwareShader : public Shader
+    {
+    public:
+        SoftwareShader(SoftwareProgram program)
+        : program(program) {}
+
+        int get_uniform_location(const std::string_view name) const override
+        {
+            static const auto locations = std::map<std::string_view, UniformLocation>{
+                {"uni_ProjectionMatrix",          UniformLocation::PROJECTION_MATRIX},
+                {"uni_ViewMatrix",                UniformLocation::VIEW_MATRIX},
+                {"uni_ModelMatrix",               UniformLocation::MODEL_MATRIX},
+                {"uni_BaseColorFactor",           UniformLocation::BASE_COLOR_FACTOR},
+                {"uni_BaseColorMap",              UniformLocation::BASE_COLOR_MAP},
+                {"uni_MetallicRoughnessMap",      UniformLocation::METALLIC_ROUGHNESS_MAP},
+                {"uni_NormalMap",                 UniformLocation::NORMAL_MAP},
+                {"uni_EmissiveMap",               UniformLocation::EMISSIVE_MAP},
+                {"uni_ShadowMap",                 UniformLocation::SHADOW_MAP},
+                {"uni_Environment",               UniformLocation::ENVIRONMENT},
+                {"uni_GBufferBaseColor",          UniformLocation::GBUFFER_BASE_COLOR},
+                {"uni_GBufferNormal",             UniformLocation::GBUFFER_NORMAL},
+                {"uni_GBufferMetallicRoughness",  UniformLocation::GBUFFER_METALLIC_ROUGHNESS},
+                {"uni_GBufferEmissive",           UniformLocation::GBUFFER_EMISSIVE},
+                {"uni_GBufferDepth",              UniformLocation::GBUFFER_DEPTH},
+                {"uni_MipLevel",                  UniformLocation::MIPLEVEL},
+                {"uni_Texture",                   UniformLocation::TEXTURE},
+                {"uni_CubeMap",                   UniformLocation::CUBEMAP},
+                {"uni_CubemapTBN",                UniformLocation::CUBEMAP_TBN}
+            };
+
+            auto i = locations.find(name);
+            return i != end(locations) ? std::to_underlying(i->second) : -1;
+        }
+
+        int get_attribute_location(const std::string_view name) const override
+        {
+            static const auto locations = std::map<std::string_view, int>{
+                {"atr_Vertex",              0},
+                {"atr_Normal",              1},
+                {"atr_Tangent",             2},
+                {"atr_TexCoord",            3},
+                {"atr_Color",               4},
+                {"atr_InstanceModelMatrix", 5}
+            };
+
+            auto i = locations.find(name);
+            return i != end(locations) ? i->second : -1;
+        }
+
+        SoftwareProgram get_program() const
+        {
+            return program;
+        }
+
+        // Uniforms are part of the program, like in OpenGL.
+        void set_uniform(int loc, const UniformValue& value)
+        {
+            uniforms.insert_or_assign(loc, value);
+        }
+
+        template <typename T>
+        T get_uniform(UniformLocation loc, const T& fallback) const
+        {
+            auto i = uniforms.find(std::to_underlying(loc));
+            if (i == end(uniforms))
+            {
+                return fallback;
+            }
+
+            auto value = std::get_if<T>(&i->second);
+            return value != nullptr ? *value : fallback;
+        }
+
+    private:
+        SoftwareProgram             program;
+        std::map<int, UniformValue> uniforms;
+    };
+
+    // Float RGBA pixels, the first row is the bottom one, like in OpenGL.
+    struct SoftwareImage
+    {
+        glm::uvec2             size = glm::uvec2(0u);
+        std::vector<glm::vec4> pixels;
+
+        SoftwareImage() = default;
+
+        SoftwareImage(const glm::uvec2& size, const glm::vec4& value = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f))
+        : size(size), pixels(size_t{size.x} * size.y, value) {}
+
+        const glm::vec4& at(int x, int y) const
+        {
+            return pixels[static_cast<size_t>(y) * size.x + x];
+        }
+    };
+
+    int wrap_texel(int i, int n, bool clamp)
+    {
+        if (clamp)
+        {
+            return std::clamp(i, 0, n - 1);
+        }
+        auto r = i % n;
+        return r < 0 ? r + n : r;
+    }
+
+    float wrap_coordinate(float value, bool clamp)
+    {
+        // wrapping first keeps the texel coordinates in integer range
+        return clamp ? std::clamp(value, 0.0f, 1.0f) : value - std::floor(value);
+    }
+
+    glm::vec4 sample_nearest(const SoftwareImage& image, const glm::vec2& uv, bool clamp_u, bool clamp_v)
+    {
+        if (image.pixels.empty() || !std::isfinite(uv.x) || !std::isfinite(uv.y))
+        {
+            return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        const auto w = static_cast<int>(image.size.x);
+        const auto h = static_cast<int>(image.size.y);
+        const auto x = static_cast<int>(std::floor(wrap_coordinate(uv.x, clamp_u) * static_cast<float>(w)));
+        const auto y = static_cast<int>(std::floor(wrap_coordinate(uv.y, clamp_v) * static_cast<float>(h)));
+        return image.at(wrap_texel(x, w, clamp_u), wrap_texel(y, h, clamp_v));
+    }
+
+    glm::vec4 sample_bilinear(const SoftwareImage& image, const glm::vec2& uv, bool clamp_u, bool clamp_v)
+    {
+        if (image.pixels.empty() || !std::isfinite(uv.x) || !std::isfinite(uv.y))
+        {
+            return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        const auto w  = static_cast<int>(image.size.x);
+        const auto h  = static_cast<int>(image.size.y);
+        const auto p  = glm::vec2(wrap_coordinate(uv.x, clamp_u), wrap_coordinate(uv.y, clamp_v)) * glm::vec2(image.size) - 0.5f;
+        const auto p0 = glm::floor(p);
+        const auto f  = p - p0;
+
+        const auto x0 = wrap_texel(static_cast<int>(p0.x),      w, clamp_u);
+        const auto x1 = wrap_texel(static_cast<int>(p0.x) + 1,  w, clamp_u);
+        const auto y0 = wrap_texel(static_cast<int>(p0.y),      h, clamp_v);
+        const auto y1 = wrap_texel(static_cast<int>(p0.y) + 1,  h, clamp_v);
+
+        const auto a = glm::mix(image.at(x0, y0), image.at(x1, y0), f.x);
+        const auto b = glm::mix(image.at(x0, y1), image.at(x1, y1), f.x);
+        return glm::mix(a, b, f.y);
+    }
+
+    glm::vec4 sample_trilinear(const std::vector<SoftwareImage>& mips, const glm::vec2& uv, float lod, bool clamp_u, bool clamp_v)
+    {
+        check(!mips.empty());
+
+        // also catches NaN from zero derivatives
+        if (!(lod > 0.0f) || mips.size() == 1u)
+        {
+            return sample_bilinear(mips.front(), uv, clamp_u, clamp_v);
+        }
+
+        lod = std::min(lod, static_cast<float>(mips.size() - 1u));
+        const auto level = static_cast<size_t>(lod);
+        const auto f     = lod - static_cast<float>(level);
+
+        const auto a = sample_bilinear(mips[level], uv, clamp_u, clamp_v);
+        if (f == 0.0f || level + 1u >= mips.size())
+        {
+            return a;
+        }
+        return glm::mix(a, sample_bilinear(mips[level + 1u], uv, clamp_u, clamp_v), f);
+    }
+
+    SoftwareImage downsample(const SoftwareImage& image)
+    {
+        const auto size   = glm::max(image.size / 2u, glm::uvec2(1u));
+        const auto last   = glm::ivec2(image.size) - 1;
+        auto       result = SoftwareImage(size);
+
+        for (auto y = 0; y < static_cast<int>(size.y); y++)
+        {
+            for (auto x = 0; x < static_cast<int>(size.x); x++)
+            {
+                const auto x0 = std::min(x * 2, last.x);
+                const auto x1 = std::min(x * 2 + 1, last.x);
+                const auto y0 = std::min(y * 2, last.y);
+                const auto y1 = std::min(y * 2 + 1, last.y);
+                result.pixels[static_cast<size_t>(y) * size.x + x] = (image.at(x0, y0) + image.at(x1, y0) + image.at(x0, y1) + image.at(x1, y1)) * 0.25f;
+            }
+        }
+
+        return result;
+    }
+
+    class SoftwareTexture : public Texture
+    {
+    public:
+        SoftwareTexture(const std::string& id, SoftwareImage image, TextureFilter filter, Clamp clamp)
+        : id(id), filter(filter), clamp(clamp)
+        {
+            mips.push_back(std::move(image));
+            if (filter == TextureFilter::LINEAR_MIPMAP && !mips.front().pixels.empty())
+            {
+                while (mips.back().size != glm::uvec2(1u))
+                {
+                    mips.push_back(downsample(mips.back()));
+                }
+            }
+        }
+
+        const std::string& get_id() const override
+        {
+            return id;
+        }
+
+        glm::uvec2 get_size() const override
+        {
+            return mips.front().size;
+        }
+
+        ColorMode get_color_mode() const override
+        {
+            return ColorMode::RGBA;
+        }
+
+        DataType get_data_type() const override
+        {
+            return DataType::FLOAT;
+        }
+
+        const void* get_memory() const override
+        {
+            return mips.front().pixels.data();
+        }
+
+        TextureFilter get_filter() const override
+        {
+            return filter;
+        }
+
+        Clamp get_clamp() const override
+        {
+            return clamp;
+        }
+
+        std::shared_ptr<MemoryTexture> download() override
+        {
+            return MemoryTexture::create({
+                .id         = id,
+                .size       = get_size(),
+                .data_type  = DataType::FLOAT,
+                .color_mode = ColorMode::RGBA,
+                .memory     = get_memory(),
+                .filter     = filter,
+                .clamp      = clamp
+            });
+        }
+
+        //! Pixels of the base level, for rendering into the texture.
+        SoftwareImage& get_image()
+        {
+            return mips.front();
+        }
+
+        const SoftwareImage& get_image() const
+        {
+            return mips.front();
+        }
+
+        glm::vec4 sample(const glm::vec2& uv, const glm::vec2& duv_dx, const glm::vec2& duv_dy) const
+        {
+            const auto clamp_u = clamp == Clamp::CLAMP || clamp == Clamp::CLAMP_HORIZONTAL;
+            const auto clamp_v = clamp == Clamp::CLAMP || clamp == Clamp::CLAMP_VERTICAL;
+
+            if (filter == TextureFilter::NEAREST)
+            {
+                return sample_nearest(mips.front(), uv, clamp_u, clamp_v);
+            }
+
+            const auto size = glm::vec2(mips.front().size);
+            const auto rho  = std::max(glm::length(duv_dx * size), glm::length(duv_dy * size));
+            return sample_trilinear(mips, uv, std::log2(rho), clamp_u, clamp_v);
+        }
+
+    private:
+        std::string                id;
+        std::vector<SoftwareImage> mips;
+        TextureFilter              filter;
+        Clamp                      clamp;
+    };
+
+    glm::vec4 sample_texture(const SoftwareTexture* texture, const glm::vec2& uv, const glm::vec2& duv_dx, const glm::vec2& duv_dy)
+    {
+        // like an incomplete texture in OpenGL
+        if (texture == nullptr)
+        {
+            return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+        return texture->sample(uv, duv_dx, duv_dy);
+    }
+
+    // Reads one texel of the base level, like texelFetch.
+    glm::vec4 fetch_texture(const SoftwareTexture* texture, const glm::ivec2& texel)
+    {
+        if (texture == nullptr)
+        {
+            return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        const auto& image = texture->get_image();
+        const auto  size  = glm::ivec2(image.size);
+        if (texel.x < 0 || texel.y < 0 || texel.x >= size.x || texel.y >= size.y)
+        {
+            return glm::vec4(0.0f);
+        }
+        return image.at(texel.x, texel.y);
+    }
+
+    class SoftwareCubeMap : public CubeMap
+    {
+    public:
+        SoftwareCubeMap(const CubeMapGenerator& generator, unsigned int shading_size)
+        : id(generator.id), size(generator.size), data_type(generator.data_type), color_mode(generator.color_mode)
+        {
+            const auto levels = std::max(generator.miplevels, 1u);
+            for (auto& face : faces)
+            {
+                for (auto mip = 0u; mip < levels; mip++)
+                {
+                    face.emplace_back(glm::uvec2(std::max(shading_size >> mip, 1u)));
+                }
+            }
+        }
+
+        // the images are RGBA float texels, as written by download
+        SoftwareCubeMap(const CubeMapData& data)
+        : id(data.id), size(data.size), data_type(DataType::FLOAT), color_mode(ColorMode::RGBA)
+        {
+            check(data.data_type == DataType::FLOAT && data.color_mode == ColorMode::RGBA, "The software cube map data must be RGBA float.");
+            check(data.images.size() == 6u * data.miplevels, "The cube map data must have an image for each face and mip level.");
+
+            for (auto face = 0u; face < 6u; face++)
+            {
+                for (auto mip = 0u; mip < data.miplevels; mip++)
+                {
+                    const auto& source = data.images[face * data.miplevels + mip];
+                    auto&       image  = faces[face].emplace_back(glm::uvec2(source.size));
+                    check(source.pixels.size() == image.pixels.size() * sizeof(glm::vec4), "The cube map image does not match its face size.");
+                    std::memcpy(image.pixels.data(), source.pixels.data(), source.pixels.size());
+                }
+            }
+        }
+
+        std::string get_id() const override
+        {
+            return id;
+        }
+
+        unsigned int get_size() const override
+        {
+            return size;
+        }
+
+        DataType get_data_type() const override
+        {
+            return data_type;
+        }
+
+        ColorMode get_color_mode() const override
+        {
+            return color_mode;
+        }
+
+        unsigned int get_miplevels() const
+        {
+            return static_cast<unsigned int>(faces.front().size());
+        }
+
+        SoftwareImage& get_face(unsigned int face, unsigned int mip)
+        {
+            return faces.at(face).at(mip);
+        }
+
+        CubeMapData download() const
+        {
+            auto data = CubeMapData{
+                .id         = id,
+                .size       = size,
+                .data_type  = DataType::FLOAT,
+                .color_mode = ColorMode::RGBA,
+                .miplevels  = get_miplevels()
+            };
+
+            for (const auto& face : faces)
+            {
+                for (const auto& mip : face)
+                {
+                    auto& image = data.images.emplace_back();
+                    image.size  = mip.size.x;
+                    image.pixels.resize(mip.pixels.size() * sizeof(glm::vec4));
+                    std::memcpy(image.pixels.data(), mip.pixels.data(), image.pixels.size());
+                }
+            }
+
+            return data;
+        }
+
+        glm::vec4 sample(const glm::vec3& direction, float lod) const
+        {
+            // face selection and orientation as in the OpenGL specification
+            const auto a = glm::abs(direction);
+
+            auto face = CubeFace::XPOS;
+            auto sc   = 0.0f;
+            auto tc   = 0.0f;
+            auto ma   = 0.0f;
+            if (a.x >= a.y && a.x >= a.z)
+            {
+                ma   = a.x;
+                face = direction.x > 0.0f ? CubeFace::XPOS : CubeFace::XNEG;
+                sc   = direction.x > 0.0f ? -direction.z : direction.z;
+                tc   = -direction.y;
+            }
+            else if (a.y >= a.z)
+            {
+                ma   = a.y;
+                face = direction.y > 0.0f ? CubeFace::YPOS : CubeFace::YNEG;
+                sc   = direction.x;
+                tc   = direction.y > 0.0f ? direction.z : -direction.z;
+            }
+            else
+            {
+                ma   = a.z;
+                face = direction.z > 0.0f ? CubeFace::ZPOS : CubeFace::ZNEG;
+                sc   = direction.z > 0.0f ? direction.x : -direction.x;
+                tc   = -direction.y;
+            }
+
+            if (!(ma > 0.0f))
+            {
+                return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            }
+
+            const auto uv = (glm::vec2(sc, tc) / ma + 1.0f) * 0.5f;
+            return sample_trilinear(faces[std::to_underlying(face)], uv, lod, true, true);
+        }
+
+    private:
+        std::string  id;
+        unsigned int size;
+        DataType     data_type;
+        ColorMode    color_mode;
+
+        std::array<std::vector<SoftwareImage>, 6> faces;
+    };
+
+    glm::vec4 sample_cubemap(const SoftwareCubeMap* cubemap, const glm::vec3& direction, float lod)
+    {
+        if (cubemap == nullptr)
+        {
+            return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+        return cubemap->sample(direction, lod);
+    }
+
+    // What draws write to, the color attachments and the depth buffer.
+    struct SoftwareTarget
+    {
+        glm::uvec2                                size     = glm::uvec2(0u);
+        std::array<glm::vec4*, MAX_COLOR_OUTPUTS> colors   = {};
+        float*                                    depth    = nullptr;
+        std::array<bool, MAX_COLOR_OUTPUTS>       saturate = {}; //!< Fixed point buffers only hold values in [0, 1].
+    };
+
+    class SoftwareFrameBuffer : public FrameBuffer
+    {
+    public:
+        SoftwareFrameBuffer(const BufferConfig& config)
+        : id(config.id), size(config.size)
+        {
+            for (const auto& color : config.colors)
+            {
+                colors.push_back(std::make_shared<SoftwareTexture>(config.id, SoftwareImage(size), TextureFilter::LINEAR, Clamp::CLAMP));
+                saturate.push_back(color.data == DataType::UNSIGNED_BYTE);
+            }
+
+            if (config.depth)
+            {
+                depth.resize(size_t{size.x} * size.y, 1.0f);
+            }
+        }
+
+        glm::uvec2 get_size() const override
+        {
+            return size;
+        }
+
+        std::shared_ptr<Texture> get_depth() const override
+        {
+            if (depth.empty())
+            {
+                return nullptr;
+            }
+
+            auto image = SoftwareImage(size);
+            for (auto i = size_t{0u}; i < depth.size(); i++)
+            {
+                image.pixels[i] = glm::vec4(depth[i], 0.0f, 0.0f, 1.0f);
+            }
+            return std::make_shared<SoftwareTexture>(id, std::move(image), TextureFilter::NEAREST, Clamp::CLAMP);
+        }
+
+        std::vector<std::shared_ptr<Texture>> get_colors() const override
+        {
+            return std::vector<std::shared_ptr<Texture>>(begin(colors), end(colors));
+        }
+
+        std::shared_ptr<Texture> get_color(unsigned int slot) const override
+        {
+            check(slot < colors.size());
+            return colors[slot];
+        }
+
+        SoftwareTarget get_target()
+        {
+            auto target = SoftwareTarget{
+                .size  = size,
+                .depth = depth.empty() ? nullptr : depth.data()
+            };
+            for (auto i = 0u; i < colors.size() && i < MAX_COLOR_OUTPUTS; i++)
+            {
+                target.colors[i]   = colors[i]->get_image().pixels.data();
+                target.saturate[i] = saturate[i];
+            }
+            return target;
+        }
+
+        const SoftwareImage* get_color_image() const
+        {
+            return colors.empty() ? nullptr : &colors.front()->get_image();
+        }
+
+        void clear(const glm::vec4& color, float value)
+        {
+            for (auto& texture : colors)
+            {
+                auto& pixels = texture->get_image().pixels;
+                std::fill(begin(pixels), end(pixels), color);
+            }
+            std::fill(begin(depth), end(depth), value);
+        }
+
+    private:
+        std::string                                   id;
+        glm::uvec2                                    size;
+        std::vector<std::shared_ptr<SoftwareTexture>> colors;
+        std::vector<bool>                             saturate;
+        std::vector<float>                            depth;
+    };
+
+    class SoftwareUniformBuffer : public UniformBuffer
+    {
+    public:
+        SoftwareUniformBuffer(size_t size)
+        : data(size, 0u) {}
+
+        size_t get_size() const override
+        {
+            return data.size();
+        }
+
+        void upload(size_t offset, size_t size, const void* value) override
+        {
+            check(offset + size <= data.size());
+            std::memcpy(data.data() + offset, value, size);
+        }
+
+        const uint8_t* get_data() const
+        {
+            return data.data();
+        }
+
+    private:
+        std::vector<uint8_t> data;
+    };
+
+    struct SoftwareBufferRange
+    {
+        std::shared_ptr<const SoftwareUniformBuffer> buffer;
+        size_t                                       offset = 0u;
+        size_t                                       size   = 0u;
+    };
+
+    using SoftwareStorage = std::shared_ptr<const std::vector<uint8_t>>;
+
+    // Bindings of the context, uniforms live in the shaders.
+    struct SoftwareDrawState
+    {
+        BlendMode                                       blend_mode = BlendMode::DISABLED;
+        DepthTest                                       depth_test = DepthTest::DISABLED;
+        std::map<int, std::shared_ptr<SoftwareTexture>> textures;
+        std::map<int, std::shared_ptr<SoftwareCubeMap>> cubemaps;
+        std::map<int, SoftwareBufferRange>              uniform_buffers;
+        std::map<int, SoftwareStorage>                  storage_buffers;
+    };
+
+    // Everything a draw reads, resolved when it is issued.
+    struct SoftwareDraw
+    {
+        SoftwareProgram program    = SoftwareProgram::FORWARD;
+        BlendMode       blend_mode = BlendMode::DISABLED;
+        DepthTest       depth_test = DepthTest::DISABLED;
+
+        FrameBlock    frame           = {};
+        MaterialBlock material        = {};
+        ObjectBlock   object          = {};
+        glm::vec3     camera_position = glm::vec3(0.0f);
+
+        glm::mat4 projection_matrix = glm::mat4(0.0f);
+        glm::mat4 view_matrix       = glm::mat4(0.0f);
+        glm::mat4 model_matrix      = glm::mat4(0.0f);
+        glm::vec4 base_color_factor = glm::vec4(0.0f);
+        glm::mat3 cubemap_tbn       = glm::mat3(0.0f);
+        int       mip_level         = 0;
+
+        std::shared_ptr<SoftwareTexture> base_color_map;
+        std::shared_ptr<SoftwareTexture> metallic_roughness_map;
+        std::shared_ptr<SoftwareTexture> normal_map;
+        std::shared_ptr<SoftwareTexture> emissive_map;
+        std::shared_ptr<SoftwareTexture> texture;
+        std::shared_ptr<SoftwareCubeMap> environment;
+        std::shared_ptr<SoftwareCubeMap> cubemap;
+
+        std::shared_ptr<SoftwareTexture> gbuffer_base_color;
+        std::shared_ptr<SoftwareTexture> gbuffer_normal;
+        std::shared_ptr<SoftwareTexture> gbuffer_metallic_roughness;
+        std::shared_ptr<SoftwareTexture> gbuffer_emissive;
+        std::shared_ptr<SoftwareTexture> gbuffer_depth;
+
+        std::shared_ptr<SoftwareTexture> shadow_map;
+
+        bool                             light_probe_enabled = false;
+        std::shared_ptr<SoftwareCubeMap> light_probe_environment;
+        std::shared_ptr<SoftwareCubeMap> light_probe_specular;
+        IrradianceSH                     irradiance;
+
+        SoftwareStorage cluster_lights;
+        SoftwareStorage cluster_ranges;
+        SoftwareStorage cluster_light_indexes;
+    };
+
+    template <typename Block>
+    Block read_block(const SoftwareDrawState& state, UniformBinding binding)
+    {
+        auto block = Block{};
+
+        auto i = state.uniform_buffers.find(std::to_underlying(binding));
+        if (i != end(state.uniform_buffers) && i->second.buffer != nullptr)
+        {
+            const auto& range = i->second;
+            std::memcpy(&block, range.buffer->get_data() + range.offset, std::min(sizeof(Block), range.size));
+        }
+
+        return block;
+    }
+
+    template <typename T>
+    std::shared_ptr<T> get_binding(const std::map<int, std::shared_ptr<T>>& bindings, int slot)
+    {
+        auto i = bindings.find(slot);
+        return i != end(bindings) ? i->second : nullptr;
+    }
+
+    int offset_location(UniformLocation base, int offset)
+    {
+        return std::to_underlying(base) + offset;
+    }
+
+    SoftwareDraw resolve_draw(const SoftwareShader& shader, const SoftwareDrawState& state)
+    {
+        using enum UniformLocation;
+
+        // samplers that were never set read unit 0, like in OpenGL
+        auto texture = [&] (UniformLocation loc) {
+            return get_binding(state.textures, shader.get_uniform(loc, 0));
+        };
+        auto cubemap = [&] (UniformLocation loc) {
+            return get_binding(state.cubemaps, shader.get_uniform(loc, 0));
+        };
+        auto storage = [&] (StorageBinding binding) {
+            return get_binding(state.storage_buffers, std::to_underlying(binding));
+        };
+
+        auto draw = SoftwareDraw{};
+        draw.program    = shader.get_program();
+        draw.blend_mode = state.blend_mode;
+        draw.depth_test = state.depth_test;
+
+        switch (draw.program)
+        {
+            case SoftwareProgram::FORWARD:
+                draw.frame           = read_block<FrameBlock>(state, UniformBinding::FRAME);
+                draw.material        = read_block<MaterialBlock>(state, UniformBinding::MATERIAL);
+                draw.object          = read_block<ObjectBlock>(state, UniformBinding::OBJECT);
+                draw.camera_position = glm::vec3(glm::inverse(draw.frame.view_matrix)[3]);
+
+                draw.base_color_map         = texture(BASE_COLOR_MAP);
+                draw.metallic_roughness_map = texture(METALLIC_ROUGHNESS_MAP);
+                draw.normal_map             = texture(NORMAL_MAP);
+                draw.emissive_map           = texture(EMISSIVE_MAP);
+                draw.shadow_map             = texture(SHADOW_MAP);
+
+                draw.light_probe_enabled     = shader.get_uniform(LIGHT_PROBE0_ENABLED, 0) != 0;
+                draw.light_probe_environment = cubemap(LIGHT_PROBE0_ENVIRONMENT);
+                draw.light_probe_specular    = cubemap(LIGHT_PROBE0_SPECULAR);
+                for (auto c = 0; c < IRRADIANCE_COEFFICIENTS; c++)
+                {
+                    draw.irradiance.coefficients[c] = glm::vec3(draw.frame.light_probe_irradiance[c]);
+                }
+
+                draw.cluster_lights        = storage(StorageBinding::CLUSTER_LIGHTS);
+                draw.cluster_ranges        = storage(StorageBinding::CLUSTER_RANGES);
+                draw.cluster_light_indexes = storage(StorageBinding::CLUSTER_LIGHT_INDEXES);
+                break;
+            case SoftwareProgram::GEOMETRY_BUFFER:
+                draw.frame    = read_block<FrameBlock>(state, UniformBinding::FRAME);
+                draw.material = read_block<MaterialBlock>(state, UniformBinding::MATERIAL);
+                draw.object   = read_block<ObjectBlock>(state, UniformBinding::OBJECT);
+
+                draw.base_color_map         = texture(BASE_COLOR_MAP);
+                draw.metallic_roughness_map = texture(METALLIC_ROUGHNESS_MAP);
+                draw.normal_map             = texture(NORMAL_MAP);
+                draw.emissive_map           = texture(EMISSIVE_MAP);
+                break;
+            case SoftwareProgram::DEFERRED_LIGHTING:
+                draw.frame           = read_block<FrameBlock>(state, UniformBinding::FRAME);
+                draw.camera_position = glm::vec3(glm::inverse(draw.frame.view_matrix)[3]);
+
+                draw.gbuffer_base_color         = texture(GBUFFER_BASE_COLOR);
+                draw.gbuffer_normal             = texture(GBUFFER_NORMAL);
+                draw.gbuffer_metallic_roughness = texture(GBUFFER_METALLIC_ROUGHNESS);
+                draw.gbuffer_emissive           = texture(GBUFFER_EMISSIVE);
+                draw.gbuffer_depth              = texture(GBUFFER_DEPTH);
+                draw.shadow_map                 = texture(SHADOW_MAP);
+
+                draw.light_probe_enabled     = shader.get_uniform(LIGHT_PROBE0_ENABLED, 0) != 0;
+                draw.light_probe_environment = cubemap(LIGHT_PROBE0_ENVIRONMENT);
+                draw.light_probe_specular    = cubemap(LIGHT_PROBE0_SPECULAR);
+                for (auto c = 0; c < IRRADIANCE_COEFFICIENTS; c++)
+                {
+                    draw.irradiance.coefficients[c] = glm::vec3(draw.frame.light_probe_irradiance[c]);
+                }
+
+                draw.cluster_lights        = storage(StorageBinding::CLUSTER_LIGHTS);
+                draw.cluster_ranges        = storage(StorageBinding::CLUSTER_RANGES);
+                draw.cluster_light_indexes = storage(StorageBinding::CLUSTER_LIGHT_INDEXES);
+                break;
+            case SoftwareProgram::SHADOW:
+                draw.frame  = read_block<FrameBlock>(state, UniformBinding::FRAME);
+                draw.object = read_block<ObjectBlock>(state, UniformBinding::OBJECT);
+                break;
+            case SoftwareProgram::SHADOW_COPY:
+                draw.texture = texture(TEXTURE);
+                break;
+            case SoftwareProgram::SKYBOX:
+                draw.projection_matrix = shader.get_uniform(PROJECTION_MATRIX, glm::mat4(0.0f));
+                draw.view_matrix       = shader.get_uniform(VIEW_MATRIX, glm::mat4(0.0f));
+                draw.environment       = cubemap(ENVIRONMENT);
+                break;
+            case SoftwareProgram::SCREEN:
+                draw.projection_matrix = shader.get_uniform(PROJECTION_MATRIX, glm::mat4(0.0f));
+                draw.view_matrix       = shader.get_uniform(VIEW_MATRIX, glm::mat4(0.0f));
+                draw.model_matrix      = shader.get_uniform(MODEL_MATRIX, glm::mat4(0.0f));
+                draw.base_color_factor = shader.get_uniform(BASE_COLOR_FACTOR, glm::vec4(0.0f));
+                draw.base_color_map    = texture(BASE_COLOR_MAP);
+                break;
+            case SoftwareProgram::DEBUG_LINE:
+                draw.projection_matrix = shader.get_uniform(PROJECTION_MATRIX, glm::mat4(0.0f));
+                draw.view_matrix       = shader.get_uniform(VIEW_MATRIX, glm::mat4(0.0f));
+                break;
+            case SoftwareProgram::GENERATE_CUBEMAP:
+            case SoftwareProgram::FILTER_CUBEMAP_SPECULAR:
+                draw.cubemap_tbn = shader.get_uniform(CUBEMAP_TBN, glm::mat3(0.0f));
+                draw.mip_level   = shader.get_uniform(MIPLEVEL, 0);
+                draw.texture     = texture(TEXTURE);
+                draw.cubemap     = cubemap(CUBEMAP);
+                break;
+            default:
+                std::unreachable();
+        }
+
+        return draw;
+    }
+
+    using Varyings = std::array<float, MAX_VARYINGS>;
+
+    struct SoftwareClipVertex
+    {
+        glm::vec4 position = glm::vec4(0.0f); //!< Clip space position.
+        Varyings  varyings = {};
+    };
+
+    struct SoftwareVertex
+    {
+        glm::vec4 position = glm::vec4(0.0f); //!< Window x, y and z and 1 / w.
+        Varyings  varyings = {};              //!< Varyings divided by w.
+    };
+
+    struct SoftwarePrimitive
+    {
+        uint32_t                      draw  = 0u;
+        uint32_t                      count = 0u; //!< 2 for lines, 3 for triangles.
+        std::array<SoftwareVertex, 3> vertexes;
+        glm::ivec4                    bounds;     //!< Covered pixels, min x, min y, max x and max y exclusive.
+    };
+
+    struct SoftwareFragment
+    {
+        glm::vec2    frag_coord  = glm::vec2(0.0f);
+        const float* varyings    = nullptr;
+        glm::vec2    texcoord_dx = glm::vec2(0.0f);
+        glm::vec2    texcoord_dy = glm::vec2(0.0f);
+    };
+
+    // Per draw constants of the vertex stage.
+    struct SoftwareVertexStage
+    {
+        glm::mat4 model_matrix  = glm::mat4(1.0f);
+        glm::mat3 normal_matrix = glm::mat3(1.0f);
+        glm::mat4 clip_matrix   = glm::mat4(1.0f);
+        glm::mat4 inverse_projection_matrix = glm::mat4(1.0f);
+        glm::mat3 inverse_camera_rotation   = glm::mat3(1.0f);
+    };
+
+    struct SoftwareAttributes
+    {
+        const std::vector<glm::vec3>& vertexes;
+        const std::vector<glm::vec3>& normals;
+        const std::vector<glm::vec3>& tangents;
+        const std::vector<glm::vec2>& texcoords;
+        const std::vector<glm::vec4>& colors;
+    };
+
+    template <typename T>
+    T get_attribute(const std::vector<T>& values, size_t i, const T& fallback)
+    {
+        return i < values.size() ? values[i] : fallback;
+    }
+
+    template <typename T>
+    void write_varyings(Varyings& varyings, size_t offset, const T& value)
+    {
+        for (auto i = 0; i < T::length(); i++)
+        {
+            varyings[offset + i] = value[i];
+        }
+    }
+
+    glm::vec3 read_vec3(const float* varyings, size_t offset)
+    {
+        return glm::vec3(varyings[offset], varyings[offset + 1u], varyings[offset + 2u]);
+    }
+
+    // Normalizes without producing NaN for missing attributes.
+    glm::vec3 safe_normalize(const glm::vec3& value)
+    {
+        const auto length = glm::length(value);
+        return length > 0.0f ? value / length : value;
+    }
+
+    SoftwareVertexStage make_vertex_stage(const SoftwareDraw& draw, const glm::mat4& instance)
+    {
+        auto stage = SoftwareVertexStage{};
+        switch (draw.program)
+        {
+            case SoftwareProgram::FORWARD:
+            case SoftwareProgram::GEOMETRY_BUFFER:
+            case SoftwareProgram::SHADOW:
+                stage.model_matrix  = draw.object.instanced != 0 ? instance : draw.object.model_matrix;
+                stage.normal_matrix = glm::mat3(glm::transpose(glm::inverse(stage.model_matrix)));
+                stage.clip_matrix   = draw.frame.projection_matrix * draw.frame.view_matrix;
+                break;
+            case SoftwareProgram::SKYBOX:
+                stage.inverse_projection_matrix = glm::inverse(draw.projection_matrix);
+                stage.inverse_camera_rotation   = glm::inverse(glm::mat3(draw.view_matrix));
+                break;
+            case SoftwareProgram::SCREEN:
+                stage.clip_matrix = draw.projection_matrix * draw.view_matrix * draw.model_matrix;
+                break;
+            case SoftwareProgram::DEBUG_LINE:
+                stage.clip_matrix = draw.projection_matrix * draw.view_matrix;
+                break;
+            default:
+                break;
+        }
+        return stage;
+    }
+
+    SoftwareClipVertex shade_vertex(const SoftwareDraw& draw, const SoftwareVertexStage& stage, const SoftwareAttributes& attributes, size_t i)
+    {
+        const auto vertex = attributes.vertexes[i];
+
+        auto result = SoftwareClipVertex{};
+        switch (draw.program)
+        {
+            case SoftwareProgram::FORWARD:
+            case SoftwareProgram::GEOMETRY_BUFFER:
+            {
+                const auto normal    = safe_normalize(stage.normal_matrix * get_attribute(attributes.normals, i, glm::vec3(0.0f)));
+                const auto tangent   = safe_normalize(stage.normal_matrix * get_attribute(attributes.tangents, i, glm::vec3(0.0f)));
+                const auto bitangent = glm::cross(normal, tangent);
+                const auto world     = stage.model_matrix * glm::vec4(vertex, 1.0f);
+
+                write_varyings(result.varyings, 0u,  get_attribute(attributes.texcoords, i, glm::vec2(0.0f)));
+                write_varyings(result.varyings, 2u,  glm::vec3(world));
+                write_varyings(result.varyings, 5u,  tangent);
+                write_varyings(result.varyings, 8u,  bitangent);
+                write_varyings(result.varyings, 11u, normal);
+                result.position = stage.clip_matrix * world;
+                break;
+            }
+            case SoftwareProgram::DEFERRED_LIGHTING:
+                result.position = glm::vec4(vertex, 1.0f);
+                break;
+            case SoftwareProgram::SHADOW:
+                result.position = stage.clip_matrix * stage.model_matrix * glm::vec4(vertex, 1.0f);
+                break;
+            case SoftwareProgram::SHADOW_COPY:
+                write_varyings(result.varyings, 0u, glm::vec2(vertex) * 0.5f + 0.5f);
+                result.position = glm::vec4(vertex, 1.0f);
+                break;
+            case SoftwareProgram::SKYBOX:
+            {
+                const auto direction = stage.inverse_camera_rotation * glm::vec3(stage.inverse_projection_matrix * glm::vec4(vertex.x, vertex.y, 1.0f, 1.0f));
+                write_varyings(result.varyings, 0u, direction);
+                result.position = glm::vec4(vertex, 1.0f);
+                break;
+            }
+            case SoftwareProgram::SCREEN:
+                write_varyings(result.varyings, 0u, get_attribute(attributes.texcoords, i, glm::vec2(0.0f)));
+                result.position = stage.clip_matrix * glm::vec4(vertex, 1.0f);
+                break;
+            case SoftwareProgram::DEBUG_LINE:
+                write_varyings(result.varyings, 0u, get_attribute(attributes.colors, i, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)));
+                result.position = stage.clip_matrix * glm::vec4(vertex, 1.0f);
+                break;
+            case SoftwareProgram::GENERATE_CUBEMAP:
+            case SoftwareProgram::FILTER_CUBEMAP_SPECULAR:
+                write_varyings(result.varyings, 0u, draw.cubemap_tbn * glm::vec3(vertex.x, -vertex.y, 1.0f));
+                result.position = glm::vec4(vertex, 1.0f);
+                break;
+            default:
+                std::unreachable();
+        }
+        return result;
+    }
+
+    glm::vec3 tonemap(const glm::vec3& x)
+    {
+        const auto X      = glm::max(glm::vec3(0.0f), x - 0.004f);
+        const auto result = (X * (6.2f * X + 0.5f)) / (X * (6.2f * X + 1.7f) + 0.06f);
+        return glm::pow(result, glm::vec3(2.2f));
+    }
+
+    struct SoftwareSurface
+    {
+        glm::vec3 position;
+        glm::vec3 normal;
+        glm::vec3 view;
+        glm::vec3 diffuse_color;
+        glm::vec3 specular_color;
+        float     shininess;
+    };
+
+    glm::vec3 shade_light(const SoftwareSurface& surface, const glm::vec3& light_dir, const glm::vec3& color)
+    {
+        const auto NdotL    = std::max(glm::dot(surface.normal, light_dir), 0.0f);
+        const auto diffuse  = surface.diffuse_color * color * NdotL;
+
+        const auto halfway  = glm::normalize(light_dir + surface.view);
+        const auto NdotH    = std::max(glm::dot(surface.normal, halfway), 0.0f);
+        const auto specular = std::pow(NdotH, surface.shininess * 128.0f) * surface.specular_color * color;
+
+        return diffuse + specular;
+    }
+
+    float range_window(float dist, float range)
+    {
+        if (range <= 0.0f)
+        {
+            return 1.0f;
+        }
+
+        const auto r = dist / range;
+        const auto w = std::clamp(1.0f - r * r * r * r, 0.0f, 1.0f);
+        return w * w;
+    }
+
+    glm::vec3 shade_local_light(const SoftwareSurface& surface, const LightData& light)
+    {
+        const auto offset = glm::vec3(light.position) - surface.position;
+        const auto dist   = glm::length(offset);
+        const auto dir    = offset / dist;
+
+        auto attenuation = range_window(dist, light.position.w) / (dist * dist);
+
+        if (static_cast<int>(light.direction.w) == std::to_underlying(LightType::SPOT))
+        {
+            const auto theta     = glm::dot(dir, -glm::normalize(glm::vec3(light.direction)));
+            const auto cos_inner = std::cos(light.angles.x);
+            const auto cos_outer = std::cos(light.angles.y);
+            attenuation *= std::clamp((theta - cos_outer) / (cos_inner - cos_outer), 0.0f, 1.0f);
+        }
+
+        return shade_light(surface, dir, glm::vec3(light.color)) * attenuation;
+    }
+
+    // Mirrors shadowView in lighting.glsl.
+    float shadow_view(const SoftwareDraw& draw, int view, const SoftwareSurface& surface)
+    {
+        constexpr auto SHADOW_DEPTH_BIAS = 0.0005f;
+
+        if (view < 0 || view >= MAX_SHADOW_VIEWS || draw.shadow_map == nullptr)
+        {
+            return 1.0f;
+        }
+
+        const auto& matrix = draw.frame.shadow_matrices[view];
+        const auto& tile   = draw.frame.shadow_tiles[view];
+
+        const auto w    = (matrix * glm::vec4(surface.position, 1.0f)).w;
+        const auto clip = matrix * glm::vec4(surface.position + surface.normal * tile.w * w, 1.0f);
+        const auto ndc  = glm::vec3(clip) / clip.w;
+        if (glm::any(glm::greaterThan(glm::abs(ndc), glm::vec3(1.0f))))
+        {
+            return 1.0f;
+        }
+
+        const auto depth = ndc.z * 0.5f + 0.5f - SHADOW_DEPTH_BIAS;
+        const auto first = glm::ivec2(glm::vec2(tile));
+        const auto last  = first + static_cast<int>(tile.z) - 1;
+        const auto base  = first + glm::ivec2(glm::floor((glm::vec2(ndc) * 0.5f + 0.5f) * tile.z - 0.5f));
+
+        auto lit = 0.0f;
+        for (auto y = 0; y < 2; y++)
+        {
+            for (auto x = 0; x < 2; x++)
+            {
+                const auto texel = glm::clamp(base + glm::ivec2(x, y), first, last);
+                lit += depth <= fetch_texture(draw.shadow_map.get(), texel).r ? 1.0f : 0.0f;
+            }
+        }
+        return lit * 0.25f;
+    }
+
+    // Mirrors shadowCascades in lighting.glsl.
+    float shadow_cascades(const SoftwareDraw& draw, int first, const SoftwareSurface& surface)
+    {
+        if (first < 0)
+        {
+            return 1.0f;
+        }
+
+        const auto depth = -(draw.frame.view_matrix * glm::vec4(surface.position, 1.0f)).z;
+        for (auto i = 0; i < SHADOW_CASCADES; i++)
+        {
+            if (depth < draw.frame.shadow_cascade_splits[i])
+            {
+                return shadow_view(draw, first + i, surface);
+            }
+        }
+        return 1.0f;
+    }
+
+    glm::vec3 shade_light_probe(const SoftwareDraw& draw, const SoftwareSurface& surface, float roughness)
+    {
+        const auto reflection = glm::reflect(-surface.view, surface.normal);
+        const auto diffuse    = evaluate(draw.irradiance, surface.normal) * surface.diffuse_color;
+
+        auto specular = glm::vec3(0.0f);
+        if (roughness < 0.1f)
+        {
+            specular = glm::vec3(sample_cubemap(draw.light_probe_environment.get(), reflection, 0.0f)) * surface.specular_color;
+        }
+        else
+        {
+            specular = glm::vec3(sample_cubemap(draw.light_probe_specular.get(), reflection, roughness * static_cast<float>(SPECULAR_MIP_LEVELS - 1))) * surface.specular_color;
+        }
+
+        return diffuse + specular;
+    }
+
+    // Index that clamps instead of overflowing on large or NaN values.
+    int clamp_index(float value, int count)
+    {
+        if (!(value >= 0.0f) || count <= 0)
+        {
+            return 0;
+        }
+        return std::min(static_cast<int>(std::min(value, static_cast<float>(count))), count - 1);
+    }
+
+    template <typename T>
+    size_t get_storage_count(const SoftwareStorage& storage)
+    {
+        return storage != nullptr ? storage->size() / sizeof(T) : 0u;
+    }
+
+    template <typename T>
+    T read_storage(const SoftwareStorage& storage, size_t index)
+    {
+        auto value = T{};
+        std::memcpy(&value, storage->data() + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    glm::vec3 shade_cluster_lights(const SoftwareDraw& draw, const SoftwareSurface& surface, const glm::vec2& frag_coord)
+    {
+        const auto& frame = draw.frame;
+        const auto  grid  = frame.cluster_grid;
+
+        const auto z_near  = frame.cluster_depth.x;
+        const auto z_far   = frame.cluster_depth.y;
+        const auto depth   = -(frame.view_matrix * glm::vec4(surface.position, 1.0f)).z;
+        const auto slice   = std::log(std::max(depth, z_near) / z_near) / std::log(z_far / z_near) * static_cast<float>(grid.z);
+        const auto tile    = frag_coord / frame.cluster_tile_size;
+        const auto cluster = glm::ivec3(clamp_index(tile.x, grid.x), clamp_index(tile.y, grid.y), clamp_index(std::floor(slice), grid.z));
+        const auto index   = static_cast<size_t>(cluster.x + grid.x * (cluster.y + grid.y * cluster.z));
+
+        if (index >= get_storage_count<glm::uvec2>(draw.cluster_ranges))
+        {
+            return glm::vec3(0.0f);
+        }
+
+        const auto range         = read_storage<glm::uvec2>(draw.cluster_ranges, index);
+        const auto light_count   = get_storage_count<LightData>(draw.cluster_lights);
+        const auto index_count   = get_storage_count<uint32_t>(draw.cluster_light_indexes);
+
+        auto result = glm::vec3(0.0f);
+        for (auto i = 0u; i < range.y && range.x + i < index_count; i++)
+        {
+            const auto light_index = read_storage<uint32_t>(draw.cluster_light_indexes, range.x + i);
+            if (light_index < light_count)
+            {
+                const auto light = read_storage<LightData>(draw.cluster_lights, light_index);
+                result += shade_local_light(surface, light) * shadow_view(draw, static_cast<int>(light.angles.z), surface);
+            }
+        }
+        return result;
+    }
+
+    SoftwareSurface make_surface(const glm::vec3& position, const glm::vec3& normal, const glm::vec3& camera_position, const glm::vec3& base_color, float metallic, float roughness)
+    {
+        auto surface = SoftwareSurface{};
+        surface.position       = position;
+        surface.normal         = normal;
+        surface.view           = glm::normalize(camera_position - position);
+        surface.diffuse_color  = glm::mix(base_color, glm::vec3(0.0f), metallic);
+        surface.specular_color = glm::mix(glm::vec3(0.04f), base_color, metallic);
+        surface.shininess      = glm::mix(2.0f, 256.0f, 1.0f - roughness);
+        return surface;
+    }
+
+    // Mirrors shadeSurface in lighting.glsl, the result is not tone mapped.
+    glm::vec3 shade_surface(const SoftwareDraw& draw, const SoftwareSurface& surface, const glm::vec3& base_color, float roughness, const glm::vec3& emissive, const glm::vec2& frag_coord)
+    {
+        auto result = emissive;
+
+        if (draw.light_probe_enabled)
+        {
+            result += shade_light_probe(draw, surface, roughness);
+        }
+
+        for (const auto& light : draw.frame.lights)
+        {
+            switch (static_cast<LightType>(static_cast<int>(light.direction.w)))
+            {
+                case LightType::AMBIENT:
+                    result += base_color * glm::vec3(light.color);
+                    break;
+                case LightType::DIRECTIONAL:
+                    result += shade_light(surface, glm::normalize(-glm::vec3(light.direction)), glm::vec3(light.color)) * shadow_cascades(draw, static_cast<int>(light.angles.z), surface);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        result += shade_cluster_lights(draw, surface, frag_coord);
+
+        return result;
+    }
+
+    // The material of a fragment, sampled like Forward.frag and GBuffer.frag.
+    struct SoftwareMaterialSample
+    {
+        glm::vec4 base_color;
+        glm::vec3 normal;
+        float     metallic;
+        float     roughness;
+        glm::vec3 emissive;
+    };
+
+    SoftwareMaterialSample sample_material(const SoftwareDraw& draw, const SoftwareFragment& fragment)
+    {
+        const auto* v        = fragment.varyings;
+        const auto  texcoord = glm::vec2(v[0], v[1]);
+        const auto  tbn      = glm::mat3(read_vec3(v, 5u), read_vec3(v, 8u), read_vec3(v, 11u));
+
+        auto sample = [&] (const std::shared_ptr<SoftwareTexture>& texture) {
+            return sample_texture(texture.get(), texcoord, fragment.texcoord_dx, fragment.texcoord_dy);
+        };
+
+        const auto& material           = draw.material;
+        const auto  metallic_roughness = sample(draw.metallic_roughness_map);
+        const auto  normal_map         = glm::vec3(sample(draw.normal_map));
+
+        return {
+            .base_color = sample(draw.base_color_map) * material.base_color_factor,
+            .normal     = glm::normalize(tbn * (normal_map * 2.0f - 1.0f)),
+            .metallic   = metallic_roughness.r * material.metallic_factor,
+            .roughness  = metallic_roughness.g * material.roughness_factor,
+            .emissive   = glm::vec3(sample(draw.emissive_map)) * material.emissive_factor
+        };
+    }
+
+    glm::vec4 shade_forward(const SoftwareDraw& draw, const SoftwareFragment& fragment)
+    {
+        const auto material = sample_material(draw, fragment);
+        const auto surface  = make_surface(read_vec3(fragment.varyings, 2u), material.normal, draw.camera_position, glm::vec3(material.base_color), material.metallic, material.roughness);
+        const auto result   = shade_surface(draw, surface, glm::vec3(material.base_color), material.roughness, material.emissive, fragment.frag_coord);
+
+        return glm::vec4(tonemap(result), material.base_color.a);
+    }
+
+    glm::vec2 equirectangular_uv(const glm::vec3& direction)
+    {
+        const auto d = glm::normalize(direction);
+        return glm::vec2(0.5f + std::atan2(d.x, d.y) / (2.0f * PI), 0.5f + std::asin(std::clamp(d.z, -1.0f, 1.0f)) / PI);
+    }
+
+    glm::vec2 hammersley(unsigned int i, unsigned int n)
+    {
+        auto bits = i;
+        bits = (bits << 16u) | (bits >> 16u);
+        bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+        bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+        bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+        bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+        return glm::vec2(static_cast<float>(i) / static_cast<float>(n), static_cast<float>(bits) * 2.3283064365386963e-10f);
+    }
+
+    // Mirrors FilterCubemapSpecular.frag, GGX importance sampling with the source mip picked by the sample pdf.
+    glm::vec4 filter_specular(const SoftwareDraw& draw, const glm::vec3& direction)
+    {
+        const auto normal    = glm::normalize(direction);
+        const auto roughness = static_cast<float>(draw.mip_level) / static_cast<float>(SPECULAR_MIP_LEVELS - 1);
+        if (roughness == 0.0f || draw.cubemap == nullptr)
+        {
+            return glm::vec4(glm::vec3(sample_cubemap(draw.cubemap.get(), normal, 0.0f)), 1.0f);
+        }
+
+        const auto up      = std::abs(normal.z) < 0.999f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+        const auto right   = glm::normalize(glm::cross(up, normal));
+        const auto tbn     = glm::mat3(right, glm::cross(normal, right), normal);
+        const auto alpha   = roughness * roughness;
+        const auto a2      = alpha * alpha;
+        const auto samples = static_cast<unsigned int>(std::lerp(16.0f, 64.0f, roughness));
+
+        const auto size              = static_cast<float>(draw.cubemap->get_face(0u, 0u).size.x);
+        const auto texel_solid_angle = 4.0f * PI / (6.0f * size * size);
+
+        auto color  = glm::vec3(0.0f);
+        auto weight = 0.0f;
+        for (auto i = 0u; i < samples; i++)
+        {
+            const auto xi        = hammersley(i, samples);
+            const auto phi       = xi.y * 2.0f * PI;
+            const auto cos_theta = std::sqrt((1.0f - xi.x) / (1.0f + (a2 - 1.0f) * xi.x));
+            const auto sin_theta = std::sqrt(1.0f - cos_theta * cos_theta);
+            const auto h         = tbn * glm::vec3(std::cos(phi) * sin_theta, std::sin(phi) * sin_theta, cos_theta);
+            const auto l         = glm::reflect(-normal, h);
+
+            const auto n_dot_l = glm::dot(normal, l);
+            if (n_dot_l > 0.0f)
+            {
+                const auto n_dot_h = std::max(glm::dot(normal, h), 0.0f);
+                const auto d       = n_dot_h * n_dot_h * (a2 - 1.0f) + 1.0f;
+                const auto pdf     = a2 / (PI * d * d) * 0.25f;
+
+                const auto sample_solid_angle = 1.0f / (static_cast<float>(samples) * pdf + 0.0001f);
+                const auto mip                = std::max(0.5f * std::log2(sample_solid_angle / texel_solid_angle) + 1.0f, 0.0f);
+
+                color  += glm::vec3(sample_cubemap(draw.cubemap.get(), l, mip)) * n_dot_l;
+                weight += n_dot_l;
+            }
+        }
+
+        return glm::vec4(color / std::max(weight, 0.0001f), 1.0f);
+    }
+
+    // Shades a texel of a generated cube map, returns false if it is discarded.
+    //
+    // The neighbouring directions take the place of the screen space derivatives.
+    bool shade_cubemap(const SoftwareDraw& draw, const glm::vec3& direction, const glm::vec3& direction_dx, const glm::vec3& direction_dy, glm::vec4& color)
+    {
+        switch (draw.program)
+        {
+            case SoftwareProgram::GENERATE_CUBEMAP:
+            {
+                const auto uv = equirectangular_uv(direction);
+                color = sample_texture(draw.texture.get(), uv, equirectangular_uv(direction_dx) - uv, equirectangular_uv(direction_dy) - uv);
+                return true;
+            }
+            case SoftwareProgram::FILTER_CUBEMAP_SPECULAR:
+                if (draw.mip_level >= SPECULAR_MIP_LEVELS)
+                {
+                    return false;
+                }
+                color = filter_specular(draw, direction);
+                return true;
+            default:
+                std::unreachable();
+        }
+    }
+
+    // What the fragment stage writes, out_FragColor0 to 7 and gl_FragDepth.
+    struct SoftwareOutput
+    {
+        std::array<glm::vec4, MAX_COLOR_OUTPUTS> colors = {};
+        float                                    depth  = 0.0f;
+    };
+
+    // Mirrors GBuffer.frag, the layout must match SceneRenderer's geometry buffer.
+    void shade_geometry_buffer(const SoftwareDraw& draw, const SoftwareFragment& fragment, SoftwareOutput& output)
+    {
+        const auto material = sample_material(draw, fragment);
+        output.colors[0] = glm::vec4(glm::vec3(material.base_color), 1.0f);
+        output.colors[1] = glm::vec4(material.normal, 0.0f);
+        output.colors[2] = glm::vec4(material.metallic, material.roughness, 0.0f, 1.0f);
+        output.colors[3] = glm::vec4(material.emissive, 1.0f);
+    }
+
+    // Mirrors DeferredLighting.frag, returns false where nothing was drawn.
+    bool shade_deferred_lighting(const SoftwareDraw& draw, const SoftwareFragment& fragment, SoftwareOutput& output)
+    {
+        if (draw.gbuffer_depth == nullptr)
+        {
+            return false;
+        }
+
+        const auto texel = glm::ivec2(glm::floor(fragment.frag_coord));
+        const auto depth = fetch_texture(draw.gbuffer_depth.get(), texel).r;
+        if (depth == 1.0f)
+        {
+            return false;
+        }
+
+        const auto uv       = fragment.frag_coord / glm::vec2(draw.gbuffer_depth->get_size());
+        const auto world    = draw.frame.inverse_view_projection_matrix * glm::vec4(glm::vec3(uv, depth) * 2.0f - 1.0f, 1.0f);
+        const auto position = glm::vec3(world) / world.w;
+
+        const auto base_color         = glm::vec3(fetch_texture(draw.gbuffer_base_color.get(), texel));
+        const auto normal             = glm::vec3(fetch_texture(draw.gbuffer_normal.get(), texel));
+        const auto metallic_roughness = fetch_texture(draw.gbuffer_metallic_roughness.get(), texel);
+        const auto emissive           = glm::vec3(fetch_texture(draw.gbuffer_emissive.get(), texel));
+
+        const auto surface = make_surface(position, normal, draw.camera_position, base_color, metallic_roughness.r, metallic_roughness.g);
+        const auto result  = shade_surface(draw, surface, base_color, metallic_roughness.g, emissive, fragment.frag_coord);
+
+        output.colors[0] = glm::vec4(tonemap(result), 1.0f);
+        output.depth     = depth;
+        return true;
+    }
+
+    // Runs the fragment stage, returns false if the fragment is discarded.
+    bool shade_fragment(const SoftwareDraw& draw, const SoftwareFragment& fragment, SoftwareOutput& output)
+    {
+        auto& color = output.colors[0];
+        switch (draw.program)
+        {
+            case SoftwareProgram::FORWARD:
+                color = shade_forward(draw, fragment);
+                return true;
+            case SoftwareProgram::GEOMETRY_BUFFER:
+                shade_geometry_buffer(draw, fragment, output);
+                return true;
+            case SoftwareProgram::DEFERRED_LIGHTING:
+                return shade_deferred_lighting(draw, fragment, output);
+            case SoftwareProgram::SHADOW:
+                return true;
+            case SoftwareProgram::SHADOW_COPY:
+            {
+                // mirrors ShadowCopy.frag
+                const auto texcoord = glm::vec2(fragment.varyings[0], fragment.varyings[1]);
+                const auto size     = draw.texture != nullptr ? glm::vec2(draw.texture->get_size()) : glm::vec2(0.0f);
+                output.depth = fetch_texture(draw.texture.get(), glm::ivec2(texcoord * size)).r;
+                return true;
+            }
+            case SoftwareProgram::SKYBOX:
+            {
+                const auto direction = glm::normalize(read_vec3(fragment.varyings, 0u));
+                color = glm::vec4(tonemap(glm::vec3(sample_cubemap(draw.environment.get(), direction, 0.0f))), 1.0f);
+                return true;
+            }
+            case SoftwareProgram::SCREEN:
+            {
+                const auto texcoord = glm::vec2(fragment.varyings[0], fragment.varyings[1]);
+                color = sample_texture(draw.base_color_map.get(), texcoord, fragment.texcoord_dx, fragment.texcoord_dy) * draw.base_color_factor;
+                return true;
+            }
+            case SoftwareProgram::DEBUG_LINE:
+                color = glm::vec4(fragment.varyings[0], fragment.varyings[1], fragment.varyings[2], fragment.varyings[3]);
+                return true;
+            case SoftwareProgram::GENERATE_CUBEMAP:
+            case SoftwareProgram::FILTER_CUBEMAP_SPECULAR:
+            {
+                const auto direction = read_vec3(fragment.varyings, 0u);
+                return shade_cubemap(draw, direction, direction, direction, color);
+            }
+            default:
+                std::unreachable();
+        }
+    }
+
+    bool test_depth(const SoftwareDraw& draw, const SoftwareTarget& target, size_t index, float z)
+    {
+        if (draw.depth_test == DepthTest::DISABLED || target.depth == nullptr)
+        {
+            return true;
+        }
+        return z <= target.depth[index];
+    }
+
+    void write_fragment(const SoftwareDraw& draw, const SoftwareTarget& target, size_t index, const SoftwareOutput& output)
+    {
+        if (draw.depth_test == DepthTest::ENABLED && target.depth != nullptr)
+        {
+            target.depth[index] = output.depth;
+        }
+
+        for (auto i = 0u; i < MAX_COLOR_OUTPUTS; i++)
+        {
+            if (target.colors[i] == nullptr)
+            {
+                continue;
+            }
+
+            const auto& color = output.colors[i];
+            const auto  src   = target.saturate[i] ? glm::clamp(color, 0.0f, 1.0f) : color;
+            auto&       dst   = target.colors[i][index];
+            switch (draw.blend_mode)
+            {
+                case BlendMode::DISABLED:
+                    dst = src;
+                    break;
+                case BlendMode::ALPHA:
+                    dst = src * src.a + dst * (1.0f - src.a);
+                    break;
+                case BlendMode::ONE:
+                    dst = src + dst;
+                    break;
+                default:
+                    std::unreachable();
+            }
+
+            if (target.saturate[i])
+            {
+                dst = glm::clamp(dst, 0.0f, 1.0f);
+            }
+        }
+    }
+
+    // Edge function a * x + b * y + c, positive inside counter clockwise triangles.
+    struct SoftwareEdge
+    {
+        float a;
+        float b;
+        float c;
+        bool  top_left; //!< Owns the pixels exactly on the edge, so that shared edges are drawn once.
+
+        float evaluate(const glm::vec2& p) const
+        {
+            return a * p.x + b * p.y + c;
+        }
+
+        bool covers(float value) const
+        {
+            return value > 0.0f || (value == 0.0f && top_left);
+        }
+    };
+
+    SoftwareEdge make_edge(const glm::vec4& from, const glm::vec4& to)
+    {
+        const auto a = from.y - to.y;
+        const auto b = to.x - from.x;
+        return {a, b, -(a * from.x + b * from.y), to.y < from.y || (to.y == from.y && to.x < from.x)};
+    }
+
+    void rasterize_triangle(const SoftwareDraw& draw, const SoftwarePrimitive& primitive, const glm::ivec4& rect, const SoftwareTarget& target)
+    {
+        const auto& v = primitive.vertexes;
+
+        const auto e0   = make_edge(v[1].position, v[2].position);
+        const auto e1   = make_edge(v[2].position, v[0].position);
+        const auto e2   = make_edge(v[0].position, v[1].position);
+        const auto area = e0.evaluate(glm::vec2(v[0].position));
+        if (!(area > 0.0f))
+        {
+            return;
+        }
+
+        const auto inv_area = 1.0f / area;
+        const auto count    = get_varying_count(draw.program);
+
+        // screen space gradients of the barycentric coordinates, for texture derivatives
+        const auto dl_dx = glm::vec3(e0.a, e1.a, e2.a) * inv_area;
+        const auto dl_dy = glm::vec3(e0.b, e1.b, e2.b) * inv_area;
+        const auto depth = glm::vec3(v[0].position.z, v[1].position.z, v[2].position.z);
+        const auto inv_w = glm::vec3(v[0].position.w, v[1].position.w, v[2].position.w);
+        const auto tu    = glm::vec3(v[0].varyings[0], v[1].varyings[0], v[2].varyings[0]);
+        const auto tv    = glm::vec3(v[0].varyings[1], v[1].varyings[1], v[2].varyings[1]);
+        const auto dw_dx = glm::dot(inv_w, dl_dx);
+        const auto dw_dy = glm::dot(inv_w, dl_dy);
+        const auto dt_dx = glm::vec2(glm::dot(tu, dl_dx), glm::dot(tv, dl_dx));
+        const auto dt_dy = glm::vec2(glm::dot(tu, dl_dy), glm::dot(tv, dl_dy));
+        const auto texcoords  = has_texcoords(draw.program);
+        const auto late_depth = writes_depth(draw.program);
+
+        auto varyings = Varyings{};
+        auto output   = SoftwareOutput{};
+        for (auto y = rect.y; y < rect.w; y++)
+        {
+            for (auto x = rect.x; x < rect.z; x++)
+            {
+                const auto p  = glm::vec2(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                const auto w0 = e0.evaluate(p);
+                const auto w1 = e1.evaluate(p);
+                const auto w2 = e2.evaluate(p);
+                if (!e0.covers(w0) || !e1.covers(w1) || !e2.covers(w2))
+                {
+                    continue;
+                }
+
+                const auto l     = glm::vec3(w0, w1, w2) * inv_area;
+                const auto z     = glm::dot(l, depth);
+                const auto index = static_cast<size_t>(y) * target.size.x + static_cast<size_t>(x);
+                if (!late_depth && !test_depth(draw, target, index, z))
+                {
+                    continue;
+                }
+
+                const auto w = 1.0f / glm::dot(l, inv_w);
+                for (auto k = 0u; k < count; k++)
+                {
+                    varyings[k] = (l.x * v[0].varyings[k] + l.y * v[1].varyings[k] + l.z * v[2].varyings[k]) * w;
+                }
+
+                auto fragment = SoftwareFragment{
+                    .frag_coord = p,
+                    .varyings   = varyings.data()
+                };
+                if (texcoords)
+                {
+                    const auto texcoord = glm::vec2(varyings[0], varyings[1]);
+                    fragment.texcoord_dx = (dt_dx - texcoord * dw_dx) * w;
+                    fragment.texcoord_dy = (dt_dy - texcoord * dw_dy) * w;
+                }
+
+                output.depth = z;
+                if (shade_fragment(draw, fragment, output) && (!late_depth || test_depth(draw, target, index, output.depth)))
+                {
+                    write_fragment(draw, target, index, output);
+                }
+            }
+        }
+    }
+
+    void rasterize_line(const SoftwareDraw& draw, const SoftwarePrimitive& primitive, const glm::ivec4& rect, const SoftwareTarget& target)
+    {
+        const auto& a = primitive.vertexes[0];
+        const auto& b = primitive.vertexes[1];
+
+        // one fragment per pixel along the major axis
+        const auto d       = glm::vec2(b.position - a.position);
+        const auto major_x = std::abs(d.x) >= std::abs(d.y);
+        const auto length  = major_x ? d.x : d.y;
+        if (length == 0.0f)
+        {
+            return;
+        }
+
+        const auto start = major_x ? a.position.x : a.position.y;
+        const auto first = major_x ? rect.x : rect.y;
+        const auto last  = major_x ? rect.z : rect.w;
+        const auto count = get_varying_count(draw.program);
+
+        auto varyings = Varyings{};
+        auto output   = SoftwareOutput{};
+        for (auto i = first; i < last; i++)
+        {
+            const auto t = (static_cast<float>(i) + 0.5f - start) / length;
+            if (t < 0.0f || t > 1.0f)
+            {
+                continue;
+            }
+
+            const auto p = glm::mix(glm::vec2(a.position), glm::vec2(b.position), t);
+            const auto x = major_x ? i : static_cast<int>(std::floor(p.x));
+            const auto y = major_x ? static_cast<int>(std::floor(p.y)) : i;
+            if (x < rect.x || x >= rect.z || y < rect.y || y >= rect.w)
+            {
+                continue;
+            }
+
+            const auto z     = glm::mix(a.position.z, b.position.z, t);
+            const auto index = static_cast<size_t>(y) * target.size.x + static_cast<size_t>(x);
+            if (!test_depth(draw, target, index, z))
+            {
+                continue;
+            }
+
+            const auto w = 1.0f / glm::mix(a.position.w, b.position.w, t);
+            for (auto k = 0u; k < count; k++)
+            {
+                varyings[k] = glm::mix(a.varyings[k], b.varyings[k], t) * w;
+            }
+
+            auto fragment = SoftwareFragment{
+                .frag_coord = glm::vec2(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f),
+                .varyings   = varyings.data()
+            };
+
+            output.depth = z;
+            if (shade_fragment(draw, fragment, output))
+            {
+                write_fragment(draw, target, index, output);
+            }
+        }
+    }
+
+    // Clip planes in homogeneous space, a position is inside when the dot product is not negative.
+    // The x and y planes form a guard band around the view, they only keep window coordinates small
+    // enough for precise edge functions, pixels outside the viewport are dropped in binning.
+    constexpr auto GUARD_BAND       = 4.0f;
+    constexpr auto CLIP_PLANE_COUNT = 6u;
+    const auto clip_planes = std::array<glm::vec4, CLIP_PLANE_COUNT>{
+        glm::vec4( 0.0f,  0.0f,  1.0f, 1.0f),
+        glm::vec4( 0.0f,  0.0f, -1.0f, 1.0f),
+        glm::vec4( 1.0f,  0.0f,  0.0f, GUARD_BAND),
+        glm::vec4(-1.0f,  0.0f,  0.0f, GUARD_BAND),
+        glm::vec4( 0.0f,  1.0f,  0.0f, GUARD_BAND),
+        glm::vec4( 0.0f, -1.0f,  0.0f, GUARD_BAND)
+    };
+
+    constexpr auto MAX_CLIP_VERTEXES = 3u + CLIP_PLANE_COUNT;
+
+    using ClipPolygon = std::array<SoftwareClipVertex, MAX_CLIP_VERTEXES>;
+
+    SoftwareClipVertex lerp(const SoftwareClipVertex& a, const SoftwareClipVertex& b, float t)
+    {
+        auto result = SoftwareClipVertex{};
+        result.position = glm::mix(a.position, b.position, t);
+        for (auto i = 0u; i < MAX_VARYINGS; i++)
+        {
+            result.varyings[i] = a.varyings[i] + (b.varyings[i] - a.varyings[i]) * t;
+        }
+        return result;
+    }
+
+    bool is_inside(const SoftwareClipVertex& vertex)
+    {
+        return std::all_of(begin(clip_planes), end(clip_planes), [&] (const auto& plane) {
+            return glm::dot(plane, vertex.position) >= 0.0f;
+        });
+    }
+
+    // Sutherland-Hodgman against all planes, returns the vertex count of the clipped polygon.
+    size_t clip_polygon(ClipPolygon& polygon, size_t count)
+    {
+        auto buffer = ClipPolygon{};
+        for (const auto& plane : clip_planes)
+        {
+            auto n = size_t{0u};
+            for (auto i = size_t{0u}; i < count; i++)
+            {
+                const auto& a  = polygon[i];
+                const auto& b  = polygon[(i + 1u) % count];
+                const auto  da = glm::dot(plane, a.position);
+                const auto  db = glm::dot(plane, b.position);
+
+                if (da >= 0.0f)
+                {
+                    buffer[n++] = a;
+                }
+                if ((da >= 0.0f) != (db >= 0.0f))
+                {
+                    buffer[n++] = lerp(a, b, da / (da - db));
+                }
+            }
+
+            std::copy_n(begin(buffer), n, begin(polygon));
+            count = n;
+            if (count < 3u)
+            {
+                return 0u;
+            }
+        }
+        return count;
+    }
+
+    bool clip_line(SoftwareClipVertex& a, SoftwareClipVertex& b)
+    {
+        auto t0 = 0.0f;
+        auto t1 = 1.0f;
+        for (const auto& plane : clip_planes)
+        {
+            const auto da = glm::dot(plane, a.position);
+            const auto db = glm::dot(plane, b.position);
+            if (da < 0.0f && db < 0.0f)
+            {
+                return false;
+            }
+            if (da < 0.0f)
+            {
+                t0 = std::max(t0, da / (da - db));
+            }
+            else if (db < 0.0f)
+            {
+                t1 = std::min(t1, da / (da - db));
+            }
+        }
+
+        if (t0 > t1)
+        {
+            return false;
+        }
+
+        const auto ca = lerp(a, b, t0);
+        const auto cb = lerp(a, b, t1);
+        a = ca;
+        b = cb;
+        return true;
+    }
+
+    SoftwareVertex project(const SoftwareClipVertex& vertex, const Viewport& viewport)
+    {
+        const auto inv_w = 1.0f / vertex.position.w;
+        const auto ndc   = glm::vec3(vertex.position) * inv_w;
+
+        auto result = SoftwareVertex{};
+        result.position = glm::vec4(
+            static_cast<float>(viewport.position.x) + (ndc.x * 0.5f + 0.5f) * static_cast<float>(viewport.size.x),
+            static_cast<float>(viewport.position.y) + (ndc.y * 0.5f + 0.5f) * static_cast<float>(viewport.size.y),
+            ndc.z * 0.5f + 0.5f,
+            inv_w
+        );
+        for (auto i = 0u; i < MAX_VARYINGS; i++)
+        {
+            result.varyings[i] = vertex.varyings[i] * inv_w;
+        }
+        return result;
+    }
+
+    // Pixels touched by the vertexes, limited to the scissor rectangle.
+    glm::ivec4 get_bounds(const SoftwareVertex* vertexes, size_t count, const glm::ivec4& scissor, int margin)
+    {
+        auto lo = glm::vec2(vertexes[0].position);
+        auto hi = lo;
+        for (auto i = 1u; i < count; i++)
+        {
+            lo = glm::min(lo, glm::vec2(vertexes[i].position));
+            hi = glm::max(hi, glm::vec2(vertexes[i].position));
+        }
+
+        return glm::ivec4(
+            std::max(static_cast<int>(std::floor(lo.x)) - margin, scissor.x),
+            std::max(static_cast<int>(std::floor(lo.y)) - margin, scissor.y),
+            std::min(static_cast<int>(std::ceil(hi.x)) + margin, scissor.z),
+            std::min(static_cast<int>(std::ceil(hi.y)) + margin, scissor.w)
+        );
+    }
+
+    bool is_empty(const glm::ivec4& rect)
+    {
+        return rect.x >= rect.z || rect.y >= rect.w;
+    }
+
+    void add_triangle(std::vector<SoftwarePrimitive>& primitives, uint32_t draw, const SoftwareVertex& a, const SoftwareVertex& b, const SoftwareVertex& c, const glm::ivec4& scissor)
+    {
+        auto primitive = SoftwarePrimitive{
+            .draw     = draw,
+            .count    = 3u,
+            .vertexes = {a, b, c}
+        };
+
+        // triangles are not culled, so orient them counter clockwise
+        const auto area = make_edge(a.position, b.position).evaluate(glm::vec2(c.position));
+        if (area < 0.0f)
+        {
+            std::swap(primitive.vertexes[1], primitive.vertexes[2]);
+        }
+        else if (!(area > 0.0f))
+        {
+            return;
+        }
+
+        primitive.bounds = get_bounds(primitive.vertexes.data(), 3u, scissor, 0);
+        if (!is_empty(primitive.bounds))
+        {
+            primitives.push_back(primitive);
+        }
+    }
+
+    void add_clipped_triangle(std::vector<SoftwarePrimitive>& primitives, uint32_t draw, const SoftwareClipVertex& a, const SoftwareClipVertex& b, const SoftwareClipVertex& c, const Viewport& viewport, const glm::ivec4& scissor)
+    {
+        auto polygon = ClipPolygon{};
+        polygon[0] = a;
+        polygon[1] = b;
+        polygon[2] = c;
+
+        auto count = size_t{3u};
+        if (!is_inside(a) || !is_inside(b) || !is_inside(c))
+        {
+            count = clip_polygon(polygon, count);
+        }
+
+        auto projected = std::array<SoftwareVertex, MAX_CLIP_VERTEXES>{};
+        for (auto i = size_t{0u}; i < count; i++)
+        {
+            if (!(polygon[i].position.w > 0.0f))
+            {
+                return;
+            }
+            projected[i] = project(polygon[i], viewport);
+        }
+
+        for (auto i = size_t{1u}; i + 1u < count; i++)
+        {
+            add_triangle(primitives, draw, projected[0], projected[i], projected[i + 1u], scissor);
+        }
+    }
+
+    void add_clipped_line(std::vector<SoftwarePrimitive>& primitives, uint32_t draw, SoftwareClipVertex a, SoftwareClipVertex b, const Viewport& viewport, const glm::ivec4& scissor)
+    {
+        if (!clip_line(a, b) || !(a.position.w > 0.0f) || !(b.position.w > 0.0f))
+        {
+            return;
+        }
+
+        auto primitive = SoftwarePrimitive{
+            .draw     = draw,
+            .count    = 2u,
+            .vertexes = {project(a, viewport), project(b, viewport)}
+        };
+
+        primitive.bounds = get_bounds(primitive.vertexes.data(), 2u, scissor, 1);
+        if (!is_empty(primitive.bounds))
+        {
+            primitives.push_back(primitive);
+        }
+    }
+
+    size_t get_component_count(ColorMode mode)
+    {
+        switch (mode)
+        {
+            case ColorMode::MONO:
+            case ColorMode::DEPTH:
+                return 1u;
+            case ColorMode::RGB:
+            case ColorMode::BGR:
+                return 3u;
+            case ColorMode::RGBA:
+            case ColorMode::BGRA:
+                return 4u;
+            default:
+                std::unreachable();
+        }
+    }
+
+    // Expands a texel the way OpenGL does when sampling it.
+    glm::vec4 read_texel(const uint8_t* texel, DataType data_type, ColorMode color_mode)
+    {
+        auto c = std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f};
+        for (auto i = 0u; i < get_component_count(color_mode); i++)
+        {
+            if (data_type == DataType::FLOAT)
+            {
+                std::memcpy(&c[i], texel + i * sizeof(float), sizeof(float));
+            }
+            else
+            {
+                c[i] = static_cast<float>(texel[i]) / 255.0f;
+            }
+        }
+
+        switch (color_mode)
+        {
+            case ColorMode::BGR:
+            case ColorMode::BGRA:
+                return glm::vec4(c[2], c[1], c[0], c[3]);
+            default:
+                return glm::vec4(c[0], c[1], c[2], c[3]);
+        }
+    }
+
+    SoftwareImage read_image(const Texture& texture)
+    {
+        const auto size   = texture.get_size();
+        auto       image  = SoftwareImage(size);
+        const auto memory = static_cast<const uint8_t*>(texture.get_memory());
+        if (memory == nullptr)
+        {
+            return image;
+        }
+
+        const auto data_type  = texture.get_data_type();
+        const auto color_mode = texture.get_color_mode();
+        const auto texel_size = get_component_count(color_mode) * (data_type == DataType::FLOAT ? sizeof(float) : 1u);
+        // rows are 4 byte aligned, the default GL_UNPACK_ALIGNMENT
+        const auto pitch      = (size.x * texel_size + 3u) / 4u * 4u;
+
+        for (auto y = size_t{0u}; y < size.y; y++)
+        {
+            for (auto x = size_t{0u}; x < size.x; x++)
+            {
+                image.pixels[y * size.x + x] = read_texel(memory + y * pitch + x * texel_size, data_type, color_mode);
+            }
+        }
+
+        return image;
+    }
+
+    uint8_t to_byte(float value)
+    {
+        return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    std::shared_ptr<Mesh> create_memory_fullscreen_mesh()
+    {
+        return std::make_shared<MemoryMesh>(MeshData{
+            .vertexes = {
+                {-1.0f, -1.0f, 0.0f},
+                { 1.0f, -1.0f, 0.0f},
+                { 1.0f,  1.0f, 0.0f},
+                {-1.0f,  1.0f, 0.0f}
+            },
+            .texcoords = {
+                {0.0f, 0.0f},
+                {1.0f, 0.0f},
+                {1.0f, 1.0f},
+                {0.0f, 1.0f}
+            },
+            .faces = {
+                {0, 1, 2},
+                {2, 3, 0}
+            }
+        });
+    }
+
+    std::shared_ptr<SoftwareFrameBuffer> create_back_buffer(const glm::uvec2& size)
+    {
+        return std::make_shared<SoftwareFrameBuffer>(FrameBuffer::BufferConfig{
+            .id     = "Back Buffer",
+            .size   = size,
+            .depth  = DataType::FLOAT,
+            .colors = {{DataType::UNSIGNED_BYTE, ColorMode::RGBA}}
+        });
+    }
+
+    glm::uvec2 get_window_size(SDL_Window* window)
+    {
+        check(window != nullptr);
+        int w, h;
+        SDL_GetWindowSizeInPixels(window, &w, &h);
+        return {static_cast<unsigned int>(w), static_cast<unsigned int>(h)};
+    }
+
+    SoftwareGraphicContext::SoftwareGraphicContext()
+    : SoftwareGraphicContext(Init{}) {}
+
+    SoftwareGraphicContext::SoftwareGraphicContext(Init init)
+    {
+        auto threads = init.threads != 0u ? init.threads : std::max(std::thread::hardware_concurrency(), 1u);
+        workers = std::make_unique<WorkerPool>(threads - 1u);
+        state   = std::make_unique<SoftwareDrawState>();
+
+        viewport.size = init.size;
+        back_buffer   = create_back_buffer(init.size);
+
+        white_fallback_texture  = std::make_shared<SoftwareTexture>("Fallback White", SoftwareImage(glm::uvec2(1u), glm::vec4(1.0f)), TextureFilter::NEAREST, Clamp::NO_CLAMP);
+        normal_fallback_texture = std::make_shared<SoftwareTexture>("Fallback Normal", SoftwareImage(glm::uvec2(1u), glm::vec4(0.5f, 0.5f, 1.0f, 1.0f)), TextureFilter::NEAREST, Clamp::NO_CLAMP);
+    }
+
+    SoftwareGraphicContext::SoftwareGraphicContext(SDL_Window* window)
+    : SoftwareGraphicContext(Init{.size = get_window_size(window)})
+    {
+        this->window = window;
+        if (SDL_GetWindowSurface(window) == nullptr)
+        {
+            throw std::runtime_error(SDL_GetError());
+        }
+    }
+
+    SoftwareGraphicContext::~SoftwareGraphicContext() = default;
+
+    Api SoftwareGraphicContext::get_api() const
+    {
+        return Api::SOFTWARE;
+    }
+
+    std::shared_ptr<MemoryTexture> SoftwareGraphicContext::screenshot() const
+    {
+        const auto* image  = back_buffer->get_color_image();
+        const auto  size   = viewport.size;
+        auto        buffer = std::vector<uint8_t>(size_t{size.x} * size.y * 3u, 0u);
+
+        for (auto y = 0u; y < size.y; y++)
+        {
+            for (auto x = 0u; x < size.x; x++)
+            {
+                const auto pos = viewport.position + glm::uvec2(x, y);
+                if (pos.x >= image->size.x || pos.y >= image->size.y)
+                {
+                    continue;
+                }
+
+                const auto& color = image->at(static_cast<int>(pos.x), static_cast<int>(pos.y));
+                auto*       texel = &buffer[(size_t{y} * size.x + x) * 3u];
+                texel[0] = to_byte(color.b);
+                texel[1] = to_byte(color.g);
+                texel[2] = to_byte(color.r);
+            }
+        }
+
+        return MemoryTexture::create({
+            .size       = size,
+            .data_type  = DataType::UNSIGNED_BYTE,
+            .color_mode = ColorMode::BGR,
+            .memory     = buffer.data()
+        });
+    }
+
+    std::shared_ptr<Shader> SoftwareGraphicContext::compile(const Shader::Source& source)
+    {
+        return std::make_shared<SoftwareShader>(identify_program(source));
+    }
+
+    std::shared_ptr<FrameBuffer> SoftwareGraphicContext::create_frame_buffer(const FrameBuffer::BufferConfig& config)
+    {
+        return std::make_shared<SoftwareFrameBuffer>(config);
+    }
+
+    std::shared_ptr<CubeMap> SoftwareGraphicContext::generate_cubemap(const CubeMapGenerator& generator)
+    {
+        return generate_cubemap_faces(generator, 0u, 6u * std::max(generator.miplevels, 1u));
+    }
+
+    std::shared_ptr<CubeMap> SoftwareGraphicContext::generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count)
+    {
+        static const glm::mat3 cube_tbn[6] = {
+            glm::mat3(glm::vec3( 0,  0, -1), glm::vec3( 0,  1,  0), glm::vec3( 1,  0,  0)),
+            glm::mat3(glm::vec3( 0,  0,  1), glm::vec3( 0,  1,  0), glm::vec3(-1,  0,  0)),
+            glm::mat3(glm::vec3( 1,  0,  0), glm::vec3( 0,  0, -1), glm::vec3( 0,  1,  0)),
+            glm::mat3(glm::vec3( 1,  0,  0), glm::vec3( 0,  0,  1), glm::vec3( 0, -1,  0)),
+            glm::mat3(glm::vec3( 1,  0,  0), glm::vec3( 0,  1,  0), glm::vec3( 0,  0,  1)),
+            glm::mat3(glm::vec3(-1,  0,  0), glm::vec3( 0,  1,  0), glm::vec3( 0,  0, -1))
+        };
+
+        auto shader = std::dynamic_pointer_cast<SoftwareShader>(generator.shader);
+        check(shader, "The cube map generator needs a software shader.");
+
+        auto cubemap = std::dynamic_pointer_cast<SoftwareCubeMap>(generator.target);
+        if (cubemap == nullptr)
+        {
+            check(generator.target == nullptr, "The cube map passed to the software generator must be a software cube map.");
+
+            auto shading_size = generator.size;
+            if (shader->get_program() == SoftwareProgram::FILTER_CUBEMAP_SPECULAR)
+            {
+                shading_size = std::min(shading_size, MAX_FILTERED_CUBEMAP_SIZE);
+            }
+            cubemap = std::make_shared<SoftwareCubeMap>(generator, shading_size);
+        }
+
+        // the generator has its own bindings, the current pass is not affected
+        auto input = SoftwareDrawState{};
+        for (const auto& [loc, value] : generator.uniforms)
+        {
+            shader->set_uniform(loc, value);
+        }
+
+        for (const auto& [slot, texture] : generator.textures)
+        {
+            if (auto cube = std::get_if<std::shared_ptr<CubeMap>>(&texture))
+            {
+                input.cubemaps[slot] = std::dynamic_pointer_cast<SoftwareCubeMap>(*cube);
+            }
+            else
+            {
+                const auto& tex = std::get<std::shared_ptr<Texture>>(texture);
+                auto software_texture = std::dynamic_pointer_cast<SoftwareTexture>(tex);
+                input.textures[slot] = software_texture != nullptr ? software_texture : upload(tex);
+            }
+        }
+
+        const auto saturate = cubemap->get_data_type() == DataType::UNSIGNED_BYTE;
+        const auto last     = std::min(first + count, 6u * cubemap->get_miplevels());
+
+        for (auto i = first; i < last; i++)
+        {
+            const auto face = i % 6u;
+            const auto mip  = i / 6u;
+
+            shader->set_uniform(std::to_underlying(UniformLocation::MIPLEVEL),    static_cast<int>(mip));
+            shader->set_uniform(std::to_underlying(UniformLocation::CUBEMAP_TBN), cube_tbn[face]);
+
+            const auto  draw  = resolve_draw(*shader, input);
+            auto&       image = cubemap->get_face(face, mip);
+            const auto  size  = image.size.x;
+            const auto  step  = 2.0f / static_cast<float>(size);
+            const auto& tbn   = cube_tbn[face];
+
+            // the texels are shaded like the full screen quad of the OpenGL generator
+            workers->parallel_for(size, [&] (size_t y) {
+                for (auto x = 0u; x < size; x++)
+                {
+                    const auto ndc = (glm::vec2(static_cast<float>(x), static_cast<float>(y)) + 0.5f) * step - 1.0f;
+
+                    auto color = glm::vec4(0.0f);
+                    if (shade_cubemap(draw, tbn * glm::vec3(ndc.x, -ndc.y, 1.0f), tbn * glm::vec3(ndc.x + step, -ndc.y, 1.0f), tbn * glm::vec3(ndc.x, -(ndc.y + step), 1.0f), color))
+                    {
+                        image.pixels[y * size + x] = saturate ? glm::clamp(color, 0.0f, 1.0f) : color;
+                    }
+                }
+            });
+        }
+
+        return cubemap;
+    }
+
+    CubeMapData SoftwareGraphicContext::download_cubemap(const std::shared_ptr<CubeMap>& cubemap)
+    {
+        auto software_cubemap = std::dynamic_pointer_cast<SoftwareCubeMap>(cubemap);
+        check(software_cubemap, "The cube map to download must be a software cube map.");
+        return software_cubemap->download();
+    }
+
+    std::shared_ptr<CubeMap> SoftwareGraphicContext::upload_cubemap(const CubeMapData& data)
+    {
+        count_upload(data);
+        return std::make_shared<SoftwareCubeMap>(data);
+    }
+
+    std::shared_ptr<Mesh> SoftwareGraphicContext::upload_mesh(MeshData data, bool stream)
+    {
+        count_upload(data);
+        return std::make_shared<MemoryMesh>(std::move(data));
+    }
+
+    std::shared_ptr<UniformBuffer> SoftwareGraphicContext::create_uniform_buffer(size_t size)
+    {
+        return std::make_shared<SoftwareUniformBuffer>(size);
+    }
+
+    size_t SoftwareGraphicContext::get_uniform_buffer_alignment() const
+    {
+        // the base alignment of std140 blocks
+        return 16u;
+    }
+
+    void SoftwareGraphicContext::set_viewport(const Viewport& value)
+    {
+        viewport = value;
+
+        // the back buffer follows the viewport, like a resized window, frame
+        // buffers have a fixed size
+        const auto required = viewport.position + viewport.size;
+        const auto size     = back_buffer->get_size();
+        if (current_frame_buffer == nullptr && (required.x > size.x || required.y > size.y))
+        {
+            flush();
+            back_buffer = create_back_buffer(glm::max(size, required));
+        }
+    }
+
+    Viewport SoftwareGraphicContext::get_viewport() const
+    {
+        return viewport;
+    }
+
+    void SoftwareGraphicContext::clear_screen()
+    {
+        flush();
+
+        auto target = current_frame_buffer != nullptr ? current_frame_buffer : back_buffer;
+        target->clear(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), 1.0f);
+    }
+
+    void SoftwareGraphicContext::start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader)
+    {
+        start_pass(name, shader, nullptr);
+    }
+
+    void SoftwareGraphicContext::start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader, const std::shared_ptr<FrameBuffer>& frame_buffer)
+    {
+        flush();
+
+        profiler.start_pass(name);
+
+        current_shader = std::dynamic_pointer_cast<SoftwareShader>(shader);
+        check(current_shader);
+        render_stats.shader_binds++;
+
+        if (frame_buffer)
+        {
+            current_frame_buffer = std::dynamic_pointer_cast<SoftwareFrameBuffer>(frame_buffer);
+            check(current_frame_buffer);
+        }
+    }
+
+    void SoftwareGraphicContext::set_blend_mode(BlendMode mode)
+    {
+        state->blend_mode = mode;
+    }
+
+    void SoftwareGraphicContext::set_depth_test(DepthTest mode)
+    {
+        state->depth_test = mode;
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, int value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, float value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::ivec2& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::ivec3& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::ivec4& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::vec2& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::vec3& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::vec4& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::mat2& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::mat3& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const glm::mat4& value)
+    {
+        set_uniform(loc, UniformValue(value));
+    }
+
+    void SoftwareGraphicContext::set_uniform(int loc, const UniformValue& value)
+    {
+        check(loc >= 0);
+        check(current_shader, "Uniforms are set on the shader of the current pass.");
+        current_shader->set_uniform(loc, value);
+        render_stats.uniforms++;
+    }
+
+    void SoftwareGraphicContext::bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback)
+    {
+        check(slot >= 0);
+        render_stats.texture_binds++;
+
+        if (texture == nullptr)
+        {
+            switch (fallback)
+            {
+                case FallbackTexture::WHITE:
+                    state->textures[slot] = white_fallback_texture;
+                    return;
+                case FallbackTexture::NORMAL:
+                    state->textures[slot] = normal_fallback_texture;
+                    return;
+                default:
+                    std::unreachable();
+            }
+        }
+
+        auto software_texture = std::dynamic_pointer_cast<SoftwareTexture>(texture);
+        if (software_texture == nullptr)
+        {
+            software_texture = upload(texture);
+        }
+        state->textures[slot] = software_texture;
+    }
+
+    void SoftwareGraphicContext::bind_texture(int slot, const std::shared_ptr<CubeMap>& texture)
+    {
+        check(slot >= 0);
+        render_stats.texture_binds++;
+
+        auto software_cubemap = std::dynamic_pointer_cast<SoftwareCubeMap>(texture);
+        check(software_cubemap != nullptr);
+        state->cubemaps[slot] = software_cubemap;
+    }
+
+    void SoftwareGraphicContext::set_storage_buffer(int binding, size_t size, const void* data)
+    {
+        // copied, draws that are already issued keep the old data
+        const auto bytes = static_cast<const uint8_t*>(data);
+        state->storage_buffers[binding] = std::make_shared<std::vector<uint8_t>>(bytes, bytes + size);
+        render_stats.buffer_bytes += size;
+    }
+
+    void SoftwareGraphicContext::bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size)
+    {
+        auto software_buffer = std::dynamic_pointer_cast<SoftwareUniformBuffer>(buffer);
+        check(software_buffer);
+        check(offset % get_uniform_buffer_alignment() == 0u);
+        check(offset + size <= software_buffer->get_size());
+
+        state->uniform_buffers[binding] = {software_buffer, offset, size};
+    }
+
+    void SoftwareGraphicContext::set_uniform_buffer(int binding, size_t size, const void* data)
+    {
+        auto buffer = std::make_shared<SoftwareUniformBuffer>(size);
+        buffer->upload(0u, size, data);
+        state->uniform_buffers[binding] = {buffer, 0u, size};
+        render_stats.buffer_bytes += size;
+    }
+
+    void SoftwareGraphicContext::draw(const std::shared_ptr<Mesh>& mesh)
+    {
+        check(mesh);
+        submit(*mesh, glm::mat4(1.0f));
+        count_draw(*mesh);
+    }
+
+    void SoftwareGraphicContext::draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms)
+    {
+        check(mesh);
+        for (const auto& transform : transforms)
+        {
+            submit(*mesh, transform);
+        }
+        if (!transforms.empty())
+        {
+            count_draw(*mesh, transforms.size());
+        }
+    }
+
+    void SoftwareGraphicContext::draw_fullscreen()
+    {
+        if (fullscreen_mesh == nullptr)
+        {
+            fullscreen_mesh = create_memory_fullscreen_mesh();
+        }
+        draw(fullscreen_mesh);
+    }
+
+    void SoftwareGraphicContext::end_pass()
+    {
+        // the pass is rasterized here, so its time includes the shading
+        flush();
+
+        current_shader       = nullptr;
+        current_frame_buffer = nullptr;
+
+        profiler.end_pass();
+    }
+
+    void SoftwareGraphicContext::swap_buffers()
+    {
+        flush();
+
+        if (window != nullptr)
+        {
+            present();
+        }
+
+        collect_garbage();
+
+        end_render_stats(texture_cache.size(), 0u);
+        profiler.end_frame();
+    }
+
+    void SoftwareGraphicContext::submit(const Mesh& mesh, const glm::mat4& instance)
+    {
+        check(current_shader, "Draws are only possible in a pass.");
+
+        const auto  draw_index = static_cast<uint32_t>(draws.size());
+        const auto& draw       = draws.emplace_back(resolve_draw(*current_shader, *state));
+
+        const auto stage      = make_vertex_stage(draw, instance);
+        const auto attributes = SoftwareAttributes{
+            .vertexes  = mesh.get_vertexes(),
+            .normals   = mesh.get_normals(),
+            .tangents  = mesh.get_tangents(),
+            .texcoords = mesh.get_texcoords(),
+            .colors    = mesh.get_colors()
+        };
+
+        const auto count = attributes.vertexes.size();
+        clip_vertexes.resize(count);
+        workers->parallel_for((count + VERTEX_BATCH_SIZE - 1u) / VERTEX_BATCH_SIZE, [&] (size_t batch) {
+            const auto last = std::min(count, (batch + 1u) * VERTEX_BATCH_SIZE);
+            for (auto i = batch * VERTEX_BATCH_SIZE; i < last; i++)
+            {
+                clip_vertexes[i] = shade_vertex(draw, stage, attributes, i);
+            }
+        });
+
+        const auto target_size = (current_frame_buffer != nullptr ? current_frame_buffer : back_buffer)->get_size();
+        const auto scissor     = glm::ivec4(
+            std::max(static_cast<int>(viewport.position.x), 0),
+            std::max(static_cast<int>(viewport.position.y), 0),
+            std::min(static_cast<int>(viewport.position.x + viewport.size.x), static_cast<int>(target_size.x)),
+            std::min(static_cast<int>(viewport.position.y + viewport.size.y), static_cast<int>(target_size.y))
+        );
+
+        for (const auto& face : mesh.get_faces())
+        {
+            if (face.x < count && face.y < count && face.z < count)
+            {
+                add_clipped_triangle(primitives, draw_index, clip_vertexes[face.x], clip_vertexes[face.y], clip_vertexes[face.z], viewport, scissor);
+            }
+        }
+
+        for (const auto& line : mesh.get_lines())
+        {
+            if (line.x < count && line.y < count)
+            {
+                add_clipped_line(primitives, draw_index, clip_vertexes[line.x], clip_vertexes[line.y], viewport, scissor);
+            }
+        }
+    }
+
+    void SoftwareGraphicContext::flush()
+    {
+        if (primitives.empty())
+        {
+            draws.clear();
+            return;
+        }
+
+        auto target = (current_frame_buffer != nullptr ? current_frame_buffer : back_buffer)->get_target();
+
+        const auto tiles_x = (static_cast<int>(target.size.x) + TILE_SIZE - 1) / TILE_SIZE;
+        const auto tiles_y = (static_cast<int>(target.size.y) + TILE_SIZE - 1) / TILE_SIZE;
+
+        tiles.resize(static_cast<size_t>(tiles_x) * tiles_y);
+        for (auto& tile : tiles)
+        {
+            tile.clear();
+        }
+
+        // binning keeps the submission order within each tile
+        for (auto i = 0u; i < primitives.size(); i++)
+        {
+            const auto& bounds = primitives[i].bounds;
+            for (auto ty = bounds.y / TILE_SIZE; ty <= (bounds.w - 1) / TILE_SIZE; ty++)
+            {
+                for (auto tx = bounds.x / TILE_SIZE; tx <= (bounds.z - 1) / TILE_SIZE; tx++)
+                {
+                    tiles[static_cast<size_t>(ty) * tiles_x + tx].push_back(i);
+                }
+            }
+        }
+
+        workers->parallel_for(tiles.size(), [&] (size_t index) {
+            const auto tx   = static_cast<int>(index % tiles_x) * TILE_SIZE;
+            const auto ty   = static_cast<int>(index / tiles_x) * TILE_SIZE;
+            const auto tile = glm::ivec4(tx, ty, tx + TILE_SIZE, ty + TILE_SIZE);
+
+            for (auto i : tiles[index])
+            {
+                const auto& primitive = primitives[i];
+                const auto  rect      = glm::ivec4(glm::max(glm::ivec2(tile), glm::ivec2(primitive.bounds)), glm::min(glm::ivec2(tile.z, tile.w), glm::ivec2(primitive.bounds.z, primitive.bounds.w)));
+
+                if (primitive.count == 3u)
+                {
+                    rasterize_triangle(draws[primitive.draw], primitive, rect, target);
+                }
+                else
+                {
+                    rasterize_line(draws[primitive.draw], primitive, rect, target);
+                }
+            }
+        });
+
+        draws.clear();
+        primitives.clear();
+    }
+
+    void SoftwareGraphicContext::present()
+    {
+        auto surface = SDL_GetWindowSurface(window);
+        if (surface == nullptr)
+        {
+            throw std::runtime_error(SDL_GetError());
+        }
+
+        // SDL surfaces start at the top row
+        const auto* image  = back_buffer->get_color_image();
+        const auto  size   = image->size;
+        auto        pixels = std::vector<uint8_t>(size_t{size.x} * size.y * 4u);
+        for (auto y = 0u; y < size.y; y++)
+        {
+            for (auto x = 0u; x < size.x; x++)
+            {
+                const auto& color = image->at(static_cast<int>(x), static_cast<int>(size.y - 1u - y));
+                auto*       texel = &pixels[(size_t{y} * size.x + x) * 4u];
+                texel[0] = to_byte(color.r);
+                texel[1] = to_byte(color.g);
+                texel[2] = to_byte(color.b);
+                texel[3] = to_byte(color.a);
+            }
+        }
+
+        auto frame = SDL_CreateSurfaceFrom(static_cast<int>(size.x), static_cast<int>(size.y), SDL_PIXELFORMAT_RGBA32, pixels.data(), static_cast<int>(size.x * 4u));
+        if (frame == nullptr)
+        {
+            throw std::runtime_error(SDL_GetError());
+        }
+
+        SDL_BlitSurface(frame, nullptr, surface, nullptr);
+        SDL_DestroySurface(frame);
+        SDL_UpdateWindowSurface(window);
+    }
+
+    std::shared_ptr<SoftwareTexture> SoftwareGraphicContext::upload(const std::shared_ptr<Texture>& texture)
+    {
+        auto i = texture_cache.find(texture);
+
+        if (i != end(texture_cache))
+        {
+            return i->second;
+        }
+
+        auto swt = std::make_shared<SoftwareTexture>(texture->get_id(), read_image(*texture), texture->get_filter(), texture->get_clamp());
+        count_upload(*texture);
+        texture_cache.insert_or_assign(texture, swt);
+        return swt;
+    }
+
+    void SoftwareGraphicContext::collect_garbage()
+    {
+        std::erase_if(texture_cache, [] (const auto& pair) { return pair.first.expired(); });
+    }
+}
@@ -0,0 +1,157 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "GraphicContext.h"
+
+namespace pkzo
+{
+    class SoftwareShader;
+    class SoftwareTexture;
+    class SoftwareFrameBuffer;
+    class WorkerPool;
+    struct SoftwareDrawState;
+    struct SoftwareDraw;
+    struct SoftwarePrimitive;
+    struct SoftwareClipVertex;
+
+    //! Graphic context that rasterizes on the CPU.
+    //!
+    //! Draws are transformed and clipped when they are issued and collected
+    //! until the end of the pass. The primitives are then binned into screen
+    //! tiles and the tiles are shaded in parallel, each in submission order.
+    //!
+    //! The built in shaders are implemented as C++ functions that follow the
+    //! GLSL code, other shaders can not be compiled. Without a window the
+    //! context renders off screen, so scenes can be rendered and compared to
+    //! reference images on machines without a GPU.
+    class PKZO_EXPORT SoftwareGraphicContext : public GraphicContext
+    {
+    public:
+        struct Init
+        {
+            glm::uvec2   size    = glm::uvec2(800u, 600u); //!< Initial size of the back buffer.
+            unsigned int threads = 0u;                     //!< Threads to shade with, 0 uses one per core.
+        };
+
+        SoftwareGraphicContext();
+        SoftwareGraphicContext(Init init);
+        SoftwareGraphicContext(SDL_Window* window);
+        ~SoftwareGraphicContext();
+
+        Api get_api() const override;
+
+        std::shared_ptr<MemoryTexture> screenshot() const override;
+
+        std::shared_ptr<Shader> compile(const Shader::Source& source) override;
+        std::shared_ptr<FrameBuffer> create_frame_buffer(const FrameBuffer::BufferConfig& config) override;
+
+        std::shared_ptr<CubeMap> generate_cubemap(const CubeMapGenerator& generator) override;
+        std::shared_ptr<CubeMap> generate_cubemap_faces(const CubeMapGenerator& generator, unsigned int first, unsigned int count) override;
+        CubeMapData download_cubemap(const std::shared_ptr<CubeMap>& cubemap) override;
+        std::shared_ptr<CubeMap> upload_cubemap(const CubeMapData& data) override;
+
+        std::shared_ptr<Mesh> upload_mesh(MeshData data, bool stream = false) override;
+
+        std::shared_ptr<UniformBuffer> create_uniform_buffer(size_t size) override;
+        size_t get_uniform_buffer_alignment() const override;
+
+        void set_viewport(const Viewport& viewport) override;
+        Viewport get_viewport() const override;
+
+        void clear_screen() override;
+
+        void start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader) override;
+        void start_pass(const std::string_view name, const std::shared_ptr<Shader>& shader, const std::shared_ptr<FrameBuffer>& frame_buffer) override;
+
+        void set_blend_mode(BlendMode mode) override;
+        void set_depth_test(DepthTest mode) override;
+
+        void set_uniform(int loc, int value) override;
+        void set_uniform(int loc, float value) override;
+        void set_uniform(int loc, const glm::ivec2& value) override;
+        void set_uniform(int loc, const glm::ivec3& value) override;
+        void set_uniform(int loc, const glm::ivec4& value) override;
+        void set_uniform(int loc, const glm::vec2& value) override;
+        void set_uniform(int loc, const glm::vec3& value) override;
+        void set_uniform(int loc, const glm::vec4& value) override;
+        void set_uniform(int loc, const glm::mat2& value) override;
+        void set_uniform(int loc, const glm::mat3& value) override;
+        void set_uniform(int loc, const glm::mat4& value) override;
+        void set_uniform(int loc, const UniformValue& value) override;
+
+        void bind_texture(int slot, const std::shared_ptr<Texture>& texture, FallbackTexture fallback = FallbackTexture::WHITE) override;
+        void bind_texture(int slot, const std::shared_ptr<CubeMap>& texture) override;
+
+        using GraphicContext::set_storage_buffer;
+        void set_storage_buffer(int binding, size_t size, const void* data) override;
+
+        void bind_uniform_buffer(int binding, const std::shared_ptr<UniformBuffer>& buffer, size_t offset, size_t size) override;
+
+        using GraphicContext::set_uniform_buffer;
+        void set_uniform_buffer(int binding, size_t size, const void* data) override;
+
+        void draw(const std::shared_ptr<Mesh>& mesh) override;
+        void draw_instanced(const std::shared_ptr<Mesh>& mesh, const std::vector<glm::mat4>& transforms) override;
+        void draw_fullscreen() override;
+
+        void end_pass() override;
+
+        void swap_buffers() override;
+
+    private:
+        SDL_Window* window = nullptr;
+
+        Viewport viewport;
+
+        std::unique_ptr<WorkerPool>         workers;
+        std::unique_ptr<SoftwareDrawState>  state;
+
+        std::shared_ptr<SoftwareShader>      current_shader;
+        std::shared_ptr<SoftwareFrameBuffer> current_frame_buffer;
+        std::shared_ptr<SoftwareFrameBuffer> back_buffer;
+
+        // draws of the current pass, shaded in end_pass
+        std::vector<SoftwareDraw>          draws;
+        std::vector<SoftwarePrimitive>     primitives;
+        std::vector<SoftwareClipVertex>    clip_vertexes;
+        std::vector<std::vector<uint32_t>> tiles;
+
+        std::map<std::weak_ptr<Texture>, std::shared_ptr<SoftwareTexture>, std::owner_less<>> texture_cache;
+
+        std::shared_ptr<SoftwareTexture> white_fallback_texture;
+        std::shared_ptr<SoftwareTexture> normal_fallback_texture;
+
+        std::shared_ptr<Mesh> fullscreen_mesh;
+
+        void submit(const Mesh& mesh, const glm::mat4& instance);
+        void flush();
+        void present();
+
+        std::shared_ptr<SoftwareTexture> upload(const std::shared_ptr<Texture>& texture);
+        void collect_garbage();
+    };
+}
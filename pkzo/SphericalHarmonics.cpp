@@ -0,0 +1,308 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "SphericalHarmonics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+#include "debug.h"
+#include "MemoryTexture.h"
+
+namespace pkzo
+{
+    std::array<float, IRRADIANCE_COEFFICIENTS> sh_basis(const glm::vec3& n)
+    {
+        return {
+            0.282095f,
+            0.488603f * n.y,
+            0.488603f * n.z,
+            0.488603f * n.x,
+            1.092548f * n.x * n.y,
+            1.092548f * n.y * n.z,
+            0.315392f * (3.0f * n.z * n.z - 1.0f),
+            1.092548f * n.x * n.z,
+            0.546274f * (n.x * n.x - n.y * n.y)
+        };
+    }
+
+    // cosine lobe convolution divided by pi, per band
+    constexpr auto SH_BAND_FACTORS = std::array<float, IRRADIANCE_COEFFICIENTS>{
+        1.0f,
+        2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f,
+        0.25f, 0.25f, 0.25f, 0.25f, 0.25f
+    };
+
+    glm::vec3 read_radiance(const uint8_t* texel, DataType data_type, ColorMode color_mode)
+    {
+        auto c = glm::vec3(0.0f);
+        auto components = 3u;
+        switch (color_mode)
+        {
+            case ColorMode::MONO:
+            case ColorMode::DEPTH:
+                components = 1u;
+                break;
+            case ColorMode::RGBA:
+            case ColorMode::BGRA:
+                components = 3u; // alpha is ignored
+                break;
+            default:
+                break;
+        }
+
+        for (auto i = 0u; i < components; i++)
+        {
+            if (data_type == DataType::FLOAT)
+            {
+                std::memcpy(&c[i], texel + i * sizeof(float), sizeof(float));
+            }
+            else
+            {
+                c[i] = static_cast<float>(texel[i]) / 255.0f;
+            }
+        }
+
+        switch (color_mode)
+        {
+            case ColorMode::MONO:
+            case ColorMode::DEPTH:
+                return glm::vec3(c.r);
+            case ColorMode::BGR:
+            case ColorMode::BGRA:
+                return glm::vec3(c.b, c.g, c.r);
+            default:
+                return c;
+        }
+    }
+
+    size_t get_texel_size(DataType data_type, ColorMode color_mode)
+    {
+        auto type_size = data_type == DataType::FLOAT ? sizeof(float) : sizeof(uint8_t);
+        switch (color_mode)
+        {
+            case ColorMode::MONO:
+            case ColorMode::DEPTH:
+                return type_size;
+            case ColorMode::RGB:
+            case ColorMode::BGR:
+                return type_size * 3u;
+            case ColorMode::RGBA:
+            case ColorMode::BGRA:
+                return type_size * 4u;
+            default:
+                std::unreachable();
+        }
+    }
+
+    // Same as FilterCubemapDiffuse.frag did, keeps the sun from dominating.
+    glm::vec3 compress_radiance(const glm::vec3& radiance)
+    {
+        constexpr auto LIMIT = 10.0f;
+
+        auto lum = glm::dot(radiance, glm::vec3(0.2126f, 0.7152f, 0.0722f));
+        if (lum > LIMIT)
+        {
+            auto compressed = LIMIT + std::log(1.0f + lum - LIMIT);
+            return radiance * (compressed / lum);
+        }
+        return radiance;
+    }
+
+    IrradianceSH project_irradiance(const std::shared_ptr<Texture>& texture)
+    {
+        check(texture);
+
+        auto source = std::shared_ptr<Texture>(texture);
+        if (source->get_memory() == nullptr)
+        {
+            source = texture->download();
+            check(source && source->get_memory(), "Failed to download the environment texture.");
+        }
+
+        const auto size       = source->get_size();
+        const auto data_type  = source->get_data_type();
+        const auto color_mode = source->get_color_mode();
+        const auto memory     = static_cast<const uint8_t*>(source->get_memory());
+        const auto texel_size = get_texel_size(data_type, color_mode);
+        // rows are 4 byte aligned, the default GL_UNPACK_ALIGNMENT
+        const auto pitch      = (size.x * texel_size + 3u) / 4u * 4u;
+
+        // Large maps are sampled on a coarser grid, the irradiance has no detail
+        // that needs more and the projection runs on the render thread.
+        constexpr auto MAX_SAMPLES = glm::uvec2(512u, 256u);
+        const auto samples = glm::min(size, MAX_SAMPLES);
+
+        // accumulated per row and in double, millions of float sums lose the small weights
+        auto radiance = std::array<glm::dvec3, IRRADIANCE_COEFFICIENTS>{};
+        auto weight   = 0.0;
+
+        // Inverse of the mapping in GenerateCubemap.frag:
+        //   u = 0.5 + atan(d.x, d.y) / 2pi, v = 0.5 + asin(d.z) / pi
+        for (auto sy = 0u; sy < samples.y; sy++)
+        {
+            const auto v         = (static_cast<float>(sy) + 0.5f) / static_cast<float>(samples.y);
+            const auto y         = std::min(static_cast<unsigned int>(v * static_cast<float>(size.y)), size.y - 1u);
+            const auto elevation = (v - 0.5f) * std::numbers::pi_v<float>;
+            const auto cos_el    = std::cos(elevation);
+            const auto sin_el    = std::sin(elevation);
+
+            auto row = std::array<glm::dvec3, IRRADIANCE_COEFFICIENTS>{};
+            for (auto sx = 0u; sx < samples.x; sx++)
+            {
+                const auto u         = (static_cast<float>(sx) + 0.5f) / static_cast<float>(samples.x);
+                const auto x         = std::min(static_cast<unsigned int>(u * static_cast<float>(size.x)), size.x - 1u);
+                const auto azimuth   = (u - 0.5f) * 2.0f * std::numbers::pi_v<float>;
+                const auto direction = glm::vec3(cos_el * std::sin(azimuth), cos_el * std::cos(azimuth), sin_el);
+
+                const auto color = compress_radiance(read_radiance(memory + y * pitch + x * texel_size, data_type, color_mode));
+                const auto basis = sh_basis(direction);
+                for (auto i = 0u; i < row.size(); i++)
+                {
+                    row[i] += glm::dvec3(color * basis[i]);
+                }
+            }
+
+            // the sample solid angle up to a constant, normalized below
+            const auto row_weight = static_cast<double>(cos_el);
+            for (auto i = 0u; i < radiance.size(); i++)
+            {
+                radiance[i] += row[i] * row_weight;
+            }
+            weight += row_weight * samples.x;
+        }
+
+        auto result = IrradianceSH{};
+        if (weight > 0.0)
+        {
+            const auto solid_angle = 4.0 * std::numbers::pi / weight;
+            for (auto i = 0u; i < radiance.size(); i++)
+            {
+                result.coefficients[i] = glm::vec3(radiance[i] * solid_angle) * SH_BAND_FACTORS[i];
+            }
+        }
+        return result;
+    }
+
+    // Direction through a cube map texel, face orientation as in the OpenGL specification.
+    glm::vec3 get_cube_direction(CubeFace face, float s, float t)
+    {
+        switch (face)
+        {
+            case CubeFace::XPOS:
+                return {1.0f, -t, -s};
+            case CubeFace::XNEG:
+                return {-1.0f, -t, s};
+            case CubeFace::YPOS:
+                return {s, 1.0f, t};
+            case CubeFace::YNEG:
+                return {s, -1.0f, -t};
+            case CubeFace::ZPOS:
+                return {s, -t, 1.0f};
+            case CubeFace::ZNEG:
+                return {-s, -t, -1.0f};
+            default:
+                std::unreachable();
+        }
+    }
+
+    IrradianceSH project_irradiance(const CubeMapData& data)
+    {
+        // a small mip level holds all the detail the irradiance needs
+        constexpr auto MAX_FACE_SIZE = 64u;
+
+        if (data.images.size() != 6u * data.miplevels)
+        {
+            return {};
+        }
+
+        auto mip = 0u;
+        while (mip + 1u < data.miplevels && data.images[mip].size > MAX_FACE_SIZE)
+        {
+            mip++;
+        }
+
+        const auto texel_size = get_texel_size(data.data_type, data.color_mode);
+
+        auto radiance = std::array<glm::dvec3, IRRADIANCE_COEFFICIENTS>{};
+        auto weight   = 0.0;
+
+        for (auto face = 0u; face < 6u; face++)
+        {
+            const auto& image = data.images[face * data.miplevels + mip];
+            const auto  size  = image.size;
+            if (size == 0u || image.pixels.size() < size_t{size} * size * texel_size)
+            {
+                return {};
+            }
+
+            const auto memory = reinterpret_cast<const uint8_t*>(image.pixels.data());
+            for (auto y = 0u; y < size; y++)
+            {
+                const auto t = 2.0f * (static_cast<float>(y) + 0.5f) / static_cast<float>(size) - 1.0f;
+                for (auto x = 0u; x < size; x++)
+                {
+                    const auto s         = 2.0f * (static_cast<float>(x) + 0.5f) / static_cast<float>(size) - 1.0f;
+                    const auto direction = get_cube_direction(static_cast<CubeFace>(face), s, t);
+
+                    // the texel solid angle up to a constant, normalized below
+                    const auto length2      = glm::dot(direction, direction);
+                    const auto texel_weight = 1.0 / (length2 * std::sqrt(length2));
+
+                    const auto color = compress_radiance(read_radiance(memory + (size_t{y} * size + x) * texel_size, data.data_type, data.color_mode));
+                    const auto basis = sh_basis(glm::normalize(direction));
+                    for (auto i = 0u; i < radiance.size(); i++)
+                    {
+                        radiance[i] += glm::dvec3(color * basis[i]) * texel_weight;
+                    }
+                    weight += texel_weight;
+                }
+            }
+        }
+
+        auto result = IrradianceSH{};
+        if (weight > 0.0)
+        {
+            const auto solid_angle = 4.0 * std::numbers::pi / weight;
+            for (auto i = 0u; i < radiance.size(); i++)
+            {
+                result.coefficients[i] = glm::vec3(radiance[i] * solid_angle) * SH_BAND_FACTORS[i];
+            }
+        }
+        return result;
+    }
+
+    glm::vec3 evaluate(const IrradianceSH& sh, const glm::vec3& normal)
+    {
+        const auto basis = sh_basis(normal);
+
+        auto result = glm::vec3(0.0f);
+        for (auto i = 0u; i < basis.size(); i++)
+        {
+            result += sh.coefficients[i] * basis[i];
+        }
+        return glm::max(result, glm::vec3(0.0f));
+    }
+}
@@ -0,0 +1,61 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include <glm/glm.hpp>
+
+#include "api.h"
+#include "CubeMap.h"
+#include "Shader.h"
+#include "Texture.h"
+
+namespace pkzo
+{
+    //! Diffuse irradiance as L2 spherical harmonics.
+    //!
+    //! The coefficients are convolved with the cosine lobe, evaluating them
+    //! gives the cosine weighted average radiance around the normal. This is
+    //! what a diffuse filtered cube map holds, in 9 RGB values.
+    struct IrradianceSH
+    {
+        std::array<glm::vec3, IRRADIANCE_COEFFICIENTS> coefficients = {};
+    };
+
+    //! Project an equirectangular environment texture, as used by SkyBox.
+    //!
+    //! Textures without memory are downloaded. Textures larger than 512x256
+    //! are sampled on a 512x256 grid. Very bright texels, like the sun, are
+    //! compressed so that they do not ring across the sphere.
+    PKZO_EXPORT IrradianceSH project_irradiance(const std::shared_ptr<Texture>& texture);
+
+    //! Project a downloaded cube map.
+    //!
+    //! The largest mip level of at most 64 texels is used, or the smallest
+    //! level if all are larger. Data without pixels projects to zero.
+    PKZO_EXPORT IrradianceSH project_irradiance(const CubeMapData& data);
+
+    //! Irradiance around the normal, as Forward.frag evaluates it.
+    PKZO_EXPORT glm::vec3 evaluate(const IrradianceSH& sh, const glm::vec3& normal);
+}
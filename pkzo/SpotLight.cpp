@@ -28,7 +28,9 @@ namespace pkzo
     SpotLight::SpotLight(Init init)
     : Light({init.parent, init.transform}),
       color(init.color),
-      angles(init.angles) {}
+      angles(init.angles),
+      range(init.range),
+      cast_shadows(init.cast_shadows) {}
 
     SpotLight::~SpotLight() = default;
 
@@ -42,6 +44,16 @@ namespace pkzo
         angles = value;
     }
 
+    void SpotLight::set_range(float value)
+    {
+        range = value;
+    }
+
+    void SpotLight::set_cast_shadows(bool value)
+    {
+        cast_shadows = value;
+    }
+
     LightType SpotLight::get_type() const
     {
         return LightType::SPOT;
@@ -68,4 +80,14 @@ namespace pkzo
     {
         return glm::radians(angles);
     }
+
+    float SpotLight::get_range() const
+    {
+        return range;
+    }
+
+    bool SpotLight::get_cast_shadows() const
+    {
+        return cast_shadows;
+    }
 }
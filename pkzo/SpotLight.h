@@ -30,10 +30,14 @@ namespace pkzo
     public:
         struct Init
         {
-            Node*     parent    = nullptr;
-            glm::mat4 transform = glm::mat4(1.0f);
-            glm::vec3 color     = glm::vec3(0.1f);
-            glm::vec2 angles    = glm::vec2(30.0f, 35.0f);
+            Node*     parent       = nullptr;
+            glm::mat4 transform    = glm::mat4(1.0f);
+            glm::vec3 color        = glm::vec3(0.1f);
+            glm::vec2 angles       = glm::vec2(30.0f, 35.0f);
+            //! Distance at which the light fades out, 0 keeps the 1/d^2 falloff unbounded.
+            float     range        = 0.0f;
+            //! Render a shadow map for this light.
+            bool      cast_shadows = false;
         };
 
         SpotLight(Init init);
@@ -41,15 +45,21 @@ namespace pkzo
 
         void set_color(const glm::vec3& value);
         void set_angles(const glm::vec2& value);
+        void set_range(float value);
+        void set_cast_shadows(bool value);
 
         LightType get_type() const override;
         glm::vec3 get_color() const override;
         glm::vec3 get_direction() const override;
         glm::vec3 get_position() const override;
         glm::vec2 get_angles() const override;
+        float get_range() const override;
+        bool get_cast_shadows() const override;
 
     private:
         glm::vec3 color;
         glm::vec2 angles;
+        float     range;
+        bool      cast_shadows;
     };
 }
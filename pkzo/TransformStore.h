@@ -0,0 +1,222 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "debug.h"
+
+namespace pkzo
+{
+    //! Contiguous storage for a transform hierarchy.
+    //!
+    //! Local and world matrices are kept in parallel arrays ordered so that
+    //! every parent precedes its children. This allows all world matrices to
+    //! be computed in one linear pass, without recursion or pointer chasing.
+    //!
+    //! Entries are addressed through stable handles; the dense index of an
+    //! entry may change when removed entries are compacted.
+    template <typename Matrix>
+    class TransformStore
+    {
+    public:
+        using Handle = std::uint32_t;
+
+        static constexpr Handle NO_HANDLE = std::numeric_limits<Handle>::max();
+
+        TransformStore() = default;
+
+        //! Add an entry.
+        //!
+        //! @param parent    The handle of the parent entry or NO_HANDLE for a root.
+        //! @param transform The initial local transform.
+        //! @returns The handle of the new entry.
+        Handle add(Handle parent, const Matrix& transform)
+        {
+            auto index = static_cast<std::uint32_t>(locals.size());
+
+            auto parent_index = NO_INDEX;
+            if (parent != NO_HANDLE)
+            {
+                parent_index = index_of(parent);
+            }
+
+            auto handle = NO_HANDLE;
+            if (free_handles.empty())
+            {
+                handle = static_cast<Handle>(indexes.size());
+                indexes.push_back(index);
+            }
+            else
+            {
+                handle = free_handles.back();
+                free_handles.pop_back();
+                indexes[handle] = index;
+            }
+
+            locals.push_back(transform);
+            worlds.push_back(transform);
+            parents.push_back(parent_index);
+            handles.push_back(handle);
+
+            first_dirty = std::min(first_dirty, index);
+
+            return handle;
+        }
+
+        //! Remove an entry.
+        //!
+        //! Children must be removed before their parent.
+        void remove(Handle handle)
+        {
+            auto index = index_of(handle);
+            handles[index] = NO_HANDLE;
+            indexes[handle] = NO_INDEX;
+            free_handles.push_back(handle);
+            removed_count++;
+        }
+
+        void set_local(Handle handle, const Matrix& transform)
+        {
+            auto index = index_of(handle);
+            locals[index] = transform;
+            first_dirty = std::min(first_dirty, index);
+        }
+
+        [[nodiscard]]
+        const Matrix& get_local(Handle handle) const
+        {
+            return locals[index_of(handle)];
+        }
+
+        //! Get the world transform of an entry.
+        //!
+        //! Entries changed since the last update() are composed from the
+        //! local transforms up to the first up to date ancestor; the store
+        //! itself is not modified.
+        [[nodiscard]]
+        Matrix get_world(Handle handle) const
+        {
+            auto index = index_of(handle);
+            if (index < first_dirty)
+            {
+                return worlds[index];
+            }
+
+            auto result = locals[index];
+            for (auto p = parents[index]; p != NO_INDEX; p = parents[p])
+            {
+                if (p < first_dirty)
+                {
+                    return worlds[p] * result;
+                }
+                result = locals[p] * result;
+            }
+            return result;
+        }
+
+        //! Number of live entries.
+        [[nodiscard]]
+        std::size_t size() const
+        {
+            return locals.size() - removed_count;
+        }
+
+        //! Compute all world transforms that may have changed.
+        //!
+        //! Every entry at or after the first modified entry is recomputed in
+        //! one forward pass, since parents are always stored before children.
+        void update()
+        {
+            if (removed_count > 0u)
+            {
+                compact();
+            }
+
+            const auto count = static_cast<std::uint32_t>(locals.size());
+            for (auto i = first_dirty; i < count; i++)
+            {
+                const auto p = parents[i];
+                worlds[i] = (p == NO_INDEX) ? locals[i] : worlds[p] * locals[i];
+            }
+            first_dirty = count;
+        }
+
+    private:
+        static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        // dense, parent ordered
+        std::vector<Matrix>        locals;
+        std::vector<Matrix>        worlds;
+        std::vector<std::uint32_t> parents;
+        std::vector<Handle>        handles;
+
+        // handle -> dense index
+        std::vector<std::uint32_t> indexes;
+        std::vector<Handle>        free_handles;
+
+        std::uint32_t first_dirty   = 0u;
+        std::uint32_t removed_count = 0u;
+
+        std::uint32_t index_of(Handle handle) const
+        {
+            check(handle < indexes.size() && indexes[handle] != NO_INDEX, "Invalid transform handle.");
+            return indexes[handle];
+        }
+
+        // Stable compaction keeps the parent before child ordering intact.
+        void compact()
+        {
+            auto remap = std::vector<std::uint32_t>(locals.size(), NO_INDEX);
+
+            auto out = std::uint32_t{0};
+            for (auto i = std::uint32_t{0}; i < locals.size(); i++)
+            {
+                if (handles[i] == NO_HANDLE)
+                {
+                    continue;
+                }
+
+                remap[i] = out;
+
+                locals[out]  = locals[i];
+                worlds[out]  = worlds[i];
+                parents[out] = (parents[i] == NO_INDEX) ? NO_INDEX : remap[parents[i]];
+                handles[out] = handles[i];
+                indexes[handles[out]] = out;
+
+                out++;
+            }
+
+            locals.resize(out);
+            worlds.resize(out);
+            parents.resize(out);
+            handles.resize(out);
+
+            removed_count = 0u;
+            first_dirty   = 0u;
+        }
+    };
+}
@@ -0,0 +1,109 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// This file is generated, do not edit.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace pkzo
+{
+    struct LightData
+    {
+        glm::vec4 position;
+        glm::vec4 direction;
+        glm::vec4 color;
+        glm::vec4 angles;
+    };
+    static_assert(offsetof(LightData, position) == 0);
+    static_assert(offsetof(LightData, direction) == 16);
+    static_assert(offsetof(LightData, color) == 32);
+    static_assert(offsetof(LightData, angles) == 48);
+    static_assert(sizeof(LightData) == 64);
+
+    struct FrameBlock
+    {
+        glm::mat4 projection_matrix;
+        glm::mat4 view_matrix;
+        glm::mat4 inverse_view_projection_matrix;
+        LightData lights[4];
+        glm::ivec3 cluster_grid;
+        uint8_t _pad0[4];
+        glm::vec2 cluster_tile_size;
+        glm::vec2 cluster_depth;
+        glm::vec4 light_probe_irradiance[9];
+        glm::mat4 shadow_matrices[8];
+        glm::vec4 shadow_tiles[8];
+        glm::vec4 shadow_cascade_splits;
+    };
+    static_assert(offsetof(FrameBlock, projection_matrix) == 0);
+    static_assert(offsetof(FrameBlock, view_matrix) == 64);
+    static_assert(offsetof(FrameBlock, inverse_view_projection_matrix) == 128);
+    static_assert(offsetof(FrameBlock, lights) == 192);
+    static_assert(offsetof(FrameBlock, cluster_grid) == 448);
+    static_assert(offsetof(FrameBlock, cluster_tile_size) == 464);
+    static_assert(offsetof(FrameBlock, cluster_depth) == 472);
+    static_assert(offsetof(FrameBlock, light_probe_irradiance) == 480);
+    static_assert(offsetof(FrameBlock, shadow_matrices) == 624);
+    static_assert(offsetof(FrameBlock, shadow_tiles) == 1136);
+    static_assert(offsetof(FrameBlock, shadow_cascade_splits) == 1264);
+    static_assert(sizeof(FrameBlock) == 1280);
+
+    struct MaterialBlock
+    {
+        glm::vec4 base_color_factor;
+        glm::vec3 emissive_factor;
+        float metallic_factor;
+        float roughness_factor;
+        uint8_t _pad0[12];
+    };
+    static_assert(offsetof(MaterialBlock, base_color_factor) == 0);
+    static_assert(offsetof(MaterialBlock, emissive_factor) == 16);
+    static_assert(offsetof(MaterialBlock, metallic_factor) == 28);
+    static_assert(offsetof(MaterialBlock, roughness_factor) == 32);
+    static_assert(sizeof(MaterialBlock) == 48);
+
+    struct ObjectBlock
+    {
+        glm::mat4 model_matrix;
+        int32_t instanced;
+        uint8_t _pad0[12];
+    };
+    static_assert(offsetof(ObjectBlock, model_matrix) == 0);
+    static_assert(offsetof(ObjectBlock, instanced) == 64);
+    static_assert(sizeof(ObjectBlock) == 80);
+
+    struct MeshBlock
+    {
+        glm::vec4 position_scale;
+        glm::vec4 position_offset;
+        int32_t packed;
+        uint8_t _pad0[12];
+    };
+    static_assert(offsetof(MeshBlock, position_scale) == 0);
+    static_assert(offsetof(MeshBlock, position_offset) == 16);
+    static_assert(offsetof(MeshBlock, packed) == 32);
+    static_assert(sizeof(MeshBlock) == 48);
+}
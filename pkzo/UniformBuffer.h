@@ -0,0 +1,50 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+#include "api.h"
+
+namespace pkzo
+{
+    //! Buffer holding uniform blocks, see UniformBlocks.h.
+    class PKZO_EXPORT UniformBuffer
+    {
+    public:
+        UniformBuffer() = default;
+        virtual ~UniformBuffer() = default;
+
+        virtual size_t get_size() const = 0;
+
+        //! Write data into the buffer.
+        //!
+        //! @param offset the offset in bytes, must be a multiple of GraphicContext::get_uniform_buffer_alignment
+        //! @param size the size of data in bytes
+        //! @param data the data to write
+        virtual void upload(size_t offset, size_t size, const void* data) = 0;
+
+    private:
+        UniformBuffer(const UniformBuffer&) = delete;
+        UniformBuffer& operator = (const UniformBuffer&) = delete;
+    };
+}
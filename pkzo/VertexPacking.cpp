@@ -0,0 +1,104 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "VertexPacking.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace pkzo
+{
+    glm::vec2 sign_not_zero(const glm::vec2& value)
+    {
+        return glm::vec2(value.x >= 0.0f ? 1.0f : -1.0f, value.y >= 0.0f ? 1.0f : -1.0f);
+    }
+
+    glm::vec2 encode_octahedral(const glm::vec3& direction)
+    {
+        auto length = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (length == 0.0f)
+        {
+            return glm::vec2(0.0f);
+        }
+
+        auto n = direction / length;
+        if (n.z < 0.0f)
+        {
+            return (1.0f - glm::abs(glm::vec2(n.y, n.x))) * sign_not_zero(glm::vec2(n.x, n.y));
+        }
+        return glm::vec2(n.x, n.y);
+    }
+
+    glm::vec3 decode_octahedral(const glm::vec2& value)
+    {
+        auto n = glm::vec3(value.x, value.y, 1.0f - std::abs(value.x) - std::abs(value.y));
+        if (n.z < 0.0f)
+        {
+            auto xy = (1.0f - glm::abs(glm::vec2(n.y, n.x))) * sign_not_zero(glm::vec2(n.x, n.y));
+            n.x = xy.x;
+            n.y = xy.y;
+        }
+        return glm::normalize(n);
+    }
+
+    PackedVertexes pack_vertexes(const MeshData& data)
+    {
+        auto result = PackedVertexes{};
+        if (data.vertexes.empty())
+        {
+            return result;
+        }
+
+        // the bounds of the mesh data may be set by hand, so the exact range is used
+        auto min = data.vertexes.front();
+        auto max = data.vertexes.front();
+        for (const auto& v : data.vertexes)
+        {
+            min = glm::min(min, v);
+            max = glm::max(max, v);
+        }
+
+        auto size = max - min;
+        for (auto i = 0; i < 3; i++)
+        {
+            // flat meshes have no extent along an axis
+            result.position_scale[i] = size[i] > 0.0f ? size[i] : 1.0f;
+        }
+        result.position_offset = min;
+
+        result.vertexes.resize(data.vertexes.size());
+        for (auto i = 0u; i < data.vertexes.size(); i++)
+        {
+            auto& pv = result.vertexes[i];
+
+            auto position = (data.vertexes[i] - result.position_offset) / result.position_scale;
+            pv.vertex = glm::packUnorm4x16(glm::vec4(position, 0.0f));
+
+            pv.normal   = i < data.normals.size()   ? glm::packSnorm2x16(encode_octahedral(data.normals[i]))  : 0u;
+            pv.tangent  = i < data.tangents.size()  ? glm::packSnorm2x16(encode_octahedral(data.tangents[i])) : 0u;
+            pv.texcoord = i < data.texcoords.size() ? glm::packHalf2x16(data.texcoords[i])                    : 0u;
+            pv.color    = i < data.colors.size()    ? glm::packUnorm4x8(data.colors[i])                       : 0u;
+        }
+
+        return result;
+    }
+}
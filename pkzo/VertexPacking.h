@@ -0,0 +1,64 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "api.h"
+#include "Mesh.h"
+#include "PackedVertex.h"
+
+namespace pkzo
+{
+    //! Layout of the vertex data uploaded to the GPU.
+    enum class VertexFormat
+    {
+        FLOAT,  //!< One float buffer per attribute.
+        PACKED  //!< One interleaved buffer of 24 byte quantized vertexes, see PackedVertex.
+    };
+
+    //! Vertexes of a mesh in the packed vertex format.
+    //!
+    //! Positions are stored as 16 bit fractions of the mesh bounds, the
+    //! original position is vertex * position_scale + position_offset.
+    struct PackedVertexes
+    {
+        std::vector<PackedVertex> vertexes;
+        glm::vec3                 position_scale  = glm::vec3(1.0f);
+        glm::vec3                 position_offset = glm::vec3(0.0f);
+    };
+
+    //! Map a direction onto the octahedron unfolded into [-1, 1]².
+    PKZO_EXPORT glm::vec2 encode_octahedral(const glm::vec3& direction);
+
+    //! Unit direction of an octahedral encoded direction.
+    PKZO_EXPORT glm::vec3 decode_octahedral(const glm::vec2& value);
+
+    //! Quantize and interleave the vertex attributes of a mesh.
+    //!
+    //! Normals and tangents are octahedral encoded in two 16 bit values,
+    //! texture coordinates are half floats and colors 8 bit per channel.
+    //! Missing attributes are stored as zero.
+    PKZO_EXPORT PackedVertexes pack_vertexes(const MeshData& data);
+}
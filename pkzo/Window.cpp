@@ -29,9 +29,23 @@
 
 namespace pkzo
 {
+    SDL_WindowFlags get_window_flags(Api api)
+    {
+        switch (api)
+        {
+            case Api::OPENGL:
+                return SDL_WINDOW_OPENGL;
+            case Api::SOFTWARE:
+            case Api::RECORDING:
+                return 0;
+            default:
+                std::unreachable();
+        }
+    }
+
     Window::Window(Init init)
     {
-        auto flags = std::to_underlying(init.api)
+        auto flags = get_window_flags(init.api)
                    | std::to_underlying(init.state);
         window = SDL_CreateWindow(init.title.data(), init.size.x, init.size.y, flags);
         if (window == nullptr)
@@ -39,7 +53,7 @@ namespace pkzo
             throw std::runtime_error(SDL_GetError());
         }
 
-        graphic_context = GraphicContext::create(init.api, window);
+        graphic_context = GraphicContext::create(init.api, window, init.shader_cache, init.cubemap_cache, init.vertex_format);
     }
 
     Window::~Window()
@@ -143,4 +157,14 @@ namespace pkzo
 
         graphic_context->swap_buffers();
     }
+
+    void Window::make_current()
+    {
+        graphic_context->make_current();
+    }
+
+    void Window::release_current()
+    {
+        graphic_context->release_current();
+    }
 }
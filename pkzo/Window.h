@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <functional>
 
 #include <glm/glm.hpp>
@@ -57,6 +58,9 @@ namespace pkzo
             glm::uvec2  size  = glm::uvec2(800u, 600u); //!< Initial window size in pixels.
             WindowState state = WindowState::WINDOW;    //!< Initial display state.
             Api         api   = Api::OPENGL;            //!< Graphics API to use.
+            std::filesystem::path shader_cache;         //!< Directory to cache compiled shaders in, empty disables it.
+            std::filesystem::path cubemap_cache;        //!< Directory to cache generated sky box and light probe cube maps in, empty disables it.
+            VertexFormat vertex_format = VertexFormat::FLOAT; //!< Layout of uploaded mesh data, PACKED trades precision for vertex bandwidth.
         };
 
         //! Construct and open a window.
@@ -134,6 +138,15 @@ namespace pkzo
         //! Render a frame, invoking all registered draw callbacks.
         void draw();
 
+        //! Make the graphic context current on the calling thread.
+        //!
+        //! The context is current on the thread that created the window,
+        //! to draw on an other thread, release it here and make it current there.
+        void make_current();
+
+        //! Release the graphic context from the calling thread.
+        void release_current();
+
     private:
         SdlSentry                       sdl_sentry = SdlSentry{SdlSubsystem::VIDEO | SdlSubsystem::EVENTS};
         SDL_Window*                     window     = nullptr;
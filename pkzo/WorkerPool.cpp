@@ -0,0 +1,115 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "pch.h"
+
+#include "WorkerPool.h"
+
+namespace pkzo
+{
+    WorkerPool::WorkerPool(unsigned int count)
+    {
+        for (auto i = 0u; i < count; i++)
+        {
+            threads.emplace_back([this] () { run(); });
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            auto lock = std::unique_lock(mutex);
+            stop = true;
+        }
+        start_condition.notify_all();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    size_t WorkerPool::get_thread_count() const
+    {
+        return threads.size() + 1u;
+    }
+
+    void WorkerPool::parallel_for(size_t count, const std::function<void (size_t)>& func)
+    {
+        if (threads.empty() || count < 2u)
+        {
+            for (auto i = size_t{0u}; i < count; i++)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        {
+            auto lock = std::unique_lock(mutex);
+            job       = &func;
+            job_count = count;
+            next      = 0u;
+            busy      = threads.size();
+            generation++;
+        }
+        start_condition.notify_all();
+
+        work();
+
+        auto lock = std::unique_lock(mutex);
+        done_condition.wait(lock, [this] () { return busy == 0u; });
+        job = nullptr;
+    }
+
+    void WorkerPool::work()
+    {
+        for (auto i = next.fetch_add(1u); i < job_count; i = next.fetch_add(1u))
+        {
+            (*job)(i);
+        }
+    }
+
+    void WorkerPool::run()
+    {
+        auto seen = uint64_t{0u};
+        while (true)
+        {
+            {
+                auto lock = std::unique_lock(mutex);
+                start_condition.wait(lock, [&] () { return stop || generation != seen; });
+                if (stop)
+                {
+                    return;
+                }
+                seen = generation;
+            }
+
+            work();
+
+            {
+                auto lock = std::unique_lock(mutex);
+                busy--;
+            }
+            done_condition.notify_one();
+        }
+    }
+}
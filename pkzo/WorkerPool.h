@@ -0,0 +1,70 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "api.h"
+
+namespace pkzo
+{
+    //! Runs jobs on a fixed set of threads, the calling thread helps out.
+    class PKZO_EXPORT WorkerPool
+    {
+    public:
+        //! Create a pool with count threads besides the calling thread.
+        WorkerPool(unsigned int count);
+
+        ~WorkerPool();
+
+        //! Threads that run jobs, including the calling thread.
+        size_t get_thread_count() const;
+
+        //! Call func for every index in [0, count) and wait for all calls.
+        void parallel_for(size_t count, const std::function<void (size_t)>& func);
+
+    private:
+        std::vector<std::thread> threads;
+
+        std::mutex              mutex;
+        std::condition_variable start_condition;
+        std::condition_variable done_condition;
+
+        const std::function<void (size_t)>* job        = nullptr;
+        size_t                              job_count  = 0u;
+        std::atomic<size_t>                 next       = 0u;
+        size_t                              busy       = 0u;
+        uint64_t                            generation = 0u;
+        bool                                stop       = false;
+
+        void work();
+        void run();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator = (const WorkerPool&) = delete;
+    };
+}
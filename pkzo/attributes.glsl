@@ -26,3 +26,36 @@ layout(location = 1) in vec3 atr_Normal;
 layout(location = 2) in vec3 atr_Tangent;
 layout(location = 3) in vec2 atr_TexCoord;
 layout(location = 4) in vec4 atr_Color;
+layout(location = 5) in mat4 atr_InstanceModelMatrix;
+
+layout(std140, binding = 3) uniform MeshBlock
+{
+    vec4 position_scale;
+    vec4 position_offset;
+    int packed;
+} blk_Mesh;
+
+vec3 decode_octahedral(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+    {
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(n);
+}
+
+vec3 get_vertex()
+{
+    return atr_Vertex * blk_Mesh.position_scale.xyz + blk_Mesh.position_offset.xyz;
+}
+
+vec3 get_normal()
+{
+    return blk_Mesh.packed != 0 ? decode_octahedral(atr_Normal.xy) : atr_Normal;
+}
+
+vec3 get_tangent()
+{
+    return blk_Mesh.packed != 0 ? decode_octahedral(atr_Tangent.xy) : atr_Tangent;
+}
@@ -0,0 +1,251 @@
+// pkzo
+// Copyright 2010-2026 Sean Farrell
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Light evaluation, include after uniforms.glsl and math.glsl.
+
+vec3 tonemap(vec3 x)
+{
+    vec3 X = max(vec3(0.0), x - 0.004);
+    vec3 result = (X * (6.2 * X + 0.5)) / (X * (6.2 * X + 1.7) + 0.06);
+    return pow(result, vec3(2.2));
+}
+
+// L2 spherical harmonics, the coefficients are convolved with the cosine lobe
+vec3 lightProbeIrradiance(int index, vec3 n)
+{
+    int i = index * IRRADIANCE_COEFFICIENTS;
+    vec3 result = blk_Frame.light_probe_irradiance[i + 0].rgb * 0.282095;
+    result += blk_Frame.light_probe_irradiance[i + 1].rgb * 0.488603 * n.y;
+    result += blk_Frame.light_probe_irradiance[i + 2].rgb * 0.488603 * n.z;
+    result += blk_Frame.light_probe_irradiance[i + 3].rgb * 0.488603 * n.x;
+    result += blk_Frame.light_probe_irradiance[i + 4].rgb * 1.092548 * n.x * n.y;
+    result += blk_Frame.light_probe_irradiance[i + 5].rgb * 1.092548 * n.y * n.z;
+    result += blk_Frame.light_probe_irradiance[i + 6].rgb * 0.315392 * (3.0 * n.z * n.z - 1.0);
+    result += blk_Frame.light_probe_irradiance[i + 7].rgb * 1.092548 * n.x * n.z;
+    result += blk_Frame.light_probe_irradiance[i + 8].rgb * 0.546274 * (n.x * n.x - n.y * n.y);
+    return max(result, vec3(0.0));
+}
+
+vec3 lightProbe(int index, LightProbe probe, vec3 normal, vec3 view, vec3 diffuseColor, vec3 specularColor, float roughness)
+{
+    vec3  reflection = reflect(-view, normal);
+
+    vec3 diffuse  = lightProbeIrradiance(index, normal) * diffuseColor;
+
+    vec3 specular;
+    if (roughness < 0.1)
+    {
+        specular = textureLod(probe.environment, reflection, 0).rgb * specularColor;
+    }
+    else
+    {
+        specular = textureLod(probe.specular, reflection, specularRoughnessMip(roughness)).rgb * specularColor;
+    }
+
+    return diffuse + specular;
+}
+
+vec3 directionalLight(Light light, vec3 normal, vec3 view, vec3 diffuseColor, vec3 specularColor, float shininess)
+{
+    vec3 lightDir   = normalize(-light.direction);
+
+    float NdotL      = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse     = diffuseColor * light.color * NdotL;
+
+    vec3 halfway     = normalize(lightDir + view);
+    float NdotH      = max(dot(normal, halfway), 0.0);
+    vec3 specular    = pow(NdotH, shininess * 128.0) * specularColor * light.color;
+
+    return diffuse + specular;
+}
+
+// Smooth falloff to zero at the light's range, so that lights can be culled.
+// A range of 0 is unbounded and keeps the plain 1/d^2 falloff.
+float rangeWindow(float dist, float range)
+{
+    if (range <= 0.0)
+    {
+        return 1.0;
+    }
+
+    float r = dist / range;
+    float w = clamp(1.0 - r * r * r * r, 0.0, 1.0);
+    return w * w;
+}
+
+vec3 pointLight(Light light, float range, vec3 position, vec3 normal, vec3 view, vec3 diffuseColor, vec3 specularColor, float shininess)
+{
+    vec3  lightDir   = light.position - position;
+    float dist       = length(lightDir);
+          lightDir   = normalize(lightDir);
+
+    float attenuation = rangeWindow(dist, range) / (dist * dist);
+
+    float NdotL      = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse     = diffuseColor * light.color * NdotL * attenuation;
+
+    vec3 halfway     = normalize(lightDir + view);
+    float NdotH      = max(dot(normal, halfway), 0.0);
+    vec3 specular    = pow(NdotH, shininess * 128.0) * specularColor * light.color * attenuation;
+
+    return diffuse + specular;
+}
+
+vec3 spotLight(Light light, float range, vec3 position, vec3 normal, vec3 view, vec3 diffuseColor, vec3 specularColor, float shininess)
+{
+    vec3  lightDir   = light.position - position;
+    float dist       = length(lightDir);
+          lightDir   = normalize(lightDir);
+
+    float attenuation = rangeWindow(dist, range) / (dist * dist);
+
+    float theta       = dot(lightDir, -normalize(light.direction));
+    float cos_inner   = cos(light.angles.x);
+    float cos_outer   = cos(light.angles.y);
+          attenuation = attenuation * clamp((theta - cos_outer) / (cos_inner - cos_outer), 0.0, 1.0);
+
+    float NdotL      = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse     = diffuseColor * light.color * NdotL * attenuation;
+
+    vec3 halfway     = normalize(lightDir + view);
+    float NdotH      = max(dot(normal, halfway), 0.0);
+    vec3 specular    = pow(NdotH, shininess * 128.0) * specularColor * light.color * attenuation;
+
+    return diffuse + specular;
+}
+
+// Depth bias on top of the normal offset, in window depth.
+const float SHADOW_DEPTH_BIAS = 0.0005;
+
+// Visibility in a shadow view of the atlas, 2x2 percentage closer filtered.
+float shadowView(int view, vec3 position, vec3 normal)
+{
+    mat4 matrix = blk_Frame.shadow_matrices[view];
+    vec4 tile   = blk_Frame.shadow_tiles[view];
+
+    // the normal offset of spot lights grows with the distance, which is w
+    float w    = (matrix * vec4(position, 1.0)).w;
+    vec4  clip = matrix * vec4(position + normal * tile.w * w, 1.0);
+    vec3  ndc  = clip.xyz / clip.w;
+    if (any(greaterThan(abs(ndc), vec3(1.0))))
+    {
+        return 1.0;
+    }
+
+    float depth = ndc.z * 0.5 + 0.5 - SHADOW_DEPTH_BIAS;
+    ivec2 first = ivec2(tile.xy);
+    ivec2 last  = first + ivec2(tile.z) - 1;
+    ivec2 base  = first + ivec2(floor((ndc.xy * 0.5 + 0.5) * tile.z - 0.5));
+
+    float lit = 0.0;
+    for (int y = 0; y < 2; y++)
+    {
+        for (int x = 0; x < 2; x++)
+        {
+            ivec2 texel = clamp(base + ivec2(x, y), first, last);
+            lit += depth <= texelFetch(uni_ShadowMap, texel, 0).r ? 1.0 : 0.0;
+        }
+    }
+    return lit * 0.25;
+}
+
+// Visibility for a directional light, the cascades are consecutive views.
+float shadowCascades(int first, vec3 position, vec3 normal)
+{
+    float depth = -(blk_Frame.view_matrix * vec4(position, 1.0)).z;
+    for (int i = 0; i < SHADOW_CASCADES; i++)
+    {
+        if (depth < blk_Frame.shadow_cascade_splits[i])
+        {
+            return shadowView(first + i, position, normal);
+        }
+    }
+    return 1.0;
+}
+
+// Index of the light cluster of this fragment, the slicing must match LightClusters.
+uint clusterIndex(vec3 position)
+{
+    ivec3 grid    = blk_Frame.cluster_grid;
+    float near    = blk_Frame.cluster_depth.x;
+    float far     = blk_Frame.cluster_depth.y;
+    float depth   = -(blk_Frame.view_matrix * vec4(position, 1.0)).z;
+    int   slice   = int(floor(log(max(depth, near) / near) / log(far / near) * float(grid.z)));
+    ivec3 cluster = clamp(ivec3(ivec2(gl_FragCoord.xy / blk_Frame.cluster_tile_size), slice), ivec3(0), grid - 1);
+    return uint(cluster.x + grid.x * (cluster.y + grid.y * cluster.z));
+}
+
+Light unpackLight(LightData data)
+{
+    return Light(int(data.direction.w), data.direction.xyz, data.position.xyz, data.color.rgb, data.angles.xy);
+}
+
+// Lighting of an opaque surface, shared by the forward and deferred shading.
+vec3 shadeSurface(vec3 position, vec3 normal, vec3 view, vec3 baseColor, float metallic, float roughness, vec3 emissive)
+{
+    vec3  diffuseColor  = mix(baseColor, vec3(0.0), metallic);
+    vec3  specularColor = mix(vec3(0.04), baseColor, metallic);
+    float shininess     = mix(2.0, 256.0, 1.0 - roughness);
+
+    vec3 result = emissive;
+
+    for (int i = 0; i < MAX_LIGHT_PROBES; i++)
+    {
+        result += lightProbe(i, uni_LightProbes[i], normal, view, diffuseColor, specularColor, roughness);
+    }
+
+    for (int i = 0; i < MAX_LIGHTS; i++)
+    {
+        Light light  = unpackLight(blk_Frame.lights[i]);
+        int   shadow = int(blk_Frame.lights[i].angles.z);
+        switch (light.type)
+        {
+            case NONE_LIGHT:
+                break;
+            case AMBIENT_LIGHT:
+                result += baseColor * light.color;
+                break;
+            case DIRECTIONAL_LIGHT:
+                result += directionalLight(light, normal, view, diffuseColor, specularColor, shininess) * (shadow >= 0 ? shadowCascades(shadow, position, normal) : 1.0);
+                break;
+        }
+    }
+
+    uvec2 cluster = ssb_ClusterRanges[clusterIndex(position)];
+    for (uint i = 0u; i < cluster.y; i++)
+    {
+        LightData data   = ssb_ClusterLights[ssb_ClusterLightIndexes[cluster.x + i]];
+        Light     light  = unpackLight(data);
+        float     range  = data.position.w;
+        int       shadow = int(data.angles.z);
+        switch (light.type)
+        {
+            case POINT_LIGHT:
+                result += pointLight(light, range, position, normal, view, diffuseColor, specularColor, shininess);
+                break;
+            case SPOT_LIGHT:
+                result += spotLight(light, range, position, normal, view, diffuseColor, specularColor, shininess) * (shadow >= 0 ? shadowView(shadow, position, normal) : 1.0);
+                break;
+        }
+    }
+
+    return result;
+}
@@ -60,3 +60,37 @@ vec3 hemisphereSample_cos(float u, float v)
      return vec3(cos(phi) * sinTheta, sin(phi) * sinTheta, cosTheta);
 }
 
+
+vec3 importanceSample_ggx(float u, float v, float alpha)
+{
+     float phi = v * 2.0 * PI;
+     float cosTheta = sqrt((1.0 - u) / (1.0 + (alpha * alpha - 1.0) * u));
+     float sinTheta = sqrt(1.0 - cosTheta * cosTheta);
+     return vec3(cos(phi) * sinTheta, sin(phi) * sinTheta, cosTheta);
+}
+
+float distribution_ggx(float NdotH, float alpha)
+{
+    float a2 = alpha * alpha;
+    float d  = NdotH * NdotH * (a2 - 1.0) + 1.0;
+    return a2 / (PI * d * d);
+}
+
+mat3 tangentFrame(vec3 normal)
+{
+    vec3 up    = abs(normal.z) < 0.999 ? vec3(0, 0, 1) : vec3(1, 0, 0);
+    vec3 right = normalize(cross(up, normal));
+    return mat3(right, cross(normal, right), normal);
+}
+
+// The specular light probe holds one roughness per mip level, shared by
+// the prefilter and the shaders sampling it.
+float specularMipRoughness(float mip)
+{
+    return mip / float(SPECULAR_MIP_LEVELS - 1);
+}
+
+float specularRoughnessMip(float roughness)
+{
+    return roughness * float(SPECULAR_MIP_LEVELS - 1);
+}
@@ -24,16 +24,29 @@
 // OS Wrappers
 #include "events.h"
 #include "Window.h"
+#include "RenderThread.h"
 #include "Keyboard.h"
 #include "Mouse.h"
 #include "GraphicContext.h"
+#include "CommandBuffer.h"
+#include "WorkerPool.h"
+#include "FrameProfiler.h"
+#include "RecordingGraphicContext.h"
+#include "SoftwareGraphicContext.h"
 
 // Assets
 #include "Texture.h"
 #include "MemoryTexture.h"
 #include "CubeMap.h"
+#include "CacheFile.h"
+#include "CubeMapCache.h"
+#include "IncrementalCubeMapGenerator.h"
+#include "SphericalHarmonics.h"
 #include "Material.h"
 #include "Mesh.h"
+#include "MeshLod.h"
+#include "VertexPacking.h"
+#include "OcclusionBuffer.h"
 
 // Screen
 #include "Screen.h"
@@ -45,6 +58,8 @@
 #include "Node.h"
 #include "Group.h"
 #include "Scene.h"
+#include "SceneRenderer.h"
+#include "RenderProxies.h"
 #include "Camera.h"
 #include "Geometry.h"
 #include "BoxGeometry.h"
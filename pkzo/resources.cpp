@@ -10,7 +10,7 @@ namespace pkzo
 
     std::string_view get_resource(const std::string_view file)
     {
-        static const auto attributes_glsl_data = std::array<unsigned char, 1396>{
+        static const auto attributes_glsl_data = std::array<unsigned char, 2161>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0d,0x0a,0x2f,0x2f,0x20,0x43,
             0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,
             0x2d,0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,
@@ -118,10 +118,69 @@ namespace pkzo
             0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
             0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,
             0x76,0x65,0x63,0x34,0x20,0x61,0x74,0x72,0x5f,0x43,0x6f,0x6c,0x6f,
-            0x72,0x3b,0x0d,0x0a,0x00
+            0x72,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+            0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x69,
+            0x6e,0x20,0x6d,0x61,0x74,0x34,0x20,0x61,0x74,0x72,0x5f,0x49,0x6e,
+            0x73,0x74,0x61,0x6e,0x63,0x65,0x4d,0x6f,0x64,0x65,0x6c,0x4d,0x61,
+            0x74,0x72,0x69,0x78,0x3b,0x0d,0x0a,0x0d,0x0a,0x6c,0x61,0x79,0x6f,
+            0x75,0x74,0x28,0x73,0x74,0x64,0x31,0x34,0x30,0x2c,0x20,0x62,0x69,
+            0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x33,0x29,0x20,0x75,0x6e,
+            0x69,0x66,0x6f,0x72,0x6d,0x20,0x4d,0x65,0x73,0x68,0x42,0x6c,0x6f,
+            0x63,0x6b,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+            0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x73,
+            0x63,0x61,0x6c,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+            0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x6f,
+            0x66,0x66,0x73,0x65,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x69,
+            0x6e,0x74,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x3b,0x0d,0x0a,0x7d,
+            0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x65,0x73,0x68,0x3b,0x0d,0x0a,0x0d,
+            0x0a,0x76,0x65,0x63,0x33,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,
+            0x6f,0x63,0x74,0x61,0x68,0x65,0x64,0x72,0x61,0x6c,0x28,0x76,0x65,
+            0x63,0x32,0x20,0x65,0x29,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,
+            0x33,0x28,0x65,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,
+            0x73,0x28,0x65,0x2e,0x78,0x29,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,
+            0x65,0x2e,0x79,0x29,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x69,
+            0x66,0x20,0x28,0x6e,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,
+            0x0d,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x6e,0x2e,0x78,0x79,0x20,0x3d,0x20,0x28,0x31,
+            0x2e,0x30,0x20,0x2d,0x20,0x61,0x62,0x73,0x28,0x6e,0x2e,0x79,0x78,
+            0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x6e,0x2e,0x78,
+            0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,
+            0x20,0x3a,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x6e,0x2e,0x79,0x20,
+            0x3e,0x3d,0x20,0x30,0x2e,0x30,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,
+            0x3a,0x20,0x2d,0x31,0x2e,0x30,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+            0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,
+            0x29,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x76,0x65,0x63,0x33,
+            0x20,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,0x65,0x78,0x28,0x29,
+            0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+            0x72,0x6e,0x20,0x61,0x74,0x72,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,
+            0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x65,0x73,0x68,0x2e,0x70,
+            0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x63,0x61,0x6c,0x65,
+            0x2e,0x78,0x79,0x7a,0x20,0x2b,0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x65,
+            0x73,0x68,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x6f,
+            0x66,0x66,0x73,0x65,0x74,0x2e,0x78,0x79,0x7a,0x3b,0x0d,0x0a,0x7d,
+            0x0d,0x0a,0x0d,0x0a,0x76,0x65,0x63,0x33,0x20,0x67,0x65,0x74,0x5f,
+            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x29,0x0d,0x0a,0x7b,0x0d,0x0a,
+            0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x62,0x6c,
+            0x6b,0x5f,0x4d,0x65,0x73,0x68,0x2e,0x70,0x61,0x63,0x6b,0x65,0x64,
+            0x20,0x21,0x3d,0x20,0x30,0x20,0x3f,0x20,0x64,0x65,0x63,0x6f,0x64,
+            0x65,0x5f,0x6f,0x63,0x74,0x61,0x68,0x65,0x64,0x72,0x61,0x6c,0x28,
+            0x61,0x74,0x72,0x5f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x78,0x79,
+            0x29,0x20,0x3a,0x20,0x61,0x74,0x72,0x5f,0x4e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x76,0x65,0x63,0x33,
+            0x20,0x67,0x65,0x74,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x28,
+            0x29,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+            0x75,0x72,0x6e,0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x65,0x73,0x68,0x2e,
+            0x70,0x61,0x63,0x6b,0x65,0x64,0x20,0x21,0x3d,0x20,0x30,0x20,0x3f,
+            0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x6f,0x63,0x74,0x61,0x68,
+            0x65,0x64,0x72,0x61,0x6c,0x28,0x61,0x74,0x72,0x5f,0x54,0x61,0x6e,
+            0x67,0x65,0x6e,0x74,0x2e,0x78,0x79,0x29,0x20,0x3a,0x20,0x61,0x74,
+            0x72,0x5f,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x3b,0x0d,0x0a,0x7d,
+            0x0d,0x0a,0x00
         };
 
-        static const auto math_glsl_data = std::array<unsigned char, 2342>{
+        static const auto math_glsl_data = std::array<unsigned char, 3322>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -302,7 +361,834 @@ namespace pkzo
             0x65,0x74,0x61,0x2c,0x20,0x73,0x69,0x6e,0x28,0x70,0x68,0x69,0x29,
             0x20,0x2a,0x20,0x73,0x69,0x6e,0x54,0x68,0x65,0x74,0x61,0x2c,0x20,
             0x63,0x6f,0x73,0x54,0x68,0x65,0x74,0x61,0x29,0x3b,0x0a,0x7d,0x0a,
-            0x0a,0x00
+            0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,
+            0x61,0x6e,0x63,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x67,0x67,
+            0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x2c,0x20,0x66,0x6c,
+            0x6f,0x61,0x74,0x20,0x76,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x61,0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x68,0x69,0x20,0x3d,0x20,
+            0x76,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2a,0x20,0x50,0x49,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,
+            0x6f,0x73,0x54,0x68,0x65,0x74,0x61,0x20,0x3d,0x20,0x73,0x71,0x72,
+            0x74,0x28,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x75,0x29,0x20,0x2f,
+            0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x61,0x6c,0x70,0x68,
+            0x61,0x20,0x2a,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x2d,0x20,0x31,
+            0x2e,0x30,0x29,0x20,0x2a,0x20,0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,
+            0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x6e,0x54,
+            0x68,0x65,0x74,0x61,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x31,
+            0x2e,0x30,0x20,0x2d,0x20,0x63,0x6f,0x73,0x54,0x68,0x65,0x74,0x61,
+            0x20,0x2a,0x20,0x63,0x6f,0x73,0x54,0x68,0x65,0x74,0x61,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+            0x76,0x65,0x63,0x33,0x28,0x63,0x6f,0x73,0x28,0x70,0x68,0x69,0x29,
+            0x20,0x2a,0x20,0x73,0x69,0x6e,0x54,0x68,0x65,0x74,0x61,0x2c,0x20,
+            0x73,0x69,0x6e,0x28,0x70,0x68,0x69,0x29,0x20,0x2a,0x20,0x73,0x69,
+            0x6e,0x54,0x68,0x65,0x74,0x61,0x2c,0x20,0x63,0x6f,0x73,0x54,0x68,
+            0x65,0x74,0x61,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x69,0x6f,
+            0x6e,0x5f,0x67,0x67,0x78,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,
+            0x64,0x6f,0x74,0x48,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,
+            0x6c,0x70,0x68,0x61,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+            0x6c,0x6f,0x61,0x74,0x20,0x61,0x32,0x20,0x3d,0x20,0x61,0x6c,0x70,
+            0x68,0x61,0x20,0x2a,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x20,0x3d,
+            0x20,0x4e,0x64,0x6f,0x74,0x48,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,
+            0x48,0x20,0x2a,0x20,0x28,0x61,0x32,0x20,0x2d,0x20,0x31,0x2e,0x30,
+            0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x32,0x20,0x2f,0x20,0x28,
+            0x50,0x49,0x20,0x2a,0x20,0x64,0x20,0x2a,0x20,0x64,0x29,0x3b,0x0a,
+            0x7d,0x0a,0x0a,0x6d,0x61,0x74,0x33,0x20,0x74,0x61,0x6e,0x67,0x65,
+            0x6e,0x74,0x46,0x72,0x61,0x6d,0x65,0x28,0x76,0x65,0x63,0x33,0x20,
+            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x75,0x70,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x61,0x62,0x73,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,0x7a,
+            0x29,0x20,0x3c,0x20,0x30,0x2e,0x39,0x39,0x39,0x20,0x3f,0x20,0x76,
+            0x65,0x63,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x20,
+            0x3a,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2c,0x20,0x30,0x2c,0x20,
+            0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+            0x72,0x69,0x67,0x68,0x74,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x69,0x7a,0x65,0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x75,0x70,
+            0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x74,
+            0x33,0x28,0x72,0x69,0x67,0x68,0x74,0x2c,0x20,0x63,0x72,0x6f,0x73,
+            0x73,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x72,0x69,0x67,
+            0x68,0x74,0x29,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,
+            0x0a,0x7d,0x0a,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,0x20,0x73,0x70,
+            0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,
+            0x70,0x72,0x6f,0x62,0x65,0x20,0x68,0x6f,0x6c,0x64,0x73,0x20,0x6f,
+            0x6e,0x65,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,
+            0x70,0x65,0x72,0x20,0x6d,0x69,0x70,0x20,0x6c,0x65,0x76,0x65,0x6c,
+            0x2c,0x20,0x73,0x68,0x61,0x72,0x65,0x64,0x20,0x62,0x79,0x0a,0x2f,
+            0x2f,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,0x74,
+            0x65,0x72,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x73,0x68,
+            0x61,0x64,0x65,0x72,0x73,0x20,0x73,0x61,0x6d,0x70,0x6c,0x69,0x6e,
+            0x67,0x20,0x69,0x74,0x2e,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x4d,0x69,0x70,0x52,0x6f,0x75,
+            0x67,0x68,0x6e,0x65,0x73,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x6d,0x69,0x70,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+            0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x70,0x20,0x2f,0x20,0x66,0x6c,
+            0x6f,0x61,0x74,0x28,0x53,0x50,0x45,0x43,0x55,0x4c,0x41,0x52,0x5f,
+            0x4d,0x49,0x50,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x53,0x20,0x2d,0x20,
+            0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x52,0x6f,0x75,0x67,0x68,
+            0x6e,0x65,0x73,0x73,0x4d,0x69,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,
+            0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,
+            0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+            0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x66,0x6c,
+            0x6f,0x61,0x74,0x28,0x53,0x50,0x45,0x43,0x55,0x4c,0x41,0x52,0x5f,
+            0x4d,0x49,0x50,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x53,0x20,0x2d,0x20,
+            0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+        };
+
+        static const auto lighting_glsl_data = std::array<unsigned char, 9732>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x2f,0x2f,0x20,0x4c,0x69,0x67,0x68,0x74,0x20,0x65,0x76,0x61,
+            0x6c,0x75,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x69,0x6e,0x63,0x6c,
+            0x75,0x64,0x65,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x75,0x6e,0x69,
+            0x66,0x6f,0x72,0x6d,0x73,0x2e,0x67,0x6c,0x73,0x6c,0x20,0x61,0x6e,
+            0x64,0x20,0x6d,0x61,0x74,0x68,0x2e,0x67,0x6c,0x73,0x6c,0x2e,0x0a,
+            0x0a,0x76,0x65,0x63,0x33,0x20,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,
+            0x28,0x76,0x65,0x63,0x33,0x20,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+            0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x58,0x20,0x3d,0x20,0x6d,0x61,
+            0x78,0x28,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,
+            0x78,0x20,0x2d,0x20,0x30,0x2e,0x30,0x30,0x34,0x29,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,0x75,0x6c,
+            0x74,0x20,0x3d,0x20,0x28,0x58,0x20,0x2a,0x20,0x28,0x36,0x2e,0x32,
+            0x20,0x2a,0x20,0x58,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x29,0x20,
+            0x2f,0x20,0x28,0x58,0x20,0x2a,0x20,0x28,0x36,0x2e,0x32,0x20,0x2a,
+            0x20,0x58,0x20,0x2b,0x20,0x31,0x2e,0x37,0x29,0x20,0x2b,0x20,0x30,
+            0x2e,0x30,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+            0x75,0x72,0x6e,0x20,0x70,0x6f,0x77,0x28,0x72,0x65,0x73,0x75,0x6c,
+            0x74,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x32,0x2e,0x32,0x29,0x29,
+            0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2f,0x20,0x4c,0x32,0x20,0x73,0x70,
+            0x68,0x65,0x72,0x69,0x63,0x61,0x6c,0x20,0x68,0x61,0x72,0x6d,0x6f,
+            0x6e,0x69,0x63,0x73,0x2c,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x65,
+            0x66,0x66,0x69,0x63,0x69,0x65,0x6e,0x74,0x73,0x20,0x61,0x72,0x65,
+            0x20,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x76,0x65,0x64,0x20,0x77,0x69,
+            0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x73,0x69,0x6e,0x65,
+            0x20,0x6c,0x6f,0x62,0x65,0x0a,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,
+            0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x49,0x72,0x72,0x61,0x64,
+            0x69,0x61,0x6e,0x63,0x65,0x28,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,
+            0x65,0x78,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x29,0x0a,0x7b,
+            0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,
+            0x69,0x6e,0x64,0x65,0x78,0x20,0x2a,0x20,0x49,0x52,0x52,0x41,0x44,
+            0x49,0x41,0x4e,0x43,0x45,0x5f,0x43,0x4f,0x45,0x46,0x46,0x49,0x43,
+            0x49,0x45,0x4e,0x54,0x53,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x62,
+            0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,0x69,0x67,0x68,
+            0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,0x72,0x61,0x64,
+            0x69,0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,0x30,0x5d,0x2e,
+            0x72,0x67,0x62,0x20,0x2a,0x20,0x30,0x2e,0x32,0x38,0x32,0x30,0x39,
+            0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+            0x20,0x2b,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,
+            0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,
+            0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,
+            0x2b,0x20,0x31,0x5d,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x30,0x2e,
+            0x34,0x38,0x38,0x36,0x30,0x33,0x20,0x2a,0x20,0x6e,0x2e,0x79,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,
+            0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,
+            0x69,0x67,0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,
+            0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,
+            0x32,0x5d,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x30,0x2e,0x34,0x38,
+            0x38,0x36,0x30,0x33,0x20,0x2a,0x20,0x6e,0x2e,0x7a,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,
+            0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,0x69,0x67,
+            0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,0x72,0x61,
+            0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,0x33,0x5d,
+            0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x30,0x2e,0x34,0x38,0x38,0x36,
+            0x30,0x33,0x20,0x2a,0x20,0x6e,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x62,0x6c,
+            0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,0x69,0x67,0x68,0x74,
+            0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,0x72,0x61,0x64,0x69,
+            0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,0x34,0x5d,0x2e,0x72,
+            0x67,0x62,0x20,0x2a,0x20,0x31,0x2e,0x30,0x39,0x32,0x35,0x34,0x38,
+            0x20,0x2a,0x20,0x6e,0x2e,0x78,0x20,0x2a,0x20,0x6e,0x2e,0x79,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,
+            0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,
+            0x69,0x67,0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,
+            0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,
+            0x35,0x5d,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x31,0x2e,0x30,0x39,
+            0x32,0x35,0x34,0x38,0x20,0x2a,0x20,0x6e,0x2e,0x79,0x20,0x2a,0x20,
+            0x6e,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+            0x6c,0x74,0x20,0x2b,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,
+            0x6d,0x65,0x2e,0x6c,0x69,0x67,0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,
+            0x65,0x5f,0x69,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,
+            0x69,0x20,0x2b,0x20,0x36,0x5d,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,
+            0x30,0x2e,0x33,0x31,0x35,0x33,0x39,0x32,0x20,0x2a,0x20,0x28,0x33,
+            0x2e,0x30,0x20,0x2a,0x20,0x6e,0x2e,0x7a,0x20,0x2a,0x20,0x6e,0x2e,
+            0x7a,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x62,0x6c,
+            0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,0x69,0x67,0x68,0x74,
+            0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,0x72,0x61,0x64,0x69,
+            0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,0x37,0x5d,0x2e,0x72,
+            0x67,0x62,0x20,0x2a,0x20,0x31,0x2e,0x30,0x39,0x32,0x35,0x34,0x38,
+            0x20,0x2a,0x20,0x6e,0x2e,0x78,0x20,0x2a,0x20,0x6e,0x2e,0x7a,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,
+            0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,
+            0x69,0x67,0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,
+            0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,0x69,0x20,0x2b,0x20,
+            0x38,0x5d,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x30,0x2e,0x35,0x34,
+            0x36,0x32,0x37,0x34,0x20,0x2a,0x20,0x28,0x6e,0x2e,0x78,0x20,0x2a,
+            0x20,0x6e,0x2e,0x78,0x20,0x2d,0x20,0x6e,0x2e,0x79,0x20,0x2a,0x20,
+            0x6e,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+            0x75,0x72,0x6e,0x20,0x6d,0x61,0x78,0x28,0x72,0x65,0x73,0x75,0x6c,
+            0x74,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x29,
+            0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,
+            0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x28,0x69,0x6e,0x74,0x20,0x69,
+            0x6e,0x64,0x65,0x78,0x2c,0x20,0x4c,0x69,0x67,0x68,0x74,0x50,0x72,
+            0x6f,0x62,0x65,0x20,0x70,0x72,0x6f,0x62,0x65,0x2c,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,
+            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,
+            0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,
+            0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x72,
+            0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x72,
+            0x65,0x66,0x6c,0x65,0x63,0x74,0x28,0x2d,0x76,0x69,0x65,0x77,0x2c,
+            0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,0x0a,0x20,0x20,
+            0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
+            0x65,0x20,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x72,0x6f,
+            0x62,0x65,0x49,0x72,0x72,0x61,0x64,0x69,0x61,0x6e,0x63,0x65,0x28,
+            0x69,0x6e,0x64,0x65,0x78,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+            0x29,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,
+            0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,
+            0x65,0x73,0x73,0x20,0x3c,0x20,0x30,0x2e,0x31,0x29,0x0a,0x20,0x20,
+            0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
+            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+            0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x70,0x72,0x6f,0x62,0x65,
+            0x2e,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x2c,
+            0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x30,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,
+            0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+            0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+            0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x3d,0x20,0x74,
+            0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x70,0x72,0x6f,
+            0x62,0x65,0x2e,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x2c,0x20,
+            0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x73,
+            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x52,0x6f,0x75,0x67,0x68,0x6e,
+            0x65,0x73,0x73,0x4d,0x69,0x70,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,
+            0x65,0x73,0x73,0x29,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x73,
+            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x72,
+            0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
+            0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,
+            0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x72,0x65,0x63,
+            0x74,0x69,0x6f,0x6e,0x61,0x6c,0x4c,0x69,0x67,0x68,0x74,0x28,0x4c,
+            0x69,0x67,0x68,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x76,
+            0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,
+            0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,
+            0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,
+            0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,
+            0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,
+            0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x20,0x20,0x3d,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,0x6c,0x69,0x67,
+            0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,
+            0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x4e,0x64,0x6f,0x74,0x4c,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,
+            0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,
+            0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x20,0x20,
+            0x20,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,
+            0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,
+            0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x68,0x61,
+            0x6c,0x66,0x77,0x61,0x79,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,
+            0x74,0x44,0x69,0x72,0x20,0x2b,0x20,0x76,0x69,0x65,0x77,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
+            0x6f,0x74,0x48,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,
+            0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
+            0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,0x29,0x2c,0x20,0x30,0x2e,
+            0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+            0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x70,0x6f,0x77,0x28,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x73,
+            0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x31,0x32,
+            0x38,0x2e,0x30,0x29,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,
+            0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,
+            0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x20,0x20,
+            0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x66,0x66,
+            0x75,0x73,0x65,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
+            0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,0x2f,0x20,0x53,0x6d,0x6f,0x6f,
+            0x74,0x68,0x20,0x66,0x61,0x6c,0x6c,0x6f,0x66,0x66,0x20,0x74,0x6f,
+            0x20,0x7a,0x65,0x72,0x6f,0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x20,
+            0x6c,0x69,0x67,0x68,0x74,0x27,0x73,0x20,0x72,0x61,0x6e,0x67,0x65,
+            0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,0x74,0x20,0x6c,0x69,0x67,
+            0x68,0x74,0x73,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x63,0x75,
+            0x6c,0x6c,0x65,0x64,0x2e,0x0a,0x2f,0x2f,0x20,0x41,0x20,0x72,0x61,
+            0x6e,0x67,0x65,0x20,0x6f,0x66,0x20,0x30,0x20,0x69,0x73,0x20,0x75,
+            0x6e,0x62,0x6f,0x75,0x6e,0x64,0x65,0x64,0x20,0x61,0x6e,0x64,0x20,
+            0x6b,0x65,0x65,0x70,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x6c,0x61,
+            0x69,0x6e,0x20,0x31,0x2f,0x64,0x5e,0x32,0x20,0x66,0x61,0x6c,0x6c,
+            0x6f,0x66,0x66,0x2e,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,
+            0x6e,0x67,0x65,0x57,0x69,0x6e,0x64,0x6f,0x77,0x28,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+            0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3c,
+            0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+            0x6e,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,
+            0x3d,0x20,0x64,0x69,0x73,0x74,0x20,0x2f,0x20,0x72,0x61,0x6e,0x67,
+            0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x77,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x31,0x2e,0x30,
+            0x20,0x2d,0x20,0x72,0x20,0x2a,0x20,0x72,0x20,0x2a,0x20,0x72,0x20,
+            0x2a,0x20,0x72,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+            0x20,0x77,0x20,0x2a,0x20,0x77,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,
+            0x63,0x33,0x20,0x70,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,
+            0x28,0x4c,0x69,0x67,0x68,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,
+            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x6e,0x67,0x65,0x2c,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+            0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
+            0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,
+            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,
+            0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,
+            0x20,0x20,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,
+            0x69,0x74,0x69,0x6f,0x6e,0x20,0x2d,0x20,0x70,0x6f,0x73,0x69,0x74,
+            0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x64,0x69,0x73,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x6c,0x69,0x67,0x68,
+            0x74,0x44,0x69,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,
+            0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+            0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x3b,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,
+            0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x72,0x61,
+            0x6e,0x67,0x65,0x57,0x69,0x6e,0x64,0x6f,0x77,0x28,0x64,0x69,0x73,
+            0x74,0x2c,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x20,0x2f,0x20,0x28,
+            0x64,0x69,0x73,0x74,0x20,0x2a,0x20,0x64,0x69,0x73,0x74,0x29,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,
+            0x64,0x6f,0x74,0x4c,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,
+            0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+            0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,
+            0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x20,0x20,0x20,
+            0x20,0x3d,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,
+            0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,
+            0x6c,0x6f,0x72,0x20,0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,
+            0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x68,0x61,
+            0x6c,0x66,0x77,0x61,0x79,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,
+            0x74,0x44,0x69,0x72,0x20,0x2b,0x20,0x76,0x69,0x65,0x77,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,
+            0x6f,0x74,0x48,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,
+            0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
+            0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,0x29,0x2c,0x20,0x30,0x2e,
+            0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+            0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x70,0x6f,0x77,0x28,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x73,
+            0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x31,0x32,
+            0x38,0x2e,0x30,0x29,0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,
+            0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,
+            0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x61,0x74,
+            0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x20,
+            0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x66,
+            0x66,0x75,0x73,0x65,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,
+            0x61,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x73,
+            0x70,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x4c,0x69,0x67,0x68,
+            0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x72,0x61,0x6e,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,
+            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,
+            0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x0a,
+            0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x6c,
+            0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x20,0x20,0x3d,0x20,0x6c,
+            0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+            0x20,0x2d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,
+            0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6c,0x65,0x6e,
+            0x67,0x74,0x68,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,
+            0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x20,0x20,0x3d,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,
+            0x74,0x44,0x69,0x72,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,
+            0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,
+            0x69,0x6f,0x6e,0x20,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x57,0x69,
+            0x6e,0x64,0x6f,0x77,0x28,0x64,0x69,0x73,0x74,0x2c,0x20,0x72,0x61,
+            0x6e,0x67,0x65,0x29,0x20,0x2f,0x20,0x28,0x64,0x69,0x73,0x74,0x20,
+            0x2a,0x20,0x64,0x69,0x73,0x74,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,
+            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x68,0x65,0x74,0x61,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x6c,
+            0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x2d,0x6e,0x6f,0x72,
+            0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,
+            0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x29,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x73,
+            0x5f,0x69,0x6e,0x6e,0x65,0x72,0x20,0x20,0x20,0x3d,0x20,0x63,0x6f,
+            0x73,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x61,0x6e,0x67,0x6c,0x65,
+            0x73,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x63,0x6f,0x73,0x5f,0x6f,0x75,0x74,0x65,0x72,0x20,
+            0x20,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x6c,0x69,0x67,0x68,0x74,
+            0x2e,0x61,0x6e,0x67,0x6c,0x65,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x74,0x65,
+            0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x61,0x74,0x74,
+            0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x63,0x6c,
+            0x61,0x6d,0x70,0x28,0x28,0x74,0x68,0x65,0x74,0x61,0x20,0x2d,0x20,
+            0x63,0x6f,0x73,0x5f,0x6f,0x75,0x74,0x65,0x72,0x29,0x20,0x2f,0x20,
+            0x28,0x63,0x6f,0x73,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x20,0x2d,0x20,
+            0x63,0x6f,0x73,0x5f,0x6f,0x75,0x74,0x65,0x72,0x29,0x2c,0x20,0x30,
+            0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x20,0x20,
+            0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,
+            0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,
+            0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,
+            0x66,0x66,0x75,0x73,0x65,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x64,
+            0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,
+            0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+            0x2a,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x61,0x74,0x74,
+            0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x20,0x20,
+            0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x68,0x61,0x6c,0x66,0x77,0x61,
+            0x79,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,
+            0x20,0x2b,0x20,0x76,0x69,0x65,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x48,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,
+            0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x61,0x6c,
+            0x66,0x77,0x61,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,
+            0x75,0x6c,0x61,0x72,0x20,0x20,0x20,0x20,0x3d,0x20,0x70,0x6f,0x77,
+            0x28,0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,
+            0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x31,0x32,0x38,0x2e,0x30,0x29,
+            0x20,0x2a,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,
+            0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,
+            0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,
+            0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x72,
+            0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
+            0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,
+            0x7d,0x0a,0x0a,0x2f,0x2f,0x20,0x44,0x65,0x70,0x74,0x68,0x20,0x62,
+            0x69,0x61,0x73,0x20,0x6f,0x6e,0x20,0x74,0x6f,0x70,0x20,0x6f,0x66,
+            0x20,0x74,0x68,0x65,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x6f,
+            0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x69,0x6e,0x20,0x77,0x69,0x6e,
+            0x64,0x6f,0x77,0x20,0x64,0x65,0x70,0x74,0x68,0x2e,0x0a,0x63,0x6f,
+            0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x53,0x48,0x41,
+            0x44,0x4f,0x57,0x5f,0x44,0x45,0x50,0x54,0x48,0x5f,0x42,0x49,0x41,
+            0x53,0x20,0x3d,0x20,0x30,0x2e,0x30,0x30,0x30,0x35,0x3b,0x0a,0x0a,
+            0x2f,0x2f,0x20,0x56,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,
+            0x20,0x69,0x6e,0x20,0x61,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x20,
+            0x76,0x69,0x65,0x77,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x61,
+            0x74,0x6c,0x61,0x73,0x2c,0x20,0x32,0x78,0x32,0x20,0x70,0x65,0x72,
+            0x63,0x65,0x6e,0x74,0x61,0x67,0x65,0x20,0x63,0x6c,0x6f,0x73,0x65,
+            0x72,0x20,0x66,0x69,0x6c,0x74,0x65,0x72,0x65,0x64,0x2e,0x0a,0x66,
+            0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x56,0x69,
+            0x65,0x77,0x28,0x69,0x6e,0x74,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,
+            0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+            0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,
+            0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,
+            0x46,0x72,0x61,0x6d,0x65,0x2e,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,
+            0x6d,0x61,0x74,0x72,0x69,0x63,0x65,0x73,0x5b,0x76,0x69,0x65,0x77,
+            0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x74,
+            0x69,0x6c,0x65,0x20,0x20,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,
+            0x72,0x61,0x6d,0x65,0x2e,0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x74,
+            0x69,0x6c,0x65,0x73,0x5b,0x76,0x69,0x65,0x77,0x5d,0x3b,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6e,0x6f,
+            0x72,0x6d,0x61,0x6c,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x6f,
+            0x66,0x20,0x73,0x70,0x6f,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x73,
+            0x20,0x67,0x72,0x6f,0x77,0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x74,
+            0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x2c,0x20,
+            0x77,0x68,0x69,0x63,0x68,0x20,0x69,0x73,0x20,0x77,0x0a,0x20,0x20,
+            0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x20,0x20,0x20,0x20,
+            0x3d,0x20,0x28,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,
+            0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,
+            0x20,0x31,0x2e,0x30,0x29,0x29,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x65,0x63,0x34,0x20,0x20,0x63,0x6c,0x69,0x70,0x20,0x3d,
+            0x20,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,0x63,
+            0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x2b,0x20,
+            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x2a,0x20,0x74,0x69,0x6c,0x65,
+            0x2e,0x77,0x20,0x2a,0x20,0x77,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x6e,0x64,
+            0x63,0x20,0x20,0x3d,0x20,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x7a,
+            0x20,0x2f,0x20,0x63,0x6c,0x69,0x70,0x2e,0x77,0x3b,0x0a,0x20,0x20,
+            0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,0x28,0x67,0x72,0x65,
+            0x61,0x74,0x65,0x72,0x54,0x68,0x61,0x6e,0x28,0x61,0x62,0x73,0x28,
+            0x6e,0x64,0x63,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,
+            0x30,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+            0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,
+            0x74,0x68,0x20,0x3d,0x20,0x6e,0x64,0x63,0x2e,0x7a,0x20,0x2a,0x20,
+            0x30,0x2e,0x35,0x20,0x2b,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,0x53,
+            0x48,0x41,0x44,0x4f,0x57,0x5f,0x44,0x45,0x50,0x54,0x48,0x5f,0x42,
+            0x49,0x41,0x53,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,
+            0x32,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x3d,0x20,0x69,0x76,0x65,
+            0x63,0x32,0x28,0x74,0x69,0x6c,0x65,0x2e,0x78,0x79,0x29,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x6c,0x61,0x73,
+            0x74,0x20,0x20,0x3d,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x2b,0x20,
+            0x69,0x76,0x65,0x63,0x32,0x28,0x74,0x69,0x6c,0x65,0x2e,0x7a,0x29,
+            0x20,0x2d,0x20,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,
+            0x63,0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x20,0x3d,0x20,0x66,0x69,
+            0x72,0x73,0x74,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x66,
+            0x6c,0x6f,0x6f,0x72,0x28,0x28,0x6e,0x64,0x63,0x2e,0x78,0x79,0x20,
+            0x2a,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,
+            0x2a,0x20,0x74,0x69,0x6c,0x65,0x2e,0x7a,0x20,0x2d,0x20,0x30,0x2e,
+            0x35,0x29,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x6c,0x69,0x74,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,
+            0x20,0x79,0x20,0x3d,0x20,0x30,0x3b,0x20,0x79,0x20,0x3c,0x20,0x32,
+            0x3b,0x20,0x79,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+            0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x30,0x3b,0x20,0x78,0x20,
+            0x3c,0x20,0x32,0x3b,0x20,0x78,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x74,
+            0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+            0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,
+            0x78,0x2c,0x20,0x79,0x29,0x2c,0x20,0x66,0x69,0x72,0x73,0x74,0x2c,
+            0x20,0x6c,0x61,0x73,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x74,0x20,0x2b,0x3d,
+            0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3c,0x3d,0x20,0x74,0x65,0x78,
+            0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x75,0x6e,0x69,0x5f,0x53,
+            0x68,0x61,0x64,0x6f,0x77,0x4d,0x61,0x70,0x2c,0x20,0x74,0x65,0x78,
+            0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x20,0x3f,0x20,0x31,0x2e,
+            0x30,0x20,0x3a,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+            0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x69,0x74,
+            0x20,0x2a,0x20,0x30,0x2e,0x32,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x2f,
+            0x2f,0x20,0x56,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x20,
+            0x66,0x6f,0x72,0x20,0x61,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+            0x6f,0x6e,0x61,0x6c,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x74,
+            0x68,0x65,0x20,0x63,0x61,0x73,0x63,0x61,0x64,0x65,0x73,0x20,0x61,
+            0x72,0x65,0x20,0x63,0x6f,0x6e,0x73,0x65,0x63,0x75,0x74,0x69,0x76,
+            0x65,0x20,0x76,0x69,0x65,0x77,0x73,0x2e,0x0a,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x43,0x61,0x73,0x63,0x61,
+            0x64,0x65,0x73,0x28,0x69,0x6e,0x74,0x20,0x66,0x69,0x72,0x73,0x74,
+            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+            0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,
+            0x61,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x2d,0x28,
+            0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x76,0x69,0x65,
+            0x77,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,
+            0x63,0x34,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x31,0x2e,0x30,0x29,0x29,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,
+            0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x53,0x48,0x41,0x44,0x4f,0x57,
+            0x5f,0x43,0x41,0x53,0x43,0x41,0x44,0x45,0x53,0x3b,0x20,0x69,0x2b,
+            0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x64,0x65,0x70,0x74,0x68,
+            0x20,0x3c,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,
+            0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x63,0x61,0x73,0x63,0x61,0x64,
+            0x65,0x5f,0x73,0x70,0x6c,0x69,0x74,0x73,0x5b,0x69,0x5d,0x29,0x0a,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+            0x72,0x6e,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x56,0x69,0x65,0x77,
+            0x28,0x66,0x69,0x72,0x73,0x74,0x20,0x2b,0x20,0x69,0x2c,0x20,0x70,
+            0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x6e,0x6f,0x72,0x6d,
+            0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+            0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,
+            0x0a,0x2f,0x2f,0x20,0x49,0x6e,0x64,0x65,0x78,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,0x63,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x20,0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,
+            0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x2c,0x20,0x74,0x68,0x65,
+            0x20,0x73,0x6c,0x69,0x63,0x69,0x6e,0x67,0x20,0x6d,0x75,0x73,0x74,
+            0x20,0x6d,0x61,0x74,0x63,0x68,0x20,0x4c,0x69,0x67,0x68,0x74,0x43,
+            0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x2e,0x0a,0x75,0x69,0x6e,0x74,
+            0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x49,0x6e,0x64,0x65,0x78,
+            0x28,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+            0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,
+            0x33,0x20,0x67,0x72,0x69,0x64,0x20,0x20,0x20,0x20,0x3d,0x20,0x62,
+            0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x63,0x6c,0x75,0x73,
+            0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x65,0x61,0x72,0x20,0x20,
+            0x20,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,
+            0x2e,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,
+            0x68,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x66,0x61,0x72,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x62,
+            0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x63,0x6c,0x75,0x73,
+            0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,0x68,0x2e,0x79,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,
+            0x74,0x68,0x20,0x20,0x20,0x3d,0x20,0x2d,0x28,0x62,0x6c,0x6b,0x5f,
+            0x46,0x72,0x61,0x6d,0x65,0x2e,0x76,0x69,0x65,0x77,0x5f,0x6d,0x61,
+            0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,
+            0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,
+            0x29,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+            0x20,0x20,0x73,0x6c,0x69,0x63,0x65,0x20,0x20,0x20,0x3d,0x20,0x69,
+            0x6e,0x74,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x6c,0x6f,0x67,0x28,
+            0x6d,0x61,0x78,0x28,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x6e,0x65,
+            0x61,0x72,0x29,0x20,0x2f,0x20,0x6e,0x65,0x61,0x72,0x29,0x20,0x2f,
+            0x20,0x6c,0x6f,0x67,0x28,0x66,0x61,0x72,0x20,0x2f,0x20,0x6e,0x65,
+            0x61,0x72,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,
+            0x72,0x69,0x64,0x2e,0x7a,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,
+            0x72,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x69,0x76,0x65,
+            0x63,0x33,0x28,0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,
+            0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2f,
+            0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x63,0x6c,
+            0x75,0x73,0x74,0x65,0x72,0x5f,0x74,0x69,0x6c,0x65,0x5f,0x73,0x69,
+            0x7a,0x65,0x29,0x2c,0x20,0x73,0x6c,0x69,0x63,0x65,0x29,0x2c,0x20,
+            0x69,0x76,0x65,0x63,0x33,0x28,0x30,0x29,0x2c,0x20,0x67,0x72,0x69,
+            0x64,0x20,0x2d,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+            0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,
+            0x75,0x73,0x74,0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,0x67,0x72,0x69,
+            0x64,0x2e,0x78,0x20,0x2a,0x20,0x28,0x63,0x6c,0x75,0x73,0x74,0x65,
+            0x72,0x2e,0x79,0x20,0x2b,0x20,0x67,0x72,0x69,0x64,0x2e,0x79,0x20,
+            0x2a,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x2e,0x7a,0x29,0x29,
+            0x3b,0x0a,0x7d,0x0a,0x0a,0x4c,0x69,0x67,0x68,0x74,0x20,0x75,0x6e,
+            0x70,0x61,0x63,0x6b,0x4c,0x69,0x67,0x68,0x74,0x28,0x4c,0x69,0x67,
+            0x68,0x74,0x44,0x61,0x74,0x61,0x20,0x64,0x61,0x74,0x61,0x29,0x0a,
+            0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+            0x4c,0x69,0x67,0x68,0x74,0x28,0x69,0x6e,0x74,0x28,0x64,0x61,0x74,
+            0x61,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x77,
+            0x29,0x2c,0x20,0x64,0x61,0x74,0x61,0x2e,0x64,0x69,0x72,0x65,0x63,
+            0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x64,0x61,0x74,
+            0x61,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,
+            0x7a,0x2c,0x20,0x64,0x61,0x74,0x61,0x2e,0x63,0x6f,0x6c,0x6f,0x72,
+            0x2e,0x72,0x67,0x62,0x2c,0x20,0x64,0x61,0x74,0x61,0x2e,0x61,0x6e,
+            0x67,0x6c,0x65,0x73,0x2e,0x78,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+            0x2f,0x2f,0x20,0x4c,0x69,0x67,0x68,0x74,0x69,0x6e,0x67,0x20,0x6f,
+            0x66,0x20,0x61,0x6e,0x20,0x6f,0x70,0x61,0x71,0x75,0x65,0x20,0x73,
+            0x75,0x72,0x66,0x61,0x63,0x65,0x2c,0x20,0x73,0x68,0x61,0x72,0x65,
+            0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x72,0x77,
+            0x61,0x72,0x64,0x20,0x61,0x6e,0x64,0x20,0x64,0x65,0x66,0x65,0x72,
+            0x72,0x65,0x64,0x20,0x73,0x68,0x61,0x64,0x69,0x6e,0x67,0x2e,0x0a,
+            0x76,0x65,0x63,0x33,0x20,0x73,0x68,0x61,0x64,0x65,0x53,0x75,0x72,
+            0x66,0x61,0x63,0x65,0x28,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,
+            0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+            0x69,0x65,0x77,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x61,0x73,
+            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+            0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x2c,0x20,0x66,0x6c,
+            0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,
+            0x76,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,
+            0x6f,0x72,0x20,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x61,0x73,
+            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,
+            0x30,0x2e,0x30,0x29,0x2c,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,
+            0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+            0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,
+            0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,0x63,0x33,0x28,
+            0x30,0x2e,0x30,0x34,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x43,0x6f,
+            0x6c,0x6f,0x72,0x2c,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x20,0x20,0x20,
+            0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x32,0x2e,0x30,0x2c,0x20,0x32,
+            0x35,0x36,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x72,
+            0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,0x75,0x6c,
+            0x74,0x20,0x3d,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,
+            0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,
+            0x4d,0x41,0x58,0x5f,0x4c,0x49,0x47,0x48,0x54,0x5f,0x50,0x52,0x4f,
+            0x42,0x45,0x53,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,
+            0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,
+            0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,
+            0x50,0x72,0x6f,0x62,0x65,0x28,0x69,0x2c,0x20,0x75,0x6e,0x69,0x5f,
+            0x4c,0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x73,0x5b,0x69,
+            0x5d,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,
+            0x65,0x77,0x2c,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,
+            0x6c,0x6f,0x72,0x2c,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+            0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,
+            0x65,0x73,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+            0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x4d,0x41,
+            0x58,0x5f,0x4c,0x49,0x47,0x48,0x54,0x53,0x3b,0x20,0x69,0x2b,0x2b,
+            0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x4c,0x69,0x67,0x68,0x74,0x20,0x6c,0x69,0x67,0x68,
+            0x74,0x20,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x4c,0x69,
+            0x67,0x68,0x74,0x28,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,
+            0x2e,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x69,0x5d,0x29,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x20,
+            0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x20,0x3d,0x20,0x69,0x6e,0x74,
+            0x28,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x6c,0x69,
+            0x67,0x68,0x74,0x73,0x5b,0x69,0x5d,0x2e,0x61,0x6e,0x67,0x6c,0x65,
+            0x73,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x73,0x77,0x69,0x74,0x63,0x68,0x20,0x28,0x6c,0x69,0x67,0x68,
+            0x74,0x2e,0x74,0x79,0x70,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x4e,0x4f,0x4e,0x45,
+            0x5f,0x4c,0x49,0x47,0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,
+            0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x41,0x4d,0x42,0x49,
+            0x45,0x4e,0x54,0x5f,0x4c,0x49,0x47,0x48,0x54,0x3a,0x0a,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x62,0x61,
+            0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,
+            0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x44,0x49,
+            0x52,0x45,0x43,0x54,0x49,0x4f,0x4e,0x41,0x4c,0x5f,0x4c,0x49,0x47,
+            0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+            0x20,0x2b,0x3d,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
+            0x61,0x6c,0x4c,0x69,0x67,0x68,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,
+            0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,
+            0x77,0x2c,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,
+            0x6f,0x72,0x2c,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,
+            0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,
+            0x73,0x73,0x29,0x20,0x2a,0x20,0x28,0x73,0x68,0x61,0x64,0x6f,0x77,
+            0x20,0x3e,0x3d,0x20,0x30,0x20,0x3f,0x20,0x73,0x68,0x61,0x64,0x6f,
+            0x77,0x43,0x61,0x73,0x63,0x61,0x64,0x65,0x73,0x28,0x73,0x68,0x61,
+            0x64,0x6f,0x77,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+            0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x20,0x3a,0x20,0x31,
+            0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+            0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,
+            0x63,0x32,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x20,0x3d,0x20,
+            0x73,0x73,0x62,0x5f,0x43,0x6c,0x75,0x73,0x74,0x65,0x72,0x52,0x61,
+            0x6e,0x67,0x65,0x73,0x5b,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x49,
+            0x6e,0x64,0x65,0x78,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+            0x29,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+            0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,
+            0x69,0x20,0x3c,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x2e,0x79,
+            0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4c,0x69,0x67,0x68,0x74,
+            0x44,0x61,0x74,0x61,0x20,0x64,0x61,0x74,0x61,0x20,0x20,0x20,0x3d,
+            0x20,0x73,0x73,0x62,0x5f,0x43,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,
+            0x69,0x67,0x68,0x74,0x73,0x5b,0x73,0x73,0x62,0x5f,0x43,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x49,0x6e,0x64,0x65,
+            0x78,0x65,0x73,0x5b,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x2e,0x78,
+            0x20,0x2b,0x20,0x69,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x4c,0x69,0x67,0x68,0x74,0x20,0x20,0x20,0x20,0x20,
+            0x6c,0x69,0x67,0x68,0x74,0x20,0x20,0x3d,0x20,0x75,0x6e,0x70,0x61,
+            0x63,0x6b,0x4c,0x69,0x67,0x68,0x74,0x28,0x64,0x61,0x74,0x61,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x72,0x61,0x6e,0x67,0x65,0x20,
+            0x20,0x3d,0x20,0x64,0x61,0x74,0x61,0x2e,0x70,0x6f,0x73,0x69,0x74,
+            0x69,0x6f,0x6e,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,
+            0x68,0x61,0x64,0x6f,0x77,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x64,
+            0x61,0x74,0x61,0x2e,0x61,0x6e,0x67,0x6c,0x65,0x73,0x2e,0x7a,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x77,0x69,
+            0x74,0x63,0x68,0x20,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x74,0x79,
+            0x70,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+            0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x63,0x61,0x73,0x65,0x20,0x50,0x4f,0x49,0x4e,0x54,0x5f,0x4c,0x49,
+            0x47,0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,
+            0x74,0x20,0x2b,0x3d,0x20,0x70,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,
+            0x68,0x74,0x28,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x72,0x61,0x6e,
+            0x67,0x65,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,
+            0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,0x77,
+            0x2c,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,
+            0x72,0x2c,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,
+            0x6c,0x6f,0x72,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+            0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x63,0x61,0x73,0x65,0x20,0x53,0x50,0x4f,0x54,0x5f,0x4c,0x49,0x47,
+            0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+            0x20,0x2b,0x3d,0x20,0x73,0x70,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,
+            0x28,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x72,0x61,0x6e,0x67,0x65,
+            0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,
+            0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+            0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,
+            0x72,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,
+            0x20,0x2a,0x20,0x28,0x73,0x68,0x61,0x64,0x6f,0x77,0x20,0x3e,0x3d,
+            0x20,0x30,0x20,0x3f,0x20,0x73,0x68,0x61,0x64,0x6f,0x77,0x56,0x69,
+            0x65,0x77,0x28,0x73,0x68,0x61,0x64,0x6f,0x77,0x2c,0x20,0x70,0x6f,
+            0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x29,0x20,0x3a,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,
+            0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,
+            0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
         static const auto outputs_glsl_data = std::array<unsigned char, 1560>{
@@ -428,7 +1314,7 @@ namespace pkzo
             0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x37,0x3b,0x0d,0x0a,0x00
         };
 
-        static const auto uniforms_glsl_data = std::array<unsigned char, 2761>{
+        static const auto uniforms_glsl_data = std::array<unsigned char, 4034>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0d,0x0a,0x2f,0x2f,0x20,0x43,
             0x6f,0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,
             0x2d,0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,
@@ -533,118 +1419,1030 @@ namespace pkzo
             0x50,0x4f,0x54,0x5f,0x4c,0x49,0x47,0x48,0x54,0x20,0x34,0x0d,0x0a,
             0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4d,0x41,0x58,
             0x5f,0x4c,0x49,0x47,0x48,0x54,0x5f,0x50,0x52,0x4f,0x42,0x45,0x53,
-            0x20,0x31,0x0d,0x0a,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
-            0x20,0x58,0x50,0x4f,0x53,0x20,0x30,0x0d,0x0a,0x23,0x64,0x65,0x66,
-            0x69,0x6e,0x65,0x20,0x58,0x4e,0x45,0x47,0x20,0x31,0x0d,0x0a,0x23,
-            0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x59,0x50,0x4f,0x53,0x20,0x32,
-            0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x59,0x4e,0x45,
-            0x47,0x20,0x33,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
-            0x5a,0x50,0x4f,0x53,0x20,0x34,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,
-            0x6e,0x65,0x20,0x5a,0x4e,0x45,0x47,0x20,0x35,0x0d,0x0a,0x0d,0x0a,
-            0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x4c,0x69,0x67,0x68,0x74,0x0d,
-            0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
-            0x79,0x70,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-            0x33,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,0x0d,
-            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,
-            0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0d,0x0a,0x20,
-            0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x6e,0x67,0x6c,0x65,
-            0x73,0x3b,0x0d,0x0a,0x7d,0x3b,0x0d,0x0a,0x0d,0x0a,0x73,0x74,0x72,
-            0x75,0x63,0x74,0x20,0x4c,0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,
-            0x65,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
-            0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x3b,0x0d,0x0a,0x20,0x20,
-            0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x43,0x75,0x62,0x65,
-            0x20,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x3b,
-            0x0d,0x0a,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
-            0x43,0x75,0x62,0x65,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x3b,
+            0x20,0x31,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x49,
+            0x52,0x52,0x41,0x44,0x49,0x41,0x4e,0x43,0x45,0x5f,0x43,0x4f,0x45,
+            0x46,0x46,0x49,0x43,0x49,0x45,0x4e,0x54,0x53,0x20,0x39,0x0d,0x0a,
+            0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x50,0x45,0x43,0x55,
+            0x4c,0x41,0x52,0x5f,0x4d,0x49,0x50,0x5f,0x4c,0x45,0x56,0x45,0x4c,
+            0x53,0x20,0x37,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+            0x53,0x48,0x41,0x44,0x4f,0x57,0x5f,0x43,0x41,0x53,0x43,0x41,0x44,
+            0x45,0x53,0x20,0x34,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+            0x20,0x4d,0x41,0x58,0x5f,0x53,0x48,0x41,0x44,0x4f,0x57,0x5f,0x56,
+            0x49,0x45,0x57,0x53,0x20,0x38,0x0d,0x0a,0x0d,0x0a,0x23,0x64,0x65,
+            0x66,0x69,0x6e,0x65,0x20,0x58,0x50,0x4f,0x53,0x20,0x30,0x0d,0x0a,
+            0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x58,0x4e,0x45,0x47,0x20,
+            0x31,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x59,0x50,
+            0x4f,0x53,0x20,0x32,0x0d,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+            0x20,0x59,0x4e,0x45,0x47,0x20,0x33,0x0d,0x0a,0x23,0x64,0x65,0x66,
+            0x69,0x6e,0x65,0x20,0x5a,0x50,0x4f,0x53,0x20,0x34,0x0d,0x0a,0x23,
+            0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x5a,0x4e,0x45,0x47,0x20,0x35,
+            0x0d,0x0a,0x0d,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x4c,0x69,
+            0x67,0x68,0x74,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x69,
+            0x6e,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
+            0x6f,0x6e,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0d,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+            0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x61,
+            0x6e,0x67,0x6c,0x65,0x73,0x3b,0x0d,0x0a,0x7d,0x3b,0x0d,0x0a,0x0d,
+            0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x4c,0x69,0x67,0x68,0x74,
+            0x50,0x72,0x6f,0x62,0x65,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x69,0x6e,0x74,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x3b,
             0x0d,0x0a,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
-            0x43,0x75,0x62,0x65,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
-            0x3b,0x0d,0x0a,0x7d,0x3b,0x0d,0x0a,0x0d,0x0a,0x6c,0x61,0x79,0x6f,
-            0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-            0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,
-            0x61,0x74,0x34,0x20,0x75,0x6e,0x69,0x5f,0x50,0x72,0x6f,0x6a,0x65,
-            0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0d,
-            0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
-            0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x75,0x6e,0x69,0x66,
-            0x6f,0x72,0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x75,0x6e,0x69,0x5f,
-            0x56,0x69,0x65,0x77,0x4d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0d,0x0a,
-            0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-            0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,
-            0x72,0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x75,0x6e,0x69,0x5f,0x4d,
-            0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0d,0x0a,
+            0x43,0x75,0x62,0x65,0x20,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,
+            0x65,0x6e,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x73,0x61,0x6d,
+            0x70,0x6c,0x65,0x72,0x43,0x75,0x62,0x65,0x20,0x73,0x70,0x65,0x63,
+            0x75,0x6c,0x61,0x72,0x3b,0x0d,0x0a,0x7d,0x3b,0x0d,0x0a,0x0d,0x0a,
+            0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x4c,0x69,0x67,0x68,0x74,0x44,
+            0x61,0x74,0x61,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,
+            0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+            0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x69,
+            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0d,
+            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x61,0x6e,0x67,
+            0x6c,0x65,0x73,0x3b,0x0d,0x0a,0x7d,0x3b,0x0d,0x0a,0x0d,0x0a,0x6c,
+            0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+            0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
+            0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x75,0x6e,0x69,0x5f,0x50,0x72,
+            0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,0x69,
+            0x78,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+            0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x75,
+            0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x75,
+            0x6e,0x69,0x5f,0x56,0x69,0x65,0x77,0x4d,0x61,0x74,0x72,0x69,0x78,
+            0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+            0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x75,0x6e,
+            0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x75,0x6e,
+            0x69,0x5f,0x4d,0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,
+            0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+            0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x75,0x6e,
+            0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x75,0x6e,
+            0x69,0x5f,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x46,0x61,
+            0x63,0x74,0x6f,0x72,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+            0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,
+            0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+            0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x42,0x61,
+            0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x4d,0x61,0x70,0x3b,0x0d,0x0a,
             0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-            0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,
-            0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x75,0x6e,0x69,0x5f,0x42,
-            0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x46,0x61,0x63,0x74,0x6f,
-            0x72,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-            0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x75,
-            0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
-            0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,0x65,0x43,
-            0x6f,0x6c,0x6f,0x72,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,
-            0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
-            0x3d,0x20,0x35,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
-            0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x6e,0x69,0x5f,0x4d,0x65,0x74,
-            0x61,0x6c,0x6c,0x69,0x63,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0d,
+            0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,
+            0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+            0x75,0x6e,0x69,0x5f,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,
+            0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x4d,0x61,0x70,0x3b,0x0d,
             0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
             0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,0x20,0x75,0x6e,0x69,0x66,
-            0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x6e,0x69,
-            0x5f,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x46,0x61,0x63,
-            0x74,0x6f,0x72,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
-            0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x37,0x29,
-            0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
-            0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x4d,0x65,0x74,
-            0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-            0x73,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
-            0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x38,
-            0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
-            0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x4e,0x6f,
-            0x72,0x6d,0x61,0x6c,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,
-            0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
-            0x3d,0x20,0x39,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
-            0x76,0x65,0x63,0x33,0x20,0x75,0x6e,0x69,0x5f,0x45,0x6d,0x69,0x73,
-            0x73,0x69,0x76,0x65,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0d,0x0a,
-            0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-            0x6f,0x6e,0x20,0x3d,0x20,0x31,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,
             0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,
-            0x20,0x75,0x6e,0x69,0x5f,0x45,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
-            0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
-            0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x31,
+            0x20,0x75,0x6e,0x69,0x5f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,
+            0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+            0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x37,0x29,0x20,0x75,
+            0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+            0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x45,0x6d,0x69,0x73,0x73,
+            0x69,0x76,0x65,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,
+            0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+            0x20,0x38,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,
+            0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,
+            0x53,0x68,0x61,0x64,0x6f,0x77,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,
+            0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+            0x6e,0x20,0x3d,0x20,0x39,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
+            0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x43,0x75,0x62,0x65,
+            0x20,0x75,0x6e,0x69,0x5f,0x45,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,
+            0x65,0x6e,0x74,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+            0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x30,
             0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x4c,0x69,0x67,
-            0x68,0x74,0x20,0x75,0x6e,0x69,0x5f,0x4c,0x69,0x67,0x68,0x74,0x5b,
-            0x34,0x5d,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
-            0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x31,0x29,
+            0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x20,0x75,0x6e,0x69,0x5f,0x4c,
+            0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x73,0x5b,0x31,0x5d,
+            0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+            0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x33,0x29,0x20,0x75,
+            0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+            0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,
+            0x65,0x72,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0d,
+            0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+            0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x34,0x29,0x20,0x75,0x6e,0x69,
+            0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+            0x44,0x20,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,0x65,0x72,
+            0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,
+            0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+            0x20,0x31,0x35,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+            0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x6e,0x69,
+            0x5f,0x47,0x42,0x75,0x66,0x66,0x65,0x72,0x4d,0x65,0x74,0x61,0x6c,
+            0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x3b,
+            0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+            0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x36,0x29,0x20,0x75,0x6e,
+            0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+            0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,0x65,
+            0x72,0x45,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x3b,0x0d,0x0a,0x6c,
+            0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+            0x6e,0x20,0x3d,0x20,0x31,0x37,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,
+            0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
+            0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,0x65,0x72,0x44,0x65,
+            0x70,0x74,0x68,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+            0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x38,
+            0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,
+            0x20,0x75,0x6e,0x69,0x5f,0x4d,0x69,0x70,0x4c,0x65,0x76,0x65,0x6c,
+            0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+            0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x39,0x29,0x20,0x75,
+            0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+            0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x54,0x65,0x78,0x74,0x75,
+            0x72,0x65,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+            0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x30,0x29,
             0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
-            0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x6e,0x69,0x5f,0x53,0x68,0x61,
-            0x64,0x6f,0x77,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,
+            0x6c,0x65,0x72,0x43,0x75,0x62,0x65,0x20,0x75,0x6e,0x69,0x5f,0x43,
+            0x75,0x62,0x65,0x4d,0x61,0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,
             0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-            0x20,0x33,0x32,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
-            0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x43,0x75,0x62,0x65,0x20,0x75,
-            0x6e,0x69,0x5f,0x45,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,
-            0x74,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-            0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x33,0x29,0x20,
-            0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x4c,0x69,0x67,0x68,0x74,
-            0x50,0x72,0x6f,0x62,0x65,0x20,0x75,0x6e,0x69,0x5f,0x4c,0x69,0x67,
-            0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0d,
-            0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
-            0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x37,0x29,0x20,0x75,0x6e,0x69,
-            0x66,0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,0x20,0x75,0x6e,0x69,0x5f,
-            0x4d,0x69,0x70,0x4c,0x65,0x76,0x65,0x6c,0x3b,0x0d,0x0a,0x6c,0x61,
-            0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-            0x20,0x3d,0x20,0x33,0x38,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
-            0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,
-            0x6e,0x69,0x5f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x3b,0x0d,0x0a,
-            0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-            0x6f,0x6e,0x20,0x3d,0x20,0x33,0x39,0x29,0x20,0x75,0x6e,0x69,0x66,
-            0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x43,0x75,
-            0x62,0x65,0x20,0x75,0x6e,0x69,0x5f,0x43,0x75,0x62,0x65,0x4d,0x61,
-            0x70,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-            0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x30,0x29,0x20,
-            0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x61,0x74,0x33,0x20,
-            0x75,0x6e,0x69,0x5f,0x43,0x75,0x62,0x65,0x6d,0x61,0x70,0x54,0x42,
-            0x4e,0x3b,0x0d,0x0a,0x00
+            0x20,0x32,0x31,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+            0x6d,0x61,0x74,0x33,0x20,0x75,0x6e,0x69,0x5f,0x43,0x75,0x62,0x65,
+            0x6d,0x61,0x70,0x54,0x42,0x4e,0x3b,0x0d,0x0a,0x0d,0x0a,0x6c,0x61,
+            0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x31,0x34,0x30,0x2c,0x20,
+            0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,0x20,
+            0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x46,0x72,0x61,0x6d,0x65,
+            0x42,0x6c,0x6f,0x63,0x6b,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x6d,0x61,0x74,0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,
+            0x69,0x6f,0x6e,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0d,0x0a,
+            0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,
+            0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,
+            0x20,0x6d,0x61,0x74,0x34,0x20,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,
+            0x5f,0x76,0x69,0x65,0x77,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,
+            0x69,0x6f,0x6e,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0d,0x0a,
+            0x20,0x20,0x20,0x20,0x4c,0x69,0x67,0x68,0x74,0x44,0x61,0x74,0x61,
+            0x20,0x6c,0x69,0x67,0x68,0x74,0x73,0x5b,0x34,0x5d,0x3b,0x0d,0x0a,
+            0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x63,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x3b,0x0d,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6c,0x75,0x73,0x74,
+            0x65,0x72,0x5f,0x74,0x69,0x6c,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,
+            0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6c,
+            0x75,0x73,0x74,0x65,0x72,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0d,
+            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x6c,0x69,0x67,
+            0x68,0x74,0x5f,0x70,0x72,0x6f,0x62,0x65,0x5f,0x69,0x72,0x72,0x61,
+            0x64,0x69,0x61,0x6e,0x63,0x65,0x5b,0x39,0x5d,0x3b,0x0d,0x0a,0x20,
+            0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x6f,
+            0x77,0x5f,0x6d,0x61,0x74,0x72,0x69,0x63,0x65,0x73,0x5b,0x38,0x5d,
+            0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x73,
+            0x68,0x61,0x64,0x6f,0x77,0x5f,0x74,0x69,0x6c,0x65,0x73,0x5b,0x38,
+            0x5d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+            0x73,0x68,0x61,0x64,0x6f,0x77,0x5f,0x63,0x61,0x73,0x63,0x61,0x64,
+            0x65,0x5f,0x73,0x70,0x6c,0x69,0x74,0x73,0x3b,0x0d,0x0a,0x7d,0x20,
+            0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x3b,0x0d,0x0a,0x0d,
+            0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x31,0x34,
+            0x30,0x2c,0x20,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+            0x31,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x4d,0x61,
+            0x74,0x65,0x72,0x69,0x61,0x6c,0x42,0x6c,0x6f,0x63,0x6b,0x0d,0x0a,
+            0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x62,
+            0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,
+            0x74,0x6f,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,
+            0x63,0x74,0x6f,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+            0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,
+            0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
+            0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+            0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0d,0x0a,0x7d,
+            0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+            0x3b,0x0d,0x0a,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,
+            0x74,0x64,0x31,0x34,0x30,0x2c,0x20,0x62,0x69,0x6e,0x64,0x69,0x6e,
+            0x67,0x20,0x3d,0x20,0x32,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
+            0x6d,0x20,0x4f,0x62,0x6a,0x65,0x63,0x74,0x42,0x6c,0x6f,0x63,0x6b,
+            0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x34,
+            0x20,0x6d,0x6f,0x64,0x65,0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,
+            0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,
+            0x73,0x74,0x61,0x6e,0x63,0x65,0x64,0x3b,0x0d,0x0a,0x7d,0x20,0x62,
+            0x6c,0x6b,0x5f,0x4f,0x62,0x6a,0x65,0x63,0x74,0x3b,0x0d,0x0a,0x0d,
+            0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,
+            0x30,0x2c,0x20,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+            0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,
+            0x75,0x66,0x66,0x65,0x72,0x20,0x43,0x6c,0x75,0x73,0x74,0x65,0x72,
+            0x4c,0x69,0x67,0x68,0x74,0x73,0x20,0x7b,0x20,0x4c,0x69,0x67,0x68,
+            0x74,0x44,0x61,0x74,0x61,0x20,0x73,0x73,0x62,0x5f,0x43,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x73,0x5b,0x5d,0x3b,
+            0x20,0x7d,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,
+            0x74,0x64,0x34,0x33,0x30,0x2c,0x20,0x62,0x69,0x6e,0x64,0x69,0x6e,
+            0x67,0x20,0x3d,0x20,0x31,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,
+            0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x43,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x52,0x61,0x6e,0x67,0x65,0x73,0x20,0x7b,0x20,
+            0x75,0x76,0x65,0x63,0x32,0x20,0x73,0x73,0x62,0x5f,0x43,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x52,0x61,0x6e,0x67,0x65,0x73,0x5b,0x5d,0x3b,
+            0x20,0x7d,0x3b,0x0d,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,
+            0x74,0x64,0x34,0x33,0x30,0x2c,0x20,0x62,0x69,0x6e,0x64,0x69,0x6e,
+            0x67,0x20,0x3d,0x20,0x32,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,
+            0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x43,0x6c,0x75,
+            0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,0x74,0x49,0x6e,0x64,0x65,
+            0x78,0x65,0x73,0x20,0x7b,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x73,
+            0x62,0x5f,0x43,0x6c,0x75,0x73,0x74,0x65,0x72,0x4c,0x69,0x67,0x68,
+            0x74,0x49,0x6e,0x64,0x65,0x78,0x65,0x73,0x5b,0x5d,0x3b,0x20,0x7d,
+            0x3b,0x0d,0x0a,0x00
+        };
+
+        static const auto Screen_vert_data = std::array<unsigned char, 1367>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
+            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
+            0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
+            0x6f,0x72,0x64,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+            0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x61,
+            0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,
+            0x61,0x74,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+            0x69,0x6f,0x6e,0x20,0x20,0x3d,0x20,0x75,0x6e,0x69,0x5f,0x50,0x72,
+            0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,0x69,
+            0x78,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,0x56,0x69,0x65,0x77,0x4d,
+            0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,0x4d,
+            0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,
+            0x76,0x65,0x63,0x34,0x28,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,
+            0x65,0x78,0x28,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,
+            0x0a,0x00
+        };
+
+        static const auto Screen_frag_data = std::array<unsigned char, 1312>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
+            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
+            0x73,0x6c,0x22,0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+            0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
+            0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+            0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,
+            0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x74,0x65,
+            0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,
+            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,
+            0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x20,0x2a,
+            0x20,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,
+            0x72,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x00
+        };
+
+        static const auto Forward_vert_data = std::array<unsigned char, 2006>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
+            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
+            0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
+            0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,
+            0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+            0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
+            0x6f,0x75,0x74,0x20,0x6d,0x61,0x74,0x33,0x20,0x76,0x61,0x72,0x5f,
+            0x54,0x42,0x4e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+            0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+            0x74,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,
+            0x78,0x20,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x4f,0x62,0x6a,0x65,
+            0x63,0x74,0x2e,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x64,0x20,
+            0x21,0x3d,0x20,0x30,0x20,0x3f,0x20,0x61,0x74,0x72,0x5f,0x49,0x6e,
+            0x73,0x74,0x61,0x6e,0x63,0x65,0x4d,0x6f,0x64,0x65,0x6c,0x4d,0x61,
+            0x74,0x72,0x69,0x78,0x20,0x3a,0x20,0x62,0x6c,0x6b,0x5f,0x4f,0x62,
+            0x6a,0x65,0x63,0x74,0x2e,0x6d,0x6f,0x64,0x65,0x6c,0x5f,0x6d,0x61,
+            0x74,0x72,0x69,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,
+            0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,0x74,0x72,0x69,
+            0x78,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x74,0x72,0x61,0x6e,
+            0x73,0x70,0x6f,0x73,0x65,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,
+            0x28,0x6d,0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x29,
+            0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
+            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x6f,
+            0x72,0x6d,0x61,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,
+            0x67,0x65,0x74,0x5f,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x29,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x74,0x61,
+            0x6e,0x67,0x65,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,0x6f,0x72,0x6d,
+            0x61,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x67,0x65,
+            0x74,0x5f,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x28,0x29,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x69,0x74,
+            0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x20,0x20,0x3d,0x20,0x63,0x72,
+            0x6f,0x73,0x73,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x74,
+            0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x76,0x61,0x72,0x5f,0x54,0x42,0x4e,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x74,0x61,
+            0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x62,0x69,0x74,0x61,0x6e,0x67,
+            0x65,0x6e,0x74,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,
+            0x43,0x6f,0x6f,0x72,0x64,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x61,
+            0x74,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,
+            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x6f,0x72,
+            0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x20,0x3d,0x20,0x6d,0x6f,0x64,
+            0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,
+            0x63,0x34,0x28,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,0x65,0x78,
+            0x28,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+            0x20,0x20,0x20,0x20,0x3d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+            0x6f,0x73,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,
+            0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,
+            0x20,0x20,0x3d,0x20,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x28,
+            0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x76,0x69,0x65,
+            0x77,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x29,0x20,0x2a,0x20,0x76,
+            0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+            0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x2e,0x78,
+            0x79,0x7a,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,
+            0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x70,0x72,
+            0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x6d,0x61,0x74,0x72,
+            0x69,0x78,0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,0x61,0x6d,
+            0x65,0x2e,0x76,0x69,0x65,0x77,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,
+            0x20,0x2a,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,
+            0x0a,0x7d,0x0a,0x00
+        };
+
+        static const auto Forward_frag_data = std::array<unsigned char, 2128>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
+            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
+            0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,
+            0x22,0x6d,0x61,0x74,0x68,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x6c,0x69,0x67,0x68,
+            0x74,0x69,0x6e,0x67,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x69,
+            0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,
+            0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,
+            0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,
+            0x50,0x6f,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,
+            0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+            0x0a,0x69,0x6e,0x20,0x6d,0x61,0x74,0x33,0x20,0x76,0x61,0x72,0x5f,
+            0x54,0x42,0x4e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+            0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+            0x63,0x34,0x20,0x20,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,
+            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+            0x65,0x28,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,
+            0x6f,0x72,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,
+            0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x20,0x2a,0x20,0x62,0x6c,0x6b,
+            0x5f,0x4d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x2e,0x62,0x61,0x73,
+            0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x66,0x61,0x63,0x74,0x6f,
+            0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x20,0x20,0x20,
+            0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,
+            0x69,0x5f,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,
+            0x67,0x68,0x6e,0x65,0x73,0x73,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,
+            0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x67,
+            0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x61,0x74,0x65,0x72,0x69,
+            0x61,0x6c,0x2e,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x5f,
+            0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+            0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+            0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x4d,0x65,0x74,0x61,0x6c,0x6c,
+            0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x4d,0x61,
+            0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,
+            0x72,0x64,0x29,0x2e,0x72,0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,0x4d,
+            0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x2e,0x6d,0x65,0x74,0x61,0x6c,
+            0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x65,0x6d,0x69,0x73,
+            0x73,0x69,0x76,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,
+            0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x45,0x6d,
+            0x69,0x73,0x73,0x69,0x76,0x65,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,
+            0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,
+            0x67,0x62,0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x61,0x74,0x65,
+            0x72,0x69,0x61,0x6c,0x2e,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,
+            0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x0a,0x20,0x20,0x20,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,
+            0x6d,0x61,0x70,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,
+            0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x4e,0x6f,0x72,0x6d,
+            0x61,0x6c,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,
+            0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,
+            0x61,0x6c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,
+            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x61,0x72,
+            0x5f,0x54,0x42,0x4e,0x20,0x2a,0x20,0x28,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x5f,0x6d,0x61,0x70,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,
+            0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+            0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+            0x6c,0x69,0x7a,0x65,0x28,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,
+            0x72,0x61,0x50,0x6f,0x73,0x20,0x2d,0x20,0x76,0x61,0x72,0x5f,0x50,
+            0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x0a,0x20,0x20,
+            0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+            0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x53,0x75,0x72,0x66,0x61,
+            0x63,0x65,0x28,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+            0x6f,0x6e,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,
+            0x69,0x65,0x77,0x2c,0x20,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,
+            0x72,0x2e,0x72,0x67,0x62,0x2c,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,
+            0x69,0x63,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+            0x2c,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x29,0x3b,0x0a,
+            0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,0x67,
+            0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+            0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x28,0x72,0x65,0x73,0x75,
+            0x6c,0x74,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,
+            0x72,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+        };
+
+        static const auto GBuffer_frag_data = std::array<unsigned char, 2142>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
+            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
+            0x73,0x6c,0x22,0x0a,0x0a,0x2f,0x2f,0x20,0x57,0x72,0x69,0x74,0x65,
+            0x73,0x20,0x74,0x68,0x65,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,
+            0x20,0x6f,0x66,0x20,0x6f,0x70,0x61,0x71,0x75,0x65,0x20,0x67,0x65,
+            0x6f,0x6d,0x65,0x74,0x72,0x79,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,
+            0x65,0x20,0x64,0x65,0x66,0x65,0x72,0x72,0x65,0x64,0x20,0x6c,0x69,
+            0x67,0x68,0x74,0x69,0x6e,0x67,0x2c,0x20,0x74,0x68,0x65,0x0a,0x2f,
+            0x2f,0x20,0x6c,0x61,0x79,0x6f,0x75,0x74,0x20,0x6d,0x75,0x73,0x74,
+            0x20,0x6d,0x61,0x74,0x63,0x68,0x20,0x53,0x63,0x65,0x6e,0x65,0x52,
+            0x65,0x6e,0x64,0x65,0x72,0x65,0x72,0x27,0x73,0x20,0x67,0x65,0x6f,
+            0x6d,0x65,0x74,0x72,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x2e,
+            0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x61,0x72,
+            0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x69,0x6e,
+            0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,
+            0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x69,0x6e,0x20,0x6d,0x61,0x74,
+            0x33,0x20,0x76,0x61,0x72,0x5f,0x54,0x42,0x4e,0x3b,0x0a,0x0a,0x76,
+            0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x20,0x62,0x61,0x73,
+            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,
+            0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x42,
+            0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x4d,0x61,0x70,0x2c,0x20,
+            0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,
+            0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x61,0x74,0x65,0x72,0x69,
+            0x61,0x6c,0x2e,0x62,0x61,0x73,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+            0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
+            0x73,0x73,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+            0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x4d,0x65,0x74,0x61,0x6c,
+            0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x4d,
+            0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
+            0x6f,0x72,0x64,0x29,0x2e,0x67,0x20,0x2a,0x20,0x62,0x6c,0x6b,0x5f,
+            0x4d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x2e,0x72,0x6f,0x75,0x67,
+            0x68,0x6e,0x65,0x73,0x73,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,
+            0x74,0x61,0x6c,0x6c,0x69,0x63,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,
+            0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,
+            0x6e,0x65,0x73,0x73,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,
+            0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x20,0x2a,
+            0x20,0x62,0x6c,0x6b,0x5f,0x4d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,
+            0x2e,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x5f,0x66,0x61,0x63,
+            0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+            0x75,0x6e,0x69,0x5f,0x45,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x4d,
+            0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
+            0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x62,0x6c,
+            0x6b,0x5f,0x4d,0x61,0x74,0x65,0x72,0x69,0x61,0x6c,0x2e,0x65,0x6d,
+            0x69,0x73,0x73,0x69,0x76,0x65,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,
+            0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,
+            0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x70,0x20,0x20,0x20,0x20,
+            0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,
+            0x69,0x5f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,0x70,0x2c,0x20,
+            0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,
+            0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+            0x7a,0x65,0x28,0x76,0x61,0x72,0x5f,0x54,0x42,0x4e,0x20,0x2a,0x20,
+            0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x70,0x20,0x2a,
+            0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,
+            0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,
+            0x34,0x28,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,
+            0x67,0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+            0x72,0x31,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6e,0x6f,0x72,
+            0x6d,0x61,0x6c,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+            0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+            0x6f,0x72,0x32,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x6d,0x65,
+            0x74,0x61,0x6c,0x6c,0x69,0x63,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,
+            0x6e,0x65,0x73,0x73,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+            0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,
+            0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x33,0x20,0x3d,0x20,0x76,
+            0x65,0x63,0x34,0x28,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x2c,
+            0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+        };
+
+        static const auto DeferredLighting_vert_data = std::array<unsigned char, 1363>{
+            0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
+            0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
+            0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
+            0x72,0x65,0x6c,0x6c,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x50,0x65,
+            0x72,0x6d,0x69,0x73,0x73,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x68,
+            0x65,0x72,0x65,0x62,0x79,0x20,0x67,0x72,0x61,0x6e,0x74,0x65,0x64,
+            0x2c,0x20,0x66,0x72,0x65,0x65,0x20,0x6f,0x66,0x20,0x63,0x68,0x61,
+            0x72,0x67,0x65,0x2c,0x20,0x74,0x6f,0x20,0x61,0x6e,0x79,0x20,0x70,
+            0x65,0x72,0x73,0x6f,0x6e,0x20,0x6f,0x62,0x74,0x61,0x69,0x6e,0x69,
+            0x6e,0x67,0x20,0x61,0x20,0x63,0x6f,0x70,0x79,0x0a,0x2f,0x2f,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x6f,0x66,0x74,0x77,
+            0x61,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,0x73,0x73,0x6f,0x63,
+            0x69,0x61,0x74,0x65,0x64,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+            0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x28,
+            0x74,0x68,0x65,0x20,0x22,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,
+            0x22,0x29,0x2c,0x20,0x74,0x6f,0x20,0x64,0x65,0x61,0x6c,0x0a,0x2f,
+            0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+            0x72,0x65,0x73,0x74,0x72,0x69,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,
+            0x68,0x6f,0x75,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x61,0x74,0x69,
+            0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x69,0x67,0x68,0x74,0x73,
+            0x0a,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x2c,0x20,0x63,
+            0x6f,0x70,0x79,0x2c,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2c,0x20,
+            0x6d,0x65,0x72,0x67,0x65,0x2c,0x20,0x70,0x75,0x62,0x6c,0x69,0x73,
+            0x68,0x2c,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x2c,0x20,0x73,0x75,0x62,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x2f,0x6f,0x72,0x20,0x73,0x65,0x6c,0x6c,0x0a,
+            0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x66,0x20,
+            0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2c,
+            0x20,0x61,0x6e,0x64,0x20,0x74,0x6f,0x20,0x70,0x65,0x72,0x6d,0x69,
+            0x74,0x20,0x70,0x65,0x72,0x73,0x6f,0x6e,0x73,0x20,0x74,0x6f,0x20,
+            0x77,0x68,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x53,0x6f,0x66,0x74,
+            0x77,0x61,0x72,0x65,0x20,0x69,0x73,0x0a,0x2f,0x2f,0x20,0x66,0x75,
+            0x72,0x6e,0x69,0x73,0x68,0x65,0x64,0x20,0x74,0x6f,0x20,0x64,0x6f,
+            0x20,0x73,0x6f,0x2c,0x20,0x73,0x75,0x62,0x6a,0x65,0x63,0x74,0x20,
+            0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,
+            0x69,0x6e,0x67,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,
+            0x73,0x20,0x3a,0x0a,0x2f,0x2f,0x0a,0x2f,0x2f,0x20,0x54,0x68,0x65,
+            0x20,0x61,0x62,0x6f,0x76,0x65,0x20,0x63,0x6f,0x70,0x79,0x72,0x69,
+            0x67,0x68,0x74,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x61,0x6e,
+            0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x65,0x72,0x6d,0x69,0x73,
+            0x73,0x69,0x6f,0x6e,0x20,0x6e,0x6f,0x74,0x69,0x63,0x65,0x20,0x73,
+            0x68,0x61,0x6c,0x6c,0x20,0x62,0x65,0x20,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x61,0x6c,0x6c,0x0a,0x2f,0x2f,
+            0x20,0x63,0x6f,0x70,0x69,0x65,0x73,0x20,0x6f,0x72,0x20,0x73,0x75,
+            0x62,0x73,0x74,0x61,0x6e,0x74,0x69,0x61,0x6c,0x20,0x70,0x6f,0x72,
+            0x74,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+            0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x2e,0x0a,0x2f,0x2f,0x0a,
+            0x2f,0x2f,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x49,0x53,0x20,0x50,0x52,0x4f,0x56,0x49,0x44,0x45,
+            0x44,0x20,0x22,0x41,0x53,0x20,0x49,0x53,0x22,0x2c,0x20,0x57,0x49,
+            0x54,0x48,0x4f,0x55,0x54,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x59,0x20,0x4f,0x46,0x20,0x41,0x4e,0x59,0x20,0x4b,0x49,0x4e,0x44,
+            0x2c,0x20,0x45,0x58,0x50,0x52,0x45,0x53,0x53,0x20,0x4f,0x52,0x0a,
+            0x2f,0x2f,0x20,0x49,0x4d,0x50,0x4c,0x49,0x45,0x44,0x2c,0x20,0x49,
+            0x4e,0x43,0x4c,0x55,0x44,0x49,0x4e,0x47,0x20,0x42,0x55,0x54,0x20,
+            0x4e,0x4f,0x54,0x20,0x4c,0x49,0x4d,0x49,0x54,0x45,0x44,0x20,0x54,
+            0x4f,0x20,0x54,0x48,0x45,0x20,0x57,0x41,0x52,0x52,0x41,0x4e,0x54,
+            0x49,0x45,0x53,0x20,0x4f,0x46,0x20,0x4d,0x45,0x52,0x43,0x48,0x41,
+            0x4e,0x54,0x41,0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x0a,0x2f,0x2f,
+            0x20,0x46,0x49,0x54,0x4e,0x45,0x53,0x53,0x20,0x46,0x4f,0x52,0x20,
+            0x41,0x20,0x50,0x41,0x52,0x54,0x49,0x43,0x55,0x4c,0x41,0x52,0x20,
+            0x50,0x55,0x52,0x50,0x4f,0x53,0x45,0x20,0x41,0x4e,0x44,0x20,0x4e,
+            0x4f,0x4e,0x49,0x4e,0x46,0x52,0x49,0x4e,0x47,0x45,0x4d,0x45,0x4e,
+            0x54,0x2e,0x49,0x4e,0x20,0x4e,0x4f,0x20,0x45,0x56,0x45,0x4e,0x54,
+            0x20,0x53,0x48,0x41,0x4c,0x4c,0x20,0x54,0x48,0x45,0x0a,0x2f,0x2f,
+            0x20,0x41,0x55,0x54,0x48,0x4f,0x52,0x53,0x20,0x4f,0x52,0x20,0x43,
+            0x4f,0x50,0x59,0x52,0x49,0x47,0x48,0x54,0x20,0x48,0x4f,0x4c,0x44,
+            0x45,0x52,0x53,0x20,0x42,0x45,0x20,0x4c,0x49,0x41,0x42,0x4c,0x45,
+            0x20,0x46,0x4f,0x52,0x20,0x41,0x4e,0x59,0x20,0x43,0x4c,0x41,0x49,
+            0x4d,0x2c,0x20,0x44,0x41,0x4d,0x41,0x47,0x45,0x53,0x20,0x4f,0x52,
+            0x20,0x4f,0x54,0x48,0x45,0x52,0x0a,0x2f,0x2f,0x20,0x4c,0x49,0x41,
+            0x42,0x49,0x4c,0x49,0x54,0x59,0x2c,0x20,0x57,0x48,0x45,0x54,0x48,
+            0x45,0x52,0x20,0x49,0x4e,0x20,0x41,0x4e,0x20,0x41,0x43,0x54,0x49,
+            0x4f,0x4e,0x20,0x4f,0x46,0x20,0x43,0x4f,0x4e,0x54,0x52,0x41,0x43,
+            0x54,0x2c,0x20,0x54,0x4f,0x52,0x54,0x20,0x4f,0x52,0x20,0x4f,0x54,
+            0x48,0x45,0x52,0x57,0x49,0x53,0x45,0x2c,0x20,0x41,0x52,0x49,0x53,
+            0x49,0x4e,0x47,0x20,0x46,0x52,0x4f,0x4d,0x2c,0x0a,0x2f,0x2f,0x20,
+            0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4f,0x52,0x20,0x49,0x4e,0x20,
+            0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x57,0x49,
+            0x54,0x48,0x20,0x54,0x48,0x45,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,
+            0x52,0x45,0x20,0x4f,0x52,0x20,0x54,0x48,0x45,0x20,0x55,0x53,0x45,
+            0x20,0x4f,0x52,0x20,0x4f,0x54,0x48,0x45,0x52,0x20,0x44,0x45,0x41,
+            0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
+            0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
+            0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
+            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
+            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
+            0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,
+            0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+            0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+            0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x20,
+            0x3d,0x20,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x28,0x62,0x6c,
+            0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x76,0x69,0x65,0x77,0x5f,
+            0x6d,0x61,0x74,0x72,0x69,0x78,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,
+            0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,
+            0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+            0x74,0x69,0x6f,0x6e,0x20,0x20,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+            0x28,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,0x65,0x78,0x28,0x29,
+            0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto Screen_vert_data = std::array<unsigned char, 1365>{
+        static const auto DeferredLighting_frag_data = std::array<unsigned char, 2423>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -733,26 +2531,108 @@ namespace pkzo
             0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
             0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
             0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
-            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
-            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
-            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
-            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
-            0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
-            0x6f,0x72,0x64,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
-            0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x61,
-            0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,
-            0x61,0x74,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-            0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-            0x69,0x6f,0x6e,0x20,0x20,0x3d,0x20,0x75,0x6e,0x69,0x5f,0x50,0x72,
-            0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,0x69,
-            0x78,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,0x56,0x69,0x65,0x77,0x4d,
-            0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,0x4d,
-            0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,
-            0x76,0x65,0x63,0x34,0x28,0x61,0x74,0x72,0x5f,0x56,0x65,0x72,0x74,
-            0x65,0x78,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
+            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
+            0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,
+            0x22,0x6d,0x61,0x74,0x68,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,
+            0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x22,0x6c,0x69,0x67,0x68,
+            0x74,0x69,0x6e,0x67,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x2f,
+            0x2f,0x20,0x53,0x68,0x61,0x64,0x65,0x73,0x20,0x74,0x68,0x65,0x20,
+            0x70,0x69,0x78,0x65,0x6c,0x73,0x20,0x63,0x6f,0x76,0x65,0x72,0x65,
+            0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x67,0x65,0x6f,0x6d,
+            0x65,0x74,0x72,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x2c,0x20,
+            0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x73,0x20,0x61,0x72,
+            0x65,0x0a,0x2f,0x2f,0x20,0x6c,0x6f,0x6f,0x6b,0x65,0x64,0x20,0x75,
+            0x70,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,
+            0x74,0x20,0x63,0x6c,0x75,0x73,0x74,0x65,0x72,0x73,0x20,0x6c,0x69,
+            0x6b,0x65,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x72,
+            0x77,0x61,0x72,0x64,0x20,0x70,0x61,0x73,0x73,0x2e,0x0a,0x0a,0x69,
+            0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x43,0x61,
+            0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+            0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+            0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,
+            0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,
+            0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,
+            0x70,0x74,0x68,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+            0x74,0x63,0x68,0x28,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,
+            0x65,0x72,0x44,0x65,0x70,0x74,0x68,0x2c,0x20,0x74,0x65,0x78,0x65,
+            0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x69,0x66,0x20,0x28,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x3d,0x20,
+            0x31,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6e,0x6f,0x74,0x68,
+            0x69,0x6e,0x67,0x20,0x77,0x61,0x73,0x20,0x64,0x72,0x61,0x77,0x6e,
+            0x2c,0x20,0x74,0x68,0x65,0x20,0x73,0x6b,0x79,0x20,0x62,0x6f,0x78,
+            0x20,0x73,0x68,0x6f,0x77,0x73,0x20,0x74,0x68,0x72,0x6f,0x75,0x67,
+            0x68,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,
+            0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,
+            0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,
+            0x65,0x63,0x32,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,
+            0x7a,0x65,0x28,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,0x65,
+            0x72,0x44,0x65,0x70,0x74,0x68,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x6f,0x72,0x6c,
+            0x64,0x20,0x20,0x20,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,
+            0x61,0x6d,0x65,0x2e,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x5f,0x76,
+            0x69,0x65,0x77,0x5f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,
+            0x6e,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,
+            0x63,0x34,0x28,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x2c,0x20,0x64,
+            0x65,0x70,0x74,0x68,0x29,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,
+            0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,
+            0x69,0x6f,0x6e,0x20,0x3d,0x20,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x78,
+            0x79,0x7a,0x20,0x2f,0x20,0x77,0x6f,0x72,0x6c,0x64,0x2e,0x77,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x62,
+            0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,
+            0x65,0x74,0x63,0x68,0x28,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,
+            0x66,0x65,0x72,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+            0x20,0x74,0x65,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x67,
+            0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,
+            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,
+            0x46,0x65,0x74,0x63,0x68,0x28,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,
+            0x66,0x66,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x74,
+            0x65,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x20,0x6d,0x65,
+            0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,
+            0x73,0x73,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+            0x74,0x63,0x68,0x28,0x75,0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,
+            0x65,0x72,0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,
+            0x67,0x68,0x6e,0x65,0x73,0x73,0x2c,0x20,0x74,0x65,0x78,0x65,0x6c,
+            0x2c,0x20,0x30,0x29,0x2e,0x72,0x67,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x76,0x65,0x63,0x33,0x20,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,
+            0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x75,
+            0x6e,0x69,0x5f,0x47,0x42,0x75,0x66,0x66,0x65,0x72,0x45,0x6d,0x69,
+            0x73,0x73,0x69,0x76,0x65,0x2c,0x20,0x74,0x65,0x78,0x65,0x6c,0x2c,
+            0x20,0x30,0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x76,0x65,0x63,0x33,0x20,0x20,0x76,0x69,0x65,0x77,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x61,
+            0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x20,0x2d,
+            0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x73,0x75,
+            0x6c,0x74,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x53,0x75,0x72,
+            0x66,0x61,0x63,0x65,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+            0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,
+            0x77,0x2c,0x20,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+            0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,
+            0x68,0x6e,0x65,0x73,0x73,0x2e,0x72,0x2c,0x20,0x6d,0x65,0x74,0x61,
+            0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+            0x2e,0x67,0x2c,0x20,0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x29,
+            0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,
+            0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x76,0x65,
+            0x63,0x34,0x28,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x28,0x72,0x65,
+            0x73,0x75,0x6c,0x74,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+            0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x44,0x65,
+            0x70,0x74,0x68,0x20,0x20,0x20,0x3d,0x20,0x64,0x65,0x70,0x74,0x68,
+            0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto Screen_frag_data = std::array<unsigned char, 1312>{
+        static const auto Shadow_vert_data = std::array<unsigned char, 1546>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -841,22 +2721,40 @@ namespace pkzo
             0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
             0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
             0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
-            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
-            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
-            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
-            0x73,0x6c,0x22,0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
-            0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-            0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
-            0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,
-            0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x74,0x65,
-            0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,
-            0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x20,0x2a,
-            0x20,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,
-            0x72,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x00
+            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
+            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x2f,0x2f,0x20,0x53,0x68,
+            0x61,0x64,0x6f,0x77,0x20,0x63,0x61,0x73,0x74,0x65,0x72,0x73,0x2c,
+            0x20,0x74,0x68,0x65,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x62,0x6c,
+            0x6f,0x63,0x6b,0x20,0x68,0x6f,0x6c,0x64,0x73,0x20,0x74,0x68,0x65,
+            0x20,0x76,0x69,0x65,0x77,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,
+            0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x73,0x68,
+            0x61,0x64,0x6f,0x77,0x0a,0x2f,0x2f,0x20,0x76,0x69,0x65,0x77,0x20,
+            0x61,0x73,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,
+            0x20,0x61,0x6e,0x64,0x20,0x61,0x6e,0x20,0x69,0x64,0x65,0x6e,0x74,
+            0x69,0x74,0x79,0x20,0x76,0x69,0x65,0x77,0x2e,0x0a,0x0a,0x76,0x6f,
+            0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+            0x20,0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,
+            0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,
+            0x4f,0x62,0x6a,0x65,0x63,0x74,0x2e,0x69,0x6e,0x73,0x74,0x61,0x6e,
+            0x63,0x65,0x64,0x20,0x21,0x3d,0x20,0x30,0x20,0x3f,0x20,0x61,0x74,
+            0x72,0x5f,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x4d,0x6f,0x64,
+            0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x3a,0x20,0x62,0x6c,
+            0x6b,0x5f,0x4f,0x62,0x6a,0x65,0x63,0x74,0x2e,0x6d,0x6f,0x64,0x65,
+            0x6c,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x62,0x6c,0x6b,0x5f,0x46,0x72,
+            0x61,0x6d,0x65,0x2e,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,
+            0x6e,0x5f,0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x62,0x6c,
+            0x6b,0x5f,0x46,0x72,0x61,0x6d,0x65,0x2e,0x76,0x69,0x65,0x77,0x5f,
+            0x6d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x65,
+            0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,0x63,
+            0x34,0x28,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,0x65,0x78,0x28,
+            0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto Forward_vert_data = std::array<unsigned char, 1884>{
+        static const auto Shadow_frag_data = std::array<unsigned char, 1188>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -944,67 +2842,14 @@ namespace pkzo
             0x4c,0x49,0x4e,0x47,0x53,0x20,0x49,0x4e,0x20,0x54,0x48,0x45,0x0a,
             0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
             0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
-            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
-            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
-            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
-            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
-            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
-            0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
-            0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,
-            0x20,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,
-            0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
-            0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
-            0x6f,0x75,0x74,0x20,0x6d,0x61,0x74,0x33,0x20,0x76,0x61,0x72,0x5f,
-            0x54,0x42,0x4e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
-            0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
-            0x74,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,0x74,0x72,
-            0x69,0x78,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x74,0x72,0x61,
-            0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x69,0x6e,0x76,0x65,0x72,0x73,
-            0x65,0x28,0x75,0x6e,0x69,0x5f,0x4d,0x6f,0x64,0x65,0x6c,0x4d,0x61,
-            0x74,0x72,0x69,0x78,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
-            0x7a,0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,0x74,0x72,
-            0x69,0x78,0x20,0x2a,0x20,0x61,0x74,0x72,0x5f,0x4e,0x6f,0x72,0x6d,
-            0x61,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-            0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,
-            0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6e,
-            0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,
-            0x20,0x61,0x74,0x72,0x5f,0x54,0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,
-            0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x69,
-            0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x20,0x20,0x20,0x3d,0x20,0x63,
-            0x72,0x6f,0x73,0x73,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,
-            0x74,0x61,0x6e,0x67,0x65,0x6e,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x76,0x61,0x72,0x5f,0x54,0x42,0x4e,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x74,
-            0x61,0x6e,0x67,0x65,0x6e,0x74,0x2c,0x20,0x62,0x69,0x74,0x61,0x6e,
-            0x67,0x65,0x6e,0x74,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,
-            0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,
-            0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,
-            0x61,0x74,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-            0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x77,0x6f,
-            0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,0x20,0x3d,0x20,0x75,0x6e,
-            0x69,0x5f,0x4d,0x6f,0x64,0x65,0x6c,0x4d,0x61,0x74,0x72,0x69,0x78,
-            0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x74,0x72,0x5f,0x56,
-            0x65,0x72,0x74,0x65,0x78,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,
-            0x69,0x6f,0x6e,0x20,0x20,0x20,0x20,0x3d,0x20,0x77,0x6f,0x72,0x6c,
-            0x64,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x0a,0x20,
-            0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,
-            0x50,0x6f,0x73,0x20,0x20,0x3d,0x20,0x28,0x69,0x6e,0x76,0x65,0x72,
-            0x73,0x65,0x28,0x75,0x6e,0x69,0x5f,0x56,0x69,0x65,0x77,0x4d,0x61,
-            0x74,0x72,0x69,0x78,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
-            0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,
-            0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
-            0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-            0x69,0x6f,0x6e,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x75,0x6e,0x69,
-            0x5f,0x50,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,
-            0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,0x56,0x69,
-            0x65,0x77,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x77,0x6f,
-            0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x7d,0x0a,0x00
+            0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x2f,0x2f,0x20,0x53,0x68,0x61,
+            0x64,0x6f,0x77,0x20,0x6d,0x61,0x70,0x73,0x20,0x6f,0x6e,0x6c,0x79,
+            0x20,0x68,0x6f,0x6c,0x64,0x20,0x64,0x65,0x70,0x74,0x68,0x2e,0x0a,
+            0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+            0x7b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto Forward_frag_data = std::array<unsigned char, 6024>{
+        static const auto ShadowCopy_vert_data = std::array<unsigned char, 1320>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -1093,385 +2938,23 @@ namespace pkzo
             0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
             0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
             0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
-            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
-            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
-            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
-            0x73,0x6c,0x22,0x0a,0x0a,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
-            0x4d,0x49,0x50,0x53,0x20,0x20,0x20,0x20,0x36,0x0a,0x0a,0x69,0x6e,
-            0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,
-            0x43,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,
-            0x33,0x20,0x76,0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,
-            0x6f,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
-            0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
-            0x69,0x6e,0x20,0x6d,0x61,0x74,0x33,0x20,0x76,0x61,0x72,0x5f,0x54,
-            0x42,0x4e,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x74,0x6f,0x6e,
-            0x65,0x6d,0x61,0x70,0x28,0x76,0x65,0x63,0x33,0x20,0x78,0x29,0x0a,
-            0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x58,0x20,
-            0x3d,0x20,0x6d,0x61,0x78,0x28,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,
-            0x30,0x29,0x2c,0x20,0x78,0x20,0x2d,0x20,0x30,0x2e,0x30,0x30,0x34,
-            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,
-            0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x28,0x58,0x20,0x2a,0x20,
-            0x28,0x36,0x2e,0x32,0x20,0x2a,0x20,0x58,0x20,0x2b,0x20,0x30,0x2e,
-            0x35,0x29,0x29,0x20,0x2f,0x20,0x28,0x58,0x20,0x2a,0x20,0x28,0x36,
-            0x2e,0x32,0x20,0x2a,0x20,0x58,0x20,0x2b,0x20,0x31,0x2e,0x37,0x29,
-            0x20,0x2b,0x20,0x30,0x2e,0x30,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x6f,0x77,0x28,0x72,
-            0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x32,
-            0x2e,0x32,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,
-            0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x28,0x4c,
-            0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x20,0x70,0x72,0x6f,
-            0x62,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,
-            0x61,0x6c,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,
-            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,
-            0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,
-            0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x75,0x67,0x68,
-            0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,
-            0x6f,0x6e,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x28,
-            0x2d,0x76,0x69,0x65,0x77,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-            0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-            0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x20,0x3d,0x20,0x74,0x65,
-            0x78,0x74,0x75,0x72,0x65,0x28,0x70,0x72,0x6f,0x62,0x65,0x2e,0x64,
-            0x69,0x66,0x66,0x75,0x73,0x65,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,
-            0x6c,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x64,0x69,0x66,0x66,
-            0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x20,0x20,
-            0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,
-            0x61,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,
-            0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x3c,0x20,0x30,0x2e,
-            0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,
-            0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,
-            0x70,0x72,0x6f,0x62,0x65,0x2e,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,
-            0x6d,0x65,0x6e,0x74,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,
-            0x69,0x6f,0x6e,0x2c,0x20,0x30,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,
-            0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,
-            0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-            0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
-            0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,
-            0x64,0x28,0x70,0x72,0x6f,0x62,0x65,0x2e,0x73,0x70,0x65,0x63,0x75,
-            0x6c,0x61,0x72,0x2c,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,0x74,0x69,
-            0x6f,0x6e,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-            0x20,0x2a,0x20,0x4d,0x49,0x50,0x53,0x29,0x2e,0x72,0x67,0x62,0x20,
-            0x2a,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,
-            0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,
-            0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x66,0x66,
-            0x75,0x73,0x65,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,
-            0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x64,0x69,
-            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x4c,0x69,0x67,0x68,
-            0x74,0x28,0x4c,0x69,0x67,0x68,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,
-            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-            0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,
-            0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,
-            0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,
-            0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,
-            0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,
-            0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-            0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x20,0x20,
-            0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x2d,
-            0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,0x69,0x72,0x65,0x63,0x74,0x69,
-            0x6f,0x6e,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-            0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,
-            0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,
-            0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,
-            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,
-            0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x4e,0x64,0x6f,
-            0x74,0x4c,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-            0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,0x20,0x20,0x20,0x20,0x20,
-            0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,
-            0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x2b,0x20,0x76,0x69,0x65,
-            0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-            0x20,0x4e,0x64,0x6f,0x74,0x48,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,
-            0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,
-            0x61,0x6c,0x2c,0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,0x29,0x2c,
-            0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-            0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x20,
-            0x20,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x4e,0x64,0x6f,0x74,0x48,
-            0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x2a,
-            0x20,0x31,0x32,0x38,0x2e,0x30,0x29,0x20,0x2a,0x20,0x73,0x70,0x65,
-            0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,
-            0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
-            0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,
-            0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,
-            0x75,0x6c,0x61,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,
-            0x20,0x70,0x6f,0x69,0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x4c,
-            0x69,0x67,0x68,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x76,0x65,0x63,
-            0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,
-            0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,
-            0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,
-            0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,
-            0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,
-            0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x20,0x20,0x3d,0x20,
-            0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-            0x6e,0x20,0x2d,0x20,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,
-            0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-            0x74,0x20,0x64,0x69,0x73,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x6c,0x69,0x67,0x68,
-            0x74,0x44,0x69,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,
-            0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-            0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x3b,0x0a,0x0a,
-            0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,
-            0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x2e,
-            0x30,0x20,0x2f,0x20,0x28,0x64,0x69,0x73,0x74,0x20,0x2a,0x20,0x64,
-            0x69,0x73,0x74,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-            0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,
-            0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,
-            0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
-            0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
-            0x65,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x64,0x69,0x66,0x66,0x75,
-            0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,
-            0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x4e,0x64,
-            0x6f,0x74,0x4c,0x20,0x2a,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,
-            0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-            0x63,0x33,0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,0x20,0x20,0x20,
-            0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-            0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x2b,0x20,0x76,
-            0x69,0x65,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-            0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x48,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,
-            0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,
-            0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
-            0x20,0x20,0x20,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x4e,0x64,0x6f,
-            0x74,0x48,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,
-            0x20,0x2a,0x20,0x31,0x32,0x38,0x2e,0x30,0x29,0x20,0x2a,0x20,0x73,
-            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x20,
-            0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,
-            0x20,0x2a,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,
-            0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-            0x6e,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x2b,0x20,0x73,
-            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
-            0x65,0x63,0x33,0x20,0x73,0x70,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,
-            0x28,0x4c,0x69,0x67,0x68,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,
-            0x20,0x76,0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
-            0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,
-            0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,
-            0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,
-            0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
-            0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-            0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x20,0x20,
-            0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,
-            0x69,0x6f,0x6e,0x20,0x2d,0x20,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,
-            0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-            0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x6c,0x69,
-            0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,
-            0x72,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
-            0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x29,0x3b,
-            0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,
-            0x74,0x74,0x65,0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-            0x31,0x2e,0x30,0x20,0x2f,0x20,0x28,0x64,0x69,0x73,0x74,0x20,0x2a,
-            0x20,0x64,0x69,0x73,0x74,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,
-            0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x68,0x65,0x74,0x61,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x6c,0x69,
-            0x67,0x68,0x74,0x44,0x69,0x72,0x2c,0x20,0x2d,0x6e,0x6f,0x72,0x6d,
-            0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x64,
-            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x73,0x5f,
-            0x69,0x6e,0x6e,0x65,0x72,0x20,0x20,0x20,0x3d,0x20,0x63,0x6f,0x73,
-            0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,0x61,0x6e,0x67,0x6c,0x65,0x73,
-            0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-            0x74,0x20,0x63,0x6f,0x73,0x5f,0x6f,0x75,0x74,0x65,0x72,0x20,0x20,
-            0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x6c,0x69,0x67,0x68,0x74,0x2e,
-            0x61,0x6e,0x67,0x6c,0x65,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x74,0x65,0x6e,
-            0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x61,0x74,0x74,0x65,
-            0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x63,0x6c,0x61,
-            0x6d,0x70,0x28,0x28,0x74,0x68,0x65,0x74,0x61,0x20,0x2d,0x20,0x63,
-            0x6f,0x73,0x5f,0x6f,0x75,0x74,0x65,0x72,0x29,0x20,0x2f,0x20,0x28,
-            0x63,0x6f,0x73,0x5f,0x69,0x6e,0x6e,0x65,0x72,0x20,0x2d,0x20,0x63,
-            0x6f,0x73,0x5f,0x6f,0x75,0x74,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,
-            0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,
-            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,
-            0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x69,0x67,
-            0x68,0x74,0x44,0x69,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,
-            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,
-            0x66,0x75,0x73,0x65,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x64,0x69,
-            0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,
-            0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,
-            0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x2a,0x20,0x61,0x74,0x74,0x65,
-            0x6e,0x75,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,
-            0x20,0x76,0x65,0x63,0x33,0x20,0x68,0x61,0x6c,0x66,0x77,0x61,0x79,
-            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-            0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,
-            0x2b,0x20,0x76,0x69,0x65,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x66,0x6c,0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x48,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,
-            0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x61,0x6c,0x66,
-            0x77,0x61,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x70,0x65,0x63,0x75,
-            0x6c,0x61,0x72,0x20,0x20,0x20,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,
-            0x4e,0x64,0x6f,0x74,0x48,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,
-            0x65,0x73,0x73,0x20,0x2a,0x20,0x31,0x32,0x38,0x2e,0x30,0x29,0x20,
-            0x2a,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,
-            0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x67,0x68,0x74,0x2e,0x63,0x6f,
-            0x6c,0x6f,0x72,0x20,0x2a,0x20,0x61,0x74,0x74,0x65,0x6e,0x75,0x61,
-            0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-            0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,
-            0x2b,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x3b,0x0a,0x7d,
-            0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
-            0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x20,
-            0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x20,0x20,0x20,
-            0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,
-            0x69,0x5f,0x42,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x4d,0x61,
-            0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,
-            0x72,0x64,0x29,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,0x42,0x61,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,
-            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
-            0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x20,0x20,0x20,0x20,0x3d,
-            0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,
-            0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,
-            0x6e,0x65,0x73,0x73,0x4d,0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,
-            0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x67,0x20,0x2a,
-            0x20,0x75,0x6e,0x69,0x5f,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,
-            0x73,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x65,0x74,0x61,0x6c,0x6c,0x69,
-            0x63,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
-            0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x4d,0x65,0x74,0x61,0x6c,
-            0x6c,0x69,0x63,0x52,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x4d,
-            0x61,0x70,0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
-            0x6f,0x72,0x64,0x29,0x2e,0x72,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,
-            0x4d,0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x46,0x61,0x63,0x74,0x6f,
-            0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,
-            0x65,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,
-            0x69,0x5f,0x45,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x4d,0x61,0x70,
-            0x2c,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-            0x64,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,
-            0x45,0x6d,0x69,0x73,0x73,0x69,0x76,0x65,0x46,0x61,0x63,0x74,0x6f,
-            0x72,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,
-            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x70,0x20,0x20,0x20,
-            0x20,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,
-            0x6e,0x69,0x5f,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x4d,0x61,0x70,0x2c,
-            0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,
-            0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-            0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
-            0x69,0x7a,0x65,0x28,0x76,0x61,0x72,0x5f,0x54,0x42,0x4e,0x20,0x2a,
-            0x20,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x5f,0x6d,0x61,0x70,0x20,
-            0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x29,
-            0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x69,
-            0x65,0x77,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,
-            0x61,0x72,0x5f,0x43,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x20,
-            0x2d,0x20,0x76,0x61,0x72,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-            0x6e,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-            0x20,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,
-            0x72,0x20,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x61,0x73,0x65,
-            0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x67,0x62,0x2c,0x20,0x76,0x65,
-            0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x6d,0x65,0x74,0x61,
-            0x6c,0x6c,0x69,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-            0x63,0x33,0x20,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,
-            0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,
-            0x63,0x33,0x28,0x30,0x2e,0x30,0x34,0x29,0x2c,0x20,0x62,0x61,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x67,0x62,0x2c,0x20,0x6d,
-            0x65,0x74,0x61,0x6c,0x6c,0x69,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,
-            0x65,0x73,0x73,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x6d,0x69,0x78,
-            0x28,0x32,0x2e,0x30,0x2c,0x20,0x32,0x35,0x36,0x2e,0x30,0x2c,0x20,
-            0x31,0x2e,0x30,0x20,0x2d,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
-            0x73,0x73,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x2f,0x2f,0x6f,
-            0x75,0x74,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,
-            0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x6f,0x75,0x67,0x68,
-            0x6e,0x65,0x73,0x73,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,
-            0x73,0x73,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
-            0x2c,0x20,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,
-            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x2f,0x2f,0x72,0x65,0x74,0x75,
-            0x72,0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-            0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x65,0x6d,0x69,
-            0x73,0x73,0x69,0x76,0x65,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,
-            0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
-            0x3b,0x20,0x69,0x20,0x3c,0x20,0x4d,0x41,0x58,0x5f,0x4c,0x49,0x47,
-            0x48,0x54,0x5f,0x50,0x52,0x4f,0x42,0x45,0x53,0x3b,0x20,0x69,0x2b,
-            0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,
-            0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,0x28,0x75,
-            0x6e,0x69,0x5f,0x4c,0x69,0x67,0x68,0x74,0x50,0x72,0x6f,0x62,0x65,
-            0x73,0x5b,0x69,0x5d,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
-            0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x73,0x70,0x65,0x63,0x75,
-            0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x72,0x6f,0x75,
-            0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,
-            0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,
-            0x20,0x4d,0x41,0x58,0x5f,0x4c,0x49,0x47,0x48,0x54,0x53,0x3b,0x20,
-            0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x77,0x69,0x74,0x63,0x68,0x20,
-            0x28,0x75,0x6e,0x69,0x5f,0x4c,0x69,0x67,0x68,0x74,0x5b,0x69,0x5d,
-            0x2e,0x74,0x79,0x70,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x4e,0x4f,0x4e,0x45,0x5f,
-            0x4c,0x49,0x47,0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,
-            0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x41,0x4d,0x42,0x49,0x45,
-            0x4e,0x54,0x5f,0x4c,0x49,0x47,0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x62,0x61,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,
-            0x75,0x6e,0x69,0x5f,0x4c,0x69,0x67,0x68,0x74,0x5b,0x69,0x5d,0x2e,
-            0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,
-            0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x44,0x49,0x52,0x45,0x43,
-            0x54,0x49,0x4f,0x4e,0x41,0x4c,0x5f,0x4c,0x49,0x47,0x48,0x54,0x3a,
-            0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,
-            0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x4c,
-            0x69,0x67,0x68,0x74,0x28,0x75,0x6e,0x69,0x5f,0x4c,0x69,0x67,0x68,
-            0x74,0x5b,0x69,0x5d,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
-            0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x64,0x69,0x66,0x66,0x75,0x73,
-            0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x73,0x70,0x65,0x63,0x75,
-            0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x73,0x68,0x69,
-            0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,
-            0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,0x50,0x4f,0x49,
-            0x4e,0x54,0x5f,0x4c,0x49,0x47,0x48,0x54,0x3a,0x0a,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x70,0x6f,0x69,
-            0x6e,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x75,0x6e,0x69,0x5f,0x4c,
-            0x69,0x67,0x68,0x74,0x5b,0x69,0x5d,0x2c,0x20,0x6e,0x6f,0x72,0x6d,
-            0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x64,0x69,0x66,
-            0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x73,0x70,
-            0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,
-            0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x20,
-            0x53,0x50,0x4f,0x54,0x5f,0x4c,0x49,0x47,0x48,0x54,0x3a,0x0a,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x2b,0x3d,0x20,0x73,
-            0x70,0x6f,0x74,0x4c,0x69,0x67,0x68,0x74,0x28,0x75,0x6e,0x69,0x5f,
-            0x4c,0x69,0x67,0x68,0x74,0x5b,0x69,0x5d,0x2c,0x20,0x6e,0x6f,0x72,
-            0x6d,0x61,0x6c,0x2c,0x20,0x76,0x69,0x65,0x77,0x2c,0x20,0x64,0x69,
-            0x66,0x66,0x75,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x73,
-            0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
-            0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-            0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,
-            0x20,0x74,0x6f,0x6e,0x65,0x6d,0x61,0x70,0x28,0x72,0x65,0x73,0x75,
-            0x6c,0x74,0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
-            0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,
-            0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,
-            0x20,0x62,0x61,0x73,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x29,
-            0x3b,0x0a,0x7d,0x0a,0x00
+            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,
+            0x76,0x65,0x63,0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,
+            0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+            0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+            0x65,0x63,0x33,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x20,0x3d,
+            0x20,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,0x65,0x78,0x28,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,
+            0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x76,0x65,0x72,0x74,0x65,
+            0x78,0x2e,0x78,0x79,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,
+            0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,
+            0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x20,0x3d,0x20,0x76,0x65,
+            0x63,0x34,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x2c,0x20,0x31,0x2e,
+            0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto GenerateCubemap_vert_data = std::array<unsigned char, 1353>{
+        static const auto ShadowCopy_frag_data = std::array<unsigned char, 1440>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -1560,26 +3043,32 @@ namespace pkzo
             0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
             0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
             0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
-            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
-            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
-            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
-            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,
-            0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
-            0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
-            0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,
-            0x3d,0x20,0x75,0x6e,0x69,0x5f,0x43,0x75,0x62,0x65,0x6d,0x61,0x70,
-            0x54,0x42,0x4e,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x61,0x74,
-            0x72,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x2e,0x78,0x2c,0x20,0x2d,
-            0x61,0x74,0x72,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x2e,0x79,0x2c,
-            0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
-            0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x20,0x20,0x3d,
-            0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x74,0x72,0x5f,0x56,0x65,0x72,
-            0x74,0x65,0x78,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
-            0x00
+            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
+            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x2f,0x2f,0x20,0x43,0x6f,0x70,
+            0x69,0x65,0x73,0x20,0x61,0x20,0x63,0x61,0x63,0x68,0x65,0x64,0x20,
+            0x73,0x68,0x61,0x64,0x6f,0x77,0x20,0x6d,0x61,0x70,0x20,0x6f,0x66,
+            0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x67,
+            0x65,0x6f,0x6d,0x65,0x74,0x72,0x79,0x20,0x69,0x6e,0x74,0x6f,0x20,
+            0x69,0x74,0x73,0x20,0x61,0x74,0x6c,0x61,0x73,0x20,0x74,0x69,0x6c,
+            0x65,0x2c,0x0a,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x76,0x69,0x65,
+            0x77,0x70,0x6f,0x72,0x74,0x20,0x69,0x73,0x20,0x74,0x68,0x65,0x20,
+            0x74,0x69,0x6c,0x65,0x2e,0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,
+            0x32,0x20,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
+            0x64,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+            0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,
+            0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x20,0x3d,0x20,0x69,0x76,
+            0x65,0x63,0x32,0x28,0x76,0x61,0x72,0x5f,0x54,0x65,0x78,0x43,0x6f,
+            0x6f,0x72,0x64,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x65,
+            0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x75,0x6e,0x69,
+            0x5f,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x30,0x29,0x29,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,
+            0x67,0x44,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+            0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x75,0x6e,0x69,0x5f,0x54,0x65,
+            0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x74,0x65,0x78,0x65,0x6c,0x2c,
+            0x20,0x30,0x29,0x2e,0x72,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto GenerateCubemap_frag_data = std::array<unsigned char, 1716>{
+        static const auto GenerateCubemap_vert_data = std::array<unsigned char, 1375>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -1668,53 +3157,27 @@ namespace pkzo
             0x2f,0x2f,0x20,0x53,0x4f,0x46,0x54,0x57,0x41,0x52,0x45,0x2e,0x0a,
             0x0a,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,
             0x20,0x63,0x6f,0x72,0x65,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,
-            0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,0x2e,
-            0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
-            0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
-            0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,
-            0x22,0x6d,0x61,0x74,0x68,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,
-            0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x44,
-            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x65,
-            0x63,0x32,0x20,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x44,0x69,0x72,
-            0x65,0x63,0x74,0x69,0x6f,0x6e,0x28,0x76,0x65,0x63,0x33,0x20,0x64,
-            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x7b,0x0a,0x20,
-            0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x70,0x68,0x65,0x72,
-            0x69,0x63,0x61,0x6c,0x20,0x3d,0x20,0x63,0x61,0x72,0x74,0x65,0x73,
-            0x69,0x61,0x6e,0x54,0x6f,0x53,0x70,0x68,0x65,0x72,0x69,0x63,0x61,
-            0x6c,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x64,
-            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x20,0x3d,0x20,
-            0x30,0x2e,0x35,0x20,0x2b,0x20,0x73,0x70,0x68,0x65,0x72,0x69,0x63,
-            0x61,0x6c,0x2e,0x78,0x20,0x2f,0x20,0x28,0x32,0x2e,0x30,0x20,0x2a,
-            0x20,0x50,0x49,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-            0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,
-            0x73,0x70,0x68,0x65,0x72,0x69,0x63,0x61,0x6c,0x2e,0x79,0x20,0x2f,
-            0x20,0x28,0x50,0x49,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-            0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x75,0x2c,0x20,
-            0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+            0x64,0x65,0x20,0x22,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+            0x73,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,
+            0x75,0x64,0x65,0x20,0x22,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x73,
+            0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,0x6f,0x75,0x74,0x20,0x76,
+            0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,
+            0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
             0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
-            0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
-            0x76,0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
-            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
-            0x76,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x69,0x6e,
-            0x76,0x65,0x72,0x73,0x65,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,
-            0x6e,0x28,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,
-            0x0a,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x2e,0x78,0x20,0x3d,0x20,
-            0x30,0x2e,0x35,0x20,0x2b,0x20,0x61,0x74,0x61,0x6e,0x28,0x64,0x69,
-            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x2c,0x20,0x64,0x69,
-            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x29,0x20,0x2f,0x20,
-            0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x50,0x49,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x75,0x76,0x2e,0x79,0x20,0x3d,0x20,0x30,0x2e,0x35,
-            0x20,0x2b,0x20,0x61,0x73,0x69,0x6e,0x28,0x64,0x69,0x72,0x65,0x63,
-            0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x29,0x20,0x2f,0x20,0x50,0x49,0x3b,
-            0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,
-            0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,
-            0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x54,0x65,0x78,0x74,
-            0x75,0x72,0x65,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+            0x65,0x63,0x33,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x20,0x20,
+            0x3d,0x20,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,0x65,0x78,0x28,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x44,0x69,
+            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x75,0x6e,0x69,
+            0x5f,0x43,0x75,0x62,0x65,0x6d,0x61,0x70,0x54,0x42,0x4e,0x20,0x2a,
+            0x20,0x76,0x65,0x63,0x33,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x2e,
+            0x78,0x2c,0x20,0x2d,0x76,0x65,0x72,0x74,0x65,0x78,0x2e,0x79,0x2c,
+            0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+            0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x20,0x20,0x3d,
+            0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x2c,
+            0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto FilterCubemapDiffuse_frag_data = std::array<unsigned char, 2127>{
+        static const auto GenerateCubemap_frag_data = std::array<unsigned char, 1716>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -1808,80 +3271,48 @@ namespace pkzo
             0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
             0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,
             0x22,0x6d,0x61,0x74,0x68,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,
-            0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x41,0x4d,0x50,0x4c,
-            0x45,0x53,0x20,0x31,0x30,0x32,0x34,0x0a,0x0a,0x69,0x6e,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,
-            0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+            0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,0x44,
+            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,0x65,
+            0x63,0x32,0x20,0x69,0x6e,0x76,0x65,0x72,0x73,0x65,0x44,0x69,0x72,
+            0x65,0x63,0x74,0x69,0x6f,0x6e,0x28,0x76,0x65,0x63,0x33,0x20,0x64,
+            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x7b,0x0a,0x20,
+            0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x70,0x68,0x65,0x72,
+            0x69,0x63,0x61,0x6c,0x20,0x3d,0x20,0x63,0x61,0x72,0x74,0x65,0x73,
+            0x69,0x61,0x6e,0x54,0x6f,0x53,0x70,0x68,0x65,0x72,0x69,0x63,0x61,
+            0x6c,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x64,
+            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x29,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x20,0x3d,0x20,
+            0x30,0x2e,0x35,0x20,0x2b,0x20,0x73,0x70,0x68,0x65,0x72,0x69,0x63,
+            0x61,0x6c,0x2e,0x78,0x20,0x2f,0x20,0x28,0x32,0x2e,0x30,0x20,0x2a,
+            0x20,0x50,0x49,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+            0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2d,0x20,
+            0x73,0x70,0x68,0x65,0x72,0x69,0x63,0x61,0x6c,0x2e,0x79,0x20,0x2f,
+            0x20,0x28,0x50,0x49,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+            0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x75,0x2c,0x20,
+            0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
             0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
-            0x65,0x63,0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,
-            0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x61,0x72,
-            0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
-            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x75,0x70,0x20,
-            0x3d,0x20,0x61,0x62,0x73,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2e,
-            0x7a,0x29,0x20,0x3c,0x20,0x30,0x2e,0x39,0x39,0x39,0x20,0x3f,0x20,
-            0x76,0x65,0x63,0x33,0x28,0x30,0x2c,0x30,0x2c,0x31,0x29,0x20,0x3a,
-            0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2c,0x30,0x2c,0x30,0x29,0x3b,
-            0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x69,0x67,
-            0x68,0x74,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
-            0x65,0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x75,0x70,0x2c,0x6e,0x6f,
-            0x72,0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
-            0x70,0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x6e,0x6f,0x72,
-            0x6d,0x61,0x6c,0x2c,0x72,0x69,0x67,0x68,0x74,0x29,0x3b,0x0a,0x0a,
-            0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x33,0x20,0x74,0x62,0x6e,0x20,
-            0x3d,0x20,0x6d,0x61,0x74,0x33,0x28,0x72,0x69,0x67,0x68,0x74,0x2c,
-            0x20,0x75,0x70,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,
-            0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x63,
-            0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,
-            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-            0x70,0x6f,0x77,0x65,0x72,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x20,
-            0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,
-            0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x53,0x41,0x4d,
-            0x50,0x4c,0x45,0x53,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,
-            0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
-            0x65,0x63,0x32,0x20,0x73,0x20,0x3d,0x20,0x68,0x61,0x6d,0x6d,0x65,
-            0x72,0x73,0x6c,0x65,0x79,0x32,0x64,0x28,0x69,0x2c,0x20,0x53,0x41,
-            0x4d,0x50,0x4c,0x45,0x53,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x20,0x3d,0x20,0x68,
-            0x65,0x6d,0x69,0x73,0x70,0x68,0x65,0x72,0x65,0x53,0x61,0x6d,0x70,
-            0x6c,0x65,0x5f,0x63,0x6f,0x73,0x28,0x73,0x2e,0x78,0x2c,0x20,0x73,
-            0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x6c,0x20,0x3d,0x20,0x74,0x62,0x6e,0x20,0x2a,0x20,0x6c,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-            0x20,0x4e,0x78,0x4c,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x6e,0x6f,
-            0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x29,0x3b,0x0a,0x0a,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x73,0x6d,
-            0x70,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,
-            0x6e,0x69,0x5f,0x43,0x75,0x62,0x65,0x4d,0x61,0x70,0x2c,0x20,0x6c,
-            0x29,0x2e,0x72,0x67,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x75,0x6d,0x20,0x3d,
-            0x20,0x64,0x6f,0x74,0x28,0x73,0x6d,0x70,0x2c,0x20,0x76,0x65,0x63,
-            0x33,0x28,0x30,0x2e,0x32,0x31,0x32,0x36,0x2c,0x20,0x30,0x2e,0x37,
-            0x31,0x35,0x32,0x2c,0x20,0x30,0x2e,0x30,0x37,0x32,0x32,0x29,0x29,
-            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-            0x61,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x20,0x3d,0x20,0x31,0x30,
-            0x2e,0x30,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x69,0x66,0x20,0x28,0x6c,0x75,0x6d,0x20,0x3e,0x20,0x6c,0x69,0x6d,
-            0x69,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-            0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
-            0x73,0x65,0x64,0x20,0x3d,0x20,0x6c,0x69,0x6d,0x69,0x74,0x20,0x2b,
-            0x20,0x6c,0x6f,0x67,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x6c,0x75,
-            0x6d,0x20,0x2d,0x20,0x6c,0x69,0x6d,0x69,0x74,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x6d,
-            0x70,0x20,0x2a,0x3d,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,
-            0x65,0x64,0x20,0x2f,0x20,0x6c,0x75,0x6d,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2b,0x3d,0x20,0x73,0x6d,
-            0x70,0x20,0x2a,0x20,0x4e,0x78,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x70,0x6f,0x77,0x65,0x72,0x20,0x2b,0x3d,0x20,
-            0x4e,0x78,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,
-            0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,
-            0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,
-            0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x70,0x6f,0x77,0x65,0x72,0x2c,
-            0x20,0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+            0x65,0x63,0x33,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
+            0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,
+            0x76,0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+            0x76,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x69,0x6e,
+            0x76,0x65,0x72,0x73,0x65,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,
+            0x6e,0x28,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x2e,0x78,0x20,0x3d,0x20,
+            0x30,0x2e,0x35,0x20,0x2b,0x20,0x61,0x74,0x61,0x6e,0x28,0x64,0x69,
+            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x2c,0x20,0x64,0x69,
+            0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x29,0x20,0x2f,0x20,
+            0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x50,0x49,0x29,0x3b,0x0a,0x20,
+            0x20,0x20,0x20,0x75,0x76,0x2e,0x79,0x20,0x3d,0x20,0x30,0x2e,0x35,
+            0x20,0x2b,0x20,0x61,0x73,0x69,0x6e,0x28,0x64,0x69,0x72,0x65,0x63,
+            0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x29,0x20,0x2f,0x20,0x50,0x49,0x3b,
+            0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,
+            0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,
+            0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,0x54,0x65,0x78,0x74,
+            0x75,0x72,0x65,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto FilterCubemapSpecular_frag_data = std::array<unsigned char, 2309>{
+        static const auto FilterCubemapSpecular_frag_data = std::array<unsigned char, 3013>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -1975,94 +3406,148 @@ namespace pkzo
             0x65,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x73,0x2e,0x67,0x6c,
             0x73,0x6c,0x22,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,
             0x22,0x6d,0x61,0x74,0x68,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x0a,
-            0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x41,0x4d,0x50,0x4c,
-            0x45,0x53,0x20,0x31,0x30,0x32,0x34,0x0a,0x23,0x64,0x65,0x66,0x69,
-            0x6e,0x65,0x20,0x4d,0x49,0x50,0x53,0x20,0x20,0x20,0x20,0x36,0x0a,
-            0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x61,0x72,0x5f,
-            0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x0a,0x76,
-            0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
-            0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x75,0x6e,0x69,0x5f,0x4d,
-            0x69,0x70,0x4c,0x65,0x76,0x65,0x6c,0x20,0x3e,0x20,0x4d,0x49,0x50,
-            0x53,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
-            0x74,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x30,0x20,
-            0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,
-            0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-            0x74,0x75,0x72,0x6e,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-            0x6f,0x61,0x74,0x20,0x73,0x5b,0x37,0x5d,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x73,0x5b,0x30,0x5d,0x20,0x3d,0x20,0x31,0x30,0x32,0x34,0x2e,
-            0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x5b,0x31,0x5d,0x20,0x3d,
-            0x20,0x35,0x31,0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
-            0x5b,0x32,0x5d,0x20,0x3d,0x20,0x32,0x35,0x36,0x2e,0x30,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x73,0x5b,0x33,0x5d,0x20,0x3d,0x20,0x31,0x32,
-            0x38,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x5b,0x34,0x5d,
-            0x20,0x3d,0x20,0x33,0x32,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x73,0x5b,0x35,0x5d,0x20,0x3d,0x20,0x31,0x36,0x2e,0x30,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x73,0x5b,0x36,0x5d,0x20,0x3d,0x20,0x38,0x2e,
-            0x30,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
-            0x6e,0x5b,0x37,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x5b,0x30,
-            0x5d,0x20,0x3d,0x20,0x32,0x30,0x38,0x34,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x6e,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x32,0x30,0x38,0x34,0x3b,
-            0x0a,0x20,0x20,0x20,0x20,0x6e,0x5b,0x32,0x5d,0x20,0x3d,0x20,0x31,
-            0x30,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x5b,0x33,0x5d,
-            0x20,0x3d,0x20,0x31,0x30,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x6e,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x35,0x31,0x32,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x6e,0x5b,0x35,0x5d,0x20,0x3d,0x20,0x35,0x31,0x32,
-            0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x5b,0x36,0x5d,0x20,0x3d,0x20,
-            0x35,0x31,0x32,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-            0x33,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x6e,0x6f,
-            0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x61,0x72,0x5f,0x44,
-            0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x0a,0x20,
-            0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x75,0x70,0x20,0x3d,0x20,
-            0x76,0x65,0x63,0x33,0x28,0x30,0x2c,0x30,0x2c,0x31,0x29,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x72,0x69,0x67,0x68,
-            0x74,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
-            0x28,0x63,0x72,0x6f,0x73,0x73,0x28,0x75,0x70,0x2c,0x6e,0x6f,0x72,
-            0x6d,0x61,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x70,
-            0x20,0x3d,0x20,0x63,0x72,0x6f,0x73,0x73,0x28,0x6e,0x6f,0x72,0x6d,
-            0x61,0x6c,0x2c,0x72,0x69,0x67,0x68,0x74,0x29,0x3b,0x0a,0x0a,0x20,
-            0x20,0x20,0x20,0x6d,0x61,0x74,0x33,0x20,0x74,0x62,0x6e,0x20,0x3d,
-            0x20,0x6d,0x61,0x74,0x33,0x28,0x72,0x69,0x67,0x68,0x74,0x2c,0x20,
-            0x75,0x70,0x2c,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x29,0x3b,0x0a,
+            0x2f,0x2f,0x20,0x47,0x47,0x58,0x20,0x70,0x72,0x65,0x66,0x69,0x6c,
+            0x74,0x65,0x72,0x20,0x77,0x69,0x74,0x68,0x20,0x66,0x69,0x6c,0x74,
+            0x65,0x72,0x65,0x64,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,
+            0x63,0x65,0x20,0x73,0x61,0x6d,0x70,0x6c,0x69,0x6e,0x67,0x3a,0x20,
+            0x65,0x61,0x63,0x68,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,0x72,
+            0x65,0x61,0x64,0x73,0x20,0x74,0x68,0x65,0x0a,0x2f,0x2f,0x20,0x6d,
+            0x69,0x70,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x73,0x6f,0x75,
+            0x72,0x63,0x65,0x20,0x77,0x68,0x6f,0x73,0x65,0x20,0x74,0x65,0x78,
+            0x65,0x6c,0x73,0x20,0x63,0x6f,0x76,0x65,0x72,0x20,0x74,0x68,0x65,
+            0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x61,0x6e,0x67,0x6c,0x65,0x20,
+            0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+            0x2c,0x20,0x73,0x6f,0x0a,0x2f,0x2f,0x20,0x66,0x65,0x77,0x20,0x73,
+            0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x67,0x69,0x76,0x65,0x20,0x61,
+            0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x20,0x72,0x65,0x73,0x75,0x6c,
+            0x74,0x2e,0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+            0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3b,
+            0x0a,0x0a,0x2f,0x2f,0x20,0x72,0x6f,0x75,0x67,0x68,0x20,0x6c,0x65,
+            0x76,0x65,0x6c,0x73,0x20,0x61,0x72,0x65,0x20,0x73,0x6d,0x61,0x6c,
+            0x6c,0x20,0x61,0x6e,0x64,0x20,0x62,0x6c,0x75,0x72,0x72,0x79,0x2c,
+            0x20,0x74,0x68,0x65,0x79,0x20,0x6e,0x65,0x65,0x64,0x20,0x66,0x65,
+            0x77,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x0a,0x75,0x69,0x6e,
+            0x74,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x53,0x61,0x6d,
+            0x70,0x6c,0x65,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
+            0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+            0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,
+            0x28,0x6d,0x69,0x78,0x28,0x31,0x36,0x2e,0x30,0x2c,0x20,0x36,0x34,
+            0x2e,0x30,0x2c,0x20,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+            0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+            0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,
+            0x66,0x20,0x28,0x75,0x6e,0x69,0x5f,0x4d,0x69,0x70,0x4c,0x65,0x76,
+            0x65,0x6c,0x20,0x3e,0x3d,0x20,0x53,0x50,0x45,0x43,0x55,0x4c,0x41,
+            0x52,0x5f,0x4d,0x49,0x50,0x5f,0x4c,0x45,0x56,0x45,0x4c,0x53,0x29,
+            0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,
+            0x20,0x20,0x7d,0x0a,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+            0x20,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x20,0x20,0x20,0x3d,
+            0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x61,
+            0x72,0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,
+            0x75,0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x3d,0x20,0x73,0x70,0x65,
+            0x63,0x75,0x6c,0x61,0x72,0x4d,0x69,0x70,0x52,0x6f,0x75,0x67,0x68,
+            0x6e,0x65,0x73,0x73,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x75,0x6e,
+            0x69,0x5f,0x4d,0x69,0x70,0x4c,0x65,0x76,0x65,0x6c,0x29,0x29,0x3b,
+            0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x6f,0x75,0x67,
+            0x68,0x6e,0x65,0x73,0x73,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,
+            0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+            0x6f,0x72,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x74,0x65,
+            0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x6e,0x69,0x5f,
+            0x43,0x75,0x62,0x65,0x4d,0x61,0x70,0x2c,0x20,0x6e,0x6f,0x72,0x6d,
+            0x61,0x6c,0x2c,0x20,0x30,0x29,0x2e,0x72,0x67,0x62,0x2c,0x20,0x31,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,
+            0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x33,0x20,0x20,0x74,0x62,0x6e,
+            0x20,0x20,0x20,0x20,0x20,0x3d,0x20,0x74,0x61,0x6e,0x67,0x65,0x6e,
+            0x74,0x46,0x72,0x61,0x6d,0x65,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x61,0x6c,0x70,0x68,0x61,0x20,0x20,0x20,0x3d,0x20,0x72,0x6f,0x75,
+            0x67,0x68,0x6e,0x65,0x73,0x73,0x20,0x2a,0x20,0x72,0x6f,0x75,0x67,
+            0x68,0x6e,0x65,0x73,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+            0x6e,0x74,0x20,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x3d,
+            0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x53,0x61,0x6d,0x70,
+            0x6c,0x65,0x73,0x28,0x72,0x6f,0x75,0x67,0x68,0x6e,0x65,0x73,0x73,
+            0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+            0x20,0x73,0x69,0x7a,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x74,
+            0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x75,0x6e,
+            0x69,0x5f,0x43,0x75,0x62,0x65,0x4d,0x61,0x70,0x2c,0x20,0x30,0x29,
+            0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+            0x74,0x20,0x74,0x65,0x78,0x65,0x6c,0x53,0x6f,0x6c,0x69,0x64,0x41,
+            0x6e,0x67,0x6c,0x65,0x20,0x3d,0x20,0x34,0x2e,0x30,0x20,0x2a,0x20,
+            0x50,0x49,0x20,0x2f,0x20,0x28,0x36,0x2e,0x30,0x20,0x2a,0x20,0x73,
+            0x69,0x7a,0x65,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,
             0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x20,0x63,0x6f,
-            0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x29,
-            0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
-            0x6f,0x77,0x65,0x72,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,0x20,0x20,
-            0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x73,0x20,0x3d,0x20,
-            0x73,0x5b,0x75,0x6e,0x69,0x5f,0x4d,0x69,0x70,0x4c,0x65,0x76,0x65,
-            0x6c,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
-            0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x3d,0x20,0x6e,0x5b,0x75,
-            0x6e,0x69,0x5f,0x4d,0x69,0x70,0x4c,0x65,0x76,0x65,0x6c,0x5d,0x3b,
-            0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,
-            0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,
-            0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x3b,0x20,0x69,0x2b,0x2b,
-            0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x20,0x3d,0x20,0x68,
-            0x61,0x6d,0x6d,0x65,0x72,0x73,0x6c,0x65,0x79,0x32,0x64,0x28,0x69,
-            0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x29,0x3b,0x0a,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,
-            0x20,0x3d,0x20,0x68,0x65,0x6d,0x69,0x73,0x70,0x68,0x65,0x72,0x65,
-            0x53,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x63,0x6f,0x73,0x28,0x73,0x2e,
-            0x78,0x2c,0x20,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x6c,0x20,0x3d,0x20,0x74,0x62,0x6e,0x20,0x2a,
-            0x20,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-            0x6c,0x6f,0x61,0x74,0x20,0x4e,0x78,0x4c,0x20,0x3d,0x20,0x70,0x6f,
-            0x77,0x28,0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,
-            0x20,0x6c,0x29,0x2c,0x20,0x66,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2b,0x3d,
-            0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x6e,0x69,0x5f,
-            0x43,0x75,0x62,0x65,0x4d,0x61,0x70,0x2c,0x20,0x6c,0x29,0x2e,0x72,
-            0x67,0x62,0x20,0x2a,0x20,0x4e,0x78,0x4c,0x3b,0x0a,0x20,0x20,0x20,
-            0x20,0x20,0x20,0x20,0x20,0x70,0x6f,0x77,0x65,0x72,0x20,0x2b,0x3d,
-            0x20,0x4e,0x78,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,
+            0x6c,0x6f,0x72,0x20,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,
+            0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x0a,
+            0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x76,0x69,
+            0x65,0x77,0x20,0x69,0x73,0x20,0x74,0x68,0x65,0x20,0x6e,0x6f,0x72,
+            0x6d,0x61,0x6c,0x2c,0x20,0x74,0x68,0x65,0x20,0x72,0x65,0x66,0x6c,
+            0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x62,0x65,0x20,0x69,
+            0x73,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,0x20,0x6f,0x6e,
+            0x20,0x69,0x74,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+            0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,
+            0x20,0x3c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x3b,0x20,0x69,
+            0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x78,0x69,0x20,
+            0x3d,0x20,0x68,0x61,0x6d,0x6d,0x65,0x72,0x73,0x6c,0x65,0x79,0x32,
+            0x64,0x28,0x69,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x68,0x20,0x20,0x3d,0x20,0x74,0x62,0x6e,0x20,0x2a,0x20,
+            0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x63,0x65,0x53,0x61,0x6d,
+            0x70,0x6c,0x65,0x5f,0x67,0x67,0x78,0x28,0x78,0x69,0x2e,0x78,0x2c,
+            0x20,0x78,0x69,0x2e,0x79,0x2c,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+            0x33,0x20,0x6c,0x20,0x20,0x3d,0x20,0x72,0x65,0x66,0x6c,0x65,0x63,
+            0x74,0x28,0x2d,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,0x29,
+            0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+            0x6f,0x61,0x74,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x3d,0x20,0x64,
+            0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x6c,0x29,
+            0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+            0x28,0x4e,0x64,0x6f,0x74,0x4c,0x20,0x3e,0x20,0x30,0x29,0x0a,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+            0x20,0x4e,0x64,0x6f,0x74,0x48,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,
+            0x64,0x6f,0x74,0x28,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x2c,0x20,0x68,
+            0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+            0x64,0x66,0x20,0x20,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x72,0x69,
+            0x62,0x75,0x74,0x69,0x6f,0x6e,0x5f,0x67,0x67,0x78,0x28,0x4e,0x64,
+            0x6f,0x74,0x48,0x2c,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x20,0x2a,
+            0x20,0x30,0x2e,0x32,0x35,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+            0x73,0x61,0x6d,0x70,0x6c,0x65,0x53,0x6f,0x6c,0x69,0x64,0x41,0x6e,
+            0x67,0x6c,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x28,
+            0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,
+            0x29,0x20,0x2a,0x20,0x70,0x64,0x66,0x20,0x2b,0x20,0x30,0x2e,0x30,
+            0x30,0x30,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6d,0x69,
+            0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x30,0x2e,0x35,0x20,0x2a,
+            0x20,0x6c,0x6f,0x67,0x32,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x53,
+            0x6f,0x6c,0x69,0x64,0x41,0x6e,0x67,0x6c,0x65,0x20,0x2f,0x20,0x74,
+            0x65,0x78,0x65,0x6c,0x53,0x6f,0x6c,0x69,0x64,0x41,0x6e,0x67,0x6c,
+            0x65,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,
+            0x29,0x3b,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x20,0x2b,0x3d,0x20,
+            0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x6e,
+            0x69,0x5f,0x43,0x75,0x62,0x65,0x4d,0x61,0x70,0x2c,0x20,0x6c,0x2c,
+            0x20,0x6d,0x69,0x70,0x29,0x2e,0x72,0x67,0x62,0x20,0x2a,0x20,0x4e,
+            0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x2b,
+            0x3d,0x20,0x4e,0x64,0x6f,0x74,0x4c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+            0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x0a,
             0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5f,0x46,0x72,0x61,0x67,0x43,
             0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
-            0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x70,0x6f,0x77,0x65,0x72,
-            0x2c,0x20,0x31,0x29,0x3b,0x0a,0x7d,0x00
+            0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x77,
+            0x65,0x69,0x67,0x68,0x74,0x2c,0x20,0x30,0x2e,0x30,0x30,0x30,0x31,
+            0x29,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto Skybox_vert_data = std::array<unsigned char, 1495>{
+        static const auto Skybox_vert_data = std::array<unsigned char, 1521>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -2167,16 +3652,18 @@ namespace pkzo
             0x69,0x6f,0x6e,0x20,0x20,0x20,0x3d,0x20,0x69,0x6e,0x76,0x65,0x72,
             0x73,0x65,0x28,0x6d,0x61,0x74,0x33,0x28,0x75,0x6e,0x69,0x5f,0x56,
             0x69,0x65,0x77,0x4d,0x61,0x74,0x72,0x69,0x78,0x29,0x29,0x3b,0x0a,
-            0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,
-            0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
-            0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x76,0x65,
-            0x63,0x33,0x28,0x69,0x6e,0x76,0x5f,0x50,0x72,0x6f,0x6a,0x65,0x63,
-            0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,
-            0x76,0x65,0x63,0x34,0x28,0x61,0x74,0x72,0x5f,0x56,0x65,0x72,0x74,
-            0x65,0x78,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,
-            0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
-            0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x20,0x20,0x3d,0x20,
-            0x76,0x65,0x63,0x34,0x28,0x61,0x74,0x72,0x5f,0x56,0x65,0x72,0x74,
+            0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x65,0x72,0x74,
+            0x65,0x78,0x20,0x20,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x76,0x65,
+            0x72,0x74,0x65,0x78,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+            0x61,0x72,0x5f,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,
+            0x3d,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x52,0x6f,0x74,0x61,0x74,
+            0x69,0x6f,0x6e,0x20,0x2a,0x20,0x76,0x65,0x63,0x33,0x28,0x69,0x6e,
+            0x76,0x5f,0x50,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,
+            0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+            0x76,0x65,0x72,0x74,0x65,0x78,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,
+            0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+            0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+            0x20,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x65,0x72,0x74,
             0x65,0x78,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
         };
 
@@ -2305,7 +3792,7 @@ namespace pkzo
             0x0a,0x7d,0x0a,0x00
         };
 
-        static const auto DebugLine_vert_data = std::array<unsigned char, 1339>{
+        static const auto DebugLine_vert_data = std::array<unsigned char, 1341>{
             0x2f,0x2f,0x20,0x70,0x6b,0x7a,0x6f,0x0a,0x2f,0x2f,0x20,0x43,0x6f,
             0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x32,0x30,0x31,0x30,0x2d,
             0x32,0x30,0x32,0x36,0x20,0x53,0x65,0x61,0x6e,0x20,0x46,0x61,0x72,
@@ -2407,8 +3894,9 @@ namespace pkzo
             0x6e,0x69,0x5f,0x50,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,
             0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x75,0x6e,0x69,0x5f,
             0x56,0x69,0x65,0x77,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,
-            0x76,0x65,0x63,0x34,0x28,0x61,0x74,0x72,0x5f,0x56,0x65,0x72,0x74,
-            0x65,0x78,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x00
+            0x76,0x65,0x63,0x34,0x28,0x67,0x65,0x74,0x5f,0x76,0x65,0x72,0x74,
+            0x65,0x78,0x28,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,
+            0x0a,0x00
         };
 
         static const auto DebugLine_frag_data = std::array<unsigned char, 1232>{
@@ -2512,15 +4000,22 @@ namespace pkzo
         static const auto resource_table = std::map<std::string_view, std::string_view>{
             {"attributes.glsl", std::string_view(reinterpret_cast<const char*>(attributes_glsl_data.data()), attributes_glsl_data.size()-1)},
             {"math.glsl", std::string_view(reinterpret_cast<const char*>(math_glsl_data.data()), math_glsl_data.size()-1)},
+            {"lighting.glsl", std::string_view(reinterpret_cast<const char*>(lighting_glsl_data.data()), lighting_glsl_data.size()-1)},
             {"outputs.glsl", std::string_view(reinterpret_cast<const char*>(outputs_glsl_data.data()), outputs_glsl_data.size()-1)},
             {"uniforms.glsl", std::string_view(reinterpret_cast<const char*>(uniforms_glsl_data.data()), uniforms_glsl_data.size()-1)},
             {"Screen.vert", std::string_view(reinterpret_cast<const char*>(Screen_vert_data.data()), Screen_vert_data.size()-1)},
             {"Screen.frag", std::string_view(reinterpret_cast<const char*>(Screen_frag_data.data()), Screen_frag_data.size()-1)},
             {"Forward.vert", std::string_view(reinterpret_cast<const char*>(Forward_vert_data.data()), Forward_vert_data.size()-1)},
             {"Forward.frag", std::string_view(reinterpret_cast<const char*>(Forward_frag_data.data()), Forward_frag_data.size()-1)},
+            {"GBuffer.frag", std::string_view(reinterpret_cast<const char*>(GBuffer_frag_data.data()), GBuffer_frag_data.size()-1)},
+            {"DeferredLighting.vert", std::string_view(reinterpret_cast<const char*>(DeferredLighting_vert_data.data()), DeferredLighting_vert_data.size()-1)},
+            {"DeferredLighting.frag", std::string_view(reinterpret_cast<const char*>(DeferredLighting_frag_data.data()), DeferredLighting_frag_data.size()-1)},
+            {"Shadow.vert", std::string_view(reinterpret_cast<const char*>(Shadow_vert_data.data()), Shadow_vert_data.size()-1)},
+            {"Shadow.frag", std::string_view(reinterpret_cast<const char*>(Shadow_frag_data.data()), Shadow_frag_data.size()-1)},
+            {"ShadowCopy.vert", std::string_view(reinterpret_cast<const char*>(ShadowCopy_vert_data.data()), ShadowCopy_vert_data.size()-1)},
+            {"ShadowCopy.frag", std::string_view(reinterpret_cast<const char*>(ShadowCopy_frag_data.data()), ShadowCopy_frag_data.size()-1)},
             {"GenerateCubemap.vert", std::string_view(reinterpret_cast<const char*>(GenerateCubemap_vert_data.data()), GenerateCubemap_vert_data.size()-1)},
             {"GenerateCubemap.frag", std::string_view(reinterpret_cast<const char*>(GenerateCubemap_frag_data.data()), GenerateCubemap_frag_data.size()-1)},
-            {"FilterCubemapDiffuse.frag", std::string_view(reinterpret_cast<const char*>(FilterCubemapDiffuse_frag_data.data()), FilterCubemapDiffuse_frag_data.size()-1)},
             {"FilterCubemapSpecular.frag", std::string_view(reinterpret_cast<const char*>(FilterCubemapSpecular_frag_data.data()), FilterCubemapSpecular_frag_data.size()-1)},
             {"Skybox.vert", std::string_view(reinterpret_cast<const char*>(Skybox_vert_data.data()), Skybox_vert_data.size()-1)},
             {"Skybox.frag", std::string_view(reinterpret_cast<const char*>(Skybox_frag_data.data()), Skybox_frag_data.size()-1)},
@@ -29,6 +29,10 @@
 #define SPOT_LIGHT 4
 
 #define MAX_LIGHT_PROBES 1
+#define IRRADIANCE_COEFFICIENTS 9
+#define SPECULAR_MIP_LEVELS 7
+#define SHADOW_CASCADES 4
+#define MAX_SHADOW_VIEWS 8
 
 #define XPOS 0
 #define XNEG 1
@@ -50,26 +54,67 @@ struct LightProbe
 {
     int enabled;
     samplerCube environment;
-    samplerCube diffuse;
     samplerCube specular;
 };
 
+struct LightData
+{
+    vec4 position;
+    vec4 direction;
+    vec4 color;
+    vec4 angles;
+};
+
 layout(location = 0) uniform mat4 uni_ProjectionMatrix;
 layout(location = 1) uniform mat4 uni_ViewMatrix;
 layout(location = 2) uniform mat4 uni_ModelMatrix;
 layout(location = 3) uniform vec4 uni_BaseColorFactor;
 layout(location = 4) uniform sampler2D uni_BaseColorMap;
-layout(location = 5) uniform float uni_MetallicFactor;
-layout(location = 6) uniform float uni_RoughnessFactor;
-layout(location = 7) uniform sampler2D uni_MetallicRoughnessMap;
-layout(location = 8) uniform sampler2D uni_NormalMap;
-layout(location = 9) uniform vec3 uni_EmissiveFactor;
-layout(location = 10) uniform sampler2D uni_EmissiveMap;
-layout(location = 11) uniform Light uni_Light[4];
-layout(location = 31) uniform sampler2D uni_ShadowMap;
-layout(location = 32) uniform samplerCube uni_Environment;
-layout(location = 33) uniform LightProbe uni_LightProbes[1];
-layout(location = 37) uniform int uni_MipLevel;
-layout(location = 38) uniform sampler2D uni_Texture;
-layout(location = 39) uniform samplerCube uni_CubeMap;
-layout(location = 40) uniform mat3 uni_CubemapTBN;
+layout(location = 5) uniform sampler2D uni_MetallicRoughnessMap;
+layout(location = 6) uniform sampler2D uni_NormalMap;
+layout(location = 7) uniform sampler2D uni_EmissiveMap;
+layout(location = 8) uniform sampler2D uni_ShadowMap;
+layout(location = 9) uniform samplerCube uni_Environment;
+layout(location = 10) uniform LightProbe uni_LightProbes[1];
+layout(location = 13) uniform sampler2D uni_GBufferBaseColor;
+layout(location = 14) uniform sampler2D uni_GBufferNormal;
+layout(location = 15) uniform sampler2D uni_GBufferMetallicRoughness;
+layout(location = 16) uniform sampler2D uni_GBufferEmissive;
+layout(location = 17) uniform sampler2D uni_GBufferDepth;
+layout(location = 18) uniform int uni_MipLevel;
+layout(location = 19) uniform sampler2D uni_Texture;
+layout(location = 20) uniform samplerCube uni_CubeMap;
+layout(location = 21) uniform mat3 uni_CubemapTBN;
+
+layout(std140, binding = 0) uniform FrameBlock
+{
+    mat4 projection_matrix;
+    mat4 view_matrix;
+    mat4 inverse_view_projection_matrix;
+    LightData lights[4];
+    ivec3 cluster_grid;
+    vec2 cluster_tile_size;
+    vec2 cluster_depth;
+    vec4 light_probe_irradiance[9];
+    mat4 shadow_matrices[8];
+    vec4 shadow_tiles[8];
+    vec4 shadow_cascade_splits;
+} blk_Frame;
+
+layout(std140, binding = 1) uniform MaterialBlock
+{
+    vec4 base_color_factor;
+    vec3 emissive_factor;
+    float metallic_factor;
+    float roughness_factor;
+} blk_Material;
+
+layout(std140, binding = 2) uniform ObjectBlock
+{
+    mat4 model_matrix;
+    int instanced;
+} blk_Object;
+
+layout(std430, binding = 0) readonly buffer ClusterLights { LightData ssb_ClusterLights[]; };
+layout(std430, binding = 1) readonly buffer ClusterRanges { uvec2 ssb_ClusterRanges[]; };
+layout(std430, binding = 2) readonly buffer ClusterLightIndexes { uint ssb_ClusterLightIndexes[]; };